@@ -0,0 +1,69 @@
+using Vista.SDK.Internal;
+
+namespace Vista.SDK.Benchmarks.Codebooks;
+
+[MemoryDiagnoser]
+[Orderer(SummaryOrderPolicy.FastestToSlowest, MethodOrderPolicy.Declared)]
+public class CodebooksFuzzyLookup
+{
+    private const int Queries = 1000;
+
+    private (CodebookStandardValues Values, string[] All, string Query)[] _queries;
+
+    [Params(1, 2)]
+    public int MaxEdits { get; set; }
+
+    [GlobalSetup]
+    public void Setup()
+    {
+        var codebooks = VIS.Instance.GetCodebooks(VisVersion.v3_10a);
+        var standardValues = Enum.GetValues(typeof(CodebookName))
+            .Cast<CodebookName>()
+            .Select(name => codebooks[name].StandardValues)
+            .Where(values => values.Count > 0)
+            .ToArray();
+
+        // Legacy tag names: standard values of every codebook, with one random edit
+        var random = new Random(42);
+        _queries = new (CodebookStandardValues, string[], string)[Queries];
+        for (var i = 0; i < Queries; i++)
+        {
+            var values = standardValues[i % standardValues.Length];
+            var all = values.ToArray();
+            var query = all[random.Next(all.Length)];
+            var at = random.Next(query.Length);
+            query = random.Next(2) == 0 ? query.Remove(at, 1) : query.Insert(at, "x");
+            _queries[i] = (values, all, query);
+        }
+
+        // Build the indexes outside of the measurements
+        foreach (var values in standardValues)
+            values.FindClosest("");
+    }
+
+    /// <summary>Edit distance to every standard value, as done without the index.</summary>
+    [Benchmark(Baseline = true, OperationsPerInvoke = Queries)]
+    public int Scan()
+    {
+        var count = 0;
+        foreach (var (_, all, query) in _queries)
+        {
+            var key = query.ToLowerInvariant();
+            foreach (var value in all)
+            {
+                if (BkTree.Distance(key, value.ToLowerInvariant()) <= MaxEdits)
+                    count++;
+            }
+        }
+        return count;
+    }
+
+    [Benchmark(OperationsPerInvoke = Queries)]
+    public int FindClosest()
+    {
+        var count = 0;
+        foreach (var (values, _, query) in _queries)
+            count += values.FindClosest(query, MaxEdits).Count;
+        return count;
+    }
+}
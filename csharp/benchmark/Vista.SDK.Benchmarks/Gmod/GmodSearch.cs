@@ -0,0 +1,42 @@
+namespace Vista.SDK.Benchmarks.Gmod;
+
+[MemoryDiagnoser]
+[Orderer(SummaryOrderPolicy.FastestToSlowest, MethodOrderPolicy.Declared)]
+public class GmodSearch
+{
+    private SDK.Gmod _gmod;
+
+    // What users type while searching: a code prefix, then the start of a word, then most of one
+    [Params("c", "pum", "lubricat")]
+    public string Query { get; set; }
+
+    [GlobalSetup]
+    public void Setup()
+    {
+        _gmod = VIS.Instance.GetGmod(VisVersion.v3_4a);
+        // Build the index outside of the measurements
+        _gmod.Search(Query);
+    }
+
+    /// <summary>Scan of every node, as done without the index.</summary>
+    [Benchmark(Baseline = true)]
+    public int Scan()
+    {
+        var count = 0;
+        foreach (var node in _gmod)
+        {
+            var metadata = node.Metadata;
+            if (
+                node.Code.StartsWith(Query, StringComparison.OrdinalIgnoreCase)
+                || metadata.Name?.Contains(Query, StringComparison.OrdinalIgnoreCase) == true
+                || metadata.CommonName?.Contains(Query, StringComparison.OrdinalIgnoreCase) == true
+                || metadata.Definition?.Contains(Query, StringComparison.OrdinalIgnoreCase) == true
+            )
+                count++;
+        }
+        return count;
+    }
+
+    [Benchmark]
+    public int Search() => _gmod.Search(Query).Count;
+}
@@ -8,14 +8,32 @@ public class GmodVersioningConvertPath
 {
     private Gmod _gmod;
     private GmodPath _gmodPath;
+    private GmodNode _node;
 
     [GlobalSetup]
     public void Setup()
     {
         _gmod = VIS.Instance.GetGmod(VisVersion.v3_4a);
         _gmodPath = _gmod.ParsePath("411.1/C101.72/I101");
+        _node = VIS.Instance.GetGmod(VisVersion.v3_9a)["411.1"];
+
+        // Cold starts measure the versioning, not the Gmods
+        foreach (var visVersion in VisVersions.All)
+            VIS.Instance.GetGmod(visVersion);
     }
 
     [Benchmark]
     public GmodPath ConvertPath() => VIS.Instance.ConvertPath(VisVersion.v3_4a, _gmodPath, VisVersion.v3_5a);
+
+    /// <summary>First conversion over every version step, as paid by any conversion before steps were lazy.</summary>
+    [Benchmark]
+    public GmodNode ColdStartAllSteps() =>
+        CreateVersioning().ConvertNode(VisVersion.v3_4a, _gmod["411.1"], VisVersion.v3_10a);
+
+    /// <summary>First conversion from 3-9a to 3-10a, only that step is loaded.</summary>
+    [Benchmark]
+    public GmodNode ColdStartLastStep() => CreateVersioning().ConvertNode(VisVersion.v3_9a, _node, VisVersion.v3_10a);
+
+    private static GmodVersioning CreateVersioning() =>
+        new(v => EmbeddedResource.GetGmodVersioning(v.ToVersionString()), VIS.Instance.GetGmod);
 }
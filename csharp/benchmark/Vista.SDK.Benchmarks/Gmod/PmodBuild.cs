@@ -0,0 +1,63 @@
+using Vista.SDK;
+
+namespace Vista.SDK.Benchmarks.Gmod;
+
+[MemoryDiagnoser]
+[Orderer(SummaryOrderPolicy.FastestToSlowest, MethodOrderPolicy.Declared)]
+public class PmodBuild
+{
+    private const int PathCount = 100_000;
+
+    private List<GmodPath> _paths;
+    private Pmod _pmod;
+
+    [GlobalSetup]
+    public void Setup()
+    {
+        var gmod = VIS.Instance.GetGmod(VisVersion.v3_4a);
+
+        // Synthetic vessel: the first 100k leaf paths of the Gmod
+        _paths = new List<GmodPath>(PathCount);
+        gmod.Traverse(
+            _paths,
+            (paths, parents, node) =>
+            {
+                if (node.IsLeafNode)
+                    paths.Add(new GmodPath(parents.ToList(), node, skipVerify: true));
+                return paths.Count < PathCount ? TraversalHandlerResult.Continue : TraversalHandlerResult.Stop;
+            }
+        );
+
+        _pmod = Pmod.CreateFromPaths(VisVersion.v3_4a, _paths);
+    }
+
+    [Benchmark(Baseline = true)]
+    public Pmod Build() => Pmod.CreateFromPaths(VisVersion.v3_4a, _paths);
+
+    [Benchmark]
+    public Pmod BuildParallel() => Pmod.CreateFromPaths(VisVersion.v3_4a, _paths, parallel: true);
+
+    [Benchmark]
+    public bool FullTraversal() => _pmod.Traverse(_ => TraversalHandlerResult.Continue);
+
+    [Benchmark]
+    public int Enumerate()
+    {
+        var count = 0;
+        foreach (var node in _pmod)
+            count += node.Depth;
+        return count;
+    }
+
+    [Benchmark]
+    public int Lookup()
+    {
+        var found = 0;
+        for (int i = 0; i < _paths.Count; i += 100)
+        {
+            if (_pmod.Contains(_paths[i]))
+                found++;
+        }
+        return found;
+    }
+}
@@ -0,0 +1,395 @@
+using System.Globalization;
+using Vista.SDK.Transport;
+using Vista.SDK.Transport.Json;
+using Vista.SDK.Transport.Json.TimeSeriesData;
+using DcDomain = Vista.SDK.Transport.DataChannel;
+using TsDomain = Vista.SDK.Transport.TimeSeries;
+
+namespace Vista.SDK.Benchmarks;
+
+/// <summary>
+/// Deterministic synthetic workloads for the transport benchmarks.
+/// The same seed and sizes always produce the same DataChannelList and TimeSeriesData,
+/// built from real Gmod paths, codebook tags and ISO19848 formats.
+/// </summary>
+public sealed class SyntheticData
+{
+    public const int DefaultSeed = 19848;
+
+    private static readonly DateTimeOffset Epoch = new(2024, 1, 1, 0, 0, 0, System.TimeSpan.Zero);
+
+    // Roughly the channel mix of a real vessel: mostly analog measurements, some status and alert channels.
+    private static readonly ChannelTemplate[] Templates =
+    [
+        ChannelTemplate.Measurement("temperature", "°C", -20, 150),
+        ChannelTemplate.Measurement("pressure", "bar", 0, 40),
+        ChannelTemplate.Measurement("level", "%", 0, 100),
+        ChannelTemplate.Measurement("rotational.frequency", "rpm", 0, 1200),
+        ChannelTemplate.Measurement("electric.current", "A", 0, 500),
+        ChannelTemplate.Measurement("volume.flow.rate", "m3/h", 0, 200),
+        new(CodebookName.Quantity, "energy", "Calculated", "Integer", null),
+        new(CodebookName.State, "running", "Status", "Boolean", null),
+        new(CodebookName.State, "control.location", "Status", "String", ["Local", "Remote", "Auto"]),
+        new(CodebookName.State, "alarm", "Alert", "String", ["Normal", "Alarm"]),
+        new(CodebookName.State, "warning", "Alert", "String", ["Normal", "Warning"]),
+    ];
+
+    private static readonly string[] AlertPriorities = ["Emergency", "Alarm", "Warning", "Caution"];
+
+    private static readonly string[] Qualities = ["0", "0", "0", "0", "0", "0", "0", "1", "2"];
+
+    private readonly int _seed;
+    private readonly VisVersion _visVersion;
+
+    public SyntheticData(int seed = DefaultSeed, VisVersion visVersion = VisVersion.v3_4a)
+    {
+        _seed = seed;
+        _visVersion = visVersion;
+    }
+
+    /// <summary>Creates a DataChannelList of exactly <paramref name="channelCount"/> channels.</summary>
+    /// <remarks>
+    /// Leaf paths are sampled across the whole Gmod and get one to four channels each,
+    /// so paths share prefixes the way real configurations do.
+    /// ShortIds are short hex counters, or UUIDs like the ISO19848 samples with <paramref name="uuidShortIds"/>.
+    /// </remarks>
+    public DcDomain.DataChannelListPackage CreateDataChannelList(int channelCount, bool uuidShortIds = false)
+    {
+        if (channelCount <= 0)
+            throw new ArgumentOutOfRangeException(nameof(channelCount));
+
+        var gmod = VIS.Instance.GetGmod(_visVersion);
+        var codebooks = VIS.Instance.GetCodebooks(_visVersion);
+        var positions = codebooks[CodebookName.Position].StandardValues.ToArray();
+        var random = new Random(_seed);
+
+        var channels = new List<DcDomain.DataChannel>(channelCount);
+        var templates = new int[Templates.Length];
+        // Every pass over the Gmod samples a new set of leaves, later passes add a position tag to keep LocalIds unique
+        for (var pass = 0; channels.Count < channelCount; pass++)
+        {
+            MetadataTag? position = pass == 0 ? null : codebooks.CreateTag(CodebookName.Position, positions[pass - 1]);
+            gmod.Traverse(
+                (parents, node) =>
+                {
+                    if (!node.IsLeafNode || random.Next(16) != 0)
+                        return TraversalHandlerResult.Continue;
+
+                    var path = new GmodPath(parents.ToList(), node, skipVerify: true);
+                    var count = Math.Min(random.Next(1, 5), channelCount - channels.Count);
+                    Shuffle(random, templates);
+                    for (var i = 0; i < count; i++)
+                        channels.Add(CreateChannel(codebooks, path, position, Templates[templates[i]], channels.Count));
+
+                    return channels.Count < channelCount
+                        ? TraversalHandlerResult.Continue
+                        : TraversalHandlerResult.Stop;
+                }
+            );
+        }
+
+        if (uuidShortIds)
+        {
+            // Separate stream, so the same seed gives the same channels either way
+            var uuidRandom = new Random(_seed);
+            var bytes = new byte[16];
+            foreach (var channel in channels)
+            {
+                uuidRandom.NextBytes(bytes);
+                channel.DataChannelId.ShortId = new Guid(bytes).ToString();
+            }
+        }
+
+        return new DcDomain.DataChannelListPackage
+        {
+            Package = new DcDomain.Package
+            {
+                Header = new DcDomain.Header
+                {
+                    ShipId = ShipId.Parse("IMO1234567"),
+                    DataChannelListId = new DcDomain.ConfigurationReference
+                    {
+                        Id = $"synthetic-{_seed}-{channelCount}",
+                        Version = "1.0",
+                        TimeStamp = Epoch,
+                    },
+                    Author = "Vista.SDK.Benchmarks",
+                    DateCreated = Epoch,
+                },
+                DataChannelList = new DcDomain.DataChannelList(channels),
+            }
+        };
+    }
+
+    /// <summary>
+    /// Creates one TimeSeriesData package for <paramref name="dataChannelList"/>, with <paramref name="dataSets"/> rows
+    /// of tabular data for the non-alert channels and <paramref name="events"/> alert events.
+    /// </summary>
+    /// <remarks>
+    /// Packages are seeded by index, so any package of a stream can be recreated on its own,
+    /// and consecutive indices continue the same time line.
+    /// </remarks>
+    public TsDomain.TimeSeriesDataPackage CreateTimeSeriesData(
+        DcDomain.DataChannelListPackage dataChannelList,
+        int dataSets,
+        int events,
+        long packageIndex = 0,
+        int channelsPerTable = 500,
+        bool useShortIds = true
+    )
+    {
+        if (dataSets < 0)
+            throw new ArgumentOutOfRangeException(nameof(dataSets));
+        if (events < 0)
+            throw new ArgumentOutOfRangeException(nameof(events));
+        if (channelsPerTable <= 0)
+            throw new ArgumentOutOfRangeException(nameof(channelsPerTable));
+
+        var random = new Random(unchecked(_seed * 397 ^ (int)packageIndex ^ (int)(packageIndex >> 32)));
+        var start = Epoch.AddSeconds(packageIndex * dataSets);
+        var end = start.AddSeconds(Math.Max(dataSets, 1));
+
+        var measurements = new List<DcDomain.DataChannel>();
+        var alerts = new List<DcDomain.DataChannel>();
+        foreach (var channel in dataChannelList.DataChannelList)
+            (channel.Property.DataChannelType.Type == "Alert" ? alerts : measurements).Add(channel);
+
+        var tables = new List<TsDomain.TabularData>();
+        for (var offset = 0; dataSets > 0 && offset < measurements.Count; offset += channelsPerTable)
+        {
+            var width = Math.Min(channelsPerTable, measurements.Count - offset);
+            var ids = new List<DataChannelId>(width);
+            for (var i = 0; i < width; i++)
+                ids.Add(CreateId(measurements[offset + i], useShortIds));
+
+            var rows = new List<TsDomain.TabularDataSet>(dataSets);
+            for (var row = 0; row < dataSets; row++)
+            {
+                var values = new List<string>(width);
+                var qualities = new List<string>(width);
+                for (var i = 0; i < width; i++)
+                {
+                    var channel = offset + i;
+                    var sequence = packageIndex * dataSets + row;
+                    values.Add(CreateValue(random, measurements[channel].Property, channel, sequence));
+                    qualities.Add(CreateQuality(channel, sequence));
+                }
+                rows.Add(
+                    new TsDomain.TabularDataSet
+                    {
+                        TimeStamp = start.AddSeconds(row),
+                        Value = values,
+                        Quality = qualities,
+                    }
+                );
+            }
+            tables.Add(new TsDomain.TabularData { DataChannelIds = ids, DataSets = rows });
+        }
+
+        var eventData = new TsDomain.EventData { DataSet = new List<TsDomain.EventDataSet>(events) };
+        if (alerts.Count > 0)
+        {
+            var window = (end - start).Ticks;
+            var timeStamps = new long[events];
+            for (var i = 0; i < events; i++)
+                timeStamps[i] = (long)(random.NextDouble() * window);
+            Array.Sort(timeStamps);
+
+            foreach (var ticks in timeStamps)
+            {
+                var channel = alerts[random.Next(alerts.Count)];
+                eventData.DataSet.Add(
+                    new TsDomain.EventDataSet
+                    {
+                        TimeStamp = start.AddTicks(ticks),
+                        DataChannelId = CreateId(channel, useShortIds),
+                        Value = CreateValue(random, channel.Property, 0, 0),
+                        Quality = Qualities[random.Next(Qualities.Length)],
+                    }
+                );
+            }
+        }
+
+        return new TsDomain.TimeSeriesDataPackage
+        {
+            Package = new TsDomain.Package
+            {
+                Header = new TsDomain.Header
+                {
+                    ShipId = dataChannelList.Package.Header.ShipId,
+                    TimeSpan = new TsDomain.TimeSpan { Start = start, End = end },
+                    DateCreated = end,
+                    Author = "Vista.SDK.Benchmarks",
+                    SystemConfiguration = [TsDomain.ConfigurationReference.From(dataChannelList)],
+                },
+                TimeSeriesData =
+                [
+                    new TsDomain.TimeSeriesData
+                    {
+                        DataConfiguration = TsDomain.ConfigurationReference.From(dataChannelList),
+                        TabularData = tables,
+                        EventData = eventData.DataSet.Count > 0 ? eventData : null,
+                    }
+                ],
+            }
+        };
+    }
+
+    /// <summary>Lazily creates consecutive packages, for workloads too large to keep in memory.</summary>
+    public IEnumerable<TsDomain.TimeSeriesDataPackage> EnumerateTimeSeriesData(
+        DcDomain.DataChannelListPackage dataChannelList,
+        long packageCount,
+        int dataSets,
+        int events
+    )
+    {
+        for (long i = 0; i < packageCount; i++)
+            yield return CreateTimeSeriesData(dataChannelList, dataSets, events, i);
+    }
+
+    /// <summary>
+    /// Writes consecutive packages as newline delimited JSON until at least <paramref name="targetBytes"/> are written,
+    /// which is how multi-gigabyte inputs are produced without holding them in memory.
+    /// </summary>
+    /// <returns>The number of packages written.</returns>
+    public long WriteTimeSeriesData(
+        Stream stream,
+        DcDomain.DataChannelListPackage dataChannelList,
+        long targetBytes,
+        int dataSets,
+        int events
+    )
+    {
+        var written = 0L;
+        var packages = 0L;
+        using var buffer = new MemoryStream();
+        while (written < targetBytes)
+        {
+            buffer.SetLength(0);
+            CreateTimeSeriesData(dataChannelList, dataSets, events, packages++).ToJsonDto().Serialize(buffer);
+            buffer.WriteByte((byte)'\n');
+            buffer.Position = 0;
+            buffer.CopyTo(stream);
+            written += buffer.Length;
+        }
+        return packages;
+    }
+
+    private static DcDomain.DataChannel CreateChannel(
+        Codebooks codebooks,
+        GmodPath path,
+        MetadataTag? position,
+        ChannelTemplate template,
+        int index
+    )
+    {
+        var builder = LocalIdBuilder
+            .Create(path.VisVersion)
+            .WithPrimaryItem(path)
+            .WithMetadataTag(codebooks.CreateTag(template.Codebook, template.Tag));
+        if (position is not null)
+            builder = builder.WithMetadataTag(position.Value);
+
+        var isDecimal = template.Format == "Decimal";
+        var isAlert = template.Type == "Alert";
+        return new DcDomain.DataChannel
+        {
+            DataChannelId = new DcDomain.DataChannelId
+            {
+                LocalId = builder.Build(),
+                ShortId = index.ToString("X4", CultureInfo.InvariantCulture),
+            },
+            Property = new DcDomain.Property
+            {
+                DataChannelType = new DcDomain.DataChannelType
+                {
+                    Type = template.Type,
+                    UpdateCycle = isAlert ? null : 1,
+                    CalculationPeriod = template.Type == "Calculated" ? 60 : null,
+                },
+                Format = new DcDomain.Format
+                {
+                    Type = template.Format,
+                    Restriction = isDecimal
+                        ? new DcDomain.Restriction { FractionDigits = 2 }
+                        : template.Enumeration is null
+                            ? null
+                            : new DcDomain.Restriction { Enumeration = template.Enumeration },
+                },
+                Range = isDecimal ? new DcDomain.Range { Low = template.Low, High = template.High } : null,
+                Unit = isDecimal ? new DcDomain.Unit { UnitSymbol = template.Unit, QuantityName = template.Tag } : null,
+                AlertPriority = isAlert ? AlertPriorities[index % AlertPriorities.Length] : null,
+                Name = template.Tag,
+            }
+        };
+    }
+
+    private static DataChannelId CreateId(DcDomain.DataChannel channel, bool useShortId) =>
+        useShortId
+            ? DataChannelId.Parse(channel.DataChannelId.ShortId)
+            : DataChannelId.Parse(channel.DataChannelId.LocalId.ToString());
+
+    // Sensors are mostly good, with an occasional ten minute stretch of bad or uncertain quality
+    private static string CreateQuality(int channel, long sequence) =>
+        ((sequence / 600 + channel) % 50) switch
+        {
+            0 => "1",
+            25 => "2",
+            _ => "0",
+        };
+
+    // Values are a function of channel and time, so signals continue smoothly from one package to the next
+    private static string CreateValue(Random random, DcDomain.Property property, int channel, long sequence)
+    {
+        var restriction = property.Format.Restriction;
+        var period = 600 + channel * 37 % 3000;
+        switch (property.Format.Type)
+        {
+            case "Decimal":
+                var range = property.Range;
+                var span = range.High - range.Low;
+                var phase = 2 * Math.PI * ((double)sequence / period + channel * 0.618);
+                var value = range.Low + span * (0.5 + 0.4 * Math.Sin(phase) + 0.002 * (random.NextDouble() - 0.5));
+                return value.ToString("F2", CultureInfo.InvariantCulture);
+            case "Integer":
+                // Accumulating counter, keeps increasing over the whole stream
+                return ((sequence / 60 * 7 + channel) % int.MaxValue).ToString(CultureInfo.InvariantCulture);
+            case "Boolean":
+                return (sequence / period + channel) % 4 == 0 ? "false" : "true";
+            default:
+                var enumeration = restriction?.Enumeration;
+                if (enumeration is null)
+                    return "";
+                // Alert values are events, anything else is a slowly changing status
+                return property.DataChannelType.Type == "Alert"
+                    ? enumeration[random.Next(enumeration.Count)]
+                    : enumeration[(int)((sequence / (period * 5) + channel) % enumeration.Count)];
+        }
+    }
+
+    private static void Shuffle(Random random, int[] indices)
+    {
+        for (var i = 0; i < indices.Length; i++)
+            indices[i] = i;
+        for (var i = indices.Length - 1; i > 0; i--)
+        {
+            var j = random.Next(i + 1);
+            (indices[i], indices[j]) = (indices[j], indices[i]);
+        }
+    }
+
+    private sealed record ChannelTemplate(
+        CodebookName Codebook,
+        string Tag,
+        string Type,
+        string Format,
+        string[] Enumeration,
+        string Unit = null,
+        double Low = 0,
+        double High = 0
+    )
+    {
+        public static ChannelTemplate Measurement(string quantity, string unit, double low, double high) =>
+            new(CodebookName.Quantity, quantity, "Inst", "Decimal", null, unit, low, high);
+    }
+}
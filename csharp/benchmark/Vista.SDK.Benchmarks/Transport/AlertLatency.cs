@@ -0,0 +1,88 @@
+using System.Diagnostics;
+using BenchmarkDotNet.Engines;
+using Vista.SDK.Transport;
+using Vista.SDK.Transport.DataChannel;
+using Vista.SDK.Transport.TimeSeries;
+
+namespace Vista.SDK.Benchmarks.Transport;
+
+[MemoryDiagnoser]
+[SimpleJob(RunStrategy.Monitoring, warmupCount: 1, iterationCount: 10)]
+public class AlertLatency
+{
+    private const int ChannelCount = 1_000;
+    private const int DataSets = 600;
+    private const int Events = 100;
+
+    private DataChannelListPackage _dataChannelList;
+    private TimeSeriesData _data;
+    private long _start;
+    private long _lastAlert;
+    private readonly List<double> _latencies = new();
+
+    [GlobalSetup]
+    public void Setup()
+    {
+        // One wide table of about 600k cells, with alert events spread over its time span
+        var data = new SyntheticData();
+        _dataChannelList = data.CreateDataChannelList(ChannelCount);
+        _data = data.CreateTimeSeriesData(_dataChannelList, DataSets, Events, channelsPerTable: ChannelCount)
+            .Package
+            .TimeSeriesData[0];
+        Console.WriteLine($"// {Environment.ProcessorCount} cores");
+    }
+
+    [GlobalCleanup]
+    public void Cleanup()
+    {
+        // Latency is the time from the start of validation until the last alert of the package is delivered
+        _latencies.Sort();
+        if (_latencies.Count > 0)
+        {
+            Console.WriteLine(
+                $"// Last alert after {_latencies[_latencies.Count / 2]:F2} ms (median of {_latencies.Count})"
+            );
+        }
+        _latencies.Clear();
+    }
+
+    private ValidateResult OnValue(DateTimeOffset timeStamp, DataChannel dataChannel, Value value, string quality) =>
+        new ValidateResult.Ok();
+
+    private ValidateResult OnAlert(DateTimeOffset timeStamp, DataChannel dataChannel, Value value, string quality)
+    {
+        _lastAlert = Stopwatch.GetTimestamp();
+        return new ValidateResult.Ok();
+    }
+
+    private void Start() => _start = _lastAlert = Stopwatch.GetTimestamp();
+
+    private void Stop() => _latencies.Add((_lastAlert - _start) * 1000.0 / Stopwatch.Frequency);
+
+    [Benchmark(Baseline = true)]
+    public ValidateResult Sequential()
+    {
+        Start();
+        var result = _data.Validate(_dataChannelList, OnValue, OnAlert);
+        Stop();
+        return result;
+    }
+
+    [Benchmark]
+    public ValidateResult AlertsFirst()
+    {
+        Start();
+        var result = _data.ValidateAlertsFirst(_dataChannelList, OnAlert, OnValue, OnValue);
+        Stop();
+        return result;
+    }
+
+    [Benchmark]
+    public ValidateResult AlertsFirstParallel()
+    {
+        Start();
+        var result = _data.ValidateAlertsFirst(_dataChannelList, OnAlert, OnValue, OnValue, parallel: true);
+        Stop();
+        return result;
+    }
+}
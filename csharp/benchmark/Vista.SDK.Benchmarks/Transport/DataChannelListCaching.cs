@@ -0,0 +1,35 @@
+using System.Text;
+using BenchmarkDotNet.Engines;
+using Vista.SDK.Transport.Json;
+using Vista.SDK.Transport.Json.DataChannel;
+
+namespace Vista.SDK.Benchmarks.Transport;
+
+[MemoryDiagnoser]
+[SimpleJob(RunStrategy.Monitoring, warmupCount: 1, iterationCount: 5)]
+public class DataChannelListCaching
+{
+    private byte[] _json;
+    private DataChannelListCache _cache;
+
+    [Params(1_000, 10_000)]
+    public int ChannelCount { get; set; }
+
+    [GlobalSetup]
+    public void Setup()
+    {
+        _json = Encoding.UTF8.GetBytes(new SyntheticData().CreateDataChannelList(ChannelCount).Serialize());
+        _cache = new DataChannelListCache();
+        _cache.GetOrDeserialize(_json);
+    }
+
+    [GlobalCleanup]
+    public void Cleanup() => _cache.Dispose();
+
+    [Benchmark(Baseline = true)]
+    public int Deserialize() =>
+        Serializer.DeserializeDataChannelList(new MemoryStream(_json)).ToDomainModel().DataChannelList.Count;
+
+    [Benchmark]
+    public int CacheHit() => _cache.GetOrDeserialize(_json).DataChannelList.Count;
+}
@@ -0,0 +1,42 @@
+using Vista.SDK.Transport.DataChannel;
+
+namespace Vista.SDK.Benchmarks.Transport;
+
+[MemoryDiagnoser]
+[Orderer(SummaryOrderPolicy.FastestToSlowest, MethodOrderPolicy.Declared)]
+public class DataChannelListConversion
+{
+    private const int ChannelCount = 20_000;
+
+    private DataChannelList _dataChannelList;
+
+    [GlobalSetup]
+    public void Setup()
+    {
+        _dataChannelList = new SyntheticData().CreateDataChannelList(ChannelCount).DataChannelList;
+    }
+
+    [Benchmark(Baseline = true)]
+    public int PerChannel()
+    {
+        var converted = 0;
+        foreach (var channel in _dataChannelList)
+        {
+            try
+            {
+                if (VIS.Instance.ConvertLocalId(channel.DataChannelId.LocalId, VisVersion.v3_10a) is not null)
+                    converted++;
+            }
+            catch (Exception) { }
+        }
+        return converted;
+    }
+
+    [Benchmark]
+    public DataChannelListConversionResult Bulk() =>
+        VIS.Instance.ConvertDataChannelList(_dataChannelList, VisVersion.v3_10a, parallel: false);
+
+    [Benchmark]
+    public DataChannelListConversionResult BulkParallel() =>
+        VIS.Instance.ConvertDataChannelList(_dataChannelList, VisVersion.v3_10a);
+}
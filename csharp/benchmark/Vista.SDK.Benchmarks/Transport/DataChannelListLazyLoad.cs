@@ -0,0 +1,56 @@
+using BenchmarkDotNet.Engines;
+using DataChannelList = Vista.SDK.Transport.DataChannel.DataChannelList;
+using Vista.SDK.Transport.Json;
+using Vista.SDK.Transport.Json.DataChannel;
+
+namespace Vista.SDK.Benchmarks.Transport;
+
+[MemoryDiagnoser]
+[SimpleJob(RunStrategy.Monitoring, warmupCount: 1, iterationCount: 5)]
+public class DataChannelListLazyLoad
+{
+    private const int Lookups = 10;
+
+    private string _json;
+    private string[] _shortIds;
+
+    [Params(1_000, 10_000)]
+    public int ChannelCount { get; set; }
+
+    [GlobalSetup]
+    public void Setup()
+    {
+        var dataChannelList = new SyntheticData().CreateDataChannelList(ChannelCount);
+        _json = dataChannelList.Serialize();
+        _shortIds = dataChannelList
+            .DataChannelList
+            .Where((_, i) => i % (ChannelCount / Lookups) == 0)
+            .Select(c => c.DataChannelId.ShortId)
+            .ToArray();
+    }
+
+    private int Lookup(DataChannelList list)
+    {
+        var found = 0;
+        foreach (var shortId in _shortIds)
+        {
+            if (list.TryGetByShortId(shortId, out _))
+                found++;
+        }
+        return found;
+    }
+
+    [Benchmark(Baseline = true)]
+    public int Eager() => Lookup(Serializer.DeserializeDataChannelList(_json).ToDomainModel().DataChannelList);
+
+    [Benchmark]
+    public int Lazy() => Lookup(Serializer.DeserializeDataChannelListLazy(_json).DataChannelList);
+
+    [Benchmark]
+    public int LazyValidateAll()
+    {
+        var list = Serializer.DeserializeDataChannelListLazy(_json).DataChannelList;
+        list.ValidateAll(parallel: true);
+        return Lookup(list);
+    }
+}
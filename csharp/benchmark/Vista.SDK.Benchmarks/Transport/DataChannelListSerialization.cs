@@ -35,6 +35,9 @@ public class DataChannelListSerialization
     private MemoryStream _compressionStream;
 
     private DataChannelListJsonPackage _jsonPackage;
+    private DataChannelListJsonPackage _largeJsonPackage;
+
+    private const int LargeChannelCount = 30_000;
 
     // private DataChannelListAvroPackage _avroPackage;
     // private BinaryEncoder _avroEncoder;
@@ -118,6 +121,12 @@ public void Setup()
         // Avro();
         // _payloadSizes[nameof(Avro)] = _memoryStream.Length;
 
+        _largeJsonPackage = new SyntheticData().CreateDataChannelList(LargeChannelCount).ToJsonDto();
+        _memoryStream.SetLength(0);
+        _largeJsonPackage.Serialize(_memoryStream);
+        _payloadSizes[nameof(ToDomainModel)] = _memoryStream.Length;
+        _payloadSizes[nameof(ToDomainModel_Parallel)] = _memoryStream.Length;
+
         Json_Brotli();
         _payloadSizes[nameof(Json_Brotli)] = _compressionStream.Length;
 
@@ -175,6 +184,15 @@ public void Json_Brotli()
         _brotliStream.Flush();
     }
 
+    [Benchmark(Description = "Json", Baseline = true)]
+    [BenchmarkCategory("ToDomainModel")]
+    public SDK.Transport.DataChannel.DataChannelListPackage ToDomainModel() => _largeJsonPackage.ToDomainModel();
+
+    [Benchmark(Description = "Json parallel")]
+    [BenchmarkCategory("ToDomainModel")]
+    public SDK.Transport.DataChannel.DataChannelListPackage ToDomainModel_Parallel() =>
+        _largeJsonPackage.ToDomainModel(parallel: true);
+
     // [Benchmark(Description = "Avro")]
     // [BenchmarkCategory("Uncompressed")]
     // public void Avro()
@@ -0,0 +1,61 @@
+using System.IO.Compression;
+using System.Text;
+using Vista.SDK.Transport.Compression;
+using Vista.SDK.Transport.Json;
+
+namespace Vista.SDK.Benchmarks.Transport;
+
+[MemoryDiagnoser]
+[GroupBenchmarksBy(BenchmarkLogicalGroupRule.ByCategory), CategoriesColumn]
+public class PackageCompression
+{
+    private byte[] _json;
+    private byte[] _gzip;
+    private byte[] _dictionary;
+
+    [Params("DataChannelList", "TimeSeriesData")]
+    public string Sample { get; set; }
+
+    [GlobalSetup]
+    public void Setup()
+    {
+        // Samples as they go on the wire, without indentation
+        var text = File.ReadAllText($"schemas/json/{Sample}.sample.json");
+        _json = Encoding.UTF8.GetBytes(
+            Sample == "DataChannelList"
+                ? Serializer.DeserializeDataChannelList(text)!.Serialize()
+                : Serializer.DeserializeTimeSeriesData(text)!.Serialize()
+        );
+
+        _gzip = Gzip_Compress();
+        _dictionary = Dictionary_Compress();
+        Console.WriteLine(
+            $"// {_json.Length} bytes: gzip {_gzip.Length} bytes, dictionary {_dictionary.Length} bytes "
+                + $"({_gzip.Length / (double)_dictionary.Length:F2}x smaller than gzip)"
+        );
+    }
+
+    [Benchmark(Baseline = true), BenchmarkCategory("Compress")]
+    public byte[] Gzip_Compress()
+    {
+        var output = new MemoryStream();
+        using (var gzip = new GZipStream(output, CompressionLevel.Optimal, leaveOpen: true))
+            gzip.Write(_json, 0, _json.Length);
+        return output.ToArray();
+    }
+
+    [Benchmark, BenchmarkCategory("Compress")]
+    public byte[] Dictionary_Compress() => DictionaryCompression.Compress(_json, VisVersion.v3_4a);
+
+    [Benchmark(Baseline = true), BenchmarkCategory("Decompress")]
+    public byte[] Gzip_Decompress()
+    {
+        var output = new MemoryStream();
+        using (var gzip = new GZipStream(new MemoryStream(_gzip), CompressionMode.Decompress))
+            gzip.CopyTo(output);
+        return output.ToArray();
+    }
+
+    [Benchmark, BenchmarkCategory("Decompress")]
+    public byte[] Dictionary_Decompress() => DictionaryCompression.Decompress(_dictionary);
+}
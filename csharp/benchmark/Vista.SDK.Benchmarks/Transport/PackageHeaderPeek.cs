@@ -0,0 +1,46 @@
+using System.Text;
+using System.Text.Json;
+using System.Text.Json.Nodes;
+using Vista.SDK.Transport.Json;
+using Vista.SDK.Transport.Json.TimeSeriesData;
+
+namespace Vista.SDK.Benchmarks.Transport;
+
+[MemoryDiagnoser]
+public class PackageHeaderPeek
+{
+    private byte[] _json;
+
+    [Params(false, true)]
+    public bool HeaderLast { get; set; }
+
+    [GlobalSetup]
+    public void Setup()
+    {
+        var data = new SyntheticData();
+        var dataChannelList = data.CreateDataChannelList(1_000);
+        var package = data.CreateTimeSeriesData(dataChannelList, dataSets: 60, events: 1_000, channelsPerTable: 100);
+        _json = JsonSerializer.SerializeToUtf8Bytes(package.ToJsonDto(), Serializer.Options);
+
+        if (HeaderLast)
+        {
+            var node = JsonNode.Parse(_json)!;
+            var packageNode = node["Package"]!.AsObject();
+            var header = packageNode["Header"];
+            packageNode.Remove("Header");
+            packageNode.Add("Header", header);
+            _json = Encoding.UTF8.GetBytes(node.ToJsonString());
+        }
+        Console.WriteLine($"// {_json.Length} bytes");
+    }
+
+    [Benchmark(Baseline = true)]
+    public string Deserialize() =>
+        JsonSerializer.Deserialize<TimeSeriesDataPackage>(_json, Serializer.Options)!.Package.Header!.ShipID;
+
+    [Benchmark]
+    public string Peek() => Serializer.PeekTimeSeriesDataHeader(_json)!.ShipId;
+
+    [Benchmark]
+    public string PeekStream() => Serializer.PeekTimeSeriesDataHeader(new MemoryStream(_json, writable: false))!.ShipId;
+}
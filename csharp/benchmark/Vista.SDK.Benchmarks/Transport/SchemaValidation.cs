@@ -0,0 +1,44 @@
+using System.Text.Json;
+using Vista.SDK.Transport.Json;
+using Vista.SDK.Transport.Json.DataChannel;
+using Vista.SDK.Transport.Json.TimeSeriesData;
+
+namespace Vista.SDK.Benchmarks.Transport;
+
+[MemoryDiagnoser]
+[GroupBenchmarksBy(BenchmarkLogicalGroupRule.ByCategory), CategoriesColumn]
+public class SchemaValidation
+{
+    private byte[] _dataChannelList;
+    private byte[] _timeSeriesData;
+
+    [GlobalSetup]
+    public void Setup()
+    {
+        var data = new SyntheticData();
+        var dataChannelList = data.CreateDataChannelList(1_000);
+        var package = data.CreateTimeSeriesData(dataChannelList, dataSets: 60, events: 1_000, channelsPerTable: 100);
+        _dataChannelList = JsonSerializer.SerializeToUtf8Bytes(dataChannelList.ToJsonDto(), Serializer.Options);
+        _timeSeriesData = JsonSerializer.SerializeToUtf8Bytes(package.ToJsonDto(), Serializer.Options);
+    }
+
+    private MemoryStream DataChannelListStream => new(_dataChannelList, writable: false);
+
+    private MemoryStream TimeSeriesDataStream => new(_timeSeriesData, writable: false);
+
+    [Benchmark(Baseline = true), BenchmarkCategory("DataChannelList")]
+    public int DataChannelList() =>
+        Serializer.DeserializeDataChannelList(DataChannelListStream).Package.Header.ShipID.Length;
+
+    [Benchmark, BenchmarkCategory("DataChannelList")]
+    public int DataChannelListValidated() =>
+        Serializer.DeserializeDataChannelList(DataChannelListStream, validateSchema: true).Package.Header.ShipID.Length;
+
+    [Benchmark(Baseline = true), BenchmarkCategory("TimeSeriesData")]
+    public int TimeSeriesData() =>
+        Serializer.DeserializeTimeSeriesData(TimeSeriesDataStream).Package.TimeSeriesData.Count;
+
+    [Benchmark, BenchmarkCategory("TimeSeriesData")]
+    public int TimeSeriesDataValidated() =>
+        Serializer.DeserializeTimeSeriesData(TimeSeriesDataStream, validateSchema: true).Package.TimeSeriesData.Count;
+}
@@ -0,0 +1,83 @@
+using Vista.SDK.Transport.DataChannel;
+using Vista.SDK.Transport.TimeSeries;
+using TsDataChannelId = Vista.SDK.Transport.DataChannelId;
+
+namespace Vista.SDK.Benchmarks.Transport;
+
+[MemoryDiagnoser]
+[Orderer(SummaryOrderPolicy.FastestToSlowest, MethodOrderPolicy.Declared)]
+public class ShortIdLookup
+{
+    private const int ChannelCount = 20_000;
+    private const int EventCount = 100_000;
+
+    private DataChannelListPackage _dataChannelList;
+    private TimeSeriesData _timeSeriesData;
+    private Dictionary<string, DataChannel> _stringMap;
+    private TsDataChannelId[] _ids;
+
+    [GlobalSetup]
+    public void Setup()
+    {
+        // Event heavy package against a list with UUID ShortIds, like the ISO19848 samples
+        var data = new SyntheticData();
+        _dataChannelList = data.CreateDataChannelList(ChannelCount, uuidShortIds: true);
+        _timeSeriesData = data.CreateTimeSeriesData(
+            _dataChannelList,
+            dataSets: 1,
+            events: EventCount,
+            channelsPerTable: ChannelCount
+        )
+            .Package
+            .TimeSeriesData[0];
+
+        _ids = _timeSeriesData.EventData!.DataSet!.Select(e => e.DataChannelId).ToArray();
+        _stringMap = _dataChannelList.DataChannelList.ToDictionary(c => c.DataChannelId.ShortId!);
+    }
+
+    [Benchmark(Baseline = true)]
+    public int StringDictionary()
+    {
+        var found = 0;
+        foreach (var id in _ids)
+        {
+            if (_stringMap.TryGetValue(id.ShortId!, out _))
+                found++;
+        }
+        return found;
+    }
+
+    [Benchmark]
+    public int ByShortIdString()
+    {
+        var found = 0;
+        var list = _dataChannelList.DataChannelList;
+        foreach (var id in _ids)
+        {
+            if (list.TryGetByShortId(id.ShortId!, out _))
+                found++;
+        }
+        return found;
+    }
+
+    [Benchmark]
+    public int ByShortIdKey()
+    {
+        var found = 0;
+        var list = _dataChannelList.DataChannelList;
+        foreach (var id in _ids)
+        {
+            if (list.TryGetByShortId(id, out _))
+                found++;
+        }
+        return found;
+    }
+
+    [Benchmark]
+    public ValidateResult Validate() =>
+        _timeSeriesData.Validate(
+            _dataChannelList,
+            (_, _, _, _) => new ValidateResult.Ok(),
+            (_, _, _, _) => new ValidateResult.Ok()
+        );
+}
@@ -0,0 +1,106 @@
+using System.IO.Compression;
+using System.Text.Json;
+using BenchmarkDotNet.Engines;
+using Vista.SDK.Transport;
+using Vista.SDK.Transport.Archive;
+using Vista.SDK.Transport.DataChannel;
+using Vista.SDK.Transport.Json;
+using Vista.SDK.Transport.Json.TimeSeriesData;
+
+namespace Vista.SDK.Benchmarks.Transport;
+
+[MemoryDiagnoser]
+[SimpleJob(RunStrategy.Monitoring, warmupCount: 1, iterationCount: 5)]
+public class TimeSeriesArchive
+{
+    private const int ChannelCount = 1_000;
+    private const int DataSets = 450;
+    private const int Packages = 8;
+    private const int QueryChannels = 10;
+
+    private DataChannelListPackage _dataChannelList;
+    private List<byte[]> _gzipped;
+    private string _directory;
+    private TimeSeriesArchiveReader _reader;
+    private HashSet<LocalId> _channels;
+    private DateTimeOffset _from;
+    private DateTimeOffset _to;
+
+    [GlobalSetup]
+    public void Setup()
+    {
+        // An hour of 1000 channels every second, in 8 packages, queried for 10 channels over 15 minutes
+        var data = new SyntheticData();
+        _dataChannelList = data.CreateDataChannelList(ChannelCount);
+        _directory = Path.Combine(Path.GetTempPath(), "vista-archive-benchmark-" + Guid.NewGuid());
+        _gzipped = new List<byte[]>();
+        long archived = 0;
+        using (var writer = new TimeSeriesArchiveWriter(_directory))
+        {
+            for (var i = 0; i < Packages; i++)
+            {
+                var package = data.CreateTimeSeriesData(_dataChannelList, DataSets, events: 0, packageIndex: i);
+                var output = new MemoryStream();
+                using (var gzip = new GZipStream(output, CompressionLevel.Optimal, leaveOpen: true))
+                    JsonSerializer.Serialize(gzip, package.ToJsonDto(), Serializer.Options);
+                _gzipped.Add(output.ToArray());
+                if (writer.Append(package, _dataChannelList) is ValidateResult.Invalid invalid)
+                    throw new InvalidOperationException(string.Join(", ", invalid.Messages));
+            }
+        }
+        foreach (var file in Directory.EnumerateFiles(_directory))
+            archived += new FileInfo(file).Length;
+
+        // The start of SyntheticData's time line
+        var start = new DateTimeOffset(2024, 1, 1, 0, 0, 0, System.TimeSpan.Zero);
+        _from = start.AddMinutes(30);
+        _to = start.AddMinutes(45);
+        _channels = _dataChannelList.DataChannelList
+            .Select(c => c.DataChannelId.LocalId)
+            .Where((_, i) => i % (ChannelCount / QueryChannels) == 0)
+            .ToHashSet();
+        _reader = TimeSeriesArchiveReader.Open(_directory);
+        Console.WriteLine($"// {_gzipped.Sum(p => (long)p.Length)} gzip bytes, {archived} archive bytes");
+    }
+
+    [GlobalCleanup]
+    public void Cleanup()
+    {
+        _reader.Dispose();
+        Directory.Delete(_directory, recursive: true);
+    }
+
+    [Benchmark(Baseline = true)]
+    public long GzipJson()
+    {
+        long values = 0;
+        foreach (var payload in _gzipped)
+        {
+            using var gzip = new GZipStream(new MemoryStream(payload, writable: false), CompressionMode.Decompress);
+            var package = Serializer.DeserializeTimeSeriesData(gzip)!.ToDomainModel();
+            foreach (var data in package.Package.TimeSeriesData)
+            {
+                data.Validate(
+                    _dataChannelList,
+                    (timeStamp, channel, _, _) =>
+                    {
+                        if (timeStamp >= _from && timeStamp < _to && _channels.Contains(channel.DataChannelId.LocalId))
+                            values++;
+                        return new ValidateResult.Ok();
+                    },
+                    (_, _, _, _) => new ValidateResult.Ok()
+                );
+            }
+        }
+        return values;
+    }
+
+    [Benchmark]
+    public long Archive() => _reader.Scan(_channels, _from, _to).LongCount();
+
+    [Benchmark]
+    public long ArchiveAllChannels() =>
+        _reader
+            .Scan(_dataChannelList.DataChannelList.Select(c => c.DataChannelId.LocalId), _from, _to)
+            .LongCount();
+}
@@ -0,0 +1,33 @@
+using System.Text.Json;
+using Vista.SDK.Transport.Json;
+using Vista.SDK.Transport.Json.TimeSeriesData;
+using TimeSeriesDataPackage = Vista.SDK.Transport.TimeSeries.TimeSeriesDataPackage;
+
+namespace Vista.SDK.Benchmarks.Transport;
+
+[MemoryDiagnoser]
+public class TimeSeriesDataSplit
+{
+    private TimeSeriesDataPackage _package;
+
+    [Params(16 * 1024, 256 * 1024)]
+    public int MaxBytes { get; set; }
+
+    [GlobalSetup]
+    public void Setup()
+    {
+        var data = new SyntheticData();
+        var dataChannelList = data.CreateDataChannelList(1_000);
+        _package = data.CreateTimeSeriesData(dataChannelList, dataSets: 60, events: 1_000, channelsPerTable: 100);
+
+        var size = Serialize();
+        var chunks = SerializeChunked();
+        Console.WriteLine($"// {size} bytes, {chunks} chunks of at most {MaxBytes} bytes");
+    }
+
+    [Benchmark(Baseline = true)]
+    public int Serialize() => JsonSerializer.SerializeToUtf8Bytes(_package.ToJsonDto(), Serializer.Options).Length;
+
+    [Benchmark]
+    public int SerializeChunked() => _package.SerializeChunked(MaxBytes).Count();
+}
@@ -0,0 +1,54 @@
+using Vista.SDK.Transport.DataChannel;
+using Vista.SDK.Transport.TimeSeries;
+
+namespace Vista.SDK.Benchmarks.Transport;
+
+[MemoryDiagnoser]
+public class TimeSeriesDeadband
+{
+    private const int ChannelCount = 1_000;
+    private const int PackageCount = 10;
+    private const int DataSets = 60;
+    private const int Events = 100;
+
+    private DataChannelListPackage _dataChannelList;
+    private TimeSeriesDataPackage[] _packages;
+
+    [Params(DeadbandTabularMode.Rows, DeadbandTabularMode.Events)]
+    public DeadbandTabularMode Mode { get; set; }
+
+    [Params(0.5, 2.0)]
+    public double Percent { get; set; }
+
+    [GlobalSetup]
+    public void Setup()
+    {
+        // Ten minutes of 1 Hz data, narrow tables so the row mode has something to drop
+        var data = new SyntheticData();
+        _dataChannelList = data.CreateDataChannelList(ChannelCount);
+        _packages = Enumerable
+            .Range(0, PackageCount)
+            .Select(i => data.CreateTimeSeriesData(_dataChannelList, DataSets, Events, i, channelsPerTable: 20))
+            .ToArray();
+
+        var filter = CreateFilter();
+        foreach (var package in _packages)
+            filter.Filter(package);
+        Console.WriteLine(
+            $"// Deadband {Percent} % {Mode}: {filter.SentValues} of {filter.ReceivedValues} values sent, "
+                + $"reduction ratio {(double)filter.ReceivedValues / Math.Max(1, filter.SentValues):F2}"
+        );
+    }
+
+    [Benchmark(OperationsPerInvoke = PackageCount)]
+    public long Filter()
+    {
+        var filter = CreateFilter();
+        foreach (var package in _packages)
+            filter.Filter(package);
+        return filter.SentValues;
+    }
+
+    private DeadbandFilter CreateFilter() =>
+        new(_dataChannelList.Package.DataChannelList, _ => Deadband.Percent(Percent), Mode);
+}
@@ -0,0 +1,69 @@
+using BenchmarkDotNet.Engines;
+using Vista.SDK.Transport.DataChannel;
+using Vista.SDK.Transport.TimeSeries;
+
+namespace Vista.SDK.Benchmarks.Transport;
+
+[MemoryDiagnoser]
+[SimpleJob(RunStrategy.Monitoring, warmupCount: 1, iterationCount: 5)]
+public class TimeSeriesMerge
+{
+    private const int InputCount = 16;
+    private const int ChannelCount = 1_000;
+    private const int PackageCount = 24;
+    private const int DataSets = 60;
+
+    private DataChannelListPackage _dataChannelList;
+    private TimeSeriesDataPackage[][] _inputs;
+
+    [GlobalSetup]
+    public void Setup()
+    {
+        // Redundant gateways sending the same 1M+ values each, every gateway misses different packages.
+        // Inputs share the package instances, the merge doesn't care and it keeps the setup within memory.
+        var data = new SyntheticData();
+        _dataChannelList = data.CreateDataChannelList(ChannelCount);
+        var packages = Enumerable
+            .Range(0, PackageCount)
+            .Select(i => data.CreateTimeSeriesData(_dataChannelList, DataSets, 0, i, channelsPerTable: ChannelCount))
+            .ToArray();
+
+        _inputs = Enumerable
+            .Range(0, InputCount)
+            .Select(input => packages.Where((_, i) => i % InputCount != input).ToArray())
+            .ToArray();
+
+        var merger = new TimeSeriesDataMerger();
+        var merged = merger.Merge(_inputs).LongCount();
+        Console.WriteLine(
+            $"// {InputCount} inputs, {merger.ReceivedValues / InputCount} values each: {merged} merged values, "
+                + $"{merger.DuplicateValues} duplicates"
+        );
+    }
+
+    [Benchmark]
+    public long Merge()
+    {
+        var merger = new TimeSeriesDataMerger();
+        var count = 0L;
+        foreach (var _ in merger.Merge(_inputs))
+            count++;
+        return count;
+    }
+
+    [Benchmark]
+    public int MergeToPackages()
+    {
+        var merger = new TimeSeriesDataMerger();
+        var count = 0;
+        foreach (
+            var _ in merger.MergeToPackages(
+                _inputs,
+                _inputs[0][0].Package.Header!,
+                _inputs[0][0].Package.TimeSeriesData[0].DataConfiguration
+            )
+        )
+            count++;
+        return count;
+    }
+}
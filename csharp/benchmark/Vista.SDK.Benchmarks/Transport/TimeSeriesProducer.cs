@@ -0,0 +1,119 @@
+using System.Globalization;
+using Vista.SDK.Transport.DataChannel;
+using Vista.SDK.Transport.TimeSeries;
+
+namespace Vista.SDK.Benchmarks.Transport;
+
+[MemoryDiagnoser]
+[Orderer(SummaryOrderPolicy.FastestToSlowest, MethodOrderPolicy.Declared)]
+public class TimeSeriesProducer
+{
+    private const int ChannelCount = 1_000;
+    private const int Seconds = 300;
+    private const int Readings = ChannelCount * Seconds;
+
+    private static readonly double[] UpdateCycles = [1, 10, 60];
+
+    private static readonly DateTimeOffset Start = new(2024, 1, 1, 0, 0, 0, System.TimeSpan.Zero);
+
+    private DataChannelListPackage _dataChannelList;
+    private (string ShortId, DateTimeOffset TimeStamp, string Value)[] _readings;
+
+    [GlobalSetup]
+    public void Setup()
+    {
+        _dataChannelList = new SyntheticData().CreateDataChannelList(ChannelCount);
+        var channels = _dataChannelList.Package.DataChannelList.DataChannels;
+        for (var i = 0; i < channels.Count; i++)
+            channels[i].Property.DataChannelType.UpdateCycle = UpdateCycles[i % UpdateCycles.Length];
+
+        // Every channel once a second, at jittered times within the second
+        var random = new Random(42);
+        _readings = new (string, DateTimeOffset, string)[Readings];
+        for (var second = 0; second < Seconds; second++)
+        {
+            for (var i = 0; i < ChannelCount; i++)
+            {
+                _readings[second * ChannelCount + i] = (
+                    channels[i].DataChannelId.ShortId!,
+                    Start.AddSeconds(second).AddMilliseconds(random.Next(1000)),
+                    (random.NextDouble() * 100).ToString("F3", CultureInfo.InvariantCulture)
+                );
+            }
+        }
+    }
+
+    /// <summary>Reading lists per channel, grouped by update cycle and time slot on flush, as in the samples.</summary>
+    [Benchmark(Baseline = true, OperationsPerInvoke = Readings)]
+    public int Buffered()
+    {
+        var list = _dataChannelList.Package.DataChannelList;
+        var buffer = new Dictionary<string, List<(DateTimeOffset TimeStamp, string Value)>>();
+        var windowEnd = Start.AddMinutes(1);
+        var count = 0;
+        foreach (var (shortId, timeStamp, value) in _readings)
+        {
+            if (!list.TryGetByShortId(shortId, out _))
+                continue;
+            if (timeStamp >= windowEnd)
+            {
+                count += Flush(buffer);
+                windowEnd = windowEnd.AddMinutes(1);
+            }
+            if (!buffer.TryGetValue(shortId, out var readings))
+                buffer.Add(shortId, readings = []);
+            readings.Add((timeStamp, value));
+        }
+        return count + Flush(buffer);
+
+        int Flush(Dictionary<string, List<(DateTimeOffset TimeStamp, string Value)>> buffer)
+        {
+            var rows = 0;
+            var groups = buffer.GroupBy(b =>
+                list.TryGetByShortId(b.Key, out var dc) ? dc.Property.DataChannelType.UpdateCycle : null
+            );
+            foreach (var group in groups)
+            {
+                var cycle = System.TimeSpan.FromSeconds(group.Key ?? 0).Ticks;
+                var channels = group.ToArray();
+                var table = new SortedDictionary<long, string[]>();
+                for (var c = 0; c < channels.Length; c++)
+                {
+                    foreach (var (timeStamp, value) in channels[c].Value)
+                    {
+                        var slot = cycle > 0 ? timeStamp.UtcTicks - timeStamp.UtcTicks % cycle : timeStamp.UtcTicks;
+                        if (!table.TryGetValue(slot, out var row))
+                            table.Add(slot, row = new string[channels.Length]);
+                        row[c] = value;
+                    }
+                }
+                var dataSets = table
+                    .Select(r => new TabularDataSet
+                    {
+                        TimeStamp = new DateTimeOffset(r.Key, System.TimeSpan.Zero),
+                        Value = r.Value.Select(v => v ?? "").ToList(),
+                        Quality = null,
+                    })
+                    .ToList();
+                rows += dataSets.Count;
+            }
+            buffer.Clear();
+            return rows;
+        }
+    }
+
+    [Benchmark(OperationsPerInvoke = Readings)]
+    public int Producer()
+    {
+        var rows = 0;
+        var producer = new TimeSeriesDataProducer(
+            _dataChannelList,
+            package => rows += package.Package.TimeSeriesData[0].TabularData!.Sum(t => t.DataSets!.Count),
+            System.TimeSpan.FromMinutes(1)
+        );
+        foreach (var (shortId, timeStamp, value) in _readings)
+            producer.TryAdd(shortId, timeStamp, value);
+        producer.Flush();
+        return rows;
+    }
+}
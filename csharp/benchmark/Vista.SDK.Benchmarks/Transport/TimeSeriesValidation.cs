@@ -0,0 +1,61 @@
+using BenchmarkDotNet.Engines;
+using Vista.SDK.Transport;
+using Vista.SDK.Transport.DataChannel;
+using Vista.SDK.Transport.TimeSeries;
+
+namespace Vista.SDK.Benchmarks.Transport;
+
+[MemoryDiagnoser]
+[SimpleJob(RunStrategy.Monitoring, warmupCount: 1, iterationCount: 5)]
+public class TimeSeriesValidation
+{
+    private const int ChannelCount = 1_000;
+    private const int DataSets = 600;
+    private const int Events = 10_000;
+
+    private DataChannelListPackage _dataChannelList;
+    private TimeSeriesData _data;
+    private long _values;
+
+    [GlobalSetup]
+    public void Setup()
+    {
+        // 600k cells in one wide table, as received from a gateway sending every channel in one package
+        var data = new SyntheticData();
+        _dataChannelList = data.CreateDataChannelList(ChannelCount);
+        _data = data.CreateTimeSeriesData(_dataChannelList, DataSets, Events, channelsPerTable: ChannelCount)
+            .Package
+            .TimeSeriesData[0];
+        Console.WriteLine($"// {Environment.ProcessorCount} cores");
+    }
+
+    private ValidateResult OnValue(DateTimeOffset timeStamp, DataChannel dataChannel, Value value, string quality)
+    {
+        Interlocked.Increment(ref _values);
+        return new ValidateResult.Ok();
+    }
+
+    [Benchmark(Baseline = true)]
+    public long Sequential()
+    {
+        _values = 0;
+        _data.Validate(_dataChannelList, OnValue, OnValue);
+        return _values;
+    }
+
+    [Benchmark]
+    public long ParallelOrdered()
+    {
+        _values = 0;
+        _data.Validate(_dataChannelList, OnValue, OnValue, parallel: true);
+        return _values;
+    }
+
+    [Benchmark]
+    public long ParallelUnordered()
+    {
+        _values = 0;
+        _data.Validate(_dataChannelList, OnValue, OnValue, parallel: true, ordered: false);
+        return _values;
+    }
+}
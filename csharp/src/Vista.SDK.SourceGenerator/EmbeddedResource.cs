@@ -89,30 +89,21 @@ internal static GZipStream GetDecompressedStream(Assembly assembly, string resou
         return new GZipStream(stream, CompressionMode.Decompress, leaveOpen: false);
     }
 
-    internal static Dictionary<string, GmodVersioningDto>? GetGmodVersioning()
+    /// <summary>Versioning of the Gmod from the previous VIS version to <paramref name="visVersion"/>.</summary>
+    internal static GmodVersioningDto? GetGmodVersioning(string visVersion)
     {
         var assembly = Assembly.GetExecutingAssembly();
-        var baseName = assembly.GetName().Name;
-        var gmodVersioningResourceNames = assembly
-            .GetManifestResourceNames()
-            .Where(x => x.Contains("gmod-vis-versioning") && x.EndsWith(".gz"))
-            .ToList();
 
-        if (gmodVersioningResourceNames is null)
-            return null;
+        var gmodVersioningResourceName = GetResourceNames(assembly)
+            .Where(x => x.EndsWith($"gmod-vis-versioning-{visVersion}.json.gz"))
+            .SingleOrDefault();
 
-        var dtos = new Dictionary<string, GmodVersioningDto>();
+        if (gmodVersioningResourceName is null)
+            return null;
 
-        foreach (var resourceName in gmodVersioningResourceNames)
-        {
-            using var stream = GetDecompressedStream(assembly, resourceName);
-            var gmodVersioning = JsonSerializer.Deserialize<GmodVersioningDto>(stream);
-            if (gmodVersioning is null)
-                continue;
-            dtos.Add(gmodVersioning.VisVersion, gmodVersioning);
-        }
+        using var stream = GetDecompressedStream(assembly, gmodVersioningResourceName);
 
-        return dtos;
+        return JsonSerializer.Deserialize<GmodVersioningDto>(stream);
     }
 
     internal static LocationsDto? GetLocations(string visVersion)
@@ -167,4 +158,23 @@ internal static GZipStream GetDecompressedStream(Assembly assembly, string resou
 
         return JsonSerializer.Deserialize<FormatDataTypesDto>(stream);
     }
+
+    internal static byte[]? GetCompressionDictionary(string visVersion)
+    {
+        var assembly = Assembly.GetExecutingAssembly();
+
+        var dictionaryResourceName = GetResourceNames(assembly)
+            .Where(x => x.Contains("compression-dictionary") && x.EndsWith(".gz"))
+            .Where(x => x.Contains(visVersion))
+            .SingleOrDefault();
+
+        if (dictionaryResourceName is null)
+            return null;
+
+        using var stream = GetDecompressedStream(assembly, dictionaryResourceName);
+        using var buffer = new MemoryStream();
+        stream.CopyTo(buffer);
+
+        return buffer.ToArray();
+    }
 }
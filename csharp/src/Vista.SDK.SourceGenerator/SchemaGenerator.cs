@@ -0,0 +1,250 @@
+using System.Diagnostics;
+using System.Globalization;
+using System.Text;
+using System.Text.Json;
+using Microsoft.CodeAnalysis;
+using Microsoft.CodeAnalysis.Text;
+
+namespace Vista.SDK.SourceGenerator
+{
+    /// <summary>
+    /// Compiles the ISO19848 JSON schemas, passed as additional files, to node tables for the streaming validator
+    /// of Vista.SDK.System.Text.Json. References are resolved and property names encoded at build time.
+    /// </summary>
+    [Generator]
+    public sealed class SchemaGenerator : ISourceGenerator
+    {
+        private const string SchemaExtension = ".schema.json";
+
+        // Keywords without effect on validation
+        private static readonly HashSet<string> Annotations = new HashSet<string>
+        {
+            "$schema",
+            "$id",
+            "title",
+            "description",
+            "definitions",
+        };
+
+        public void Execute(GeneratorExecutionContext context)
+        {
+            if (context.Compilation.AssemblyName != "Vista.SDK.System.Text.Json")
+                return;
+
+            var schemas = context
+                .AdditionalFiles
+                .Where(f => f.Path.EndsWith(SchemaExtension, StringComparison.OrdinalIgnoreCase))
+                .OrderBy(f => f.Path, StringComparer.Ordinal)
+                .ToList();
+            if (schemas.Count == 0)
+                throw new Exception("Couldn't find any JSON schemas, expected them as additional files");
+
+            var sourceBuilder = new StringBuilder(
+                @"
+#pragma warning disable CS1591 // Missing XML comment for publicly visible type or member
+
+namespace Vista.SDK.Transport.Json
+{
+    internal static partial class PackageSchemas
+    {"
+            );
+
+            foreach (var file in schemas)
+            {
+                var fileName = Path.GetFileName(file.Path);
+                var name = fileName.Substring(0, fileName.Length - SchemaExtension.Length);
+                var text = file.GetText(context.CancellationToken);
+                if (text is null)
+                    throw new Exception("Couldn't read JSON schema " + fileName);
+
+                using var document = JsonDocument.Parse(text.ToString());
+                var nodes = new SchemaCompiler(document.RootElement, fileName).Compile();
+
+                sourceBuilder.Append(
+                    @$"
+        /// <summary>Compiled from {fileName}.</summary>
+        public static readonly CompiledSchema {name} = new CompiledSchema(
+            ""{Title(document.RootElement, name)}"",
+            new CompiledSchema.Node[]
+            {{"
+                );
+                for (var i = 0; i < nodes.Count; i++)
+                {
+                    sourceBuilder.Append(
+                        @$"
+                /* {i} {nodes[i].Pointer} */ {nodes[i].Code},"
+                    );
+                }
+                sourceBuilder.Append(
+                    @"
+            }
+        );
+"
+                );
+            }
+
+            sourceBuilder.Append(
+                @"    }
+}"
+            );
+
+            context.AddSource("PackageSchemas.g.cs", SourceText.From(sourceBuilder.ToString(), Encoding.UTF8));
+            Debug.WriteLine($"{nameof(SchemaGenerator)} generated source code");
+        }
+
+        public void Initialize(GeneratorInitializationContext context) { }
+
+        private static string Title(JsonElement schema, string name) =>
+            schema.TryGetProperty("title", out var title) ? title.GetString() ?? name : name;
+
+        private static string Literal(string value) =>
+            "\"" + value.Replace("\\", "\\\\").Replace("\"", "\\\"") + "\"";
+
+        private sealed class CompiledNode
+        {
+            public string Pointer = "";
+            public string Code = "";
+        }
+
+        private sealed class SchemaCompiler
+        {
+            private readonly JsonElement _root;
+            private readonly string _fileName;
+            private readonly List<CompiledNode> _nodes = new List<CompiledNode>();
+            private readonly Dictionary<string, int> _definitions = new Dictionary<string, int>();
+
+            public SchemaCompiler(JsonElement root, string fileName)
+            {
+                _root = root;
+                _fileName = fileName;
+            }
+
+            public List<CompiledNode> Compile()
+            {
+                Compile(_root, "#");
+                return _nodes;
+            }
+
+            // Nodes are numbered in the order they're first reached, the root is node 0
+            private int Compile(JsonElement schema, string pointer)
+            {
+                if (schema.TryGetProperty("$ref", out var reference))
+                    return Define(reference.GetString() ?? "");
+
+                var index = _nodes.Count;
+                var node = new CompiledNode { Pointer = pointer };
+                _nodes.Add(node);
+                node.Code = Code(schema, pointer);
+                return index;
+            }
+
+            private int Define(string reference)
+            {
+                const string Prefix = "#/definitions/";
+                if (_definitions.TryGetValue(reference, out var index))
+                    return index;
+                if (
+                    !reference.StartsWith(Prefix, StringComparison.Ordinal)
+                    || !_root.TryGetProperty("definitions", out var definitions)
+                    || !definitions.TryGetProperty(reference.Substring(Prefix.Length), out var definition)
+                )
+                    throw Unsupported(reference, "$ref");
+
+                // Reserved before compiling the definition, so recursive references resolve to it
+                index = _nodes.Count;
+                _definitions.Add(reference, index);
+                var node = new CompiledNode { Pointer = reference };
+                _nodes.Add(node);
+                node.Code = Code(definition, reference);
+                return index;
+            }
+
+            private string Code(JsonElement schema, string pointer)
+            {
+                foreach (var keyword in schema.EnumerateObject())
+                {
+                    switch (keyword.Name)
+                    {
+                        case "type":
+                        case "properties":
+                        case "required":
+                        case "additionalProperties":
+                        case "items":
+                        case "minimum":
+                        case "enum":
+                        case "format":
+                            break;
+                        default:
+                            if (!Annotations.Contains(keyword.Name))
+                                throw Unsupported(pointer, keyword.Name);
+                            break;
+                    }
+                }
+
+                var type = schema.TryGetProperty("type", out var t) ? t.GetString() : null;
+                switch (type)
+                {
+                    case null:
+                        return "CompiledSchema.Any()";
+                    case "object":
+                        return Object(schema, pointer);
+                    case "array":
+                        if (!schema.TryGetProperty("items", out var items))
+                            return "CompiledSchema.Array(items: -1)";
+                        return $"CompiledSchema.Array(items: {Compile(items, pointer + "/items")})";
+                    case "string":
+                        if (schema.TryGetProperty("format", out var format) && format.GetString() == "date-time")
+                            return "CompiledSchema.DateTime()";
+                        if (!schema.TryGetProperty("enum", out var values))
+                            return "CompiledSchema.String()";
+                        return "CompiledSchema.String("
+                            + string.Join(", ", values.EnumerateArray().Select(v => Literal(v.GetString() ?? "")))
+                            + ")";
+                    case "number":
+                    case "integer":
+                        var minimum = schema.TryGetProperty("minimum", out var m)
+                            ? m.GetDouble().ToString("R", CultureInfo.InvariantCulture)
+                            : "null";
+                        return $"CompiledSchema.{(type == "number" ? "Number" : "Integer")}(minimum: {minimum})";
+                    default:
+                        throw Unsupported(pointer, "type " + type);
+                }
+            }
+
+            private string Object(JsonElement schema, string pointer)
+            {
+                var required = new HashSet<string>(
+                    schema.TryGetProperty("required", out var r)
+                        ? r.EnumerateArray().Select(v => v.GetString() ?? "")
+                        : Enumerable.Empty<string>()
+                );
+                var additionalProperties =
+                    !schema.TryGetProperty("additionalProperties", out var additional)
+                    || additional.ValueKind != JsonValueKind.False;
+                if (additional.ValueKind == JsonValueKind.Object)
+                    throw Unsupported(pointer, "additionalProperties schema");
+
+                var properties = new List<string>();
+                if (schema.TryGetProperty("properties", out var p))
+                {
+                    foreach (var property in p.EnumerateObject())
+                    {
+                        var node = Compile(property.Value, pointer + "/properties/" + property.Name);
+                        var isRequired = required.Remove(property.Name) ? "true" : "false";
+                        properties.Add($"({Literal(property.Name)}, {node}, {isRequired})");
+                    }
+                }
+                if (required.Count > 0)
+                    throw Unsupported(pointer, "required property without a schema " + required.First());
+                if (properties.Count > 64)
+                    throw Unsupported(pointer, "more than 64 properties");
+
+                var code = $"CompiledSchema.Object(additionalProperties: {(additionalProperties ? "true" : "false")}";
+                return properties.Count == 0 ? code + ")" : code + ", " + string.Join(", ", properties) + ")";
+            }
+
+            private Exception Unsupported(string pointer, string keyword) =>
+                new Exception($"Unsupported JSON schema keyword '{keyword}' at {pointer} in {_fileName}");
+        }
+    }
+}
@@ -0,0 +1,74 @@
+using System.Text;
+
+namespace Vista.SDK.Transport.Json;
+
+/// <summary>The ISO19848 package schemas, compiled from schemas/json at build time by the SchemaGenerator.</summary>
+internal static partial class PackageSchemas { }
+
+/// <summary>A JSON schema compiled to a table of nodes, with references resolved. The root is node 0.</summary>
+internal sealed class CompiledSchema(string title, CompiledSchema.Node[] nodes)
+{
+    public enum NodeType : byte
+    {
+        Any,
+        Object,
+        Array,
+        String,
+        DateTime,
+        Number,
+        Integer,
+    }
+
+    public sealed record Property(string Name, byte[] Utf8Name, int Node);
+
+    public sealed record Node(NodeType Type)
+    {
+        public Property[] Properties { get; init; } = [];
+
+        /// <summary>Bit per required property, by its index in <see cref="Properties"/>.</summary>
+        public ulong Required { get; init; }
+
+        public bool AdditionalProperties { get; init; } = true;
+
+        /// <summary>Node of the items of an array, -1 for any items.</summary>
+        public int Items { get; init; } = -1;
+
+        public double? Minimum { get; init; }
+
+        public byte[][]? Enum { get; init; }
+    }
+
+    public string Title { get; } = title;
+
+    public Node[] Nodes { get; } = nodes;
+
+    public static Node Any() => new(NodeType.Any);
+
+    public static Node Object(bool additionalProperties, params (string Name, int Node, bool Required)[] properties)
+    {
+        var required = 0UL;
+        for (var i = 0; i < properties.Length; i++)
+        {
+            if (properties[i].Required)
+                required |= 1UL << i;
+        }
+
+        return new Node(NodeType.Object)
+        {
+            Properties = properties.Select(p => new Property(p.Name, Encoding.UTF8.GetBytes(p.Name), p.Node)).ToArray(),
+            Required = required,
+            AdditionalProperties = additionalProperties,
+        };
+    }
+
+    public static Node Array(int items) => new(NodeType.Array) { Items = items };
+
+    public static Node String(params string[] values) =>
+        new(NodeType.String) { Enum = values.Length == 0 ? null : values.Select(Encoding.UTF8.GetBytes).ToArray() };
+
+    public static Node DateTime() => new(NodeType.DateTime);
+
+    public static Node Number(double? minimum) => new(NodeType.Number) { Minimum = minimum };
+
+    public static Node Integer(double? minimum) => new(NodeType.Integer) { Minimum = minimum };
+}
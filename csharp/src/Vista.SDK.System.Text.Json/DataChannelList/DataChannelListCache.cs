@@ -0,0 +1,189 @@
+using System.Buffers.Binary;
+using System.Text.Json;
+using Microsoft.Extensions.Caching.Memory;
+using Domain = Vista.SDK.Transport.DataChannel;
+
+namespace Vista.SDK.Transport.Json.DataChannel;
+
+/// <summary>Counters of a <see cref="DataChannelListCache"/>.</summary>
+/// <param name="Hits">Packages returned from the cache.</param>
+/// <param name="Misses">Packages deserialized, whether they were cached afterwards or not.</param>
+/// <param name="Evictions">Packages removed from the cache to stay within its size limit. Packages that didn't fit
+/// when they were added were never cached, and are not counted.</param>
+/// <param name="Count">Packages currently cached.</param>
+/// <param name="Size">Bytes of raw JSON currently cached.</param>
+public readonly record struct DataChannelListCacheStatistics(
+    long Hits,
+    long Misses,
+    long Evictions,
+    int Count,
+    long Size
+)
+{
+    /// <summary>Share of lookups returned from the cache, 0 before the first lookup.</summary>
+    public double HitRate => Hits + Misses == 0 ? 0 : (double)Hits / (Hits + Misses);
+}
+
+/// <summary>
+/// Caches deserialized and validated DataChannelList packages by the content of their raw JSON,
+/// so a byte-identical package, such as one re-sent on every reconnect, is only parsed once.
+/// </summary>
+/// <remarks>
+/// Packages are keyed by a hash of their bytes, their length and their DataChannelListID and Version,
+/// and a hit is confirmed by comparing the bytes. The cache is bounded by the raw JSON bytes it holds:
+/// a package that doesn't fit in the remaining size isn't cached, and starts a compaction in the background
+/// that removes the least recently used packages to make room for later ones.
+/// The parsed lists take a few times the size of their JSON.
+/// Cached lists are shared and read-only, channels included, see <see cref="Domain.DataChannelList.MakeReadOnly"/>.
+/// </remarks>
+public sealed class DataChannelListCache : IDisposable
+{
+    private readonly record struct Key(ulong Hash, int Length, string? Id, string? Version);
+
+    private sealed record Entry(byte[] Content, Domain.DataChannelListPackage Package)
+    {
+        // Pending until the entry is found in the cache after adding it, MemoryCache may reject it instead
+        public int State;
+    }
+
+    private const int Pending = 0;
+    private const int Cached = 1;
+    private const int Removed = 2;
+
+    private readonly MemoryCache _cache;
+    private readonly ulong _seed;
+    private readonly long _sizeLimit;
+
+    private long _hits;
+    private long _misses;
+    private long _evictions;
+    private long _size;
+
+    /// <param name="sizeLimit">Maximum bytes of raw JSON cached, 64 MB by default.</param>
+    /// <exception cref="ArgumentOutOfRangeException">The size limit is not positive.</exception>
+    public DataChannelListCache(long sizeLimit = 64 * 1024 * 1024)
+    {
+        if (sizeLimit <= 0)
+            throw new ArgumentOutOfRangeException(nameof(sizeLimit), sizeLimit, "Expected a positive size limit");
+
+        _cache = new MemoryCache(new MemoryCacheOptions { SizeLimit = sizeLimit });
+        _sizeLimit = sizeLimit;
+        // Per cache, so colliding packages can't be crafted to pile up in one bucket
+        _seed = (ulong)Guid.NewGuid().GetHashCode() << 32 | (uint)Guid.NewGuid().GetHashCode();
+    }
+
+    public DataChannelListCacheStatistics Statistics =>
+        new(
+            Interlocked.Read(ref _hits),
+            Interlocked.Read(ref _misses),
+            Interlocked.Read(ref _evictions),
+            _cache.Count,
+            Interlocked.Read(ref _size)
+        );
+
+    /// <summary>
+    /// Returns the cached package of byte-identical JSON, or deserializes, validates and caches the package.
+    /// </summary>
+    /// <remarks>
+    /// The package and header records are copies for every call, the DataChannelList is shared and read-only.
+    /// </remarks>
+    /// <param name="packageUtf8Json">UTF-8 JSON of a DataChannelList package.</param>
+    /// <returns>The package, null for a null package.</returns>
+    /// <exception cref="JsonException">The JSON is invalid.</exception>
+    /// <exception cref="ArgumentException">A data channel is invalid.</exception>
+    public Domain.DataChannelListPackage? GetOrDeserialize(ReadOnlySpan<byte> packageUtf8Json)
+    {
+        var header = Serializer.PeekDataChannelListHeader(packageUtf8Json);
+        if (header is null)
+        {
+            Interlocked.Increment(ref _misses);
+            return Deserialize(packageUtf8Json);
+        }
+
+        var key = new Key(
+            Hash(packageUtf8Json),
+            packageUtf8Json.Length,
+            header.DataChannelListId?.ID,
+            header.DataChannelListId?.Version
+        );
+        if (_cache.TryGetValue(key, out var value) && value is Entry entry)
+        {
+            if (packageUtf8Json.SequenceEqual(entry.Content))
+            {
+                Interlocked.Increment(ref _hits);
+                return Copy(entry.Package);
+            }
+        }
+
+        Interlocked.Increment(ref _misses);
+        var package = Deserialize(packageUtf8Json);
+        if (package is null)
+            return null;
+
+        // Never fits, so neither made read-only nor handed to MemoryCache
+        if (packageUtf8Json.Length > _sizeLimit)
+            return package;
+
+        package.DataChannelList.MakeReadOnly();
+        // A colliding package already cached under the key is replaced by the latest one
+        var options = new MemoryCacheEntryOptions { Size = packageUtf8Json.Length };
+        options.RegisterPostEvictionCallback(OnEvicted, this);
+        Interlocked.Add(ref _size, packageUtf8Json.Length);
+        var added = new Entry(packageUtf8Json.ToArray(), package);
+        _cache.Set(key, added, options);
+        if (_cache.TryGetValue(key, out var current) && ReferenceEquals(current, added))
+            Interlocked.CompareExchange(ref added.State, Cached, Pending);
+        return Copy(package);
+    }
+
+    public void Dispose() => _cache.Dispose();
+
+    private static Domain.DataChannelListPackage? Deserialize(ReadOnlySpan<byte> packageUtf8Json) =>
+        JsonSerializer.Deserialize<DataChannelListPackage>(packageUtf8Json, Serializer.Options)?.ToDomainModel();
+
+    private static void OnEvicted(object key, object? value, EvictionReason reason, object? state)
+    {
+        var cache = (DataChannelListCache)state!;
+        var entry = (Entry)value!;
+        Interlocked.Add(ref cache._size, -entry.Content.Length);
+        // A rejected entry is reported with the same reason, but was never cached
+        var cached = Interlocked.Exchange(ref entry.State, Removed) == Cached;
+        if (reason == EvictionReason.Capacity && cached)
+            Interlocked.Increment(ref cache._evictions);
+    }
+
+    // Callers may set the records of their package, but not modify the shared list
+    private static Domain.DataChannelListPackage Copy(Domain.DataChannelListPackage package)
+    {
+        var header = package.Package.Header;
+        return new Domain.DataChannelListPackage
+        {
+            Package = new Domain.Package
+            {
+                Header = header with
+                {
+                    DataChannelListId = header.DataChannelListId with { },
+                    VersionInformation = header.VersionInformation is null ? null : header.VersionInformation with { },
+                    CustomHeaders = header.CustomHeaders is null ? null : new(header.CustomHeaders),
+                },
+                DataChannelList = package.DataChannelList,
+            },
+        };
+    }
+
+    // Multiply-xorshift over 8 bytes at a time, the bytes are compared on a hit anyway
+    private ulong Hash(ReadOnlySpan<byte> bytes)
+    {
+        const ulong Prime = 0x9E3779B97F4A7C15;
+        var hash = _seed ^ (ulong)bytes.Length * Prime;
+        while (bytes.Length >= sizeof(ulong))
+        {
+            hash = (hash ^ BinaryPrimitives.ReadUInt64LittleEndian(bytes)) * Prime;
+            hash ^= hash >> 32;
+            bytes = bytes.Slice(sizeof(ulong));
+        }
+        foreach (var b in bytes)
+            hash = (hash ^ b) * Prime;
+        return hash ^ hash >> 29;
+    }
+}
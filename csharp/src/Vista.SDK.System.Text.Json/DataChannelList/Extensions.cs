@@ -1,3 +1,4 @@
+using System.Runtime.ExceptionServices;
 using Domain = Vista.SDK.Transport.DataChannel;
 
 namespace Vista.SDK.Transport.Json.DataChannel;
@@ -99,114 +100,152 @@ public static DataChannelListPackage ToJsonDto(this Domain.DataChannelListPackag
         );
     }
 
-    public static Domain.DataChannelListPackage ToDomainModel(this DataChannelListPackage package)
+    /// <summary>Converts the JSON package to the domain model.</summary>
+    /// <param name="parallel">
+    /// Parse LocalIds and build properties for all channels concurrently, useful for very large lists.
+    /// The channel order and the resulting list are the same as for the sequential conversion.
+    /// </param>
+    public static Domain.DataChannelListPackage ToDomainModel(
+        this DataChannelListPackage package,
+        bool parallel = false
+    )
     {
         var p = package.Package;
         return new Domain.DataChannelListPackage
         {
             Package = new Domain.Package
             {
-                Header = new Domain.Header
+                Header = ToDomainModel(p.Header),
+                DataChannelList = new Domain.DataChannelList(ToDomainModel(p.DataChannelList.DataChannel, parallel))
+            }
+        };
+    }
+
+    internal static Domain.Header ToDomainModel(Header header) =>
+        new Domain.Header
+        {
+            ShipId = ShipId.Parse(header.ShipID),
+            DataChannelListId = new Domain.ConfigurationReference
+            {
+                Id = header.DataChannelListID.ID,
+                Version = header.DataChannelListID.Version,
+                TimeStamp = header.DataChannelListID.TimeStamp
+            },
+            VersionInformation = header.VersionInformation is null
+                ? null
+                : new Domain.VersionInformation
+                {
+                    NamingRule = header.VersionInformation.NamingRule,
+                    NamingSchemeVersion = header.VersionInformation.NamingSchemeVersion,
+                    ReferenceUrl = header.VersionInformation.ReferenceURL
+                },
+            Author = header.Author,
+            DateCreated = header.DateCreated,
+            CustomHeaders = header.CustomHeaders?.CopyProperties()
+        };
+
+    private static Domain.DataChannel[] ToDomainModel(IReadOnlyList<DataChannel> channels, bool parallel)
+    {
+        var result = new Domain.DataChannel[channels.Count];
+        if (!parallel)
+        {
+            for (int i = 0; i < channels.Count; i++)
+                result[i] = ToDomainModel(channels[i]);
+            return result;
+        }
+
+        // Break lets every lower index complete, so the lowest failure is the one the sequential conversion throws
+        Exception? failure = null;
+        var failedIndex = int.MaxValue;
+        Parallel.For(
+            0,
+            channels.Count,
+            (i, state) =>
+            {
+                try
+                {
+                    result[i] = ToDomainModel(channels[i]);
+                }
+                catch (Exception e)
                 {
-                    ShipId = ShipId.Parse(p.Header.ShipID),
-                    DataChannelListId = new Domain.ConfigurationReference
+                    lock (result)
                     {
-                        Id = p.Header.DataChannelListID.ID,
-                        Version = p.Header.DataChannelListID.Version,
-                        TimeStamp = p.Header.DataChannelListID.TimeStamp
-                    },
-                    VersionInformation = p.Header.VersionInformation is null
+                        if (i < failedIndex)
+                            (failedIndex, failure) = (i, e);
+                    }
+                    state.Break();
+                }
+            }
+        );
+        if (failure is not null)
+            ExceptionDispatchInfo.Capture(failure).Throw();
+        return result;
+    }
+
+    internal static Domain.DataChannel ToDomainModel(DataChannel c) =>
+        new Domain.DataChannel
+        {
+            DataChannelId = new Domain.DataChannelId
+            {
+                LocalId = LocalId.Parse(c.DataChannelID.LocalID),
+                ShortId = c.DataChannelID.ShortID,
+                NameObject = c.DataChannelID.NameObject is null
+                    ? null
+                    : new Domain.NameObject
+                    {
+                        NamingRule = c.DataChannelID.NameObject.NamingRule,
+                        CustomNameObjects = c.DataChannelID.NameObject.CustomProperties?.CopyProperties()
+                    }
+            },
+            Property = new Domain.Property
+            {
+                DataChannelType = new Domain.DataChannelType
+                {
+                    Type = c.Property.DataChannelType.Type,
+                    UpdateCycle = c.Property.DataChannelType.UpdateCycle,
+                    CalculationPeriod = c.Property.DataChannelType.CalculationPeriod
+                },
+                Format = new Domain.Format
+                {
+                    Type = c.Property.Format.Type,
+                    Restriction = c.Property.Format.Restriction is null
                         ? null
-                        : new Domain.VersionInformation
+                        : new Domain.Restriction
                         {
-                            NamingRule = p.Header.VersionInformation.NamingRule,
-                            NamingSchemeVersion = p.Header.VersionInformation.NamingSchemeVersion,
-                            ReferenceUrl = p.Header.VersionInformation.ReferenceURL
-                        },
-                    Author = p.Header.Author,
-                    DateCreated = p.Header.DateCreated,
-                    CustomHeaders = p.Header.CustomHeaders?.CopyProperties()
+                            Enumeration = c.Property.Format.Restriction.Enumeration?.ToList(),
+                            FractionDigits = (uint?)c.Property.Format.Restriction.FractionDigits,
+                            Length = (uint?)c.Property.Format.Restriction.Length,
+                            MaxExclusive = c.Property.Format.Restriction.MaxExclusive,
+                            MaxInclusive = c.Property.Format.Restriction.MaxInclusive,
+                            MaxLength = (uint?)c.Property.Format.Restriction.MaxLength,
+                            MinExclusive = c.Property.Format.Restriction.MinExclusive,
+                            MinInclusive = c.Property.Format.Restriction.MinInclusive,
+                            MinLength = (uint?)c.Property.Format.Restriction.MinLength,
+                            Pattern = c.Property.Format.Restriction.Pattern,
+                            TotalDigits = (uint?)c.Property.Format.Restriction.TotalDigits,
+                            WhiteSpace = (Domain.WhiteSpace?)c.Property.Format.Restriction.WhiteSpace
+                        }
                 },
-                DataChannelList = new Domain.DataChannelList
-                {
-                    p.DataChannelList
-                        .DataChannel
-                        .Select(
-                            c =>
-                                new Domain.DataChannel
-                                {
-                                    DataChannelId = new Domain.DataChannelId
-                                    {
-                                        LocalId = LocalId.Parse(c.DataChannelID.LocalID),
-                                        ShortId = c.DataChannelID.ShortID,
-                                        NameObject = c.DataChannelID.NameObject is null
-                                            ? null
-                                            : new Domain.NameObject
-                                            {
-                                                NamingRule = c.DataChannelID.NameObject.NamingRule,
-                                                CustomNameObjects = c.DataChannelID
-                                                    .NameObject
-                                                    .CustomProperties
-                                                    ?.CopyProperties()
-                                            }
-                                    },
-                                    Property = new Domain.Property
-                                    {
-                                        DataChannelType = new Domain.DataChannelType
-                                        {
-                                            Type = c.Property.DataChannelType.Type,
-                                            UpdateCycle = c.Property.DataChannelType.UpdateCycle,
-                                            CalculationPeriod = c.Property.DataChannelType.CalculationPeriod
-                                        },
-                                        Format = new Domain.Format
-                                        {
-                                            Type = c.Property.Format.Type,
-                                            Restriction = c.Property.Format.Restriction is null
-                                                ? null
-                                                : new Domain.Restriction
-                                                {
-                                                    Enumeration = c.Property.Format.Restriction.Enumeration?.ToList(),
-                                                    FractionDigits = (uint?)
-                                                        c.Property.Format.Restriction.FractionDigits,
-                                                    Length = (uint?)c.Property.Format.Restriction.Length,
-                                                    MaxExclusive = c.Property.Format.Restriction.MaxExclusive,
-                                                    MaxInclusive = c.Property.Format.Restriction.MaxInclusive,
-                                                    MaxLength = (uint?)c.Property.Format.Restriction.MaxLength,
-                                                    MinExclusive = c.Property.Format.Restriction.MinExclusive,
-                                                    MinInclusive = c.Property.Format.Restriction.MinInclusive,
-                                                    MinLength = (uint?)c.Property.Format.Restriction.MinLength,
-                                                    Pattern = c.Property.Format.Restriction.Pattern,
-                                                    TotalDigits = (uint?)c.Property.Format.Restriction.TotalDigits,
-                                                    WhiteSpace = (Domain.WhiteSpace?)
-                                                        c.Property.Format.Restriction.WhiteSpace
-                                                }
-                                        },
-                                        Range = c.Property.Range is null
-                                            ? null
-                                            : new Domain.Range
-                                            {
-                                                Low = c.Property.Range.Low,
-                                                High = c.Property.Range.High
-                                            },
-                                        Unit = c.Property.Unit is not null
-                                            ? new Domain.Unit
-                                            {
-                                                UnitSymbol = c.Property.Unit.UnitSymbol,
-                                                QuantityName = c.Property.Unit.QuantityName,
-                                                CustomElements = c.Property.Unit.CustomProperties?.CopyProperties()
-                                            }
-                                            : null,
-                                        QualityCoding = c.Property.QualityCoding,
-                                        AlertPriority = c.Property.AlertPriority,
-                                        Name = c.Property.Name,
-                                        Remarks = c.Property.Remarks,
-                                        CustomProperties = c.Property.CustomProperties?.CopyProperties()
-                                    }
-                                }
-                        )
-                        .ToList()
-                }
+                Range = c.Property.Range is null
+                    ? null
+                    : new Domain.Range
+                    {
+                        Low = c.Property.Range.Low,
+                        High = c.Property.Range.High
+                    },
+                Unit = c.Property.Unit is not null
+                    ? new Domain.Unit
+                    {
+                        UnitSymbol = c.Property.Unit.UnitSymbol,
+                        QuantityName = c.Property.Unit.QuantityName,
+                        CustomElements = c.Property.Unit.CustomProperties?.CopyProperties()
+                    }
+                    : null,
+                QualityCoding = c.Property.QualityCoding,
+                AlertPriority = c.Property.AlertPriority,
+                Name = c.Property.Name,
+                Remarks = c.Property.Remarks,
+                CustomProperties = c.Property.CustomProperties?.CopyProperties()
             }
         };
-    }
 }
@@ -0,0 +1,60 @@
+using System.Text.Json;
+using Domain = Vista.SDK.Transport.DataChannel;
+
+namespace Vista.SDK.Transport.Json.DataChannel;
+
+/// <summary>Loads a DataChannelList package whose channels are deserialized and parsed on first access.</summary>
+/// <remarks>
+/// The JSON is kept as one document, every channel as the element of its JSON. Only the LocalID and ShortID
+/// strings are read up front, for the indexes of <see cref="Domain.DataChannelList.CreateLazy"/>.
+/// </remarks>
+internal static class LazyDataChannelList
+{
+    public static Domain.DataChannelListPackage? Load(JsonDocument document)
+    {
+        // A copy that doesn't use pooled buffers, kept alive by the channels of the list
+        var root = document.RootElement.Clone();
+        if (root.ValueKind == JsonValueKind.Null)
+            return null;
+
+        var package = GetProperty(root, "Package");
+        var header = GetProperty(package, "Header").Deserialize<Header>(Serializer.Options)!;
+        var channels = GetProperty(GetProperty(package, "DataChannelList"), "DataChannel");
+        if (channels.ValueKind != JsonValueKind.Array)
+            throw new JsonException("DataChannel is not an array");
+
+        var count = channels.GetArrayLength();
+        var elements = new JsonElement[count];
+        var localIds = new string[count];
+        var shortIds = new string?[count];
+        var i = 0;
+        foreach (var channel in channels.EnumerateArray())
+        {
+            var id = GetProperty(channel, "DataChannelID");
+            elements[i] = channel;
+            localIds[i] = GetProperty(id, "LocalID").GetString() ?? throw new JsonException("LocalID is null");
+            shortIds[i] = id.TryGetProperty("ShortID", out var shortId) ? shortId.GetString() : null;
+            i++;
+        }
+
+        return new Domain.DataChannelListPackage
+        {
+            Package = new Domain.Package
+            {
+                Header = Extensions.ToDomainModel(header),
+                DataChannelList = Domain.DataChannelList.CreateLazy(
+                    localIds,
+                    shortIds,
+                    index => Extensions.ToDomainModel(elements[index].Deserialize<DataChannel>(Serializer.Options)!)
+                )
+            }
+        };
+    }
+
+    private static JsonElement GetProperty(JsonElement element, string name)
+    {
+        if (element.ValueKind != JsonValueKind.Object || !element.TryGetProperty(name, out var value))
+            throw new JsonException($"Expected a {name} property");
+        return value;
+    }
+}
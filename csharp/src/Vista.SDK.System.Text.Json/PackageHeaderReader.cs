@@ -0,0 +1,332 @@
+using System.Buffers;
+using System.Text.Json;
+using DcJson = Vista.SDK.Transport.Json.DataChannel;
+using TsJson = Vista.SDK.Transport.Json.TimeSeriesData;
+
+namespace Vista.SDK.Transport.Json;
+
+/// <summary>Routing fields of a TimeSeriesData package, read by <c>Serializer.PeekTimeSeriesDataHeader</c>.</summary>
+/// <param name="ShipId">ShipID of the header.</param>
+/// <param name="TimeSpan">TimeSpan of the header.</param>
+/// <param name="DataConfigurations">DataConfiguration of every TimeSeriesData that has one, in order.</param>
+public sealed record TimeSeriesDataHeader(
+    string? ShipId,
+    TsJson.TimeSpan? TimeSpan,
+    IReadOnlyList<TsJson.ConfigurationReference> DataConfigurations
+);
+
+/// <summary>Routing fields of a DataChannelList package, read by <c>Serializer.PeekDataChannelListHeader</c>.</summary>
+/// <param name="ShipId">ShipID of the header.</param>
+/// <param name="DataChannelListId">DataChannelListID of the header.</param>
+public sealed record DataChannelListHeader(string? ShipId, DcJson.ConfigurationReference? DataChannelListId);
+
+/// <summary>Reads the header fields of a package token by token, skipping everything else.</summary>
+/// <remarks>
+/// Only the property names on the path to a wanted field are tracked, one per depth.
+/// A skip doesn't fit a partial buffer of a stream, the skipped value is then read token by token instead,
+/// which is slower but keeps the buffer small.
+/// </remarks>
+internal sealed class PackageHeaderReader
+{
+    private const int BufferSize = 16 * 1024;
+
+    // Deepest wanted field: Package.TimeSeriesData[].DataConfiguration.ID
+    private const int MaxDepth = 6;
+
+    private enum Name : byte
+    {
+        Other,
+        Package,
+        Header,
+        TimeSeriesData,
+        ShipId,
+        TimeSpan,
+        DataChannelListId,
+        DataConfiguration,
+        Start,
+        End,
+        Id,
+        Version,
+        TimeStamp,
+    }
+
+    private readonly bool _timeSeriesData;
+    private readonly Name[] _path = new Name[MaxDepth];
+
+    private bool _isNull;
+    private bool _hasHeader;
+    private bool _headerRead;
+    private bool _dataRead;
+
+    private string? _shipId;
+    private TsJson.TimeSpan? _timeSpan;
+    private DcJson.ConfigurationReference? _dataChannelListId;
+    private List<TsJson.ConfigurationReference>? _dataConfigurations;
+
+    // Fields of the TimeSpan or configuration reference being read
+    private string? _id;
+    private string? _version;
+    private DateTimeOffset? _start;
+    private DateTimeOffset? _end;
+    private DateTimeOffset? _timeStamp;
+
+    private PackageHeaderReader(bool timeSeriesData) => _timeSeriesData = timeSeriesData;
+
+    public static TimeSeriesDataHeader? PeekTimeSeriesData(ReadOnlySpan<byte> json) =>
+        new PackageHeaderReader(timeSeriesData: true).Read(json).ToTimeSeriesDataHeader();
+
+    public static TimeSeriesDataHeader? PeekTimeSeriesData(Stream stream) =>
+        new PackageHeaderReader(timeSeriesData: true).Read(stream).ToTimeSeriesDataHeader();
+
+    public static DataChannelListHeader? PeekDataChannelList(ReadOnlySpan<byte> json) =>
+        new PackageHeaderReader(timeSeriesData: false).Read(json).ToDataChannelListHeader();
+
+    public static DataChannelListHeader? PeekDataChannelList(Stream stream) =>
+        new PackageHeaderReader(timeSeriesData: false).Read(stream).ToDataChannelListHeader();
+
+    private TimeSeriesDataHeader? ToTimeSeriesDataHeader() =>
+        _isNull || !_hasHeader
+            ? null
+            : new TimeSeriesDataHeader(_shipId, _timeSpan, _dataConfigurations ?? []);
+
+    private DataChannelListHeader? ToDataChannelListHeader() =>
+        _isNull || !_hasHeader ? null : new DataChannelListHeader(_shipId, _dataChannelListId);
+
+    // A DataChannelList only needs its header, a TimeSeriesData package also the DataConfiguration of its data
+    private bool IsComplete => _headerRead && (_dataRead || !_timeSeriesData);
+
+    private PackageHeaderReader Read(ReadOnlySpan<byte> json)
+    {
+        var reader = new Utf8JsonReader(json);
+        Read(ref reader);
+        return this;
+    }
+
+    private PackageHeaderReader Read(Stream stream)
+    {
+        if (stream is null)
+            throw new ArgumentNullException(nameof(stream));
+
+        var buffer = ArrayPool<byte>.Shared.Rent(BufferSize);
+        try
+        {
+            var state = new JsonReaderState();
+            var length = 0;
+            while (true)
+            {
+                // A single token larger than the buffer, such as a long string
+                if (length == buffer.Length)
+                {
+                    var larger = ArrayPool<byte>.Shared.Rent(buffer.Length * 2);
+                    Buffer.BlockCopy(buffer, 0, larger, 0, length);
+                    ArrayPool<byte>.Shared.Return(buffer);
+                    buffer = larger;
+                }
+
+                var read = stream.Read(buffer, length, buffer.Length - length);
+                length += read;
+                var isFinalBlock = read == 0;
+
+                var reader = new Utf8JsonReader(buffer.AsSpan(0, length), isFinalBlock, state);
+                if (Read(ref reader) || isFinalBlock)
+                    return this;
+
+                state = reader.CurrentState;
+                var consumed = (int)reader.BytesConsumed;
+                Buffer.BlockCopy(buffer, consumed, buffer, 0, length - consumed);
+                length -= consumed;
+            }
+        }
+        finally
+        {
+            ArrayPool<byte>.Shared.Return(buffer);
+        }
+    }
+
+    /// <summary>Reads the tokens of the reader, returns true when all wanted fields are read.</summary>
+    private bool Read(ref Utf8JsonReader reader)
+    {
+        while (reader.Read())
+        {
+            var depth = reader.CurrentDepth;
+            switch (reader.TokenType)
+            {
+                case JsonTokenType.PropertyName:
+                    var name = depth < MaxDepth ? Classify(ref reader, depth) : Name.Other;
+                    if (depth < MaxDepth)
+                        _path[depth] = name;
+                    if (name == Name.Other)
+                        reader.TrySkip();
+                    break;
+
+                case JsonTokenType.StartObject:
+                case JsonTokenType.StartArray:
+                    if (depth + 1 < MaxDepth)
+                        _path[depth + 1] = Name.Other;
+                    if (depth == 2 && InHeader)
+                        _hasHeader = true;
+                    break;
+
+                case JsonTokenType.EndObject:
+                    if (depth == 0)
+                        return true;
+                    if (EndObject(depth))
+                        return true;
+                    break;
+
+                case JsonTokenType.EndArray:
+                    if (depth == 2 && InData)
+                    {
+                        _dataRead = true;
+                        if (IsComplete)
+                            return true;
+                    }
+                    break;
+
+                case JsonTokenType.String:
+                    ReadString(ref reader, depth);
+                    break;
+
+                case JsonTokenType.Null:
+                    if (depth == 0)
+                    {
+                        _isNull = true;
+                        return true;
+                    }
+                    break;
+            }
+        }
+        return false;
+    }
+
+    private bool InHeader => _path[1] == Name.Package && _path[2] == Name.Header;
+
+    private bool InData => _timeSeriesData && _path[1] == Name.Package && _path[2] == Name.TimeSeriesData;
+
+    private Name Classify(ref Utf8JsonReader reader, int depth)
+    {
+        switch (depth)
+        {
+            case 1:
+                return reader.ValueTextEquals("Package"u8) ? Name.Package : Name.Other;
+            case 2:
+                if (_path[1] != Name.Package)
+                    return Name.Other;
+                if (reader.ValueTextEquals("Header"u8))
+                    return Name.Header;
+                return _timeSeriesData && reader.ValueTextEquals("TimeSeriesData"u8)
+                    ? Name.TimeSeriesData
+                    : Name.Other;
+            case 3:
+                if (!InHeader)
+                    return Name.Other;
+                if (reader.ValueTextEquals("ShipID"u8))
+                    return Name.ShipId;
+                if (_timeSeriesData)
+                    return reader.ValueTextEquals("TimeSpan"u8) ? Name.TimeSpan : Name.Other;
+                return reader.ValueTextEquals("DataChannelListID"u8) ? Name.DataChannelListId : Name.Other;
+            case 4:
+                if (InData)
+                    return reader.ValueTextEquals("DataConfiguration"u8) ? Name.DataConfiguration : Name.Other;
+                if (!InHeader)
+                    return Name.Other;
+                if (_path[3] == Name.TimeSpan)
+                {
+                    if (reader.ValueTextEquals("Start"u8))
+                        return Name.Start;
+                    return reader.ValueTextEquals("End"u8) ? Name.End : Name.Other;
+                }
+                return _path[3] == Name.DataChannelListId ? ClassifyReference(ref reader) : Name.Other;
+            case 5:
+                return InData && _path[4] == Name.DataConfiguration ? ClassifyReference(ref reader) : Name.Other;
+            default:
+                return Name.Other;
+        }
+    }
+
+    private Name ClassifyReference(ref Utf8JsonReader reader)
+    {
+        if (reader.ValueTextEquals("ID"u8))
+            return Name.Id;
+        if (reader.ValueTextEquals("TimeStamp"u8))
+            return Name.TimeStamp;
+        return !_timeSeriesData && reader.ValueTextEquals("Version"u8) ? Name.Version : Name.Other;
+    }
+
+    private void ReadString(ref Utf8JsonReader reader, int depth)
+    {
+        if (depth >= MaxDepth || depth < 3)
+            return;
+        // The property names of every depth up to the value are current, deeper ones are stale
+        switch (_path[depth])
+        {
+            case Name.ShipId:
+                _shipId = reader.GetString();
+                break;
+            case Name.Id:
+                _id = reader.GetString();
+                break;
+            case Name.Version:
+                _version = reader.GetString();
+                break;
+            case Name.Start:
+                _start = ReadDateTimeOffset(ref reader);
+                break;
+            case Name.End:
+                _end = ReadDateTimeOffset(ref reader);
+                break;
+            case Name.TimeStamp:
+                _timeStamp = ReadDateTimeOffset(ref reader);
+                break;
+        }
+    }
+
+    private static DateTimeOffset ReadDateTimeOffset(ref Utf8JsonReader reader)
+    {
+        try
+        {
+            return DatetimeOffsetConverter.Parse(reader.GetString() ?? string.Empty);
+        }
+        catch (FormatException e)
+        {
+            throw new JsonException(e.Message, e);
+        }
+    }
+
+    /// <summary>Completes the TimeSpan or configuration reference an object ends, returns true when done.</summary>
+    private bool EndObject(int depth)
+    {
+        if (depth == 2 && InHeader)
+        {
+            _headerRead = true;
+            return IsComplete;
+        }
+
+        if (depth == 3 && InHeader && _path[3] == Name.TimeSpan)
+        {
+            if (_start is null || _end is null)
+                throw new JsonException("TimeSpan requires Start and End");
+            _timeSpan = new TsJson.TimeSpan(_end.Value, _start.Value);
+        }
+        else if (depth == 3 && InHeader && _path[3] == Name.DataChannelListId)
+        {
+            if (_id is null || _timeStamp is null)
+                throw new JsonException("DataChannelListID requires ID and TimeStamp");
+            _dataChannelListId = new DcJson.ConfigurationReference(_id, _timeStamp.Value, _version);
+        }
+        else if (depth == 4 && InData && _path[4] == Name.DataConfiguration)
+        {
+            if (_id is null || _timeStamp is null)
+                throw new JsonException("DataConfiguration requires ID and TimeStamp");
+            (_dataConfigurations ??= []).Add(new TsJson.ConfigurationReference(_id, _timeStamp.Value));
+        }
+        else
+        {
+            return false;
+        }
+
+        _id = _version = null;
+        _start = _end = _timeStamp = null;
+        return false;
+    }
+}
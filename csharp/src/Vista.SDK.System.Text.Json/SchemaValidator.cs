@@ -0,0 +1,445 @@
+using System.Buffers;
+using System.Globalization;
+using System.Text;
+using System.Text.Json;
+using NodeType = Vista.SDK.Transport.Json.CompiledSchema.NodeType;
+
+namespace Vista.SDK.Transport.Json;
+
+/// <summary>Validates the tokens of a JSON document against a compiled schema as they're read.</summary>
+/// <remarks>
+/// The tokens can come in any number of reads, such as the buffers of a stream, since only the nodes on the path
+/// from the root are kept. Values the schema doesn't describe, such as additional properties, are skipped.
+/// </remarks>
+internal sealed class SchemaValidator(CompiledSchema schema)
+{
+    private struct Frame
+    {
+        public CompiledSchema.Node Node;
+        public ulong Seen;
+
+        // Index of the current property of an object, -1 for an unknown one
+        public int Property;
+
+        // Items read of an array
+        public int Index;
+    }
+
+    private Frame[] _frames = new Frame[16];
+    private int _depth;
+    private int _skipDepth;
+    private bool _started;
+
+    /// <summary>Validates the tokens of the reader, up to the end of its data.</summary>
+    /// <exception cref="JsonException">The JSON doesn't conform to the schema.</exception>
+    public void Read(ref Utf8JsonReader reader)
+    {
+        while (reader.Read())
+        {
+            if (_skipDepth > 0)
+            {
+                if (reader.TokenType is JsonTokenType.StartObject or JsonTokenType.StartArray)
+                    _skipDepth++;
+                else if (reader.TokenType is JsonTokenType.EndObject or JsonTokenType.EndArray)
+                    _skipDepth--;
+                continue;
+            }
+
+            switch (reader.TokenType)
+            {
+                case JsonTokenType.PropertyName:
+                    ReadProperty(ref reader);
+                    break;
+                case JsonTokenType.EndObject:
+                    EndObject();
+                    break;
+                case JsonTokenType.EndArray:
+                    _depth--;
+                    break;
+                default:
+                    ReadValue(ref reader);
+                    break;
+            }
+        }
+    }
+
+    /// <summary>Checks that the document is complete, once all its tokens are read.</summary>
+    /// <exception cref="JsonException">The document is empty or incomplete.</exception>
+    public void Complete()
+    {
+        if (!_started || _depth > 0 || _skipDepth > 0)
+            throw new JsonException($"{schema.Title}: the JSON document is incomplete");
+    }
+
+    private void ReadProperty(ref Utf8JsonReader reader)
+    {
+        ref var frame = ref _frames[_depth - 1];
+        var properties = frame.Node.Properties;
+        for (var i = 0; i < properties.Length; i++)
+        {
+            if (reader.ValueTextEquals(properties[i].Utf8Name))
+            {
+                frame.Property = i;
+                frame.Seen |= 1UL << i;
+                return;
+            }
+        }
+
+        frame.Property = -1;
+        if (!frame.Node.AdditionalProperties)
+            throw Error($"property '{reader.GetString()}' is not allowed");
+    }
+
+    private void EndObject()
+    {
+        ref var frame = ref _frames[_depth - 1];
+        var missing = frame.Node.Required & ~frame.Seen;
+        if (missing != 0)
+        {
+            var i = 0;
+            while ((missing & (1UL << i)) == 0)
+                i++;
+            frame.Property = -1;
+            throw Error($"required property '{frame.Node.Properties[i].Name}' is missing");
+        }
+        _depth--;
+    }
+
+    private void ReadValue(ref Utf8JsonReader reader)
+    {
+        var index = NextNode();
+        _started = true;
+        if (index < 0 || schema.Nodes[index].Type == NodeType.Any)
+        {
+            if (reader.TokenType is JsonTokenType.StartObject or JsonTokenType.StartArray)
+                _skipDepth = 1;
+            return;
+        }
+
+        var node = schema.Nodes[index];
+        switch (reader.TokenType)
+        {
+            case JsonTokenType.StartObject:
+                Expect(node, NodeType.Object, reader.TokenType);
+                Push(node);
+                break;
+
+            case JsonTokenType.StartArray:
+                Expect(node, NodeType.Array, reader.TokenType);
+                Push(node);
+                break;
+
+            case JsonTokenType.String:
+                if (node.Type == NodeType.DateTime)
+                {
+                    if (!IsDateTime(ref reader))
+                        throw Error($"'{reader.GetString()}' is not an ISO 8601 date-time");
+                    break;
+                }
+                Expect(node, NodeType.String, reader.TokenType);
+                if (node.Enum is { } values && !IsOneOf(ref reader, values))
+                {
+                    var expected = string.Join(", ", values.Select(v => Encoding.UTF8.GetString(v)));
+                    throw Error($"'{reader.GetString()}' is not one of {expected}");
+                }
+                break;
+
+            case JsonTokenType.Number:
+                if (node.Type != NodeType.Integer)
+                    Expect(node, NodeType.Number, reader.TokenType);
+                if (!reader.TryGetDouble(out var value))
+                    throw Error("the number is out of range");
+                if (node.Type == NodeType.Integer && Math.Floor(value) != value)
+                    throw Error($"{value.ToString(CultureInfo.InvariantCulture)} is not an integer");
+                if (value < node.Minimum)
+                    throw Error($"{value.ToString(CultureInfo.InvariantCulture)} is less than {node.Minimum}");
+                break;
+
+            default:
+                throw Error($"expected {Describe(node.Type)}, found {Describe(reader.TokenType)}");
+        }
+    }
+
+    private int NextNode()
+    {
+        if (_depth == 0)
+            return 0;
+
+        ref var frame = ref _frames[_depth - 1];
+        if (frame.Node.Type == NodeType.Array)
+        {
+            frame.Index++;
+            return frame.Node.Items;
+        }
+        return frame.Property < 0 ? -1 : frame.Node.Properties[frame.Property].Node;
+    }
+
+    private void Push(CompiledSchema.Node node)
+    {
+        if (_depth == _frames.Length)
+            Array.Resize(ref _frames, _frames.Length * 2);
+        _frames[_depth++] = new Frame { Node = node, Property = -1 };
+    }
+
+    private void Expect(CompiledSchema.Node node, NodeType type, JsonTokenType token)
+    {
+        if (node.Type != type)
+            throw Error($"expected {Describe(node.Type)}, found {Describe(token)}");
+    }
+
+    private static bool IsOneOf(ref Utf8JsonReader reader, byte[][] values)
+    {
+        foreach (var value in values)
+        {
+            if (reader.ValueTextEquals(value))
+                return true;
+        }
+        return false;
+    }
+
+    // The format DatetimeOffsetConverter reads, checked on the UTF-8 bytes since every data set has a timestamp
+    private static bool IsDateTime(ref Utf8JsonReader reader)
+    {
+        var value = reader.ValueSpan;
+        if (reader.HasValueSequence || value.IndexOf((byte)'\\') >= 0)
+            return IsDateTime(reader.GetString()!);
+
+        // yyyy-MM-ddTHH:mm:ss
+        if (
+            value.Length < 20
+            || value[4] != '-'
+            || value[7] != '-'
+            || value[10] != 'T'
+            || value[13] != ':'
+            || value[16] != ':'
+            || !TryReadDigits(value, 0, 4, out var year)
+            || !TryReadDigits(value, 5, 2, out var month)
+            || !TryReadDigits(value, 8, 2, out var day)
+            || !TryReadDigits(value, 11, 2, out var hour)
+            || !TryReadDigits(value, 14, 2, out var minute)
+            || !TryReadDigits(value, 17, 2, out var second)
+        )
+            return false;
+        if (year is 1 or 9999)
+            return IsDateTime(reader.GetString()!); // The offset may move it out of range
+
+        // Fraction, then Z or an offset
+        var i = 19;
+        if (value[i] == '.')
+        {
+            var start = ++i;
+            while (i < value.Length && value[i] is >= (byte)'0' and <= (byte)'9')
+                i++;
+            if (i == start || i == value.Length)
+                return false;
+        }
+        var zone = value.Slice(i);
+        var validZone =
+            (zone.Length == 1 && zone[0] == 'Z')
+            || (
+                zone.Length == 6
+                && zone[0] is (byte)'+' or (byte)'-'
+                && zone[3] == ':'
+                && TryReadDigits(zone, 1, 2, out var offsetHours)
+                && TryReadDigits(zone, 4, 2, out var offsetMinutes)
+                && offsetMinutes < 60
+                && offsetHours * 60 + offsetMinutes <= 14 * 60
+            );
+
+        return validZone
+            && year >= 1
+            && month is >= 1 and <= 12
+            && day >= 1
+            && day <= DateTime.DaysInMonth(year, month)
+            && hour < 24
+            && minute < 60
+            && second < 60;
+    }
+
+    private static bool TryReadDigits(ReadOnlySpan<byte> value, int start, int count, out int result)
+    {
+        result = 0;
+        for (var i = start; i < start + count; i++)
+        {
+            var digit = value[i] - '0';
+            if (digit is < 0 or > 9)
+                return false;
+            result = result * 10 + digit;
+        }
+        return true;
+    }
+
+    private static bool IsDateTime(string value) =>
+        DatetimeOffsetConverter.Iso8601StrictRegex.IsMatch(value)
+        && DateTimeOffset.TryParse(value, CultureInfo.InvariantCulture, DateTimeStyles.RoundtripKind, out _);
+
+    private JsonException Error(string message)
+    {
+        var path = new StringBuilder("$");
+        for (var i = 0; i < _depth; i++)
+        {
+            var frame = _frames[i];
+            if (frame.Node.Type == NodeType.Array)
+                path.Append('[').Append(frame.Index - 1).Append(']');
+            else if (frame.Property >= 0)
+                path.Append('.').Append(frame.Node.Properties[frame.Property].Name);
+        }
+        return new JsonException($"{schema.Title}: {message} at {path}", path.ToString(), null, null);
+    }
+
+    private static string Describe(NodeType type) =>
+        type switch
+        {
+            NodeType.Object => "an object",
+            NodeType.Array => "an array",
+            NodeType.String => "a string",
+            NodeType.DateTime => "a date-time string",
+            NodeType.Number => "a number",
+            NodeType.Integer => "an integer",
+            _ => "any value",
+        };
+
+    private static string Describe(JsonTokenType token) =>
+        token switch
+        {
+            JsonTokenType.StartObject => "an object",
+            JsonTokenType.StartArray => "an array",
+            JsonTokenType.String => "a string",
+            JsonTokenType.Number => "a number",
+            JsonTokenType.True or JsonTokenType.False => "a boolean",
+            _ => "null",
+        };
+}
+
+/// <summary>
+/// Validates the JSON read through it against a compiled schema, so a deserializer reading the stream validates
+/// the document in the same pass.
+/// </summary>
+/// <remarks>
+/// Every read is tokenized as it passes through, only the bytes of a token split between reads are kept.
+/// Schema errors are thrown from the read that completes the offending token. The wrapped stream is not disposed.
+/// </remarks>
+internal sealed class SchemaValidatingStream(Stream stream, CompiledSchema schema) : Stream
+{
+    private readonly SchemaValidator _validator = new(schema);
+    private JsonReaderState _state;
+    private byte[]? _pending;
+    private int _pendingLength;
+    private bool _completed;
+
+    public override bool CanRead => true;
+
+    public override bool CanSeek => false;
+
+    public override bool CanWrite => false;
+
+    public override long Length => throw new NotSupportedException();
+
+    public override long Position
+    {
+        get => throw new NotSupportedException();
+        set => throw new NotSupportedException();
+    }
+
+    public override int Read(byte[] buffer, int offset, int count)
+    {
+        var read = stream.Read(buffer, offset, count);
+        Validate(buffer.AsSpan(offset, read), count);
+        return read;
+    }
+
+    public override async Task<int> ReadAsync(byte[] buffer, int offset, int count, CancellationToken cancellationToken)
+    {
+        var read = await stream.ReadAsync(buffer, offset, count, cancellationToken).ConfigureAwait(false);
+        Validate(buffer.AsSpan(offset, read), count);
+        return read;
+    }
+
+#if NET8_0_OR_GREATER
+    public override int Read(Span<byte> buffer)
+    {
+        var read = stream.Read(buffer);
+        Validate(buffer.Slice(0, read), buffer.Length);
+        return read;
+    }
+
+    public override async ValueTask<int> ReadAsync(Memory<byte> buffer, CancellationToken cancellationToken = default)
+    {
+        var read = await stream.ReadAsync(buffer, cancellationToken).ConfigureAwait(false);
+        Validate(buffer.Span.Slice(0, read), buffer.Length);
+        return read;
+    }
+#endif
+
+    public override void Flush() { }
+
+    public override long Seek(long offset, SeekOrigin origin) => throw new NotSupportedException();
+
+    public override void SetLength(long value) => throw new NotSupportedException();
+
+    public override void Write(byte[] buffer, int offset, int count) => throw new NotSupportedException();
+
+    protected override void Dispose(bool disposing)
+    {
+        if (_pending is not null)
+            ArrayPool<byte>.Shared.Return(_pending);
+        _pending = null;
+        base.Dispose(disposing);
+    }
+
+    private void Validate(ReadOnlySpan<byte> data, int requested)
+    {
+        if (_completed || requested == 0)
+            return;
+
+        var isFinalBlock = data.IsEmpty;
+        if (_pendingLength == 0)
+        {
+            var consumed = Validate(data, isFinalBlock);
+            Keep(data.Slice(consumed));
+        }
+        else
+        {
+            Keep(data);
+            var pending = _pending!;
+            var consumed = Validate(pending.AsSpan(0, _pendingLength), isFinalBlock);
+            pending.AsSpan(consumed, _pendingLength - consumed).CopyTo(pending);
+            _pendingLength -= consumed;
+        }
+
+        if (isFinalBlock)
+        {
+            _completed = true;
+            _validator.Complete();
+        }
+    }
+
+    private int Validate(ReadOnlySpan<byte> json, bool isFinalBlock)
+    {
+        var reader = new Utf8JsonReader(json, isFinalBlock, _state);
+        _validator.Read(ref reader);
+        _state = reader.CurrentState;
+        return (int)reader.BytesConsumed;
+    }
+
+    // Appends the bytes of a token that continues in the next read
+    private void Keep(ReadOnlySpan<byte> bytes)
+    {
+        if (bytes.IsEmpty)
+            return;
+
+        var length = _pendingLength + bytes.Length;
+        if (_pending is null || _pending.Length < length)
+        {
+            var larger = ArrayPool<byte>.Shared.Rent(Math.Max(length, 4096));
+            if (_pending is not null)
+            {
+                _pending.AsSpan(0, _pendingLength).CopyTo(larger);
+                ArrayPool<byte>.Shared.Return(_pending);
+            }
+            _pending = larger;
+        }
+        bytes.CopyTo(_pending.AsSpan(_pendingLength));
+        _pendingLength = length;
+    }
+}
@@ -44,8 +44,11 @@ public class DatetimeOffsetConverter : JsonConverter<DateTimeOffset>
     public override DateTimeOffset Read(ref Utf8JsonReader reader, Type typeToConvert, JsonSerializerOptions options)
     {
         Debug.Assert(typeToConvert == typeof(DateTimeOffset));
-        var value = reader.GetString() ?? string.Empty;
+        return Parse(reader.GetString() ?? string.Empty);
+    }
 
+    internal static DateTimeOffset Parse(string value)
+    {
         if (!Iso8601StrictRegex.IsMatch(value))
             throw new FormatException($"Invalid ISO 8601-1 format: '{value}'");
 
@@ -108,6 +111,16 @@ public static class Serializer
         CancellationToken cancellationToken = default
     ) => SerializeAsync(package.ToJsonDto(), stream, cancellationToken);
 
+    /// <summary>Serializes the package into packages of at most <paramref name="maxBytes"/> UTF-8 bytes each.</summary>
+    /// <remarks>
+    /// Data sets are serialized once and kept in order, tabular data is split between data sets.
+    /// Every chunk has the Header, with the TimeSpan of its own data sets when the package is split,
+    /// and the DataConfiguration of the TimeSeriesData its data sets come from.
+    /// </remarks>
+    /// <exception cref="ArgumentException">A single data set doesn't fit in <paramref name="maxBytes"/>.</exception>
+    public static IEnumerable<byte[]> SerializeChunked(this TsDomain.TimeSeriesDataPackage package, int maxBytes) =>
+        TimeSeriesDataSplitter.Split(package, maxBytes);
+
     public static DataChannelListPackage? DeserializeDataChannelList(string packageJson) =>
         JsonSerializer.Deserialize<DataChannelListPackage>(packageJson, Options);
 
@@ -122,6 +135,76 @@ public static class Serializer
     public static DataChannelListPackage? DeserializeDataChannelList(Stream packageJsonStream) =>
         JsonSerializer.Deserialize<DataChannelListPackage>(packageJsonStream, Options);
 
+    /// <summary>Deserializes a DataChannelList package, optionally validated by DataChannelList.schema.json.</summary>
+    /// <remarks>
+    /// The schema is compiled at build time, and the stream is validated as the deserializer reads it,
+    /// without buffering the document or validating it in a separate pass. A JSON null doesn't conform to the schema.
+    /// </remarks>
+    /// <exception cref="JsonException">The JSON is invalid, or doesn't conform to the schema.</exception>
+    public static DataChannelListPackage? DeserializeDataChannelList(Stream packageJsonStream, bool validateSchema)
+    {
+        if (!validateSchema)
+            return DeserializeDataChannelList(packageJsonStream);
+
+        using var stream = new SchemaValidatingStream(packageJsonStream, PackageSchemas.DataChannelList);
+        return JsonSerializer.Deserialize<DataChannelListPackage>(stream, Options);
+    }
+
+    /// <inheritdoc cref="DeserializeDataChannelList(Stream, bool)"/>
+    public static async ValueTask<DataChannelListPackage?> DeserializeDataChannelListAsync(
+        Stream packageJsonStream,
+        bool validateSchema,
+        CancellationToken cancellationToken = default
+    )
+    {
+        if (!validateSchema)
+            return await DeserializeDataChannelListAsync(packageJsonStream, cancellationToken).ConfigureAwait(false);
+
+        using var stream = new SchemaValidatingStream(packageJsonStream, PackageSchemas.DataChannelList);
+        return await JsonSerializer
+            .DeserializeAsync<DataChannelListPackage>(stream, Options, cancellationToken)
+            .ConfigureAwait(false);
+    }
+
+    /// <summary>Deserializes a DataChannelList package whose channels are parsed on first access.</summary>
+    /// <remarks>
+    /// Loading only reads the LocalID and ShortID of every channel, so looking up a few channels of a large list
+    /// is fast. A channel is deserialized, parsed and validated when it's first looked up or enumerated,
+    /// <see cref="DcDomain.DataChannelList.ValidateAll"/> does it for all channels. Invalid channels throw on access.
+    /// The list keeps a copy of the JSON until every channel is parsed.
+    /// </remarks>
+    public static DcDomain.DataChannelListPackage? DeserializeDataChannelListLazy(string packageJson)
+    {
+        using var document = JsonDocument.Parse(packageJson);
+        return LazyDataChannelList.Load(document);
+    }
+
+    /// <inheritdoc cref="DeserializeDataChannelListLazy(string)"/>
+    public static DcDomain.DataChannelListPackage? DeserializeDataChannelListLazy(Stream packageJsonStream)
+    {
+        using var document = JsonDocument.Parse(packageJsonStream);
+        return LazyDataChannelList.Load(document);
+    }
+
+    /// <inheritdoc cref="DeserializeDataChannelListLazy(string)"/>
+    /// <param name="packageJsonStream">The package JSON.</param>
+    /// <param name="validateSchema">
+    /// Validate the JSON against DataChannelList.schema.json as it's read, channels are still parsed on first access.
+    /// </param>
+    /// <exception cref="JsonException">The JSON is invalid, or doesn't conform to the schema.</exception>
+    public static DcDomain.DataChannelListPackage? DeserializeDataChannelListLazy(
+        Stream packageJsonStream,
+        bool validateSchema
+    )
+    {
+        if (!validateSchema)
+            return DeserializeDataChannelListLazy(packageJsonStream);
+
+        using var stream = new SchemaValidatingStream(packageJsonStream, PackageSchemas.DataChannelList);
+        using var document = JsonDocument.Parse(stream);
+        return LazyDataChannelList.Load(document);
+    }
+
     public static TimeSeriesDataPackage? DeserializeTimeSeriesData(string packageJson) =>
         JsonSerializer.Deserialize<TimeSeriesDataPackage>(packageJson, Options);
 
@@ -135,4 +218,59 @@ public static class Serializer
 
     public static TimeSeriesDataPackage? DeserializeTimeSeriesData(Stream packageJsonStream) =>
         JsonSerializer.Deserialize<TimeSeriesDataPackage>(packageJsonStream, Options);
+
+    /// <summary>Deserializes a TimeSeriesData package, optionally validated by TimeSeriesData.schema.json.</summary>
+    /// <inheritdoc cref="DeserializeDataChannelList(Stream, bool)"/>
+    public static TimeSeriesDataPackage? DeserializeTimeSeriesData(Stream packageJsonStream, bool validateSchema)
+    {
+        if (!validateSchema)
+            return DeserializeTimeSeriesData(packageJsonStream);
+
+        using var stream = new SchemaValidatingStream(packageJsonStream, PackageSchemas.TimeSeriesData);
+        return JsonSerializer.Deserialize<TimeSeriesDataPackage>(stream, Options);
+    }
+
+    /// <inheritdoc cref="DeserializeTimeSeriesData(Stream, bool)"/>
+    public static async ValueTask<TimeSeriesDataPackage?> DeserializeTimeSeriesDataAsync(
+        Stream packageJsonStream,
+        bool validateSchema,
+        CancellationToken cancellationToken = default
+    )
+    {
+        if (!validateSchema)
+            return await DeserializeTimeSeriesDataAsync(packageJsonStream, cancellationToken).ConfigureAwait(false);
+
+        using var stream = new SchemaValidatingStream(packageJsonStream, PackageSchemas.TimeSeriesData);
+        return await JsonSerializer
+            .DeserializeAsync<TimeSeriesDataPackage>(stream, Options, cancellationToken)
+            .ConfigureAwait(false);
+    }
+
+    /// <summary>Reads the routing fields of a TimeSeriesData package without deserializing its data.</summary>
+    /// <remarks>
+    /// Tabular and event data are skipped, the header can come before or after them.
+    /// Returns null for a JSON null or a package without a header.
+    /// </remarks>
+    /// <exception cref="JsonException">The JSON is invalid.</exception>
+    public static TimeSeriesDataHeader? PeekTimeSeriesDataHeader(ReadOnlySpan<byte> packageUtf8Json) =>
+        PackageHeaderReader.PeekTimeSeriesData(packageUtf8Json);
+
+    /// <inheritdoc cref="PeekTimeSeriesDataHeader(ReadOnlySpan{byte})"/>
+    /// <remarks>The stream is read in small buffers, up to the end of the TimeSeriesData and the header.</remarks>
+    public static TimeSeriesDataHeader? PeekTimeSeriesDataHeader(Stream packageJsonStream) =>
+        PackageHeaderReader.PeekTimeSeriesData(packageJsonStream);
+
+    /// <summary>Reads the routing fields of a DataChannelList package without deserializing its channels.</summary>
+    /// <remarks>
+    /// Data channels are skipped, the header can come before or after them.
+    /// Returns null for a JSON null or a package without a header.
+    /// </remarks>
+    /// <exception cref="JsonException">The JSON is invalid.</exception>
+    public static DataChannelListHeader? PeekDataChannelListHeader(ReadOnlySpan<byte> packageUtf8Json) =>
+        PackageHeaderReader.PeekDataChannelList(packageUtf8Json);
+
+    /// <inheritdoc cref="PeekDataChannelListHeader(ReadOnlySpan{byte})"/>
+    /// <remarks>The stream is read in small buffers, up to the end of the header.</remarks>
+    public static DataChannelListHeader? PeekDataChannelListHeader(Stream packageJsonStream) =>
+        PackageHeaderReader.PeekDataChannelList(packageJsonStream);
 }
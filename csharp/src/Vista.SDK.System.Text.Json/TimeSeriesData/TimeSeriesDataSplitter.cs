@@ -0,0 +1,503 @@
+using System.Diagnostics;
+using System.Globalization;
+using System.Text;
+using System.Text.Json;
+using TsDomain = Vista.SDK.Transport.TimeSeries;
+
+namespace Vista.SDK.Transport.Json.TimeSeriesData;
+
+/// <summary>Serializes a TimeSeriesData package into packages that each fit a byte budget.</summary>
+/// <remarks>
+/// Every data set is serialized once, the exact size of the chunk is kept while adding them.
+/// The JSON of each chunk is the same as <see cref="Serializer.Serialize(TimeSeriesDataPackage)"/> would write for it.
+/// </remarks>
+internal sealed class TimeSeriesDataSplitter
+{
+    private static readonly JsonEncodedText TimeStampName = JsonEncodedText.Encode("TimeStamp");
+    private static readonly JsonEncodedText DataChannelIdName = JsonEncodedText.Encode("DataChannelID");
+    private static readonly JsonEncodedText ValueName = JsonEncodedText.Encode("Value");
+    private static readonly JsonEncodedText QualityName = JsonEncodedText.Encode("Quality");
+
+    // The JSON around the serialized parts, in the property order of the DTOs
+    private static readonly byte[] PackageStart = Utf8("{\"Package\":{");
+    private static readonly byte[] HeaderProperty = Utf8("\"Header\":");
+    private static readonly byte[] TimeSeriesDataStart = Utf8("\"TimeSeriesData\":[");
+    private static readonly byte[] PackageEnd = Utf8("]}}");
+    private static readonly byte[] DataConfigurationProperty = Utf8("\"DataConfiguration\":");
+    private static readonly byte[] TabularDataStart = Utf8("\"TabularData\":[");
+    private static readonly byte[] TableStart = Utf8("{\"NumberOfDataSet\":");
+    private static readonly byte[] NumberOfDataChannelProperty = Utf8(",\"NumberOfDataChannel\":");
+    private static readonly byte[] DataChannelIdProperty = Utf8(",\"DataChannelID\":");
+    private static readonly byte[] EventDataStart = Utf8("\"EventData\":{\"NumberOfDataSet\":");
+    private static readonly byte[] DataSetStart = Utf8(",\"DataSet\":[");
+    private static readonly byte[] DataSetEnd = Utf8("]}");
+
+    private static readonly int PackageFixedSize = PackageStart.Length + TimeSeriesDataStart.Length + PackageEnd.Length;
+    private static readonly int EventsFixedSize = EventDataStart.Length + DataSetStart.Length + DataSetEnd.Length;
+
+    private readonly TsDomain.TimeSeriesDataPackage _package;
+    private readonly int _maxBytes;
+
+    private readonly Entry[] _entries;
+    private readonly int _headerSize;
+
+    // Serialized data sets of the current chunk
+    private readonly MemoryStream _scratch = new();
+    private readonly Utf8JsonWriter _writer;
+    private readonly List<int> _dataSetStarts = [];
+    private readonly List<Part> _parts = [];
+
+    private int _size;
+    private DateTimeOffset _start;
+    private DateTimeOffset _end;
+
+    private TimeSeriesDataSplitter(TsDomain.TimeSeriesDataPackage package, int maxBytes)
+    {
+        _package = package;
+        _maxBytes = maxBytes;
+        _writer = new Utf8JsonWriter(_scratch);
+        _entries = package.Package.TimeSeriesData.Select(CreateEntry).ToArray();
+
+        var header = SerializeHeader(package.Package.Header?.TimeSpan);
+        _headerSize = header is null ? 0 : HeaderProperty.Length + header.Length + 1;
+    }
+
+    /// <summary>Serializes the package into chunks of at most <paramref name="maxBytes"/> UTF-8 bytes each.</summary>
+    /// <remarks>
+    /// Chunks keep the Header, with the TimeSpan narrowed to the time stamps of the chunk when there is more than one,
+    /// and the DataConfiguration and custom data kinds of every TimeSeriesData they have data sets of.
+    /// Tabular and event data sets are kept in order, tabular data is split between data sets.
+    /// </remarks>
+    /// <exception cref="ArgumentException">A single data set doesn't fit the budget.</exception>
+    public static IEnumerable<byte[]> Split(TsDomain.TimeSeriesDataPackage package, int maxBytes)
+    {
+        if (package is null)
+            throw new ArgumentNullException(nameof(package));
+        if (maxBytes <= 0)
+            throw new ArgumentException($"Invalid budget {maxBytes}. Should be positive", nameof(maxBytes));
+
+        return new TimeSeriesDataSplitter(package, maxBytes).Split();
+    }
+
+    private IEnumerable<byte[]> Split()
+    {
+        // A chunk that overflows always has another one after it, only the last chunk can be the whole package
+        var chunks = 0;
+        for (var e = 0; e < _entries.Length; e++)
+        {
+            var data = _package.Package.TimeSeriesData[e];
+            var tables = data.TabularData ?? [];
+            for (var t = 0; t < tables.Count; t++)
+            {
+                if (_entries[e].Tables[t] is null)
+                    continue;
+                foreach (var dataSet in tables[t].DataSets!)
+                {
+                    var dataSetStart = (int)_scratch.Length;
+                    WriteTabular(dataSet);
+                    if (TryAdd(e, t, dataSetStart, dataSet.TimeStamp))
+                        continue;
+
+                    yield return Flush(dataSetStart, ++chunks);
+                    Add(e, t, dataSet.TimeStamp);
+                }
+            }
+
+            foreach (var dataSet in data.EventData?.DataSet ?? [])
+            {
+                var dataSetStart = (int)_scratch.Length;
+                WriteEvent(dataSet);
+                if (TryAdd(e, -1, dataSetStart, dataSet.TimeStamp))
+                    continue;
+
+                yield return Flush(dataSetStart, ++chunks);
+                Add(e, -1, dataSet.TimeStamp);
+            }
+        }
+
+        if (_parts.Count > 0)
+        {
+            yield return Flush((int)_scratch.Length, chunks == 0 ? 0 : chunks + 1);
+        }
+        else
+        {
+            // No data sets, nothing to split
+            var json = JsonSerializer.SerializeToUtf8Bytes(_package.ToJsonDto(), Serializer.Options);
+            if (json.Length > _maxBytes)
+                throw new ArgumentException($"Package of {json.Length} bytes doesn't fit in {_maxBytes} bytes");
+            yield return json;
+        }
+    }
+
+    private bool TryAdd(int entry, int table, int dataSetStart, DateTimeOffset timeStamp)
+    {
+        _dataSetStarts.Add(dataSetStart);
+        var size = _size + Delta(entry, table, (int)_scratch.Length - dataSetStart);
+        if (size > _maxBytes)
+        {
+            _dataSetStarts.RemoveAt(_dataSetStarts.Count - 1);
+            if (_parts.Count == 0)
+            {
+                throw new ArgumentException(
+                    $"Data set at {timeStamp:o} needs {size} bytes, more than the budget of {_maxBytes} bytes"
+                );
+            }
+            return false;
+        }
+
+        Apply(entry, table, size, timeStamp);
+        return true;
+    }
+
+    private void Add(int entry, int table, DateTimeOffset timeStamp)
+    {
+        // Throws when the data set doesn't fit an empty chunk either
+        var added = TryAdd(entry, table, 0, timeStamp);
+        Debug.Assert(added);
+    }
+
+    /// <summary>Size the chunk grows by when adding a data set of <paramref name="bytes"/>.</summary>
+    private int Delta(int entry, int table, int bytes)
+    {
+        var delta = bytes;
+        var last = _parts.Count == 0 ? default(Part?) : _parts[_parts.Count - 1];
+        if (last is { } part && part.Entry == entry && part.Table == table)
+            return delta + 1 + Digits(part.Count + 1) - Digits(part.Count);
+
+        var partSize = table >= 0 ? _entries[entry].Tables[table]!.FixedSize : EventsFixedSize;
+        delta += partSize + Digits(1);
+
+        if (_parts.Count == 0)
+            delta += PackageFixedSize + _headerSize;
+
+        var properties = _entries[entry].Properties;
+        if (last?.Entry == entry)
+        {
+            // Another table goes into the open TabularData array
+            if (table >= 0 && last.Value.Table >= 0)
+                return delta + 1;
+            properties += last.Value.Table >= 0 ? 1 : 0;
+        }
+        else
+        {
+            delta += (_parts.Count > 0 ? 1 : 0) + _entries[entry].FixedSize;
+        }
+
+        if (table >= 0)
+            delta += TabularDataStart.Length + 1;
+        return delta + (properties > 0 ? 1 : 0);
+    }
+
+    private void Apply(int entry, int table, int size, DateTimeOffset timeStamp)
+    {
+        _size = size;
+        if (_parts.Count > 0 && _parts[_parts.Count - 1] is var last && last.Entry == entry && last.Table == table)
+        {
+            _parts[_parts.Count - 1] = last with { Count = last.Count + 1 };
+        }
+        else
+        {
+            _parts.Add(new Part(entry, table, _dataSetStarts.Count - 1, 1));
+        }
+
+        if (_parts.Count == 1 && _parts[0].Count == 1)
+        {
+            _start = timeStamp;
+            _end = timeStamp;
+        }
+        else
+        {
+            if (timeStamp < _start)
+                _start = timeStamp;
+            if (timeStamp > _end)
+                _end = timeStamp;
+        }
+    }
+
+    /// <summary>Writes the current chunk, keeping the serialized data sets from <paramref name="keep"/> on.</summary>
+    /// <param name="chunk">Number of the chunk, 0 when the package isn't split.</param>
+    /// <exception cref="InvalidOperationException">The chunk isn't the size it was estimated at.</exception>
+    private byte[] Flush(int keep, int chunk)
+    {
+        var buffer = new byte[_size];
+        int position;
+        try
+        {
+            position = WriteChunk(buffer, keep, chunk);
+        }
+        catch (Exception e) when (e is ArgumentException or IndexOutOfRangeException)
+        {
+            throw new InvalidOperationException($"Chunk {chunk} is larger than its estimate of {_size} bytes", e);
+        }
+        if (position != buffer.Length)
+            throw new InvalidOperationException($"Chunk {chunk} has {position} bytes, estimated {_size} bytes");
+
+        // Move the data set that didn't fit to the start of the scratch buffer
+        var scratch = _scratch.GetBuffer();
+        var remaining = (int)_scratch.Length - keep;
+        Buffer.BlockCopy(scratch, keep, scratch, 0, remaining);
+        _scratch.SetLength(remaining);
+        _dataSetStarts.Clear();
+        _parts.Clear();
+        _size = 0;
+        return buffer;
+    }
+
+    /// <returns>The number of bytes written.</returns>
+    private int WriteChunk(byte[] buffer, int keep, int chunk)
+    {
+        var scratch = _scratch.GetBuffer();
+        var position = 0;
+
+        Write(buffer, ref position, PackageStart);
+        var header = SerializeHeader(
+            chunk == 0 || _package.Package.Header?.TimeSpan is null
+                ? _package.Package.Header?.TimeSpan
+                : new TsDomain.TimeSpan { Start = _start, End = _end }
+        );
+        if (header is not null)
+        {
+            Write(buffer, ref position, HeaderProperty);
+            Write(buffer, ref position, header);
+            buffer[position++] = (byte)',';
+        }
+        Write(buffer, ref position, TimeSeriesDataStart);
+
+        for (var i = 0; i < _parts.Count; i++)
+        {
+            var part = _parts[i];
+            var entry = _entries[part.Entry];
+            var first = i == 0 || _parts[i - 1].Entry != part.Entry;
+            var last = i == _parts.Count - 1 || _parts[i + 1].Entry != part.Entry;
+
+            if (first)
+            {
+                if (i > 0)
+                    buffer[position++] = (byte)',';
+                buffer[position++] = (byte)'{';
+                if (entry.DataConfiguration is not null)
+                {
+                    Write(buffer, ref position, DataConfigurationProperty);
+                    Write(buffer, ref position, entry.DataConfiguration);
+                }
+            }
+
+            if (part.Table >= 0)
+            {
+                var firstTable = first || _parts[i - 1].Table < 0;
+                if (firstTable)
+                {
+                    if (entry.DataConfiguration is not null)
+                        buffer[position++] = (byte)',';
+                    Write(buffer, ref position, TabularDataStart);
+                }
+                else
+                {
+                    buffer[position++] = (byte)',';
+                }
+
+                var table = entry.Tables[part.Table]!;
+                Write(buffer, ref position, TableStart);
+                WriteNumber(buffer, ref position, part.Count);
+                Write(buffer, ref position, NumberOfDataChannelProperty);
+                WriteNumber(buffer, ref position, table.Channels);
+                Write(buffer, ref position, DataChannelIdProperty);
+                Write(buffer, ref position, table.DataChannelIds);
+                Write(buffer, ref position, DataSetStart);
+                WriteDataSets(buffer, ref position, scratch, part, keep);
+                Write(buffer, ref position, DataSetEnd);
+
+                if (last || _parts[i + 1].Table < 0)
+                    buffer[position++] = (byte)']';
+            }
+            else
+            {
+                if (!first || entry.DataConfiguration is not null)
+                    buffer[position++] = (byte)',';
+                Write(buffer, ref position, EventDataStart);
+                WriteNumber(buffer, ref position, part.Count);
+                Write(buffer, ref position, DataSetStart);
+                WriteDataSets(buffer, ref position, scratch, part, keep);
+                Write(buffer, ref position, DataSetEnd);
+            }
+
+            if (last)
+            {
+                if (entry.CustomData is not null)
+                {
+                    buffer[position++] = (byte)',';
+                    Write(buffer, ref position, entry.CustomData);
+                }
+                buffer[position++] = (byte)'}';
+            }
+        }
+
+        Write(buffer, ref position, PackageEnd);
+        return position;
+    }
+
+    private void WriteDataSets(byte[] buffer, ref int position, byte[] scratch, Part part, int keep)
+    {
+        for (var i = part.FirstDataSet; i < part.FirstDataSet + part.Count; i++)
+        {
+            if (i > part.FirstDataSet)
+                buffer[position++] = (byte)',';
+            var start = _dataSetStarts[i];
+            var end = i + 1 < _dataSetStarts.Count ? _dataSetStarts[i + 1] : keep;
+            Buffer.BlockCopy(scratch, start, buffer, position, end - start);
+            position += end - start;
+        }
+    }
+
+    private void WriteTabular(TsDomain.TabularDataSet dataSet)
+    {
+        _writer.Reset();
+        _writer.WriteStartObject();
+        _writer.WriteString(TimeStampName, dataSet.TimeStamp.ToString("o", CultureInfo.InvariantCulture));
+        _writer.WriteStartArray(ValueName);
+        foreach (var value in dataSet.Value)
+            _writer.WriteStringValue(value);
+        _writer.WriteEndArray();
+        if (dataSet.Quality is not null)
+        {
+            _writer.WriteStartArray(QualityName);
+            foreach (var quality in dataSet.Quality)
+                _writer.WriteStringValue(quality);
+            _writer.WriteEndArray();
+        }
+        _writer.WriteEndObject();
+        _writer.Flush();
+    }
+
+    private void WriteEvent(TsDomain.EventDataSet dataSet)
+    {
+        _writer.Reset();
+        _writer.WriteStartObject();
+        _writer.WriteString(TimeStampName, dataSet.TimeStamp.ToString("o", CultureInfo.InvariantCulture));
+        _writer.WriteString(DataChannelIdName, dataSet.DataChannelId.ToString());
+        _writer.WriteString(ValueName, dataSet.Value);
+        if (dataSet.Quality is not null)
+            _writer.WriteString(QualityName, dataSet.Quality);
+        _writer.WriteEndObject();
+        _writer.Flush();
+    }
+
+    private byte[]? SerializeHeader(TsDomain.TimeSpan? timeSpan)
+    {
+        var header = _package.Package.Header;
+        if (header is null)
+            return null;
+
+        var dto = new TsDomain.TimeSeriesDataPackage
+        {
+            Package = new TsDomain.Package { Header = header with { TimeSpan = timeSpan }, TimeSeriesData = [] },
+        }
+            .ToJsonDto()
+            .Package
+            .Header;
+        return JsonSerializer.SerializeToUtf8Bytes(dto, Serializer.Options);
+    }
+
+    private static Entry CreateEntry(TsDomain.TimeSeriesData data)
+    {
+        var dataConfiguration = data.DataConfiguration is null
+            ? null
+            : JsonSerializer.SerializeToUtf8Bytes(
+                new ConfigurationReference(data.DataConfiguration.Id, data.DataConfiguration.TimeStamp),
+                Serializer.Options
+            );
+
+        // Custom data kinds are extension data, their properties go directly into the TimeSeriesData object
+        byte[]? customData = null;
+        if (data.CustomDataKinds is { Count: > 0 })
+        {
+            var json = JsonSerializer.SerializeToUtf8Bytes(data.CustomDataKinds, Serializer.Options);
+            customData = json.AsSpan(1, json.Length - 2).ToArray();
+        }
+
+        var tables = (data.TabularData ?? [])
+            .Select(t =>
+            {
+                if (t?.DataChannelIds is null || t.DataSets is null)
+                    return null;
+                var ids = JsonSerializer.SerializeToUtf8Bytes(
+                    t.DataChannelIds.Select(i => i.ToString()).ToList(),
+                    Serializer.Options
+                );
+                return new Table(ids, t.DataChannelIds.Count);
+            })
+            .ToArray();
+
+        return new Entry(dataConfiguration, customData, tables);
+    }
+
+    private static void Write(byte[] buffer, ref int position, byte[] bytes)
+    {
+        Buffer.BlockCopy(bytes, 0, buffer, position, bytes.Length);
+        position += bytes.Length;
+    }
+
+    private static void WriteNumber(byte[] buffer, ref int position, int value)
+    {
+        var digits = Digits(value);
+        for (var i = position + digits - 1; i >= position; i--)
+        {
+            buffer[i] = (byte)('0' + value % 10);
+            value /= 10;
+        }
+        position += digits;
+    }
+
+    private static int Digits(int value)
+    {
+        var digits = 1;
+        while (value >= 10)
+        {
+            value /= 10;
+            digits++;
+        }
+        return digits;
+    }
+
+    private static byte[] Utf8(string value) => Encoding.UTF8.GetBytes(value);
+
+    /// <summary>Serialized parts of a TimeSeriesData, repeated in every chunk that has some of its data sets.</summary>
+    private sealed class Entry(byte[]? dataConfiguration, byte[]? customData, Table?[] tables)
+    {
+        public byte[]? DataConfiguration { get; } = dataConfiguration;
+
+        public byte[]? CustomData { get; } = customData;
+
+        public Table?[] Tables { get; } = tables;
+
+        /// <summary>Number of properties written without any data.</summary>
+        public int Properties { get; } = (dataConfiguration is null ? 0 : 1) + (customData is null ? 0 : 1);
+
+        /// <summary>Size of the object without any data.</summary>
+        public int FixedSize { get; } =
+            2
+            + (dataConfiguration is null ? 0 : DataConfigurationProperty.Length + dataConfiguration.Length)
+            + (customData?.Length ?? 0)
+            + (dataConfiguration is not null && customData is not null ? 1 : 0);
+    }
+
+    private sealed class Table(byte[] dataChannelIds, int channels)
+    {
+        public byte[] DataChannelIds { get; } = dataChannelIds;
+
+        public int Channels { get; } = channels;
+
+        /// <summary>Size of the table without its data sets and count.</summary>
+        public int FixedSize { get; } =
+            TableStart.Length
+            + NumberOfDataChannelProperty.Length
+            + Digits(channels)
+            + DataChannelIdProperty.Length
+            + dataChannelIds.Length
+            + DataSetStart.Length
+            + DataSetEnd.Length;
+    }
+
+    /// <summary>Consecutive data sets of one table, or of the event data when Table is -1, in the current chunk.</summary>
+    private readonly record struct Part(int Entry, int Table, int FirstDataSet, int Count);
+}
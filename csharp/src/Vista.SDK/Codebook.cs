@@ -1,4 +1,5 @@
 using System.Collections;
+using Vista.SDK.Internal;
 
 namespace Vista.SDK;
 
@@ -166,10 +167,14 @@ public enum PositionValidationResult
     Custom = 101
 }
 
+/// <summary>A standard value or group close to a looked up value, and the number of edits between them.</summary>
+public readonly record struct CodebookValueMatch(string Value, int Distance);
+
 public sealed class CodebookStandardValues : IEnumerable<string>
 {
     private readonly CodebookName _name;
     private readonly HashSet<string> _standardValues;
+    private BkTree? _fuzzyIndex;
 
     public int Count => _standardValues.Count;
 
@@ -187,6 +192,22 @@ public bool Contains(string tagValue)
         return _standardValues.Contains(tagValue);
     }
 
+    /// <summary>Finds the standard values within <paramref name="maxEdits"/> edits of a value, closest first.</summary>
+    /// <remarks>
+    /// Edits are case insensitive single character insertions, deletions and substitutions.
+    /// The index is built on the first lookup and kept for the lifetime of the codebook.
+    /// </remarks>
+    public IReadOnlyList<CodebookValueMatch> FindClosest(string value, int maxEdits = 2)
+    {
+        if (value is null)
+            throw new ArgumentNullException(nameof(value));
+        if (maxEdits < 0)
+            throw new ArgumentOutOfRangeException(nameof(maxEdits));
+
+        var index = LazyInitializer.EnsureInitialized(ref _fuzzyIndex, () => new BkTree(_standardValues))!;
+        return index.Find(value, maxEdits);
+    }
+
     public Enumerator GetEnumerator() => new Enumerator(this);
 
     IEnumerator<string> IEnumerable<string>.GetEnumerator() => new Enumerator(this);
@@ -217,6 +238,7 @@ public Enumerator(CodebookStandardValues parent)
 public sealed class CodebookGroups : IEnumerable<string>
 {
     private readonly HashSet<string> _groups;
+    private BkTree? _fuzzyIndex;
 
     internal CodebookGroups(HashSet<string> groups)
     {
@@ -227,6 +249,19 @@ internal CodebookGroups(HashSet<string> groups)
 
     public bool Contains(string group) => _groups.Contains(group);
 
+    /// <summary>Finds the groups within <paramref name="maxEdits"/> edits of a value, closest first.</summary>
+    /// <remarks>Edits are case insensitive, see <see cref="CodebookStandardValues.FindClosest"/>.</remarks>
+    public IReadOnlyList<CodebookValueMatch> FindClosest(string value, int maxEdits = 2)
+    {
+        if (value is null)
+            throw new ArgumentNullException(nameof(value));
+        if (maxEdits < 0)
+            throw new ArgumentOutOfRangeException(nameof(maxEdits));
+
+        var index = LazyInitializer.EnsureInitialized(ref _fuzzyIndex, () => new BkTree(_groups))!;
+        return index.Find(value, maxEdits);
+    }
+
     public Enumerator GetEnumerator() => new Enumerator(this);
 
     IEnumerator<string> IEnumerable<string>.GetEnumerator() => new Enumerator(this);
@@ -0,0 +1,29 @@
+using Vista.SDK.Internal;
+
+namespace Vista.SDK;
+
+/// <summary>A Gmod node matching a search, higher scores rank first.</summary>
+public readonly record struct GmodSearchResult(GmodNode Node, int Score);
+
+public sealed partial class Gmod
+{
+    private GmodSearchIndex? _searchIndex;
+
+    /// <summary>Searches nodes by code prefix, and by words of their names and definitions.</summary>
+    /// <remarks>
+    /// Matching is case insensitive. Nodes whose code starts with the query rank first, shortest codes first.
+    /// Otherwise every word of the query has to match a word of the node, exactly, as a prefix, or inside it
+    /// for query words of 3 or more characters. Names weigh more than definitions.
+    /// The index is built on the first search and kept for the lifetime of the Gmod.
+    /// </remarks>
+    public IReadOnlyList<GmodSearchResult> Search(string query, int maxResults = 10)
+    {
+        if (query is null)
+            throw new ArgumentNullException(nameof(query));
+        if (maxResults < 0)
+            throw new ArgumentOutOfRangeException(nameof(maxResults));
+
+        var index = LazyInitializer.EnsureInitialized(ref _searchIndex, () => new GmodSearchIndex(this))!;
+        return index.Search(query, maxResults);
+    }
+}
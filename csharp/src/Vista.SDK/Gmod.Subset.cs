@@ -0,0 +1,115 @@
+using System.Text.Json;
+
+namespace Vista.SDK;
+
+public sealed partial class Gmod
+{
+    /// <summary>Projects this Gmod to the nodes used by the given paths, including all of their parents.</summary>
+    /// <remarks>
+    /// The result is a standalone Gmod that only knows about the projected nodes, and can be used with
+    /// <see cref="GmodPath.Parse(string, Gmod, Locations)"/> and <see cref="LocalIdBuilder.Parse(string, Gmod, Codebooks)"/>.
+    /// Relations between projected nodes are kept in their original order, so paths parse the same as in the full Gmod.
+    /// The product type or product selection of every function leaf is projected too, so
+    /// <see cref="GmodNode.IsMappable"/> and <see cref="GmodPath.IsMappable"/> are the same as in the full Gmod.
+    /// </remarks>
+    public Gmod CreateSubset(IEnumerable<GmodPath> paths)
+    {
+        if (paths is null)
+            throw new ArgumentNullException(nameof(paths));
+
+        var codes = new HashSet<string>(StringComparer.Ordinal) { _rootNode.Code };
+        var nodes = new List<GmodNode> { _rootNode };
+
+        foreach (var path in paths)
+        {
+            if (path.VisVersion != VisVersion)
+                throw new ArgumentException(
+                    $"Path {path} is VIS version {path.VisVersion}, expected {VisVersion}",
+                    nameof(paths)
+                );
+
+            for (int i = 0; i < path.Length; i++)
+            {
+                var node = this[path[i].Code];
+                if (!codes.Add(node.Code))
+                    continue;
+                nodes.Add(node);
+
+                // Only set for a node with this single child, which a path may not include
+                var product = node.ProductType ?? node.ProductSelection;
+                if (product is not null && codes.Add(product.Code))
+                    nodes.Add(product);
+            }
+        }
+
+        return new Gmod(VisVersion, CreateDto(nodes, codes));
+    }
+
+    /// <summary>Projects this Gmod to the nodes used by the primary and secondary items of the given Local IDs.</summary>
+    public Gmod CreateSubset(IEnumerable<ILocalId> localIds)
+    {
+        if (localIds is null)
+            throw new ArgumentNullException(nameof(localIds));
+
+        return CreateSubset(
+            localIds.SelectMany(l =>
+                l.SecondaryItem is null ? new[] { l.PrimaryItem! } : new[] { l.PrimaryItem!, l.SecondaryItem }
+            )
+        );
+    }
+
+    /// <summary>Writes this Gmod as JSON, in the same format as the Gmod resources.</summary>
+    public void Serialize(Stream stream)
+    {
+        if (stream is null)
+            throw new ArgumentNullException(nameof(stream));
+
+        var nodes = this.ToList();
+        var codes = new HashSet<string>(nodes.Select(n => n.Code), StringComparer.Ordinal);
+        JsonSerializer.Serialize(stream, CreateDto(nodes, codes));
+    }
+
+    /// <summary>Reads a Gmod written by <see cref="Serialize(Stream)"/>.</summary>
+    public static Gmod Deserialize(Stream stream)
+    {
+        if (stream is null)
+            throw new ArgumentNullException(nameof(stream));
+
+        var dto =
+            JsonSerializer.Deserialize<GmodDto>(stream) ?? throw new ArgumentException("Couldn't deserialize Gmod");
+        if (!VisVersions.TryParse(dto.VisVersion, out var visVersion))
+            throw new ArgumentException("Invalid VIS version in Gmod: " + dto.VisVersion);
+
+        return new Gmod(visVersion, dto);
+    }
+
+    private GmodDto CreateDto(List<GmodNode> nodes, HashSet<string> codes)
+    {
+        var items = new GmodNodeDto[nodes.Count];
+        var relations = new List<string[]>();
+        for (int i = 0; i < nodes.Count; i++)
+        {
+            var node = nodes[i];
+            var metadata = node.Metadata;
+            items[i] = new GmodNodeDto(
+                metadata.Category,
+                metadata.Type,
+                node.Code,
+                metadata.Name,
+                metadata.CommonName,
+                metadata.Definition,
+                metadata.CommonDefinition,
+                metadata.InstallSubstructure,
+                metadata.NormalAssignmentNames
+            );
+
+            foreach (var child in node.Children)
+            {
+                if (codes.Contains(child.Code))
+                    relations.Add([node.Code, child.Code]);
+            }
+        }
+
+        return new GmodDto(VisVersion.ToVersionString(), items, relations.ToArray());
+    }
+}
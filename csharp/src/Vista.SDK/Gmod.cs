@@ -139,15 +139,16 @@ internal Gmod(VisVersion version, IReadOnlyDictionary<string, GmodNode> nodeMap)
     public bool TryGetNode(ReadOnlySpan<char> code, [MaybeNullWhen(false)] out GmodNode node) =>
         _nodeMap.TryGetValue(code, out node);
 
-    public GmodPath ParsePath(string item) => GmodPath.Parse(item, VisVersion);
+    public GmodPath ParsePath(string item) => GmodPath.Parse(item, this, VIS.Instance.GetLocations(VisVersion));
 
     public bool TryParsePath(string item, [NotNullWhen(true)] out GmodPath? path) =>
-        GmodPath.TryParse(item, VisVersion, out path);
+        GmodPath.TryParse(item, this, VIS.Instance.GetLocations(VisVersion), out path);
 
-    public GmodPath ParseFromFullPath(string item) => GmodPath.ParseFullPath(item, VisVersion);
+    public GmodPath ParseFromFullPath(string item) =>
+        GmodPath.ParseFullPath(item, this, VIS.Instance.GetLocations(VisVersion));
 
     public bool TryParseFromFullPath(string item, [NotNullWhen(true)] out GmodPath? path) =>
-        GmodPath.TryParseFullPath(item, VisVersion, out path);
+        GmodPath.TryParseFullPath(item, this, VIS.Instance.GetLocations(VisVersion), out path);
 
     public Enumerator GetEnumerator()
     {
@@ -47,19 +47,19 @@ internal GmodNode(VisVersion version, GmodNodeDto dto)
 
     internal GmodNode WithoutLocation() => Location is null ? this : this with { Location = null };
 
-    internal GmodNode WithLocation(string location)
-    {
-        var locations = VIS.Instance.GetLocations(VisVersion);
+    internal GmodNode WithLocation(string location) => WithLocation(location, VIS.Instance.GetLocations(VisVersion));
 
-        return this with
+    internal GmodNode WithLocation(string location, Locations locations) =>
+        this with
         {
             Location = locations.Parse(location)
         };
-    }
 
-    internal GmodNode TryWithLocation(string? locationStr)
+    internal GmodNode TryWithLocation(string? locationStr) =>
+        TryWithLocation(locationStr, VIS.Instance.GetLocations(VisVersion));
+
+    internal GmodNode TryWithLocation(string? locationStr, Locations locations)
     {
-        var locations = VIS.Instance.GetLocations(VisVersion);
         if (!locations.TryParse(locationStr, out var location))
             return this;
 
@@ -558,6 +558,11 @@ GmodNode target
         }
     }
 
+    public static GmodPath Parse(string item, VisContext context) => Parse(item, context.Gmod, context.Locations);
+
+    public static bool TryParse(string? item, VisContext context, [NotNullWhen(true)] out GmodPath? path) =>
+        TryParse(item, context.Gmod, context.Locations, out path);
+
     public static bool TryParse(string? item, Gmod gmod, Locations locations, [NotNullWhen(true)] out GmodPath? path)
     {
         var result = ParseInternal(item, gmod, locations);
@@ -708,6 +713,11 @@ public static GmodPath ParseFullPath(string pathStr, VisVersion visVersion)
         var vis = VIS.Instance;
         var gmod = vis.GetGmod(visVersion);
         var locations = vis.GetLocations(visVersion);
+        return ParseFullPath(pathStr, gmod, locations);
+    }
+
+    public static GmodPath ParseFullPath(string pathStr, Gmod gmod, Locations locations)
+    {
         var result = ParseFullPathInternal(pathStr.AsSpan(), gmod, locations);
 
         return result switch
@@ -718,6 +728,9 @@ public static GmodPath ParseFullPath(string pathStr, VisVersion visVersion)
         };
     }
 
+    public static GmodPath ParseFullPath(string pathStr, VisContext context) =>
+        ParseFullPath(pathStr, context.Gmod, context.Locations);
+
     public static bool TryParseFullPath(
         string? pathStr,
         VisVersion visVersion,
@@ -749,6 +762,12 @@ public static GmodPath ParseFullPath(string pathStr, VisVersion visVersion)
         [MaybeNullWhen(false)] out GmodPath path
     ) => TryParseFullPath(pathStr.AsSpan(), gmod, locations, out path);
 
+    public static bool TryParseFullPath(
+        string? pathStr,
+        VisContext context,
+        [MaybeNullWhen(false)] out GmodPath path
+    ) => TryParseFullPath(pathStr.AsSpan(), context.Gmod, context.Locations, out path);
+
     private static bool TryParseFullPath(
         ReadOnlySpan<char> span,
         Gmod gmod,
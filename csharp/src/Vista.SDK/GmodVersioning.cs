@@ -1,22 +1,56 @@
+using System.Collections.Concurrent;
 using System.Diagnostics.CodeAnalysis;
+using Vista.SDK.Transport.DataChannel;
 
 namespace Vista.SDK;
 
 internal sealed class GmodVersioning
 {
-    private readonly Dictionary<VisVersion, GmodVersioningNode> _versioningsMap = new();
+    // Version steps by their target version, each is loaded on first use
+    private readonly Dictionary<VisVersion, Lazy<GmodVersioningNode?>> _versioningsMap = new();
+    private readonly Func<VisVersion, Gmod> _getGmod;
 
-    internal GmodVersioning(Dictionary<string, GmodVersioningDto> dto)
+    // Gmods of each version hop, resolved once instead of per converted node
+    private readonly ConcurrentDictionary<VisVersion, Gmod> _gmods = new();
+
+    internal GmodVersioning(Func<VisVersion, GmodVersioningDto?> getDto, Func<VisVersion, Gmod> getGmod)
     {
-        foreach (var kvp in dto)
+        _getGmod = getGmod;
+        foreach (var visVersion in VisVersions.All)
         {
-            var parsedVersion = VisVersions.Parse(kvp.Key);
-            var gmodVersioningNode = new GmodVersioningNode(parsedVersion, kvp.Value.Items);
-            _versioningsMap.Add(parsedVersion, gmodVersioningNode);
+            _versioningsMap.Add(
+                visVersion,
+                new Lazy<GmodVersioningNode?>(
+                    () => getDto(visVersion) is { } dto ? new GmodVersioningNode(visVersion, dto.Items) : null,
+                    LazyThreadSafetyMode.ExecutionAndPublication
+                )
+            );
         }
     }
 
-    public GmodNode? ConvertNode(VisVersion sourceVersion, GmodNode sourceNode, VisVersion targetVersion)
+    public GmodNode? ConvertNode(VisVersion sourceVersion, GmodNode sourceNode, VisVersion targetVersion) =>
+        ConvertNode(sourceVersion, sourceNode, targetVersion, null);
+
+    private GmodNode? ConvertNode(
+        VisVersion sourceVersion,
+        GmodNode sourceNode,
+        VisVersion targetVersion,
+        ConversionCache? cache
+    )
+    {
+        if (cache is null)
+            return ConvertNodeUncached(sourceVersion, sourceNode, targetVersion);
+
+        var key = (sourceVersion, sourceNode);
+        if (cache.Nodes.TryGetValue(key, out var node))
+            return node;
+
+        node = ConvertNodeUncached(sourceVersion, sourceNode, targetVersion);
+        cache.Nodes.TryAdd(key, node);
+        return node;
+    }
+
+    private GmodNode? ConvertNodeUncached(VisVersion sourceVersion, GmodNode sourceNode, VisVersion targetVersion)
     {
         ValidateSourceAndTargetVersions(sourceVersion, targetVersion);
 
@@ -51,7 +85,7 @@ internal GmodVersioning(Dictionary<string, GmodVersioningDto> dto)
             }
         }
 
-        var targetGmod = VIS.Instance.GetGmod(targetVersion);
+        var targetGmod = GetGmod(targetVersion);
 
         if (!targetGmod.TryGetNode(nextCode, out var targetNode))
             return null;
@@ -61,7 +95,14 @@ internal GmodVersioning(Dictionary<string, GmodVersioningDto> dto)
         return result;
     }
 
-    public LocalIdBuilder? ConvertLocalId(LocalIdBuilder sourceLocalId, VisVersion targetVersion)
+    public LocalIdBuilder? ConvertLocalId(LocalIdBuilder sourceLocalId, VisVersion targetVersion) =>
+        ConvertLocalId(sourceLocalId, targetVersion, null);
+
+    private LocalIdBuilder? ConvertLocalId(
+        LocalIdBuilder sourceLocalId,
+        VisVersion targetVersion,
+        ConversionCache? cache
+    )
     {
         if (sourceLocalId.VisVersion is null)
             throw new InvalidOperationException("Cant convert local ID without a specific VIS version");
@@ -73,7 +114,8 @@ internal GmodVersioning(Dictionary<string, GmodVersioningDto> dto)
             var targetPrimaryitem = ConvertPath(
                 sourceLocalId.VisVersion.Value,
                 sourceLocalId.PrimaryItem,
-                targetVersion
+                targetVersion,
+                cache
             );
             if (targetPrimaryitem is null)
                 return null;
@@ -84,7 +126,8 @@ internal GmodVersioning(Dictionary<string, GmodVersioningDto> dto)
             var targetSecondaryitem = ConvertPath(
                 sourceLocalId.VisVersion.Value,
                 sourceLocalId.SecondaryItem,
-                targetVersion
+                targetVersion,
+                cache
             );
             if (targetSecondaryitem is null)
                 return null;
@@ -106,21 +149,122 @@ internal GmodVersioning(Dictionary<string, GmodVersioningDto> dto)
     public LocalId? ConvertLocalId(LocalId sourceLocalId, VisVersion targetVersion) =>
         ConvertLocalId(sourceLocalId.Builder, targetVersion)?.Build();
 
-    public GmodPath? ConvertPath(VisVersion sourceVersion, GmodPath sourcePath, VisVersion targetVersion)
+    public DataChannelListConversionResult ConvertDataChannelList(
+        DataChannelList sourceList,
+        VisVersion targetVersion,
+        bool parallel
+    )
     {
-        var targetEndNode = ConvertNode(sourceVersion, sourcePath.Node, targetVersion);
+        // Node and path conversions are shared across the whole list, since channels
+        // typically share most of their path structure and often the exact same items
+        var cache = new ConversionCache();
+        var channels = sourceList.DataChannels;
+        var converted = new DataChannel?[channels.Count];
+        var errors = new string?[channels.Count];
+
+        void Convert(int i)
+        {
+            var channel = channels[i];
+            var sourceLocalId = channel.DataChannelId.LocalId;
+            if (sourceLocalId.VisVersion == targetVersion)
+            {
+                converted[i] = channel;
+                return;
+            }
+
+            try
+            {
+                var targetLocalId = ConvertLocalId(sourceLocalId.Builder, targetVersion, cache);
+                if (targetLocalId is null)
+                    errors[i] = $"Failed to convert {sourceLocalId} to {targetVersion.ToVersionString()}";
+                else
+                    converted[i] = channel with
+                    {
+                        DataChannelId = channel.DataChannelId with { LocalId = targetLocalId.Build() }
+                    };
+            }
+            catch (Exception e)
+            {
+                errors[i] = e.Message;
+            }
+        }
+
+        if (parallel)
+            Parallel.For(0, channels.Count, Convert);
+        else
+            for (int i = 0; i < channels.Count; i++)
+                Convert(i);
+
+        var targetList = new DataChannelList();
+        var failed = new List<DataChannelConversionError>();
+        for (int i = 0; i < channels.Count; i++)
+        {
+            var channel = converted[i];
+            if (channel is null)
+            {
+                failed.Add(new DataChannelConversionError(channels[i], errors[i]!));
+                continue;
+            }
+            if (targetList.TryGetByLocalId(channel.DataChannelId.LocalId, out var existing))
+            {
+                failed.Add(
+                    new DataChannelConversionError(
+                        channels[i],
+                        $"Converted LocalId {channel.DataChannelId.LocalId} collides with channel {existing.DataChannelId.ShortId ?? existing.DataChannelId.LocalId.ToString()}"
+                    )
+                );
+                continue;
+            }
+            targetList.Add(channel);
+        }
+
+        return new DataChannelListConversionResult(targetList, failed);
+    }
+
+    public GmodPath? ConvertPath(VisVersion sourceVersion, GmodPath sourcePath, VisVersion targetVersion) =>
+        ConvertPath(sourceVersion, sourcePath, targetVersion, null);
+
+    private GmodPath? ConvertPath(
+        VisVersion sourceVersion,
+        GmodPath sourcePath,
+        VisVersion targetVersion,
+        ConversionCache? cache
+    )
+    {
+        if (cache is null)
+            return ConvertPathUncached(sourceVersion, sourcePath, targetVersion, null);
+
+        var key = (sourceVersion, sourcePath);
+        if (cache.Paths.TryGetValue(key, out var path))
+            return path;
+
+        path = ConvertPathUncached(sourceVersion, sourcePath, targetVersion, cache);
+        cache.Paths.TryAdd(key, path);
+        return path;
+    }
+
+    private GmodPath? ConvertPathUncached(
+        VisVersion sourceVersion,
+        GmodPath sourcePath,
+        VisVersion targetVersion,
+        ConversionCache? cache
+    )
+    {
+        var targetEndNode = ConvertNode(sourceVersion, sourcePath.Node, targetVersion, cache);
         if (targetEndNode is null)
             return null;
 
         if (targetEndNode.IsRoot)
             return new GmodPath(targetEndNode._parents, targetEndNode, skipVerify: true);
 
-        var targetGmod = VIS.Instance.GetGmod(targetVersion);
-        var sourceGmod = VIS.Instance.GetGmod(sourceVersion);
+        var targetGmod = GetGmod(targetVersion);
+        var sourceGmod = GetGmod(sourceVersion);
 
         var qualifyingNodes = sourcePath
             .GetFullPath()
-            .Select((t, i) => (SourceNode: t.Node, TargetNode: ConvertNode(sourceVersion, t.Node, targetVersion)!))
+            .Select(
+                (t, i) => (SourceNode: t.Node, TargetNode: ConvertNode(sourceVersion, t.Node, targetVersion, cache)!)
+            )
             .ToArray();
         if (qualifyingNodes.Any(t => t.TargetNode is null))
             throw new Exception("Could convert node forward");
@@ -332,10 +476,25 @@ static void AddToPath(Gmod targetGmod, List<GmodNode> path, GmodNode node)
         return new GmodPath(potentialParents, targetEndNode);
     }
 
-    private bool TryGetVersioningNode(
-        VisVersion visVersion,
-        [MaybeNullWhen(false)] out GmodVersioningNode versioningNode
-    ) => _versioningsMap.TryGetValue(visVersion, out versioningNode);
+    private sealed class ConversionCache
+    {
+        public readonly ConcurrentDictionary<(VisVersion, GmodNode), GmodNode?> Nodes = new();
+        public readonly ConcurrentDictionary<(VisVersion, GmodPath), GmodPath?> Paths = new();
+    }
+
+    private bool TryGetVersioningNode(VisVersion visVersion, out GmodVersioningNode versioningNode)
+    {
+        if (_versioningsMap.TryGetValue(visVersion, out var step) && step.Value is { } node)
+        {
+            versioningNode = node;
+            return true;
+        }
+
+        versioningNode = default;
+        return false;
+    }
+
+    private Gmod GetGmod(VisVersion visVersion) => _gmods.GetOrAdd(visVersion, _getGmod);
 
     private void ValidateSourceAndTargetVersions(VisVersion sourceVersion, VisVersion targetVersion)
     {
@@ -367,40 +526,45 @@ internal GmodVersioningNode(VisVersion visVersion, IReadOnlyDictionary<string, G
             foreach (var versioningNodeDto in dto)
             {
                 var code = versioningNodeDto.Key;
-                var versioningNodeChanges = new GmodNodeConversion
-                {
-                    Operations = new(versioningNodeDto.Value.Operations.Select(ParseConversionType)),
-                    Source = versioningNodeDto.Value.Source,
-                    Target = versioningNodeDto.Value.Target,
-                    OldAssignment = versioningNodeDto.Value.OldAssignment,
-                    NewAssignment = versioningNodeDto.Value.NewAssignment,
-                    DeleteAssignment = versioningNodeDto.Value.DeleteAssignment,
-                };
+                var operations = ConversionType.None;
+                foreach (var operation in versioningNodeDto.Value.Operations)
+                    operations |= ParseConversionType(operation);
+
+                var versioningNodeChanges = new GmodNodeConversion(
+                    operations,
+                    versioningNodeDto.Value.Source,
+                    versioningNodeDto.Value.Target,
+                    versioningNodeDto.Value.OldAssignment,
+                    versioningNodeDto.Value.NewAssignment,
+                    versioningNodeDto.Value.DeleteAssignment
+                );
                 _versioningNodeChanges.Add(code, versioningNodeChanges);
             }
         }
 
-        public bool TryGetCodeChanges(string code, [MaybeNullWhen(false)] out GmodNodeConversion nodeChanges) =>
+        public bool TryGetCodeChanges(string code, out GmodNodeConversion nodeChanges) =>
             _versioningNodeChanges.TryGetValue(code, out nodeChanges);
     }
 
-    private sealed record GmodNodeConversion
-    {
-        public required HashSet<ConversionType> Operations { get; init; }
-        public required string Source { get; init; }
-        public string? Target { get; init; }
-        public string? OldAssignment { get; set; }
-        public string? NewAssignment { get; set; }
-        public bool? DeleteAssignment { get; set; }
-    }
-
-    private enum ConversionType
+    /// <summary>Change of a node code in a version step, stored inline in the step dictionary.</summary>
+    private readonly record struct GmodNodeConversion(
+        ConversionType Operations,
+        string Source,
+        string? Target,
+        string? OldAssignment,
+        string? NewAssignment,
+        bool? DeleteAssignment
+    );
+
+    [Flags]
+    private enum ConversionType : byte
     {
-        ChangeCode,
-        Merge,
-        Move,
-        AssignmentChange = 20,
-        AssignmentDelete = 21
+        None = 0,
+        ChangeCode = 1 << 0,
+        Merge = 1 << 1,
+        Move = 1 << 2,
+        AssignmentChange = 1 << 3,
+        AssignmentDelete = 1 << 4,
     }
 
     private static ConversionType ParseConversionType(string type) =>
@@ -0,0 +1,110 @@
+namespace Vista.SDK.Internal;
+
+/// <summary>BK-tree of strings by case insensitive Levenshtein distance.</summary>
+/// <remarks>
+/// Children are keyed by their distance to the parent. By the triangle inequality, values within k edits of a query
+/// at distance d of a node can only be under the children keyed d - k to d + k, the other subtrees are skipped.
+/// The tree is immutable once built.
+/// </remarks>
+internal sealed class BkTree
+{
+    private readonly string[] _values;
+    private readonly string[] _keys;
+    private readonly List<(int Distance, int Node)>?[] _children;
+
+    public BkTree(IEnumerable<string> values)
+    {
+        // Sorted for a tree shape that doesn't depend on hash set order
+        _values = values.ToArray();
+        Array.Sort(_values, StringComparer.Ordinal);
+        _keys = _values.Select(v => v.ToLowerInvariant()).ToArray();
+        _children = new List<(int, int)>?[_values.Length];
+
+        for (var i = 1; i < _values.Length; i++)
+        {
+            var node = 0;
+            while (true)
+            {
+                var distance = Distance(_keys[i], _keys[node]);
+                var children = _children[node] ??= [];
+
+                var next = -1;
+                foreach (var child in children)
+                {
+                    if (child.Distance == distance)
+                    {
+                        next = child.Node;
+                        break;
+                    }
+                }
+
+                if (next < 0)
+                {
+                    children.Add((distance, i));
+                    break;
+                }
+                node = next;
+            }
+        }
+    }
+
+    /// <summary>The values within <paramref name="maxEdits"/> edits, closest first, then ordinal.</summary>
+    public List<CodebookValueMatch> Find(string value, int maxEdits)
+    {
+        var matches = new List<CodebookValueMatch>();
+        if (_values.Length == 0)
+            return matches;
+
+        var key = value.ToLowerInvariant();
+        var stack = new Stack<int>();
+        stack.Push(0);
+        while (stack.Count > 0)
+        {
+            var node = stack.Pop();
+            var distance = Distance(key, _keys[node]);
+            if (distance <= maxEdits)
+                matches.Add(new CodebookValueMatch(_values[node], distance));
+
+            var children = _children[node];
+            if (children is null)
+                continue;
+            foreach (var child in children)
+            {
+                if (Math.Abs(child.Distance - distance) <= maxEdits)
+                    stack.Push(child.Node);
+            }
+        }
+
+        matches.Sort(
+            (a, b) => a.Distance != b.Distance ? a.Distance - b.Distance : string.CompareOrdinal(a.Value, b.Value)
+        );
+        return matches;
+    }
+
+    /// <summary>Levenshtein distance, with a single row of the matrix.</summary>
+    internal static int Distance(string a, string b)
+    {
+        if (a.Length < b.Length)
+            (a, b) = (b, a);
+        if (b.Length == 0)
+            return a.Length;
+
+        Span<int> row = b.Length < 128 ? stackalloc int[b.Length + 1] : new int[b.Length + 1];
+        for (var j = 0; j <= b.Length; j++)
+            row[j] = j;
+
+        for (var i = 1; i <= a.Length; i++)
+        {
+            var diagonal = row[0];
+            row[0] = i;
+            for (var j = 1; j <= b.Length; j++)
+            {
+                var above = row[j];
+                var cost = a[i - 1] == b[j - 1] ? 0 : 1;
+                row[j] = Math.Min(Math.Min(above + 1, row[j - 1] + 1), diagonal + cost);
+                diagonal = above;
+            }
+        }
+        return row[b.Length];
+    }
+}
@@ -0,0 +1,321 @@
+namespace Vista.SDK.Internal;
+
+/// <summary>Search index over the codes, names and definitions of the nodes of a Gmod.</summary>
+/// <remarks>
+/// Codes are kept sorted, so the nodes with a code prefix are a contiguous range found by binary search.
+/// Names and definitions are split into lowercase words with postings to their nodes. Short query words match
+/// word prefixes from the sorted word list, longer ones are looked up through trigram postings of the words.
+/// The index is immutable, searches only use thread local scratch space.
+/// </remarks>
+internal sealed class GmodSearchIndex
+{
+    internal const int CodeExact = 1000;
+    internal const int CodePrefix = 500;
+
+    private const int NameWeight = 3;
+    private const int DefinitionWeight = 1;
+
+    private const int ExactWord = 3;
+    private const int PrefixWord = 2;
+    private const int InsideWord = 1;
+
+    private const int MinTrigramLength = 3;
+
+    private readonly GmodNode[] _nodes;
+
+    private readonly string[] _codes;
+    private readonly int[] _codeNodes;
+
+    private readonly string[] _words;
+    private readonly Posting[][] _postings;
+    private readonly Dictionary<long, int[]> _trigrams;
+
+    [ThreadStatic]
+    private static Scratch? _scratch;
+
+    public GmodSearchIndex(Gmod gmod)
+    {
+        _nodes = gmod.ToArray();
+
+        var codes = new (string Code, int Node)[_nodes.Length];
+        var words = new Dictionary<string, List<Posting>>(StringComparer.Ordinal);
+        for (var i = 0; i < _nodes.Length; i++)
+        {
+            var node = _nodes[i];
+            codes[i] = (node.Code.ToLowerInvariant(), i);
+
+            var metadata = node.Metadata;
+            AddWords(words, i, metadata.Name, NameWeight);
+            AddWords(words, i, metadata.CommonName, NameWeight);
+            AddWords(words, i, metadata.Definition, DefinitionWeight);
+            AddWords(words, i, metadata.CommonDefinition, DefinitionWeight);
+        }
+
+        Array.Sort(codes, (a, b) => string.CompareOrdinal(a.Code, b.Code));
+        _codes = codes.Select(c => c.Code).ToArray();
+        _codeNodes = codes.Select(c => c.Node).ToArray();
+
+        _words = words.Keys.ToArray();
+        Array.Sort(_words, StringComparer.Ordinal);
+        _postings = _words.Select(w => words[w].ToArray()).ToArray();
+
+        var trigrams = new Dictionary<long, List<int>>();
+        for (var w = 0; w < _words.Length; w++)
+        {
+            var word = _words[w];
+            for (var i = 0; i + MinTrigramLength <= word.Length; i++)
+            {
+                var key = Trigram(word, i);
+                if (!trigrams.TryGetValue(key, out var list))
+                    trigrams[key] = list = [];
+                // Words are visited in order, so a repeated trigram of the same word is always the last entry
+                if (list.Count == 0 || list[list.Count - 1] != w)
+                    list.Add(w);
+            }
+        }
+        _trigrams = trigrams.ToDictionary(kvp => kvp.Key, kvp => kvp.Value.ToArray());
+    }
+
+    public IReadOnlyList<GmodSearchResult> Search(string query, int maxResults)
+    {
+        var text = query.Trim().ToLowerInvariant();
+        if (text.Length == 0 || maxResults == 0)
+            return [];
+
+        var first = LowerBound(_codes, text);
+        var end = first;
+        while (end < _codes.Length && _codes[end].StartsWith(text, StringComparison.Ordinal))
+            end++;
+
+        // Code matches always outrank word matches, there is only room for words when few codes match
+        var tokens = end - first < maxResults ? Tokenize(text) : [];
+        var scratch = _scratch ??= new Scratch();
+        scratch.Begin(_nodes.Length);
+        for (var k = 0; k < tokens.Count; k++)
+            MatchToken(scratch, tokens[k], k);
+
+        var results = new TopResults(maxResults);
+        for (var i = first; i < end; i++)
+        {
+            var node = _codeNodes[i];
+            var code = _codes[i];
+            var score =
+                code.Length == text.Length ? CodeExact : CodePrefix - Math.Min(code.Length - text.Length, 100);
+            if (tokens.Count > 0 && scratch.Matches(node, tokens.Count))
+                score = Math.Max(score, scratch.Text[node]);
+            results.Offer(_nodes[node], score);
+        }
+
+        if (tokens.Count > 0)
+        {
+            foreach (var node in scratch.Candidates)
+            {
+                if (!scratch.Matches(node, tokens.Count))
+                    continue;
+                // Already offered as a code match
+                if (end > first && _nodes[node].Code.StartsWith(text, StringComparison.OrdinalIgnoreCase))
+                    continue;
+                results.Offer(_nodes[node], scratch.Text[node]);
+            }
+        }
+
+        return results.ToList();
+    }
+
+    /// <summary>Scores the nodes that matched every previous token for token <paramref name="k"/>.</summary>
+    private void MatchToken(Scratch scratch, string token, int k)
+    {
+        var matches = scratch.Words;
+        matches.Clear();
+
+        if (token.Length < MinTrigramLength)
+        {
+            for (var w = LowerBound(_words, token); w < _words.Length; w++)
+            {
+                var word = _words[w];
+                if (!word.StartsWith(token, StringComparison.Ordinal))
+                    break;
+                matches.Add((w, word.Length == token.Length ? ExactWord : PrefixWord));
+            }
+        }
+        else
+        {
+            // Every word containing the token is in the postings of each of its trigrams, the rarest is enough
+            int[]? rarest = null;
+            for (var i = 0; i + MinTrigramLength <= token.Length; i++)
+            {
+                if (!_trigrams.TryGetValue(Trigram(token, i), out var words))
+                    return;
+                if (rarest is null || words.Length < rarest.Length)
+                    rarest = words;
+            }
+
+            foreach (var w in rarest!)
+            {
+                var word = _words[w];
+                var at = word.IndexOf(token, StringComparison.Ordinal);
+                if (at < 0)
+                    continue;
+                matches.Add((w, at > 0 ? InsideWord : word.Length == token.Length ? ExactWord : PrefixWord));
+            }
+        }
+
+        foreach (var (w, kind) in matches)
+        {
+            foreach (var posting in _postings[w])
+                scratch.Score(posting.Node, k, kind * posting.Weight);
+        }
+    }
+
+    private static int LowerBound(string[] sorted, string value)
+    {
+        int lo = 0,
+            hi = sorted.Length;
+        while (lo < hi)
+        {
+            var mid = lo + (hi - lo) / 2;
+            if (string.CompareOrdinal(sorted[mid], value) < 0)
+                lo = mid + 1;
+            else
+                hi = mid;
+        }
+        return lo;
+    }
+
+    private static long Trigram(string word, int index) =>
+        (long)word[index] << 32 | (long)word[index + 1] << 16 | word[index + 2];
+
+    private static void AddWords(Dictionary<string, List<Posting>> words, int node, string? text, int weight)
+    {
+        if (string.IsNullOrEmpty(text))
+            return;
+
+        foreach (var word in Tokenize(text!.ToLowerInvariant()))
+        {
+            if (!words.TryGetValue(word, out var postings))
+                words[word] = postings = [];
+
+            // Nodes are added in order, a word seen again for the same node keeps its best weight
+            if (postings.Count > 0 && postings[postings.Count - 1].Node == node)
+            {
+                if (postings[postings.Count - 1].Weight < weight)
+                    postings[postings.Count - 1] = new Posting(node, weight);
+            }
+            else
+            {
+                postings.Add(new Posting(node, weight));
+            }
+        }
+    }
+
+    /// <summary>Splits lowercase text into words of letters and digits.</summary>
+    internal static List<string> Tokenize(string text)
+    {
+        var words = new List<string>();
+        var start = -1;
+        for (var i = 0; i <= text.Length; i++)
+        {
+            var isWord = i < text.Length && char.IsLetterOrDigit(text[i]);
+            if (isWord && start < 0)
+            {
+                start = i;
+            }
+            else if (!isWord && start >= 0)
+            {
+                words.Add(text.Substring(start, i - start));
+                start = -1;
+            }
+        }
+        return words;
+    }
+
+    private readonly record struct Posting(int Node, int Weight);
+
+    /// <summary>Per thread score arrays, entries are only valid when their stamp is the current search.</summary>
+    private sealed class Scratch
+    {
+        public int[] Stamp = [];
+        public int[] Matched = [];
+        public int[] Text = [];
+        public int[] Best = [];
+        public readonly List<int> Candidates = [];
+        public readonly List<(int Word, int Kind)> Words = [];
+        private int _current;
+
+        public void Begin(int nodes)
+        {
+            if (Stamp.Length < nodes)
+            {
+                Stamp = new int[nodes];
+                Matched = new int[nodes];
+                Text = new int[nodes];
+                Best = new int[nodes];
+            }
+            if (++_current == int.MaxValue)
+            {
+                Array.Clear(Stamp, 0, Stamp.Length);
+                _current = 1;
+            }
+            Candidates.Clear();
+        }
+
+        public bool Matches(int node, int tokens) => Stamp[node] == _current && Matched[node] == tokens;
+
+        /// <summary>Keeps the best score of token k, for nodes that matched all tokens before it.</summary>
+        public void Score(int node, int k, int score)
+        {
+            if (Stamp[node] != _current)
+            {
+                if (k > 0)
+                    return;
+                Stamp[node] = _current;
+                Matched[node] = 0;
+                Text[node] = 0;
+                Candidates.Add(node);
+            }
+
+            if (Matched[node] == k)
+            {
+                Matched[node] = k + 1;
+                Text[node] += score;
+                Best[node] = score;
+            }
+            else if (Matched[node] == k + 1 && score > Best[node])
+            {
+                Text[node] += score - Best[node];
+                Best[node] = score;
+            }
+        }
+    }
+
+    /// <summary>The best results so far, by score, then shortest code, then code.</summary>
+    private sealed class TopResults(int capacity)
+    {
+        private readonly List<GmodSearchResult> _results = new(Math.Min(capacity, 64));
+
+        public void Offer(GmodNode node, int score)
+        {
+            var result = new GmodSearchResult(node, score);
+            if (_results.Count == capacity && !Before(result, _results[_results.Count - 1]))
+                return;
+
+            var i = _results.Count;
+            while (i > 0 && Before(result, _results[i - 1]))
+                i--;
+            if (_results.Count == capacity)
+                _results.RemoveAt(_results.Count - 1);
+            _results.Insert(i, result);
+        }
+
+        private static bool Before(in GmodSearchResult x, in GmodSearchResult y)
+        {
+            if (x.Score != y.Score)
+                return x.Score > y.Score;
+            if (x.Node.Code.Length != y.Node.Code.Length)
+                return x.Node.Code.Length < y.Node.Code.Length;
+            return string.CompareOrdinal(x.Node.Code, y.Node.Code) < 0;
+        }
+
+        public List<GmodSearchResult> ToList() => _results;
+    }
+}
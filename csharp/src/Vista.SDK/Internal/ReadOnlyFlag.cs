@@ -0,0 +1,30 @@
+namespace Vista.SDK.Internal;
+
+/// <summary>Marks a record as read-only, once it's shared e.g. by a read-only DataChannelList.</summary>
+/// <remarks>
+/// The flag holds the record it was set on, so a copy made with a <c>with</c> expression, which copies the flag
+/// along with the other fields, is not read-only. Every flag is equal, so it doesn't change the record's equality.
+/// </remarks>
+internal struct ReadOnlyFlag : IEquatable<ReadOnlyFlag>
+{
+    private object? _owner;
+
+    public void Set(object owner) => _owner = owner;
+
+    public readonly bool IsSet(object owner) => ReferenceEquals(_owner, owner);
+
+    /// <summary>Returns the value to assign to a property of <paramref name="owner"/>.</summary>
+    /// <exception cref="NotSupportedException"><paramref name="owner"/> is read-only.</exception>
+    public readonly T Check<T>(object owner, T value)
+    {
+        if (IsSet(owner))
+            throw new NotSupportedException($"The {owner.GetType().Name} is read-only");
+        return value;
+    }
+
+    public readonly bool Equals(ReadOnlyFlag other) => true;
+
+    public override readonly bool Equals(object? obj) => obj is ReadOnlyFlag;
+
+    public override readonly int GetHashCode() => 0;
+}
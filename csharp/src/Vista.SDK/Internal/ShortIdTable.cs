@@ -0,0 +1,184 @@
+using System.Diagnostics.CodeAnalysis;
+using System.Runtime.CompilerServices;
+
+namespace Vista.SDK.Internal;
+
+/// <summary>128-bit key of a UUID shaped ShortId, e.g. "aa9279e1-d61c-5382-ada4-ab30a6bbdc0b".</summary>
+/// <remarks>
+/// Only the canonical lowercase form is accepted, so two ShortIds have equal keys exactly when
+/// their strings are ordinally equal. Everything else stays a plain string ShortId.
+/// </remarks>
+internal readonly record struct ShortIdKey(ulong High, ulong Low)
+{
+    public const int Length = 36;
+
+    public static bool TryParse(ReadOnlySpan<char> value, out ShortIdKey key)
+    {
+        key = default;
+        if (value.Length != Length || value[8] != '-' || value[13] != '-' || value[18] != '-' || value[23] != '-')
+            return false;
+
+        ulong high = 0;
+        ulong low = 0;
+        var digits = 0;
+        for (var i = 0; i < Length; i++)
+        {
+            if (i == 8 || i == 13 || i == 18 || i == 23)
+                continue;
+
+            var ch = value[i];
+            uint digit;
+            if ((uint)(ch - '0') <= 9)
+                digit = (uint)(ch - '0');
+            else if ((uint)(ch - 'a') <= 5)
+                digit = (uint)(ch - 'a' + 10);
+            else
+                return false;
+
+            if (digits++ < 16)
+                high = (high << 4) | digit;
+            else
+                low = (low << 4) | digit;
+        }
+
+        key = new ShortIdKey(high, low);
+        return true;
+    }
+}
+
+/// <summary>Open addressing hash table with linear probing, keyed by <see cref="ShortIdKey"/>.</summary>
+internal sealed class ShortIdTable<TValue>
+    where TValue : class
+{
+    private const int MinSize = 8;
+
+    private ShortIdKey[] _keys;
+    private TValue?[] _values;
+    private int _count;
+    private int _shift;
+
+    public ShortIdTable(int capacity = 0)
+    {
+        _keys = [];
+        _values = [];
+        Resize(capacity);
+    }
+
+    public int Count => _count;
+
+    /// <summary>Grows the table once so <paramref name="capacity"/> keys fit without resizing.</summary>
+    public void EnsureCapacity(int capacity)
+    {
+        if (capacity * 2 > _keys.Length)
+            Resize(capacity);
+    }
+
+    public bool TryGetValue(in ShortIdKey key, [MaybeNullWhen(false)] out TValue value)
+    {
+        var keys = _keys;
+        var values = _values;
+        var mask = keys.Length - 1;
+        for (var i = Index(key); ; i = (i + 1) & mask)
+        {
+            value = values[i];
+            if (value is null)
+                return false;
+            if (keys[i] == key)
+                return true;
+        }
+    }
+
+    public bool TryAdd(in ShortIdKey key, TValue value)
+    {
+        if (value is null)
+            throw new ArgumentNullException(nameof(value));
+
+        // Keep the load factor at or below 1/2 so probe sequences stay short
+        if ((_count + 1) * 2 > _keys.Length)
+            Resize(_count + 1);
+
+        var mask = _keys.Length - 1;
+        var i = Index(key);
+        for (; _values[i] is not null; i = (i + 1) & mask)
+        {
+            if (_keys[i] == key)
+                return false;
+        }
+
+        _keys[i] = key;
+        _values[i] = value;
+        _count++;
+        return true;
+    }
+
+    public bool Remove(in ShortIdKey key)
+    {
+        var mask = _keys.Length - 1;
+        var i = Index(key);
+        for (; ; i = (i + 1) & mask)
+        {
+            if (_values[i] is null)
+                return false;
+            if (_keys[i] == key)
+                break;
+        }
+
+        // Backward shift deletion: move later entries of the probe sequence into the hole, no tombstones needed
+        for (var j = (i + 1) & mask; _values[j] is not null; j = (j + 1) & mask)
+        {
+            var home = Index(_keys[j]);
+            var movable = i <= j ? home <= i || home > j : home <= i && home > j;
+            if (!movable)
+                continue;
+
+            _keys[i] = _keys[j];
+            _values[i] = _values[j];
+            i = j;
+        }
+
+        _keys[i] = default;
+        _values[i] = null;
+        _count--;
+        return true;
+    }
+
+    public void Clear()
+    {
+        Array.Clear(_keys, 0, _keys.Length);
+        Array.Clear(_values, 0, _values.Length);
+        _count = 0;
+    }
+
+    private void Resize(int capacity)
+    {
+        var size = MinSize;
+        while (size < capacity * 2)
+            size *= 2;
+
+        var keys = _keys;
+        var values = _values;
+        _keys = new ShortIdKey[size];
+        _values = new TValue?[size];
+        _shift = 64 - Log2(size);
+        _count = 0;
+
+        for (var i = 0; i < keys.Length; i++)
+        {
+            var value = values[i];
+            if (value is not null)
+                TryAdd(keys[i], value);
+        }
+    }
+
+    // Fibonacci hashing of both halves, UUIDs are already well distributed but not in any particular bits
+    [MethodImpl(MethodImplOptions.AggressiveInlining)]
+    private int Index(in ShortIdKey key) => (int)(((key.High ^ (key.Low * 31)) * 0x9E3779B97F4A7C15UL) >> _shift);
+
+    private static int Log2(int value)
+    {
+        var log = 0;
+        while ((1 << log) < value)
+            log++;
+        return log;
+    }
+}
@@ -76,6 +76,9 @@ public bool Equals(LocalId? other)
 
     public static LocalId Parse(string localIdStr) => LocalIdBuilder.Parse(localIdStr).Build();
 
+    public static LocalId Parse(string localIdStr, VisContext context) =>
+        LocalIdBuilder.Parse(localIdStr, context).Build();
+
     public static bool TryParse(string localIdStr, out ParsingErrors errors, [MaybeNullWhen(false)] out LocalId localId)
     {
         if (!LocalIdBuilder.TryParse(localIdStr, out errors, out var localIdBuilder))
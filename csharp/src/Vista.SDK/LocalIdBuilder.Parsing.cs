@@ -58,8 +58,92 @@ public static bool TryParse(string localIdStr, [MaybeNullWhen(false)] out LocalI
         return result;
     }
 
+    /// <summary>Parses a Local ID against the given Gmod and Codebooks, e.g. a Gmod subset.</summary>
+    public static LocalIdBuilder Parse(string localIdStr, Gmod gmod, Codebooks codebooks)
+    {
+        if (!TryParse(localIdStr, gmod, codebooks, out var errors, out var localId))
+            throw new ArgumentException($"Couldn't parse local ID from: '{localIdStr}'. {errors}");
+
+        return localId;
+    }
+
+    public static bool TryParse(
+        string localIdStr,
+        Gmod gmod,
+        Codebooks codebooks,
+        [MaybeNullWhen(false)] out LocalIdBuilder localId
+    ) => TryParse(localIdStr, gmod, codebooks, out _, out localId);
+
+    public static bool TryParse(
+        string localIdStr,
+        Gmod gmod,
+        Codebooks codebooks,
+        out ParsingErrors errors,
+        [MaybeNullWhen(false)] out LocalIdBuilder localId
+    )
+    {
+        if (gmod is null)
+            throw new ArgumentNullException(nameof(gmod));
+        if (codebooks is null)
+            throw new ArgumentNullException(nameof(codebooks));
+
+        var errorBuilder = LocalIdParsingErrorBuilder.Empty;
+
+        var result = TryParseInternal(localIdStr, gmod, codebooks, null, ref errorBuilder, out localId);
+        errors = errorBuilder.Build();
+        return result;
+    }
+
+    /// <summary>Parses a Local ID against the Gmod and Codebooks of <paramref name="context"/>.</summary>
+    public static LocalIdBuilder Parse(string localIdStr, VisContext context)
+    {
+        if (!TryParse(localIdStr, context, out var errors, out var localId))
+            throw new ArgumentException($"Couldn't parse local ID from: '{localIdStr}'. {errors}");
+
+        return localId;
+    }
+
+    public static bool TryParse(
+        string localIdStr,
+        VisContext context,
+        [MaybeNullWhen(false)] out LocalIdBuilder localId
+    ) => TryParse(localIdStr, context, out _, out localId);
+
+    public static bool TryParse(
+        string localIdStr,
+        VisContext context,
+        out ParsingErrors errors,
+        [MaybeNullWhen(false)] out LocalIdBuilder localId
+    )
+    {
+        if (context is null)
+            throw new ArgumentNullException(nameof(context));
+
+        var errorBuilder = LocalIdParsingErrorBuilder.Empty;
+
+        var result = TryParseInternal(
+            localIdStr,
+            context.Gmod,
+            context.Codebooks,
+            context.Locations,
+            ref errorBuilder,
+            out localId
+        );
+        errors = errorBuilder.Build();
+        return result;
+    }
+
+    internal static bool TryParseInternal(
+        string localIdStr,
+        ref LocalIdParsingErrorBuilder errorBuilder,
+        [MaybeNullWhen(false)] out LocalIdBuilder localId
+    ) => TryParseInternal(localIdStr, null, null, null, ref errorBuilder, out localId);
+
     internal static bool TryParseInternal(
         string localIdStr,
+        Gmod? gmod,
+        Codebooks? codebooks,
+        Locations? locations,
         ref LocalIdParsingErrorBuilder errorBuilder,
         [MaybeNullWhen(false)] out LocalIdBuilder localId
     )
@@ -82,8 +166,6 @@ public static bool TryParse(string localIdStr, [MaybeNullWhen(false)] out LocalI
         ReadOnlySpan<char> span = localIdStr.AsSpan();
 
         VisVersion visVersion = (VisVersion)int.MaxValue;
-        Gmod? gmod = null;
-        Codebooks? codebooks = null;
         GmodPath? primaryItem = null;
         GmodPath? secondaryItem = null;
         MetadataTag? qty = null;
@@ -145,8 +227,22 @@ public static bool TryParse(string localIdStr, [MaybeNullWhen(false)] out LocalI
                         return false;
                     }
 
-                    gmod = VIS.Instance.GetGmod(visVersion);
-                    codebooks = VIS.Instance.GetCodebooks(visVersion);
+                    if (
+                        (gmod is not null && gmod.VisVersion != visVersion)
+                        || (codebooks is not null && codebooks.VisVersion != visVersion)
+                    )
+                    {
+                        AddError(
+                            ref errorBuilder,
+                            LocalIdParsingState.VisVersion,
+                            "VIS version doesn't match the provided Gmod or Codebooks"
+                        );
+                        return false;
+                    }
+
+                    gmod ??= VIS.Instance.GetGmod(visVersion);
+                    codebooks ??= VIS.Instance.GetCodebooks(visVersion);
+                    locations ??= VIS.Instance.GetLocations(visVersion);
                     if (gmod is null || codebooks is null)
                         return false;
 
@@ -159,11 +255,11 @@ public static bool TryParse(string localIdStr, [MaybeNullWhen(false)] out LocalI
                         {
                             if (primaryItemStart != -1)
                             {
-                                if (gmod is null)
+                                if (gmod is null || locations is null)
                                     return false;
 
                                 var path = span.Slice(primaryItemStart, i - 1 - primaryItemStart);
-                                if (!gmod.TryParsePath(path.ToString(), out primaryItem))
+                                if (!GmodPath.TryParse(path.ToString(), gmod, locations, out primaryItem))
                                 {
                                     // Displays the full GmodPath when first part of PrimaryItem is invalid
                                     AddError(
@@ -189,7 +285,7 @@ public static bool TryParse(string localIdStr, [MaybeNullWhen(false)] out LocalI
                         var dashIndex = segment.IndexOf('-');
                         var code = dashIndex == -1 ? segment : segment.Slice(0, dashIndex);
 
-                        if (gmod is null)
+                        if (gmod is null || locations is null)
                             return false;
 
                         if (primaryItemStart == -1)
@@ -221,7 +317,7 @@ public static bool TryParse(string localIdStr, [MaybeNullWhen(false)] out LocalI
                             if (nextState != state)
                             {
                                 var path = span.Slice(primaryItemStart, i - 1 - primaryItemStart);
-                                if (!gmod.TryParsePath(path.ToString(), out primaryItem))
+                                if (!GmodPath.TryParse(path.ToString(), gmod, locations, out primaryItem))
                                 {
                                     // Displays the full GmodPath when first part of PrimaryItem is invalid
                                     AddError(
@@ -305,7 +401,7 @@ public static bool TryParse(string localIdStr, [MaybeNullWhen(false)] out LocalI
 
                         var dashIndex = segment.IndexOf('-');
                         var code = dashIndex == -1 ? segment : segment.Slice(0, dashIndex);
-                        if (gmod is null)
+                        if (gmod is null || locations is null)
                             return false;
 
                         if (secondaryItemStart == -1)
@@ -333,7 +429,7 @@ public static bool TryParse(string localIdStr, [MaybeNullWhen(false)] out LocalI
                             if (nextState != state)
                             {
                                 var path = span.Slice(secondaryItemStart, i - 1 - secondaryItemStart);
-                                if (!gmod.TryParsePath(path.ToString(), out secondaryItem))
+                                if (!GmodPath.TryParse(path.ToString(), gmod, locations, out secondaryItem))
                                 {
                                     // Displays the full GmodPath when first part of SecondaryItem is invalid
                                     invalidSecondaryItem = true;
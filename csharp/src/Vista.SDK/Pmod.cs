@@ -0,0 +1,535 @@
+using System.Collections;
+using System.Diagnostics.CodeAnalysis;
+
+namespace Vista.SDK;
+
+public delegate TraversalHandlerResult PmodTraverseHandler(PmodNode node);
+public delegate TraversalHandlerResult PmodTraverseHandlerWithState<TState>(TState state, PmodNode node);
+
+/// <summary>
+/// The product model (asset model) of a vessel, i.e. the union of the GmodPaths that are in use on board.
+/// </summary>
+/// <remarks>
+/// Nodes are stored in a flat array forming a trie below the Gmod root, where each edge is keyed by
+/// (parent, node code, location). Paths sharing a prefix share the trie nodes of that prefix.
+/// Reads are thread-safe, but <see cref="Add(GmodPath)"/> must not run concurrently with other operations.
+/// </remarks>
+public sealed class Pmod : IEnumerable<PmodNode>
+{
+    internal const int RootIndex = 0;
+    internal const int None = -1;
+
+    public VisVersion VisVersion { get; }
+
+    internal Entry[] _entries;
+    private int _count;
+    private int _maxDepth;
+    private readonly Dictionary<EdgeKey, int> _edges;
+    private Dictionary<string, int[]>? _codeIndex;
+
+    internal struct Entry
+    {
+        public GmodNode Node;
+        public int Parent;
+        public int FirstChild;
+        public int LastChild;
+        public int NextSibling;
+        public int Depth;
+    }
+
+    private readonly record struct EdgeKey(int Parent, string Code, Location? Location);
+
+    private Pmod(VisVersion visVersion, GmodNode rootNode, int capacity)
+    {
+        VisVersion = visVersion;
+        _entries = new Entry[Math.Max(capacity, 16)];
+        _edges = new Dictionary<EdgeKey, int>(capacity);
+        _entries[RootIndex] = new Entry
+        {
+            Node = rootNode,
+            Parent = None,
+            FirstChild = None,
+            LastChild = None,
+            NextSibling = None,
+            Depth = 0,
+        };
+        _count = 1;
+    }
+
+    public static Pmod Create(VisVersion visVersion) =>
+        new Pmod(visVersion, VIS.Instance.GetGmod(visVersion).RootNode, 16);
+
+    /// <summary>Builds a Pmod from the given paths.</summary>
+    /// <param name="parallel">
+    /// Build the subtrees below each top level function in parallel, then splice them together.
+    /// The resulting Pmod is identical to the one built sequentially.
+    /// </param>
+    public static Pmod CreateFromPaths(VisVersion visVersion, IEnumerable<GmodPath> paths, bool parallel = false)
+    {
+        var rootNode = VIS.Instance.GetGmod(visVersion).RootNode;
+        var pathList = paths as IReadOnlyList<GmodPath> ?? paths.ToArray();
+
+        if (!parallel)
+        {
+            var pmod = new Pmod(visVersion, rootNode, pathList.Count);
+            for (int i = 0; i < pathList.Count; i++)
+                pmod.Add(pathList[i]);
+            return pmod;
+        }
+
+        // Paths below different top level nodes never share trie nodes (except the root),
+        // so each group can be built independently. Groups are kept in order of first appearance
+        // so that sibling order matches a sequential build.
+        var groupIndices = new Dictionary<EdgeKey, int>();
+        var groups = new List<List<GmodPath>>();
+        for (int i = 0; i < pathList.Count; i++)
+        {
+            var path = pathList[i];
+            ValidatePath(visVersion, path);
+            if (path.Length == 1)
+                continue;
+
+            var topNode = path[1];
+            var key = new EdgeKey(RootIndex, topNode.Code, topNode.Location);
+            if (!groupIndices.TryGetValue(key, out var groupIndex))
+            {
+                groupIndex = groups.Count;
+                groupIndices.Add(key, groupIndex);
+                groups.Add(new List<GmodPath>());
+            }
+            groups[groupIndex].Add(path);
+        }
+
+        var partials = new Pmod[groups.Count];
+        Parallel.For(
+            0,
+            groups.Count,
+            i =>
+            {
+                var group = groups[i];
+                var partial = new Pmod(visVersion, rootNode, group.Count);
+                for (int j = 0; j < group.Count; j++)
+                    partial.AddInternal(group[j]);
+                partials[i] = partial;
+            }
+        );
+
+        var capacity = 1;
+        foreach (var partial in partials)
+            capacity += partial._count - 1;
+
+        var result = new Pmod(visVersion, rootNode, capacity);
+        foreach (var partial in partials)
+            result.Splice(partial);
+
+        return result;
+    }
+
+    public static Pmod CreateFromLocalIds(VisVersion visVersion, IEnumerable<ILocalId> localIds, bool parallel = false)
+    {
+        var paths = new List<GmodPath>();
+        foreach (var localId in localIds)
+        {
+            paths.Add(localId.PrimaryItem);
+            if (localId.SecondaryItem is not null)
+                paths.Add(localId.SecondaryItem);
+        }
+
+        return CreateFromPaths(visVersion, paths, parallel);
+    }
+
+    public PmodNode RootNode => new PmodNode(this, RootIndex);
+
+    public int NodeCount => _count;
+
+    public int MaxDepth => _maxDepth;
+
+    /// <summary>Adds all nodes of the path to the model.</summary>
+    /// <returns>true if any new node was added, false if the path was already part of the model</returns>
+    public bool Add(GmodPath path)
+    {
+        ValidatePath(VisVersion, path);
+        return AddInternal(path);
+    }
+
+    public bool Add(ILocalId localId)
+    {
+        var added = Add(localId.PrimaryItem);
+        if (localId.SecondaryItem is not null)
+            added |= Add(localId.SecondaryItem);
+        return added;
+    }
+
+    private bool AddInternal(GmodPath path)
+    {
+        var parents = path._parents;
+        var current = RootIndex;
+        var count = _count;
+
+        // parents[0] is always the root node
+        for (int i = 1; i < parents.Count; i++)
+            current = GetOrAddChild(current, parents[i]);
+
+        if (parents.Count > 0)
+            GetOrAddChild(current, path.Node);
+
+        if (_count == count)
+            return false;
+
+        _codeIndex = null;
+        return true;
+    }
+
+    private int GetOrAddChild(int parent, GmodNode node)
+    {
+        var key = new EdgeKey(parent, node.Code, node.Location);
+        if (_edges.TryGetValue(key, out var index))
+            return index;
+
+        index = AddEntry(parent, node);
+        _edges.Add(key, index);
+        return index;
+    }
+
+    private int AddEntry(int parent, GmodNode node)
+    {
+        if (_count == _entries.Length)
+            Array.Resize(ref _entries, _entries.Length * 2);
+
+        var index = _count++;
+        ref var parentEntry = ref _entries[parent];
+        var depth = parentEntry.Depth + 1;
+
+        _entries[index] = new Entry
+        {
+            Node = node,
+            Parent = parent,
+            FirstChild = None,
+            LastChild = None,
+            NextSibling = None,
+            Depth = depth,
+        };
+
+        if (parentEntry.LastChild == None)
+            parentEntry.FirstChild = index;
+        else
+            _entries[parentEntry.LastChild].NextSibling = index;
+        parentEntry.LastChild = index;
+
+        if (depth > _maxDepth)
+            _maxDepth = depth;
+
+        return index;
+    }
+
+    /// <summary>Appends the nodes of a partial Pmod, which must not overlap with this one below the root.</summary>
+    private void Splice(Pmod partial)
+    {
+        var offset = _count - 1;
+        static int Shift(int index, int offset) =>
+            index == None ? None
+            : index == RootIndex ? RootIndex
+            : index + offset;
+
+        if (_count + partial._count - 1 > _entries.Length)
+            Array.Resize(ref _entries, _count + partial._count - 1);
+
+        for (int i = 1; i < partial._count; i++)
+        {
+            ref readonly var entry = ref partial._entries[i];
+            _entries[i + offset] = new Entry
+            {
+                Node = entry.Node,
+                Parent = Shift(entry.Parent, offset),
+                FirstChild = Shift(entry.FirstChild, offset),
+                LastChild = Shift(entry.LastChild, offset),
+                NextSibling = Shift(entry.NextSibling, offset),
+                Depth = entry.Depth,
+            };
+        }
+
+        var partialRoot = partial._entries[RootIndex];
+        if (partialRoot.FirstChild != None)
+        {
+            ref var root = ref _entries[RootIndex];
+            var firstChild = partialRoot.FirstChild + offset;
+            if (root.LastChild == None)
+                root.FirstChild = firstChild;
+            else
+                _entries[root.LastChild].NextSibling = firstChild;
+            root.LastChild = partialRoot.LastChild + offset;
+        }
+
+        foreach (var kvp in partial._edges)
+            _edges.Add(kvp.Key with { Parent = Shift(kvp.Key.Parent, offset) }, kvp.Value + offset);
+
+        _count += partial._count - 1;
+        _maxDepth = Math.Max(_maxDepth, partial._maxDepth);
+        _codeIndex = null;
+    }
+
+    private static void ValidatePath(VisVersion visVersion, GmodPath path)
+    {
+        if (path.VisVersion != visVersion)
+            throw new ArgumentException(
+                $"Path {path} has VIS version {path.VisVersion.ToVersionString()}, expected {visVersion.ToVersionString()}"
+            );
+    }
+
+    public bool Contains(GmodPath path) => TryGetNode(path, out _);
+
+    public bool TryGetNode(GmodPath path, out PmodNode node)
+    {
+        node = default;
+        if (path.VisVersion != VisVersion)
+            return false;
+
+        var parents = path._parents;
+        var current = RootIndex;
+        for (int i = 1; i < parents.Count; i++)
+        {
+            if (!_edges.TryGetValue(new EdgeKey(current, parents[i].Code, parents[i].Location), out current))
+                return false;
+        }
+
+        if (parents.Count > 0)
+        {
+            if (!_edges.TryGetValue(new EdgeKey(current, path.Node.Code, path.Node.Location), out current))
+                return false;
+        }
+
+        node = new PmodNode(this, current);
+        return true;
+    }
+
+    /// <summary>Returns all nodes with the given code, in depth-first order.</summary>
+    public IReadOnlyList<PmodNode> GetNodesByCode(string code)
+    {
+        var codeIndex = _codeIndex ?? BuildCodeIndex();
+        if (!codeIndex.TryGetValue(code, out var indices))
+            return Array.Empty<PmodNode>();
+
+        var result = new PmodNode[indices.Length];
+        for (int i = 0; i < indices.Length; i++)
+            result[i] = new PmodNode(this, indices[i]);
+        return result;
+    }
+
+    private Dictionary<string, int[]> BuildCodeIndex()
+    {
+        var lists = new Dictionary<string, List<int>>(StringComparer.Ordinal);
+        foreach (var node in this)
+        {
+            if (!lists.TryGetValue(node.Code, out var list))
+            {
+                list = new List<int>(1);
+                lists.Add(node.Code, list);
+            }
+            list.Add(node.Index);
+        }
+
+        var codeIndex = lists.ToDictionary(kvp => kvp.Key, kvp => kvp.Value.ToArray(), StringComparer.Ordinal);
+        _codeIndex = codeIndex;
+        return codeIndex;
+    }
+
+    public bool Traverse(PmodTraverseHandler handler) =>
+        Traverse(handler, RootNode, static (handler, node) => handler(node));
+
+    public bool Traverse(PmodNode fromNode, PmodTraverseHandler handler) =>
+        Traverse(handler, fromNode, static (handler, node) => handler(node));
+
+    public bool Traverse<TState>(TState state, PmodTraverseHandlerWithState<TState> handler) =>
+        Traverse(state, RootNode, handler);
+
+    /// <summary>Depth-first, pre-order traversal of the subtree rooted at <paramref name="fromNode"/>.</summary>
+    /// <returns>false if the handler stopped the traversal</returns>
+    public bool Traverse<TState>(TState state, PmodNode fromNode, PmodTraverseHandlerWithState<TState> handler)
+    {
+        if (!ReferenceEquals(fromNode.Pmod, this))
+            throw new ArgumentException("Node does not belong to this Pmod", nameof(fromNode));
+
+        var entries = _entries;
+        var start = fromNode.Index;
+        var index = start;
+        while (true)
+        {
+            var result = handler(state, new PmodNode(this, index));
+            if (result == TraversalHandlerResult.Stop)
+                return false;
+
+            if (result == TraversalHandlerResult.Continue && entries[index].FirstChild != None)
+            {
+                index = entries[index].FirstChild;
+                continue;
+            }
+
+            while (index != start && entries[index].NextSibling == None)
+                index = entries[index].Parent;
+
+            if (index == start)
+                return true;
+
+            index = entries[index].NextSibling;
+        }
+    }
+
+    internal GmodPath GetPath(int index)
+    {
+        ref readonly var entry = ref _entries[index];
+        var parents = new List<GmodNode>(entry.Depth);
+        for (int i = 0; i < entry.Depth; i++)
+            parents.Add(null!);
+
+        var parent = entry.Parent;
+        for (int i = entry.Depth - 1; i >= 0; i--)
+        {
+            parents[i] = _entries[parent].Node;
+            parent = _entries[parent].Parent;
+        }
+
+        return new GmodPath(parents, entry.Node, skipVerify: true);
+    }
+
+    public Enumerator GetEnumerator() => new Enumerator(this);
+
+    IEnumerator<PmodNode> IEnumerable<PmodNode>.GetEnumerator() => GetEnumerator();
+
+    IEnumerator IEnumerable.GetEnumerator() => GetEnumerator();
+
+    /// <summary>Enumerates all nodes depth-first, in pre-order.</summary>
+    public struct Enumerator : IEnumerator<PmodNode>
+    {
+        private readonly Pmod _pmod;
+        private int _index;
+
+        internal Enumerator(Pmod pmod)
+        {
+            _pmod = pmod;
+            _index = None;
+        }
+
+        public PmodNode Current => new PmodNode(_pmod, _index);
+
+        object IEnumerator.Current => Current;
+
+        public bool MoveNext()
+        {
+            var entries = _pmod._entries;
+            if (_index == None)
+            {
+                _index = RootIndex;
+                return true;
+            }
+
+            if (entries[_index].FirstChild != None)
+            {
+                _index = entries[_index].FirstChild;
+                return true;
+            }
+
+            var index = _index;
+            while (index != RootIndex && entries[index].NextSibling == None)
+                index = entries[index].Parent;
+
+            if (index == RootIndex)
+                return false;
+
+            _index = entries[index].NextSibling;
+            return true;
+        }
+
+        public void Reset() => _index = None;
+
+        public void Dispose() { }
+    }
+}
+
+/// <summary>A node in a <see cref="Pmod"/>. Cheap to copy, it only references the owning model.</summary>
+public readonly struct PmodNode : IEquatable<PmodNode>
+{
+    internal readonly Pmod Pmod;
+    internal readonly int Index;
+
+    internal PmodNode(Pmod pmod, int index)
+    {
+        Pmod = pmod;
+        Index = index;
+    }
+
+    /// <summary>The Gmod node, including the location of this occurrence.</summary>
+    public GmodNode Node => Pmod._entries[Index].Node;
+
+    public string Code => Node.Code;
+
+    public Location? Location => Node.Location;
+
+    public int Depth => Pmod._entries[Index].Depth;
+
+    public bool IsRoot => Index == Pmod.RootIndex;
+
+    public PmodNode? Parent
+    {
+        get
+        {
+            var parent = Pmod._entries[Index].Parent;
+            return parent == Pmod.None ? null : new PmodNode(Pmod, parent);
+        }
+    }
+
+    public ChildEnumerator Children => new ChildEnumerator(Pmod, Pmod._entries[Index].FirstChild);
+
+    public bool HasChildren => Pmod._entries[Index].FirstChild != Pmod.None;
+
+    /// <summary>Materializes the full GmodPath from the root to this node.</summary>
+    public GmodPath Path => Pmod.GetPath(Index);
+
+    public bool Equals(PmodNode other) => ReferenceEquals(Pmod, other.Pmod) && Index == other.Index;
+
+    public override bool Equals([NotNullWhen(true)] object? obj) => obj is PmodNode other && Equals(other);
+
+    public override int GetHashCode() => Index;
+
+    public static bool operator ==(PmodNode left, PmodNode right) => left.Equals(right);
+
+    public static bool operator !=(PmodNode left, PmodNode right) => !left.Equals(right);
+
+    public override string ToString() => Node.ToString();
+
+    public struct ChildEnumerator : IEnumerable<PmodNode>, IEnumerator<PmodNode>
+    {
+        private readonly Pmod _pmod;
+        private readonly int _first;
+        private int _index;
+
+        internal ChildEnumerator(Pmod pmod, int first)
+        {
+            _pmod = pmod;
+            _first = first;
+            _index = Pmod.None - 1;
+        }
+
+        public PmodNode Current => new PmodNode(_pmod, _index);
+
+        object IEnumerator.Current => Current;
+
+        public bool MoveNext()
+        {
+            if (_index == Pmod.None)
+                return false;
+
+            _index = _index == Pmod.None - 1 ? _first : _pmod._entries[_index].NextSibling;
+            return _index != Pmod.None;
+        }
+
+        public void Reset() => _index = Pmod.None - 1;
+
+        public void Dispose() { }
+
+        public ChildEnumerator GetEnumerator() => this;
+
+        IEnumerator<PmodNode> IEnumerable<PmodNode>.GetEnumerator() => this;
+
+        IEnumerator IEnumerable.GetEnumerator() => this;
+    }
+}
@@ -0,0 +1,457 @@
+using System.Buffers.Binary;
+using System.IO.Compression;
+using System.Text;
+
+namespace Vista.SDK.Transport.Archive;
+
+/// <summary>The type of the values of an archived column, one per <see cref="Value"/> subtype.</summary>
+internal enum ValueKind : byte
+{
+    String = 0,
+    Char = 1,
+    Boolean = 2,
+    Integer = 3,
+    UnsignedInteger = 4,
+    Long = 5,
+    Double = 6,
+    Decimal = 7,
+    DateTime = 8,
+}
+
+internal enum Codec : byte
+{
+    Raw = 0,
+    Deflate = 1,
+}
+
+/// <summary>Layout and encodings of the segment files of a <see cref="TimeSeriesArchiveWriter"/>.</summary>
+/// <remarks>
+/// A segment holds the values of one UTC day. It starts with <see cref="SegmentMagic"/>, followed by blocks, one per
+/// flush of the writer. A block is a header (<see cref="BlockMagic"/>, int32 body length) and a body:
+/// <list type="number">
+/// <item>LocalId dictionary entries added by the block: varint key of the first, varint count, UTF-8 strings.</item>
+/// <item>Column directory: varint count, then per column the varint LocalId key, the <see cref="ValueKind"/>, the
+/// int64 min and max UTC ticks, the varint row count, and per stream (timestamps, values, qualities) the
+/// <see cref="Codec"/>, the varint stored length and the varint raw length.</item>
+/// <item>The streams, in directory order.</item>
+/// </list>
+/// Timestamps are sorted and stored as varint deltas from the column's min ticks. Integers are zigzag varint deltas,
+/// doubles the XOR of their bits with the previous value, strings and qualities are dictionary encoded.
+/// Fixed-size numbers are little endian.
+/// A block cut short at the end of a segment is an interrupted flush, and is ignored.
+/// </remarks>
+internal static class ArchiveFormat
+{
+    internal const string Extension = ".vsa";
+    internal const string DayFormat = "yyyy-MM-dd";
+
+    internal static ReadOnlySpan<byte> SegmentMagic => "VSA1"u8;
+    internal const uint BlockMagic = 0x4B4C4256; // "VBLK"
+    internal const int BlockHeaderLength = 8;
+    internal const int StreamCount = 3;
+
+    // Streams shorter than this are stored raw, as deflate doesn't pay off
+    internal const int MinCompressedLength = 64;
+
+    internal static ValueKind KindOf(Value value) =>
+        value switch
+        {
+            Value.String => ValueKind.String,
+            Value.Char => ValueKind.Char,
+            Value.Boolean => ValueKind.Boolean,
+            Value.Integer => ValueKind.Integer,
+            Value.UnsignedInteger => ValueKind.UnsignedInteger,
+            Value.Long => ValueKind.Long,
+            Value.Double => ValueKind.Double,
+            Value.Decimal => ValueKind.Decimal,
+            Value.DateTime => ValueKind.DateTime,
+            _ => throw new ArgumentException($"Unsupported value {value}", nameof(value)),
+        };
+
+    internal static ulong ZigZag(long value) => (ulong)((value << 1) ^ (value >> 63));
+
+    internal static long UnZigZag(ulong value) => (long)(value >> 1) ^ -(long)(value & 1);
+
+    internal static void EncodeTimestamps(ArchiveBuffer buffer, long[] ticks)
+    {
+        var previous = ticks[0];
+        foreach (var t in ticks)
+        {
+            buffer.WriteVarint((ulong)(t - previous));
+            previous = t;
+        }
+    }
+
+    internal static long[] DecodeTimestamps(ReadOnlySpan<byte> data, int rows, long minTicks)
+    {
+        var reader = new ArchiveReader(data);
+        var ticks = new long[rows];
+        var previous = minTicks;
+        for (var i = 0; i < rows; i++)
+            ticks[i] = previous += (long)reader.ReadVarint();
+        return ticks;
+    }
+
+    internal static void EncodeValues(ArchiveBuffer buffer, ValueKind kind, Value[] values)
+    {
+        long previous = 0;
+        switch (kind)
+        {
+            case ValueKind.String:
+                EncodeStrings(buffer, values.Select(v => ((Value.String)v).Value).ToArray());
+                break;
+            case ValueKind.Char:
+                foreach (var v in values)
+                    buffer.WriteVarint(((Value.Char)v).Value);
+                break;
+            case ValueKind.Boolean:
+                foreach (var v in values)
+                    buffer.WriteByte(((Value.Boolean)v).Value ? (byte)1 : (byte)0);
+                break;
+            case ValueKind.Integer:
+            case ValueKind.UnsignedInteger:
+            case ValueKind.Long:
+                foreach (var v in values)
+                {
+                    long current = v switch
+                    {
+                        Value.Integer i => i.Value,
+                        Value.UnsignedInteger u => u.Value,
+                        _ => ((Value.Long)v).Value,
+                    };
+                    buffer.WriteVarint(ZigZag(current - previous));
+                    previous = current;
+                }
+                break;
+            case ValueKind.Double:
+                foreach (var v in values)
+                {
+                    var bits = BitConverter.DoubleToInt64Bits(((Value.Double)v).Value);
+                    buffer.WriteInt64(bits ^ previous);
+                    previous = bits;
+                }
+                break;
+            case ValueKind.Decimal:
+                foreach (var v in values)
+                {
+                    foreach (var part in decimal.GetBits(((Value.Decimal)v).Value))
+                        buffer.WriteInt32(part);
+                }
+                break;
+            case ValueKind.DateTime:
+                foreach (var v in values)
+                {
+                    var timeStamp = ((Value.DateTime)v).Value;
+                    buffer.WriteVarint(ZigZag(timeStamp.UtcTicks - previous));
+                    buffer.WriteVarint(ZigZag((long)timeStamp.Offset.TotalMinutes));
+                    previous = timeStamp.UtcTicks;
+                }
+                break;
+            default:
+                throw new ArgumentException($"Unsupported value kind {kind}", nameof(kind));
+        }
+    }
+
+    /// <summary>Decodes the values of rows <paramref name="start"/> up to <paramref name="end"/>.</summary>
+    /// <remarks>Preceding rows are skipped over, but no value is created for them.</remarks>
+    internal static Value[] DecodeValues(ReadOnlySpan<byte> data, ValueKind kind, int start, int end)
+    {
+        var reader = new ArchiveReader(data);
+        var values = new Value[end - start];
+        long previous = 0;
+        switch (kind)
+        {
+            case ValueKind.String:
+                var strings = DecodeStrings(data, start, end, s => new Value.String(s));
+                for (var i = 0; i < values.Length; i++)
+                    values[i] = strings[i] ?? throw Corrupt("String value is missing");
+                break;
+            case ValueKind.Char:
+                for (var i = 0; i < end; i++)
+                {
+                    var c = (char)reader.ReadVarint();
+                    if (i >= start)
+                        values[i - start] = new Value.Char(c);
+                }
+                break;
+            case ValueKind.Boolean:
+                reader.Skip(start);
+                for (var i = 0; i < values.Length; i++)
+                    values[i] = new Value.Boolean(reader.ReadByte() != 0);
+                break;
+            case ValueKind.Integer:
+            case ValueKind.UnsignedInteger:
+            case ValueKind.Long:
+                for (var i = 0; i < end; i++)
+                {
+                    previous += UnZigZag(reader.ReadVarint());
+                    if (i < start)
+                        continue;
+                    values[i - start] = kind switch
+                    {
+                        ValueKind.Integer => new Value.Integer((int)previous),
+                        ValueKind.UnsignedInteger => new Value.UnsignedInteger((uint)previous),
+                        _ => new Value.Long(previous),
+                    };
+                }
+                break;
+            case ValueKind.Double:
+                // Each value depends on the previous, but only through the bits, so skipping is cheap
+                for (var i = 0; i < end; i++)
+                {
+                    previous ^= reader.ReadInt64();
+                    if (i >= start)
+                        values[i - start] = new Value.Double(BitConverter.Int64BitsToDouble(previous));
+                }
+                break;
+            case ValueKind.Decimal:
+                reader.Skip(start * 16);
+                var parts = new int[4];
+                for (var i = 0; i < values.Length; i++)
+                {
+                    for (var j = 0; j < parts.Length; j++)
+                        parts[j] = reader.ReadInt32();
+                    values[i] = new Value.Decimal(new decimal(parts));
+                }
+                break;
+            case ValueKind.DateTime:
+                for (var i = 0; i < end; i++)
+                {
+                    previous += UnZigZag(reader.ReadVarint());
+                    var offset = UnZigZag(reader.ReadVarint());
+                    if (i >= start)
+                    {
+                        var utc = new DateTimeOffset(previous, System.TimeSpan.Zero);
+                        values[i - start] = new Value.DateTime(utc.ToOffset(System.TimeSpan.FromMinutes(offset)));
+                    }
+                }
+                break;
+            default:
+                throw Corrupt($"Unknown value kind {kind}");
+        }
+        return values;
+    }
+
+    /// <summary>Writes the distinct strings, then the index of each row's string, 0 for null.</summary>
+    internal static void EncodeStrings(ArchiveBuffer buffer, IReadOnlyList<string?> strings)
+    {
+        var indices = new Dictionary<string, int>(StringComparer.Ordinal);
+        var distinct = new List<string>();
+        foreach (var s in strings)
+        {
+            if (s is not null && !indices.ContainsKey(s))
+            {
+                indices.Add(s, distinct.Count + 1);
+                distinct.Add(s);
+            }
+        }
+
+        buffer.WriteVarint((ulong)distinct.Count);
+        foreach (var s in distinct)
+            buffer.WriteString(s);
+        foreach (var s in strings)
+            buffer.WriteVarint(s is null ? 0UL : (ulong)indices[s]);
+    }
+
+    internal static T?[] DecodeStrings<T>(ReadOnlySpan<byte> data, int start, int end, Func<string, T> create)
+        where T : class
+    {
+        var reader = new ArchiveReader(data);
+        var distinct = new T[checked((int)reader.ReadVarint())];
+        for (var i = 0; i < distinct.Length; i++)
+            distinct[i] = create(reader.ReadString());
+
+        var rows = new T?[end - start];
+        for (var i = 0; i < end; i++)
+        {
+            var index = (int)reader.ReadVarint();
+            if (index > distinct.Length)
+                throw Corrupt($"String {index} is not in the dictionary");
+            if (i >= start)
+                rows[i - start] = index == 0 ? null : distinct[index - 1];
+        }
+        return rows;
+    }
+
+    /// <summary>Deflates <paramref name="raw"/> into <paramref name="output"/>, unless it gets no smaller.</summary>
+    internal static Codec Compress(ArchiveBuffer raw, ArchiveBuffer output)
+    {
+        if (raw.Length >= MinCompressedLength)
+        {
+            var start = output.Length;
+            using (var deflate = new DeflateStream(output.AsStream(), CompressionLevel.Optimal, leaveOpen: true))
+                deflate.Write(raw.Array, 0, raw.Length);
+            if (output.Length - start < raw.Length)
+                return Codec.Deflate;
+            output.Length = start;
+        }
+        output.Write(raw.Array, 0, raw.Length);
+        return Codec.Raw;
+    }
+
+    internal static InvalidDataException Corrupt(string message) => new($"Corrupt archive segment: {message}");
+}
+
+/// <summary>Growable byte buffer the segment blocks are assembled in.</summary>
+internal sealed class ArchiveBuffer
+{
+    private byte[] _array;
+
+    public ArchiveBuffer(int capacity = 256) => _array = new byte[capacity];
+
+    public byte[] Array => _array;
+
+    public int Length { get; set; }
+
+    public void Clear() => Length = 0;
+
+    private void Reserve(int count)
+    {
+        if (Length + count <= _array.Length)
+            return;
+        var array = new byte[Math.Max(checked(Length + count), _array.Length * 2)];
+        Buffer.BlockCopy(_array, 0, array, 0, Length);
+        _array = array;
+    }
+
+    public void WriteByte(byte value)
+    {
+        Reserve(1);
+        _array[Length++] = value;
+    }
+
+    public void WriteVarint(ulong value)
+    {
+        Reserve(10);
+        while (value >= 0x80)
+        {
+            _array[Length++] = (byte)(value | 0x80);
+            value >>= 7;
+        }
+        _array[Length++] = (byte)value;
+    }
+
+    public void WriteInt32(int value)
+    {
+        Reserve(4);
+        BinaryPrimitives.WriteInt32LittleEndian(_array.AsSpan(Length), value);
+        Length += 4;
+    }
+
+    public void WriteUInt32(uint value)
+    {
+        Reserve(4);
+        BinaryPrimitives.WriteUInt32LittleEndian(_array.AsSpan(Length), value);
+        Length += 4;
+    }
+
+    public void WriteInt64(long value)
+    {
+        Reserve(8);
+        BinaryPrimitives.WriteInt64LittleEndian(_array.AsSpan(Length), value);
+        Length += 8;
+    }
+
+    public void WriteString(string value)
+    {
+        var count = Encoding.UTF8.GetByteCount(value);
+        WriteVarint((ulong)count);
+        Reserve(count);
+        Length += Encoding.UTF8.GetBytes(value, 0, value.Length, _array, Length);
+    }
+
+    public void Write(byte[] buffer, int offset, int count)
+    {
+        Reserve(count);
+        Buffer.BlockCopy(buffer, offset, _array, Length, count);
+        Length += count;
+    }
+
+    public void Write(ArchiveBuffer other) => Write(other.Array, 0, other.Length);
+
+    public Stream AsStream() => new AppendStream(this);
+
+    private sealed class AppendStream(ArchiveBuffer buffer) : Stream
+    {
+        public override bool CanRead => false;
+        public override bool CanSeek => false;
+        public override bool CanWrite => true;
+        public override long Length => buffer.Length;
+
+        public override long Position
+        {
+            get => buffer.Length;
+            set => throw new NotSupportedException();
+        }
+
+        public override void Write(byte[] array, int offset, int count) => buffer.Write(array, offset, count);
+
+        public override void Flush() { }
+
+        public override int Read(byte[] array, int offset, int count) => throw new NotSupportedException();
+
+        public override long Seek(long offset, SeekOrigin origin) => throw new NotSupportedException();
+
+        public override void SetLength(long value) => throw new NotSupportedException();
+    }
+}
+
+/// <summary>Reads what <see cref="ArchiveBuffer"/> writes.</summary>
+/// <remarks>Reading past the end throws <see cref="InvalidDataException"/>.</remarks>
+internal ref struct ArchiveReader
+{
+    private readonly ReadOnlySpan<byte> _data;
+
+    public ArchiveReader(ReadOnlySpan<byte> data)
+    {
+        _data = data;
+        Position = 0;
+    }
+
+    public int Position { get; private set; }
+
+    public int Remaining => _data.Length - Position;
+
+    private ReadOnlySpan<byte> Take(int count)
+    {
+        if (count < 0 || count > Remaining)
+            throw ArchiveFormat.Corrupt($"Unexpected end of data at {Position}");
+        var span = _data.Slice(Position, count);
+        Position += count;
+        return span;
+    }
+
+    public void Skip(int count) => Take(count);
+
+    public byte ReadByte() => Take(1)[0];
+
+    public ulong ReadVarint()
+    {
+        ulong value = 0;
+        for (var shift = 0; shift < 64; shift += 7)
+        {
+            var b = ReadByte();
+            value |= (ulong)(b & 0x7F) << shift;
+            if (b < 0x80)
+                return value;
+        }
+        throw ArchiveFormat.Corrupt($"Varint too long at {Position}");
+    }
+
+    public int ReadLength() => checked((int)ReadVarint());
+
+    public int ReadInt32() => BinaryPrimitives.ReadInt32LittleEndian(Take(4));
+
+    public uint ReadUInt32() => BinaryPrimitives.ReadUInt32LittleEndian(Take(4));
+
+    public long ReadInt64() => BinaryPrimitives.ReadInt64LittleEndian(Take(8));
+
+    public unsafe string ReadString()
+    {
+        var bytes = Take(ReadLength());
+        if (bytes.IsEmpty)
+            return string.Empty;
+        fixed (byte* p = bytes)
+            return Encoding.UTF8.GetString(p, bytes.Length);
+    }
+}
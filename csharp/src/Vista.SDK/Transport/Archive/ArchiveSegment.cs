@@ -0,0 +1,208 @@
+using System.IO.Compression;
+using System.IO.MemoryMappedFiles;
+
+namespace Vista.SDK.Transport.Archive;
+
+internal readonly record struct ArchiveStream(long Offset, int Length, int RawLength, Codec Codec);
+
+internal sealed record ArchiveColumn(
+    int Key,
+    ValueKind Kind,
+    long MinTicks,
+    long MaxTicks,
+    int Rows,
+    ArchiveStream Timestamps,
+    ArchiveStream Values,
+    ArchiveStream Qualities
+);
+
+internal sealed record ArchiveBlock(long MinTicks, long MaxTicks, ArchiveColumn[] Columns);
+
+/// <summary>A memory-mapped segment file, with the index of its blocks.</summary>
+/// <remarks>
+/// Only the block headers, LocalId dictionary and column directories are read when the segment is opened.
+/// Column streams are read from the mapping when scanned. The segment is mapped at its length when opened,
+/// blocks appended later are not seen.
+/// </remarks>
+internal sealed unsafe class ArchiveSegment : IDisposable
+{
+    private readonly MemoryMappedFile? _file;
+    private readonly MemoryMappedViewAccessor? _view;
+    private readonly long _length;
+    private byte* _pointer;
+
+    /// <summary>The LocalId of each dictionary key.</summary>
+    public List<string> Dictionary { get; } = new();
+
+    public List<ArchiveBlock> Blocks { get; } = new();
+
+    /// <summary>The length up to the end of the last complete block.</summary>
+    public long ValidLength { get; private set; }
+
+    public long MinTicks { get; private set; } = long.MaxValue;
+
+    public long MaxTicks { get; private set; } = long.MinValue;
+
+    private ArchiveSegment(string path)
+    {
+        var stream = new FileStream(path, FileMode.Open, FileAccess.Read, FileShare.ReadWrite | FileShare.Delete);
+        var length = _length = stream.Length;
+        if (length < ArchiveFormat.SegmentMagic.Length)
+        {
+            // Created, but interrupted before the magic was written
+            stream.Dispose();
+            return;
+        }
+
+        try
+        {
+            _file = MemoryMappedFile.CreateFromFile(
+                stream,
+                null,
+                length,
+                MemoryMappedFileAccess.Read,
+                HandleInheritability.None,
+                leaveOpen: false
+            );
+        }
+        catch
+        {
+            stream.Dispose();
+            throw;
+        }
+        _view = _file.CreateViewAccessor(0, length, MemoryMappedFileAccess.Read);
+        _view.SafeMemoryMappedViewHandle.AcquirePointer(ref _pointer);
+        _pointer += _view.PointerOffset;
+    }
+
+    /// <exception cref="InvalidDataException">The file is not a segment, or is corrupt.</exception>
+    public static ArchiveSegment Open(string path)
+    {
+        var segment = new ArchiveSegment(path);
+        try
+        {
+            if (segment._pointer is not null)
+                segment.ReadIndex(segment._length);
+            return segment;
+        }
+        catch
+        {
+            segment.Dispose();
+            throw;
+        }
+    }
+
+    private void ReadIndex(long length)
+    {
+        var magic = new ReadOnlySpan<byte>(_pointer, ArchiveFormat.SegmentMagic.Length);
+        if (!magic.SequenceEqual(ArchiveFormat.SegmentMagic))
+            throw new InvalidDataException("Not an archive segment");
+
+        long position = ArchiveFormat.SegmentMagic.Length;
+        while (length - position >= ArchiveFormat.BlockHeaderLength)
+        {
+            var header = new ArchiveReader(
+                new ReadOnlySpan<byte>(_pointer + position, ArchiveFormat.BlockHeaderLength)
+            );
+            if (header.ReadUInt32() != ArchiveFormat.BlockMagic)
+                throw ArchiveFormat.Corrupt($"No block at {position}");
+            var bodyLength = header.ReadInt32();
+            var body = position + ArchiveFormat.BlockHeaderLength;
+            if (bodyLength < 0 || length - body < bodyLength)
+                break;
+            ReadBlock(body, bodyLength);
+            position = body + bodyLength;
+        }
+        ValidLength = position;
+    }
+
+    private void ReadBlock(long offset, int length)
+    {
+        var reader = new ArchiveReader(new ReadOnlySpan<byte>(_pointer + offset, length));
+        if ((int)reader.ReadVarint() != Dictionary.Count)
+            throw ArchiveFormat.Corrupt($"Block at {offset} doesn't continue the LocalId dictionary");
+        var entries = reader.ReadLength();
+        for (var i = 0; i < entries; i++)
+            Dictionary.Add(reader.ReadString());
+
+        var columns = new ArchiveColumn[reader.ReadLength()];
+        var streams = new (Codec Codec, int Length, int RawLength)[columns.Length * ArchiveFormat.StreamCount];
+        var headers = new (int Key, ValueKind Kind, long MinTicks, long MaxTicks, int Rows)[columns.Length];
+        for (var i = 0; i < columns.Length; i++)
+        {
+            var key = reader.ReadLength();
+            if (key >= Dictionary.Count)
+                throw ArchiveFormat.Corrupt($"LocalId key {key} is not in the dictionary");
+            var kind = (ValueKind)reader.ReadByte();
+            if (kind > ValueKind.DateTime)
+                throw ArchiveFormat.Corrupt($"Unknown value kind {kind}");
+            headers[i] = (key, kind, reader.ReadInt64(), reader.ReadInt64(), reader.ReadLength());
+            for (var j = 0; j < ArchiveFormat.StreamCount; j++)
+            {
+                var codec = (Codec)reader.ReadByte();
+                var stored = reader.ReadLength();
+                var raw = reader.ReadLength();
+                if (codec > Codec.Deflate || (codec == Codec.Raw && stored != raw))
+                    throw ArchiveFormat.Corrupt($"Invalid stream in block at {offset}");
+                streams[i * ArchiveFormat.StreamCount + j] = (codec, stored, raw);
+            }
+        }
+
+        long position = offset + reader.Position;
+        long minTicks = long.MaxValue,
+            maxTicks = long.MinValue;
+        for (var i = 0; i < columns.Length; i++)
+        {
+            var s = new ArchiveStream[ArchiveFormat.StreamCount];
+            for (var j = 0; j < s.Length; j++)
+            {
+                var (codec, stored, raw) = streams[i * ArchiveFormat.StreamCount + j];
+                s[j] = new ArchiveStream(position, stored, raw, codec);
+                position += stored;
+            }
+            var (key, kind, min, max, rows) = headers[i];
+            columns[i] = new ArchiveColumn(key, kind, min, max, rows, s[0], s[1], s[2]);
+            minTicks = Math.Min(minTicks, min);
+            maxTicks = Math.Max(maxTicks, max);
+        }
+        if (position > offset + length)
+            throw ArchiveFormat.Corrupt($"Columns overrun the block at {offset}");
+
+        Blocks.Add(new ArchiveBlock(minTicks, maxTicks, columns));
+        MinTicks = Math.Min(MinTicks, minTicks);
+        MaxTicks = Math.Max(MaxTicks, maxTicks);
+    }
+
+    /// <summary>The raw bytes of a column stream, straight from the mapping unless compressed.</summary>
+    public ReadOnlySpan<byte> Read(ArchiveStream stream)
+    {
+        if (_pointer is null)
+            throw new ObjectDisposedException(nameof(ArchiveSegment));
+        if (stream.Codec == Codec.Raw)
+            return new ReadOnlySpan<byte>(_pointer + stream.Offset, stream.Length);
+
+        var raw = new byte[stream.RawLength];
+        using var input = new UnmanagedMemoryStream(_pointer + stream.Offset, stream.Length);
+        using var deflate = new DeflateStream(input, CompressionMode.Decompress);
+        var read = 0;
+        while (read < raw.Length)
+        {
+            var count = deflate.Read(raw, read, raw.Length - read);
+            if (count == 0)
+                throw ArchiveFormat.Corrupt($"Stream at {stream.Offset} is shorter than {raw.Length} bytes");
+            read += count;
+        }
+        return raw;
+    }
+
+    public void Dispose()
+    {
+        if (_pointer is not null)
+        {
+            _pointer = null;
+            _view!.SafeMemoryMappedViewHandle.ReleasePointer();
+        }
+        _view?.Dispose();
+        _file?.Dispose();
+    }
+}
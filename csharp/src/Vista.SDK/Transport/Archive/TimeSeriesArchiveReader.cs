@@ -0,0 +1,188 @@
+using System.Globalization;
+
+namespace Vista.SDK.Transport.Archive;
+
+/// <summary>A value read from a <see cref="TimeSeriesArchiveReader"/>, with its timestamp in UTC.</summary>
+public readonly record struct ArchivedValue(LocalId LocalId, DateTimeOffset TimeStamp, Value Value, string? Quality);
+
+/// <summary>Scans an archive written by <see cref="TimeSeriesArchiveWriter"/>.</summary>
+/// <remarks>
+/// Segments are memory-mapped the first time a scan reaches their day, and seen as they were then, reopen the
+/// reader to see later appends. A scan skips the segments, blocks and columns outside its time range or channels
+/// by their index alone, the columns it reads are decoded only up to the end of the range.
+/// Scans may run concurrently, but not with <see cref="Dispose"/>.
+/// </remarks>
+public sealed class TimeSeriesArchiveReader : IDisposable
+{
+    private readonly (DateTime Day, string Path)[] _days;
+    private readonly ArchiveSegment?[] _segments;
+    private long _decodedColumns;
+    private bool _disposed;
+
+    private TimeSeriesArchiveReader((DateTime Day, string Path)[] days)
+    {
+        _days = days;
+        _segments = new ArchiveSegment?[days.Length];
+    }
+
+    /// <exception cref="DirectoryNotFoundException">The archive directory doesn't exist.</exception>
+    public static TimeSeriesArchiveReader Open(string directory)
+    {
+        if (!Directory.Exists(directory))
+            throw new DirectoryNotFoundException($"Archive directory {directory} not found");
+
+        var days = new List<(DateTime Day, string Path)>();
+        foreach (var path in Directory.EnumerateFiles(directory, "*" + ArchiveFormat.Extension))
+        {
+            var name = Path.GetFileNameWithoutExtension(path);
+            if (
+                DateTime.TryParseExact(
+                    name,
+                    ArchiveFormat.DayFormat,
+                    CultureInfo.InvariantCulture,
+                    DateTimeStyles.AdjustToUniversal | DateTimeStyles.AssumeUniversal,
+                    out var day
+                )
+            )
+                days.Add((day, path));
+        }
+        return new TimeSeriesArchiveReader(days.OrderBy(d => d.Day).ToArray());
+    }
+
+    /// <summary>The UTC days with a segment in the archive.</summary>
+    public IEnumerable<DateTime> Days => _days.Select(d => d.Day);
+
+    /// <summary>The number of columns decoded by scans, for tests.</summary>
+    internal long DecodedColumns => Interlocked.Read(ref _decodedColumns);
+
+    /// <summary>The values of <paramref name="channels"/> from <paramref name="from"/> up to, but not including,
+    /// <paramref name="to"/>.</summary>
+    /// <remarks>
+    /// Values are ordered by day, then by block, in the order they were flushed, then by channel. The values of a
+    /// channel within a block are ordered by timestamp. A channel archived with another format in the same block,
+    /// e.g. from another DataChannelList version, has a column per format.
+    /// </remarks>
+    /// <exception cref="InvalidDataException">A segment is corrupt.</exception>
+    public IEnumerable<ArchivedValue> Scan(IEnumerable<LocalId> channels, DateTimeOffset from, DateTimeOffset to)
+    {
+        if (channels is null)
+            throw new ArgumentNullException(nameof(channels));
+        if (_disposed)
+            throw new ObjectDisposedException(nameof(TimeSeriesArchiveReader));
+
+        var requested = new Dictionary<string, LocalId>(StringComparer.Ordinal);
+        foreach (var localId in channels)
+            requested[localId.ToString()] = localId;
+        return Scan(requested, from.UtcTicks, to.UtcTicks);
+    }
+
+    private IEnumerable<ArchivedValue> Scan(Dictionary<string, LocalId> requested, long from, long to)
+    {
+        if (requested.Count == 0 || from >= to)
+            yield break;
+
+        for (var i = 0; i < _days.Length; i++)
+        {
+            var dayStart = _days[i].Day.Ticks;
+            if (dayStart >= to || dayStart + System.TimeSpan.TicksPerDay <= from)
+                continue;
+
+            var segment = GetSegment(i);
+            if (segment.MaxTicks < from || segment.MinTicks >= to)
+                continue;
+
+            // LocalId of the requested keys in this segment
+            var keys = new Dictionary<int, LocalId>();
+            for (var key = 0; key < segment.Dictionary.Count; key++)
+            {
+                if (requested.TryGetValue(segment.Dictionary[key], out var localId))
+                    keys.Add(key, localId);
+            }
+            if (keys.Count == 0)
+                continue;
+
+            foreach (var block in segment.Blocks)
+            {
+                if (block.MaxTicks < from || block.MinTicks >= to)
+                    continue;
+                foreach (var column in block.Columns)
+                {
+                    if (column.MaxTicks < from || column.MinTicks >= to)
+                        continue;
+                    if (!keys.TryGetValue(column.Key, out var localId))
+                        continue;
+                    foreach (var value in Decode(segment, column, localId, from, to))
+                        yield return value;
+                }
+            }
+        }
+    }
+
+    private ArchiveSegment GetSegment(int index)
+    {
+        var segment = Volatile.Read(ref _segments[index]);
+        if (segment is not null)
+            return segment;
+
+        lock (_segments)
+        {
+            if (_disposed)
+                throw new ObjectDisposedException(nameof(TimeSeriesArchiveReader));
+            return _segments[index] ??= ArchiveSegment.Open(_days[index].Path);
+        }
+    }
+
+    private ArchivedValue[] Decode(ArchiveSegment segment, ArchiveColumn column, LocalId localId, long from, long to)
+    {
+        Interlocked.Increment(ref _decodedColumns);
+        var ticks = ArchiveFormat.DecodeTimestamps(segment.Read(column.Timestamps), column.Rows, column.MinTicks);
+        var start = LowerBound(ticks, from);
+        var end = LowerBound(ticks, to);
+        if (start == end)
+            return [];
+
+        var values = ArchiveFormat.DecodeValues(segment.Read(column.Values), column.Kind, start, end);
+        var qualities =
+            column.Qualities.RawLength == 0
+                ? null
+                : ArchiveFormat.DecodeStrings(segment.Read(column.Qualities), start, end, s => s);
+
+        var result = new ArchivedValue[end - start];
+        for (var i = 0; i < result.Length; i++)
+        {
+            var timeStamp = new DateTimeOffset(ticks[start + i], System.TimeSpan.Zero);
+            result[i] = new ArchivedValue(localId, timeStamp, values[i], qualities?[i]);
+        }
+        return result;
+    }
+
+    private static int LowerBound(long[] ticks, long value)
+    {
+        int low = 0,
+            high = ticks.Length;
+        while (low < high)
+        {
+            var mid = low + (high - low) / 2;
+            if (ticks[mid] < value)
+                low = mid + 1;
+            else
+                high = mid;
+        }
+        return low;
+    }
+
+    public void Dispose()
+    {
+        lock (_segments)
+        {
+            if (_disposed)
+                return;
+            _disposed = true;
+            for (var i = 0; i < _segments.Length; i++)
+            {
+                _segments[i]?.Dispose();
+                _segments[i] = null;
+            }
+        }
+    }
+}
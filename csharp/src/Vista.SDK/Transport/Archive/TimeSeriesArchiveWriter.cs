@@ -0,0 +1,307 @@
+using System.Globalization;
+using System.Runtime.CompilerServices;
+using Vista.SDK.Transport.DataChannel;
+using Vista.SDK.Transport.TimeSeries;
+
+namespace Vista.SDK.Transport.Archive;
+
+/// <summary>Appends validated <see cref="TimeSeriesData"/> to a columnar archive, read by
+/// <see cref="TimeSeriesArchiveReader"/>.</summary>
+/// <remarks>
+/// The archive is a directory of segment files, one per UTC day, named <c>yyyy-MM-dd.vsa</c>. Values are buffered
+/// per day and channel, and appended to the segments as a block on <see cref="Flush"/>, when
+/// <c>maxBufferedValues</c> is reached, and on <see cref="Dispose"/>. Within a block, every channel has its own
+/// columns of timestamps, values and qualities, sorted by timestamp and compressed separately.
+/// Segments are only ever appended to, a block interrupted by a crash is dropped by the next flush to its segment.
+/// Timestamps are archived in UTC. There should be one writer per directory. Not thread safe.
+/// </remarks>
+public sealed class TimeSeriesArchiveWriter : IDisposable
+{
+    private static readonly ValidateResult Ok = new ValidateResult.Ok();
+
+    private readonly string _directory;
+    private readonly int _maxBufferedValues;
+    private readonly ValidateData _stage;
+
+    private readonly List<StagedValue> _staged = new();
+    private readonly Dictionary<DataChannel.DataChannel, string> _localIds = new(ReferenceComparer.Instance);
+    private readonly SortedDictionary<DateTime, Dictionary<(string LocalId, ValueKind Kind), ColumnBuffer>> _days =
+        new();
+    private readonly Dictionary<DateTime, SegmentState> _segments = new();
+    private int _bufferedValues;
+    private bool _disposed;
+
+    /// <param name="directory">The archive directory, created if it doesn't exist.</param>
+    /// <param name="maxBufferedValues">The number of buffered values that triggers a flush.</param>
+    public TimeSeriesArchiveWriter(string directory, int maxBufferedValues = 1_000_000)
+    {
+        if (string.IsNullOrEmpty(directory))
+            throw new ArgumentException("Archive directory is required", nameof(directory));
+        if (maxBufferedValues <= 0)
+            throw new ArgumentException($"Invalid buffer size {maxBufferedValues}", nameof(maxBufferedValues));
+
+        Directory.CreateDirectory(directory);
+        _directory = directory;
+        _maxBufferedValues = maxBufferedValues;
+        _stage = Stage;
+    }
+
+    /// <summary>Validates the package against <paramref name="dcPackage"/>, and archives it if it is valid.</summary>
+    /// <remarks>A package is archived whole or not at all.</remarks>
+    /// <returns>The result of <see cref="TimeSeriesData.Validate(DataChannelListPackage, ValidateData, ValidateData)"/>
+    /// for every <see cref="TimeSeriesData"/> of the package.</returns>
+    public ValidateResult Append(TimeSeriesDataPackage package, DataChannelListPackage dcPackage)
+    {
+        if (package is null)
+            throw new ArgumentNullException(nameof(package));
+
+        var messages = new List<string>();
+        foreach (var data in package.Package.TimeSeriesData)
+        {
+            if (Validate(data, dcPackage) is ValidateResult.Invalid invalid)
+                messages.AddRange(invalid.Messages);
+        }
+        return Commit(messages);
+    }
+
+    /// <summary>Validates the data against <paramref name="dcPackage"/>, and archives it if it is valid.</summary>
+    public ValidateResult Append(TimeSeriesData data, DataChannelListPackage dcPackage)
+    {
+        if (data is null)
+            throw new ArgumentNullException(nameof(data));
+
+        var messages = new List<string>();
+        if (Validate(data, dcPackage) is ValidateResult.Invalid invalid)
+            messages.AddRange(invalid.Messages);
+        return Commit(messages);
+    }
+
+    private ValidateResult Validate(TimeSeriesData data, DataChannelListPackage dcPackage)
+    {
+        if (dcPackage is null)
+            throw new ArgumentNullException(nameof(dcPackage));
+        if (_disposed)
+            throw new ObjectDisposedException(nameof(TimeSeriesArchiveWriter));
+
+        // Ordered, so the values are staged on this thread
+        return data.Validate(dcPackage, _stage, _stage, parallel: true, ordered: true);
+    }
+
+    private ValidateResult Stage(
+        DateTimeOffset timeStamp,
+        DataChannel.DataChannel dataChannel,
+        Value value,
+        string? quality
+    )
+    {
+        if (!_localIds.TryGetValue(dataChannel, out var localId))
+        {
+            localId = dataChannel.DataChannelId.LocalId.ToString();
+            _localIds.Add(dataChannel, localId);
+        }
+        _staged.Add(new StagedValue(timeStamp.UtcTicks, localId, value, quality));
+        return Ok;
+    }
+
+    private ValidateResult Commit(List<string> messages)
+    {
+        if (messages.Count > 0)
+        {
+            _staged.Clear();
+            return new ValidateResult.Invalid(messages.ToArray());
+        }
+
+        foreach (var staged in _staged)
+        {
+            var day = new DateTime(staged.Ticks - staged.Ticks % System.TimeSpan.TicksPerDay, DateTimeKind.Utc);
+            if (!_days.TryGetValue(day, out var columns))
+                _days.Add(day, columns = new());
+            var key = (staged.LocalId, ArchiveFormat.KindOf(staged.Value));
+            if (!columns.TryGetValue(key, out var column))
+                columns.Add(key, column = new ColumnBuffer());
+            column.Add(staged.Ticks, staged.Value, staged.Quality);
+        }
+        _bufferedValues += _staged.Count;
+        _staged.Clear();
+
+        if (_bufferedValues >= _maxBufferedValues)
+            Flush();
+        return Ok;
+    }
+
+    /// <summary>Appends the buffered values to the segments of their days.</summary>
+    public void Flush()
+    {
+        if (_disposed)
+            throw new ObjectDisposedException(nameof(TimeSeriesArchiveWriter));
+
+        var body = new ArchiveBuffer(64 * 1024);
+        foreach (var day in _days.ToList())
+        {
+            try
+            {
+                AppendBlock(day.Key, day.Value, body);
+            }
+            catch
+            {
+                // The segment is reopened on the next flush, dropping a partially written block
+                _segments.Remove(day.Key);
+                throw;
+            }
+            _days.Remove(day.Key);
+            _bufferedValues -= day.Value.Values.Sum(c => c.Count);
+        }
+        _localIds.Clear();
+    }
+
+    private void AppendBlock(
+        DateTime day,
+        Dictionary<(string LocalId, ValueKind Kind), ColumnBuffer> columns,
+        ArchiveBuffer body
+    )
+    {
+        var path = Path.Combine(_directory, day.ToString(ArchiveFormat.DayFormat, CultureInfo.InvariantCulture))
+            + ArchiveFormat.Extension;
+        var segment = OpenSegment(day, path);
+
+        // LocalId dictionary entries of the channels new to the segment
+        body.Clear();
+        body.WriteVarint((ulong)segment.Keys.Count);
+        var added = columns.Keys.Select(c => c.LocalId).Distinct().Where(id => !segment.Keys.ContainsKey(id)).ToList();
+        body.WriteVarint((ulong)added.Count);
+        foreach (var localId in added)
+        {
+            segment.Keys.Add(localId, segment.Keys.Count);
+            body.WriteString(localId);
+        }
+
+        // Column directory, then the streams
+        var raw = new ArchiveBuffer();
+        var streams = new ArchiveBuffer(64 * 1024);
+        body.WriteVarint((ulong)columns.Count);
+        foreach (var column in columns.OrderBy(c => segment.Keys[c.Key.LocalId]).ThenBy(c => c.Key.Kind))
+        {
+            var (ticks, values, qualities) = column.Value.Sorted();
+            body.WriteVarint((ulong)segment.Keys[column.Key.LocalId]);
+            body.WriteByte((byte)column.Key.Kind);
+            body.WriteInt64(ticks[0]);
+            body.WriteInt64(ticks[ticks.Length - 1]);
+            body.WriteVarint((ulong)ticks.Length);
+
+            raw.Clear();
+            ArchiveFormat.EncodeTimestamps(raw, ticks);
+            WriteStream(raw, streams, body);
+            raw.Clear();
+            ArchiveFormat.EncodeValues(raw, column.Key.Kind, values);
+            WriteStream(raw, streams, body);
+            raw.Clear();
+            if (qualities.Any(q => q is not null))
+                ArchiveFormat.EncodeStrings(raw, qualities);
+            WriteStream(raw, streams, body);
+        }
+        body.Write(streams);
+
+        var header = new ArchiveBuffer(ArchiveFormat.BlockHeaderLength);
+        header.WriteUInt32(ArchiveFormat.BlockMagic);
+        header.WriteInt32(body.Length);
+
+        using var file = new FileStream(path, FileMode.OpenOrCreate, FileAccess.Write, FileShare.Read);
+        if (file.Length != segment.Length)
+            file.SetLength(segment.Length);
+        file.Seek(0, SeekOrigin.End);
+        if (segment.Length == 0)
+            file.Write(ArchiveFormat.SegmentMagic.ToArray(), 0, ArchiveFormat.SegmentMagic.Length);
+        file.Write(header.Array, 0, header.Length);
+        file.Write(body.Array, 0, body.Length);
+        file.Flush(flushToDisk: true);
+        segment.Length = file.Length;
+    }
+
+    private static void WriteStream(ArchiveBuffer raw, ArchiveBuffer streams, ArchiveBuffer directory)
+    {
+        var start = streams.Length;
+        var codec = ArchiveFormat.Compress(raw, streams);
+        directory.WriteByte((byte)codec);
+        directory.WriteVarint((ulong)(streams.Length - start));
+        directory.WriteVarint((ulong)raw.Length);
+    }
+
+    private SegmentState OpenSegment(DateTime day, string path)
+    {
+        // Reread when the file changed since our last flush, e.g. it was cut short by a crash
+        var length = File.Exists(path) ? new FileInfo(path).Length : 0;
+        if (_segments.TryGetValue(day, out var segment) && segment.Length == length)
+            return segment;
+
+        segment = new SegmentState();
+        if (length > 0)
+        {
+            using var existing = ArchiveSegment.Open(path);
+            for (var i = 0; i < existing.Dictionary.Count; i++)
+                segment.Keys.Add(existing.Dictionary[i], i);
+            segment.Length = existing.ValidLength;
+        }
+        _segments[day] = segment;
+        return segment;
+    }
+
+    public void Dispose()
+    {
+        if (_disposed)
+            return;
+        Flush();
+        _disposed = true;
+    }
+
+    private readonly record struct StagedValue(long Ticks, string LocalId, Value Value, string? Quality);
+
+    private sealed class SegmentState
+    {
+        public Dictionary<string, int> Keys { get; } = new(StringComparer.Ordinal);
+
+        /// <summary>The length of the segment's complete blocks, 0 for a new segment.</summary>
+        public long Length { get; set; }
+    }
+
+    private sealed class ColumnBuffer
+    {
+        private readonly List<long> _ticks = new();
+        private readonly List<Value> _values = new();
+        private readonly List<string?> _qualities = new();
+        private bool _sorted = true;
+
+        public int Count => _ticks.Count;
+
+        public void Add(long ticks, Value value, string? quality)
+        {
+            if (_ticks.Count > 0 && ticks < _ticks[_ticks.Count - 1])
+                _sorted = false;
+            _ticks.Add(ticks);
+            _values.Add(value);
+            _qualities.Add(quality);
+        }
+
+        public (long[] Ticks, Value[] Values, string?[] Qualities) Sorted()
+        {
+            if (_sorted)
+                return (_ticks.ToArray(), _values.ToArray(), _qualities.ToArray());
+
+            // Stable, so values of the same timestamp keep the order they were appended in
+            var order = Enumerable.Range(0, _ticks.Count).OrderBy(i => _ticks[i]).ToArray();
+            return (
+                order.Select(i => _ticks[i]).ToArray(),
+                order.Select(i => _values[i]).ToArray(),
+                order.Select(i => _qualities[i]).ToArray()
+            );
+        }
+    }
+
+    private sealed class ReferenceComparer : IEqualityComparer<DataChannel.DataChannel>
+    {
+        public static readonly ReferenceComparer Instance = new();
+
+        public bool Equals(DataChannel.DataChannel? x, DataChannel.DataChannel? y) => ReferenceEquals(x, y);
+
+        public int GetHashCode(DataChannel.DataChannel obj) => RuntimeHelpers.GetHashCode(obj);
+    }
+}
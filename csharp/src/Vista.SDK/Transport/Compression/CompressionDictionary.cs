@@ -0,0 +1,222 @@
+using System.Text;
+
+namespace Vista.SDK.Transport.Compression;
+
+/// <summary>Preset deflate dictionary for ISO19848 JSON packages of a single VIS version.</summary>
+/// <remarks>
+/// The dictionaries ship as resources and are part of the wire format of <see cref="DictionaryCompression"/>,
+/// the bytes of a released dictionary must never change. <see cref="Id"/> is the zlib DICTID (Adler-32) of the bytes.
+/// </remarks>
+public sealed class CompressionDictionary
+{
+    /// <summary>Deflate can only reference the last 32 KiB, zlib keeps 262 bytes of that as lookahead.</summary>
+    internal const int MaxLength = 32 * 1024 - 262;
+
+    private static readonly Lazy<CompressionDictionary[]> _dictionaries = new(Load);
+
+    public VisVersion VisVersion { get; }
+
+    public uint Id { get; }
+
+    public int Length => Data.Length;
+
+    internal byte[] Data { get; }
+
+    /// <summary>The dictionary as a single stored (uncompressed) deflate block that isn't final.</summary>
+    /// <remarks>
+    /// Inflating it primes the window with the dictionary, the payload then continues at a block boundary.
+    /// </remarks>
+    internal byte[] StoredBlock { get; }
+
+    private CompressionDictionary(VisVersion visVersion, byte[] data)
+    {
+        if (data.Length > MaxLength)
+            throw new InvalidOperationException(
+                $"Compression dictionary for {visVersion.ToVersionString()} is larger than {MaxLength} bytes"
+            );
+
+        VisVersion = visVersion;
+        Data = data;
+        Id = DictionaryCompression.Adler32(1, data);
+
+        var block = new byte[5 + data.Length];
+        block[1] = (byte)data.Length;
+        block[2] = (byte)(data.Length >> 8);
+        block[3] = (byte)~block[1];
+        block[4] = (byte)~block[2];
+        Buffer.BlockCopy(data, 0, block, 5, data.Length);
+        StoredBlock = block;
+    }
+
+    public static CompressionDictionary Get(VisVersion visVersion)
+    {
+        foreach (var dictionary in _dictionaries.Value)
+        {
+            if (dictionary.VisVersion == visVersion)
+                return dictionary;
+        }
+
+        throw new ArgumentException("No compression dictionary for VIS version " + visVersion.ToVersionString());
+    }
+
+    internal static bool TryGet(uint id, out CompressionDictionary dictionary)
+    {
+        foreach (var d in _dictionaries.Value)
+        {
+            if (d.Id == id)
+            {
+                dictionary = d;
+                return true;
+            }
+        }
+
+        dictionary = null!;
+        return false;
+    }
+
+    private static CompressionDictionary[] Load()
+    {
+        var dictionaries = new List<CompressionDictionary>();
+        foreach (var visVersion in VisVersions.All)
+        {
+            var data = EmbeddedResource.GetCompressionDictionary(visVersion.ToVersionString());
+            if (data is not null)
+                dictionaries.Add(new CompressionDictionary(visVersion, data));
+        }
+        return dictionaries.ToArray();
+    }
+
+    /// <summary>Builds the dictionary the way the shipped resources were built.</summary>
+    /// <remarks>
+    /// Deflate matches closer to the data are cheaper, so the layout is, from first to last:
+    /// Gmod codes by decreasing depth, codebook standard values, and the JSON structure of the ISO19848 packages.
+    /// Gmod codes fill whatever room is left, shallow nodes first since they are part of the most paths.
+    /// </remarks>
+    internal static byte[] Train(Gmod gmod, Codebooks codebooks)
+    {
+        if (gmod.VisVersion != codebooks.VisVersion)
+            throw new ArgumentException(
+                $"Codebooks are VIS version {codebooks.VisVersion}, expected {gmod.VisVersion}",
+                nameof(codebooks)
+            );
+
+        var structure = string.Concat(Structure).Replace("{vis}", gmod.VisVersion.ToVersionString());
+
+        var tags = new StringBuilder("meta/");
+        foreach (var name in Tags)
+        {
+            var prefix = CodebookNames.ToPrefix(name);
+            var values = codebooks[name].StandardValues.ToList();
+            values.Sort(StringComparer.Ordinal);
+            foreach (var value in values)
+                tags.Append(prefix).Append('-').Append(value).Append('/');
+        }
+
+        var room = MaxLength - Encoding.UTF8.GetByteCount(structure) - Encoding.UTF8.GetByteCount(tags.ToString());
+        if (room < 0)
+            throw new InvalidOperationException("Codebooks don't fit in a compression dictionary");
+
+        var codes = new List<string>();
+        var depths = new Dictionary<GmodNode, int> { [gmod.RootNode] = 0 };
+        var queue = new Queue<GmodNode>();
+        queue.Enqueue(gmod.RootNode);
+        while (queue.Count > 0)
+        {
+            var node = queue.Dequeue();
+            var children = node.Children.Where(c => !depths.ContainsKey(c)).ToList();
+            children.Sort((a, b) => string.CompareOrdinal(a.Code, b.Code));
+            foreach (var child in children)
+            {
+                depths[child] = depths[node] + 1;
+                queue.Enqueue(child);
+
+                var length = Encoding.UTF8.GetByteCount(child.Code) + 1;
+                if (length > room)
+                {
+                    queue.Clear();
+                    break;
+                }
+                room -= length;
+                codes.Add(child.Code);
+            }
+        }
+
+        var dictionary = new StringBuilder(MaxLength);
+        for (var i = codes.Count - 1; i >= 0; i--)
+            dictionary.Append(codes[i]).Append('/');
+        dictionary.Append(tags).Append(structure);
+
+        return Encoding.UTF8.GetBytes(dictionary.ToString());
+    }
+
+    // Codebooks used in LocalId metadata, most common last
+    private static readonly CodebookName[] Tags =
+    [
+        CodebookName.Command,
+        CodebookName.Type,
+        CodebookName.Calculation,
+        CodebookName.Position,
+        CodebookName.State,
+        CodebookName.Content,
+        CodebookName.Quantity,
+    ];
+
+    // Compact JSON as written by the serializers, most common fragments last
+    private static readonly string[] Structure =
+    [
+        "\"Restriction\":{\"Enumeration\":[\"",
+        "\"Pattern\":\"",
+        "\"MinLength\":",
+        "\"MaxLength\":",
+        "\"TotalDigits\":",
+        "\"MinInclusive\":",
+        "\"MaxInclusive\":",
+        "\"Remarks\":\"",
+        "\"CalculationPeriod\":",
+        "\"NameObject\":{\"NamingRule\":\"",
+        "{\"Package\":{\"Header\":{\"ShipID\":\"IMO",
+        "\",\"DataChannelListID\":{\"ID\":\"",
+        "\",\"Version\":\"1\",\"TimeStamp\":\"",
+        "\"},\"VersionInformation\":{\"NamingRule\":\"dnv\",\"NamingSchemeVersion\":\"v2\","
+            + "\"ReferenceURL\":\"https://docs.vista.dnv.com\"},\"Author\":\"",
+        "\",\"DateCreated\":\"",
+        "\"},\"DataChannelList\":{\"DataChannel\":[",
+        "{\"Package\":{\"Header\":{\"ShipID\":\"IMO",
+        "\",\"TimeSpan\":{\"Start\":\"",
+        "\",\"End\":\"",
+        "\"},\"DateCreated\":\"",
+        "\",\"DateModified\":\"",
+        "\",\"Author\":\"",
+        "\",\"SystemConfiguration\":[{\"ID\":\"",
+        "\",\"TimeStamp\":\"",
+        "\"}]},\"TimeSeriesData\":[{\"DataConfiguration\":{\"ID\":\"",
+        "\",\"TimeStamp\":\"",
+        "\"},\"EventData\":{\"NumberOfDataSet\":",
+        ",\"DataSet\":[{\"TimeStamp\":\"",
+        "\",\"DataChannelID\":\"",
+        "\",\"Value\":\"",
+        "\",\"Quality\":\"0\"},{\"TimeStamp\":\"",
+        "\"},\"TabularData\":[{\"NumberOfDataSet\":",
+        ",\"NumberOfDataChannel\":",
+        ",\"DataChannelID\":[\"",
+        "\",\"",
+        "\"],\"DataSet\":[{\"TimeStamp\":\"",
+        "\",\"Value\":[\"",
+        "\"],\"Quality\":[\"0\",\"0\",\"0\",\"0\"]},{\"TimeStamp\":\"",
+        "{\"DataChannelID\":{\"LocalID\":\"/dnv-v2/vis-{vis}/",
+        "\",\"ShortID\":\"",
+        "\"},\"Property\":{\"DataChannelType\":{\"Type\":\"Alert\",\"UpdateCycle\":1},"
+            + "\"Format\":{\"Type\":\"String\"},\"AlertPriority\":\"",
+        "\",\"Name\":\"",
+        "\"}},",
+        "{\"DataChannelID\":{\"LocalID\":\"/dnv-v2/vis-{vis}/",
+        "/meta/qty-",
+        "\",\"ShortID\":\"",
+        "\"},\"Property\":{\"DataChannelType\":{\"Type\":\"Inst\",\"UpdateCycle\":1},"
+            + "\"Format\":{\"Type\":\"Decimal\",\"Restriction\":{\"FractionDigits\":1}},"
+            + "\"Range\":{\"High\":100,\"Low\":0},\"Unit\":{\"UnitSymbol\":\"",
+        "\",\"QuantityName\":\"",
+        "\"},\"QualityCoding\":\"OPC_QUALITY\",\"Name\":\"",
+        "\"}},",
+    ];
+}
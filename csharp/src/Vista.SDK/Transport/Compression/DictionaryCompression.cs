@@ -0,0 +1,468 @@
+using System.Buffers;
+using System.IO.Compression;
+
+namespace Vista.SDK.Transport.Compression;
+
+/// <summary>Compression of ISO19848 JSON packages with the preset dictionary of their VIS version.</summary>
+/// <remarks>
+/// The payload is a standard zlib stream (RFC 1950) with a preset dictionary, the DICTID in its header identifies the
+/// <see cref="CompressionDictionary"/>. Other zlib implementations read it given the dictionary bytes, e.g. Python
+/// <c>zlib.decompressobj(zdict=...)</c> or Node <c>zlib.inflateSync(buffer, { dictionary })</c>.
+/// A payload is a whole stream, decompression reads its input to the end to check the Adler-32 trailer.
+/// </remarks>
+public static class DictionaryCompression
+{
+    /// <summary>Creates a stream that compresses what is written to it into <paramref name="output"/>.</summary>
+    /// <remarks>The payload is complete when the returned stream is disposed.</remarks>
+    /// <exception cref="PlatformNotSupportedException">
+    /// The runtime's DeflateStream doesn't flush, e.g. .NET Framework.
+    /// </exception>
+    public static Stream CreateCompressionStream(
+        Stream output,
+        VisVersion visVersion,
+        CompressionLevel level = CompressionLevel.Optimal,
+        bool leaveOpen = false
+    )
+    {
+        if (output is null)
+            throw new ArgumentNullException(nameof(output));
+
+        return new CompressionStream(output, CompressionDictionary.Get(visVersion), level, leaveOpen);
+    }
+
+    /// <summary>Creates a stream that decompresses <paramref name="input"/>.</summary>
+    /// <remarks>The dictionary is picked from the DICTID of the payload, regardless of VIS version.</remarks>
+    /// <exception cref="InvalidDataException">
+    /// The payload is not compressed with a known dictionary, or is corrupt.
+    /// </exception>
+    public static Stream CreateDecompressionStream(Stream input, bool leaveOpen = false)
+    {
+        if (input is null)
+            throw new ArgumentNullException(nameof(input));
+
+        return new DecompressionStream(input, leaveOpen);
+    }
+
+    public static byte[] Compress(byte[] data, VisVersion visVersion, CompressionLevel level = CompressionLevel.Optimal)
+    {
+        if (data is null)
+            throw new ArgumentNullException(nameof(data));
+
+        var output = new MemoryStream(data.Length / 4 + 64);
+        using (var stream = CreateCompressionStream(output, visVersion, level, leaveOpen: true))
+            stream.Write(data, 0, data.Length);
+        return output.ToArray();
+    }
+
+    public static byte[] Decompress(byte[] payload)
+    {
+        if (payload is null)
+            throw new ArgumentNullException(nameof(payload));
+
+        var output = new MemoryStream(payload.Length * 4);
+        using (var stream = CreateDecompressionStream(new MemoryStream(payload, writable: false)))
+            stream.CopyTo(output);
+        return output.ToArray();
+    }
+
+    private const int HeaderLength = 6;
+    private const byte Deflate32K = 0x78;
+    private const byte PresetDictionary = 0x20;
+
+    internal static uint Adler32(uint adler, ReadOnlySpan<byte> data)
+    {
+        const uint Base = 65521;
+        // Largest n such that 255n(n+1)/2 + (n+1)(Base-1) fits in 32 bits
+        const int MaxRun = 5552;
+
+        uint a = adler & 0xFFFF;
+        uint b = adler >> 16;
+        while (data.Length > 0)
+        {
+            var run = Math.Min(data.Length, MaxRun);
+            for (var i = 0; i < run; i++)
+            {
+                a += data[i];
+                b += a;
+            }
+            a %= Base;
+            b %= Base;
+            data = data.Slice(run);
+        }
+        return (b << 16) | a;
+    }
+
+    private static void WriteUInt32BigEndian(Span<byte> destination, uint value)
+    {
+        destination[0] = (byte)(value >> 24);
+        destination[1] = (byte)(value >> 16);
+        destination[2] = (byte)(value >> 8);
+        destination[3] = (byte)value;
+    }
+
+    private static uint ReadUInt32BigEndian(ReadOnlySpan<byte> source) =>
+        (uint)source[0] << 24 | (uint)source[1] << 16 | (uint)source[2] << 8 | source[3];
+
+    private sealed class CompressionStream : Stream
+    {
+        private readonly Stream _output;
+        private readonly bool _leaveOpen;
+        private readonly PrimingSink _sink;
+        private DeflateStream? _deflate;
+        private uint _adler = 1;
+
+        public CompressionStream(
+            Stream output,
+            CompressionDictionary dictionary,
+            CompressionLevel level,
+            bool leaveOpen
+        )
+        {
+            _output = output;
+            _leaveOpen = leaveOpen;
+
+            var header = new byte[HeaderLength];
+            header[0] = Deflate32K;
+            // FLEVEL 2 (default) with FDICT, FCHECK makes the first two bytes a multiple of 31
+            header[1] = (2 << 6) | PresetDictionary;
+            header[1] += (byte)((31 - (header[0] << 8 | header[1]) % 31) % 31);
+            WriteUInt32BigEndian(header.AsSpan(2), dictionary.Id);
+            output.Write(header, 0, header.Length);
+
+            // Deflating the dictionary and flushing leaves the compressor with the dictionary as history, at a
+            // byte aligned block boundary. The output is dropped, readers prime their window from the stored block.
+            _sink = new PrimingSink(output);
+            _deflate = new DeflateStream(_sink, level, leaveOpen: true);
+            _deflate.Write(dictionary.Data, 0, dictionary.Length);
+            _deflate.Flush();
+            if (!_sink.EndsWithSyncFlush)
+                throw new PlatformNotSupportedException("DeflateStream.Flush doesn't flush on this runtime");
+            _sink.Priming = false;
+        }
+
+        private DeflateStream Deflate => _deflate ?? throw new ObjectDisposedException(nameof(CompressionStream));
+
+        public override bool CanRead => false;
+        public override bool CanSeek => false;
+        public override bool CanWrite => _deflate is not null;
+        public override long Length => throw new NotSupportedException();
+
+        public override long Position
+        {
+            get => throw new NotSupportedException();
+            set => throw new NotSupportedException();
+        }
+
+        public override void Write(byte[] buffer, int offset, int count)
+        {
+            var deflate = Deflate;
+            _adler = Adler32(_adler, buffer.AsSpan(offset, count));
+            deflate.Write(buffer, offset, count);
+        }
+
+#if NET8_0_OR_GREATER
+        public override void Write(ReadOnlySpan<byte> buffer)
+        {
+            var deflate = Deflate;
+            _adler = Adler32(_adler, buffer);
+            deflate.Write(buffer);
+        }
+#endif
+
+        public override void Flush() => Deflate.Flush();
+
+        public override int Read(byte[] buffer, int offset, int count) => throw new NotSupportedException();
+
+        public override long Seek(long offset, SeekOrigin origin) => throw new NotSupportedException();
+
+        public override void SetLength(long value) => throw new NotSupportedException();
+
+        protected override void Dispose(bool disposing)
+        {
+            try
+            {
+                if (disposing && _deflate is not null)
+                {
+                    _deflate.Dispose();
+                    _deflate = null;
+
+                    var trailer = new byte[4];
+                    WriteUInt32BigEndian(trailer, _adler);
+                    _output.Write(trailer, 0, trailer.Length);
+                    if (!_leaveOpen)
+                        _output.Dispose();
+                }
+            }
+            finally
+            {
+                base.Dispose(disposing);
+            }
+        }
+    }
+
+    /// <summary>Output of the DeflateStream, drops what is written while priming.</summary>
+    private sealed class PrimingSink(Stream output) : Stream
+    {
+        private uint _tail;
+
+        public bool Priming { get; set; } = true;
+
+        /// <summary>Whether the dropped output ends with the empty stored block of a sync flush.</summary>
+        public bool EndsWithSyncFlush => _tail == 0x0000FFFF;
+
+        public override bool CanRead => false;
+        public override bool CanSeek => false;
+        public override bool CanWrite => true;
+        public override long Length => throw new NotSupportedException();
+
+        public override long Position
+        {
+            get => throw new NotSupportedException();
+            set => throw new NotSupportedException();
+        }
+
+        public override void Write(byte[] buffer, int offset, int count)
+        {
+            if (!Priming)
+            {
+                output.Write(buffer, offset, count);
+                return;
+            }
+
+            for (var i = offset; i < offset + count; i++)
+                _tail = _tail << 8 | buffer[i];
+        }
+
+#if NET8_0_OR_GREATER
+        public override void Write(ReadOnlySpan<byte> buffer)
+        {
+            if (!Priming)
+            {
+                output.Write(buffer);
+                return;
+            }
+
+            foreach (var b in buffer)
+                _tail = _tail << 8 | b;
+        }
+#endif
+
+        public override void Flush() => output.Flush();
+
+        public override int Read(byte[] buffer, int offset, int count) => throw new NotSupportedException();
+
+        public override long Seek(long offset, SeekOrigin origin) => throw new NotSupportedException();
+
+        public override void SetLength(long value) => throw new NotSupportedException();
+    }
+
+    private sealed class DecompressionStream : Stream
+    {
+        private readonly Stream _input;
+        private readonly bool _leaveOpen;
+        private readonly PrimedSource _source;
+        private DeflateStream? _inflate;
+        private uint _adler = 1;
+        private bool _checked;
+
+        public DecompressionStream(Stream input, bool leaveOpen)
+        {
+            _input = input;
+            _leaveOpen = leaveOpen;
+
+            var header = new byte[HeaderLength];
+            var read = 0;
+            while (read < header.Length)
+            {
+                var n = input.Read(header, read, header.Length - read);
+                if (n == 0)
+                    throw new InvalidDataException("Compressed payload is too short");
+                read += n;
+            }
+
+            if (header[0] != Deflate32K || (header[0] << 8 | header[1]) % 31 != 0)
+                throw new InvalidDataException("Compressed payload is not a zlib stream");
+            if ((header[1] & PresetDictionary) == 0)
+                throw new InvalidDataException("Compressed payload has no preset dictionary");
+
+            var id = ReadUInt32BigEndian(header.AsSpan(2));
+            if (!CompressionDictionary.TryGet(id, out var dictionary))
+                throw new InvalidDataException($"Unknown compression dictionary {id:X8}");
+
+            _source = new PrimedSource(dictionary.StoredBlock, input);
+            _inflate = new DeflateStream(_source, CompressionMode.Decompress, leaveOpen: true);
+
+            var scratch = ArrayPool<byte>.Shared.Rent(4096);
+            try
+            {
+                var skip = dictionary.Length;
+                while (skip > 0)
+                {
+                    var n = _inflate.Read(scratch, 0, Math.Min(skip, scratch.Length));
+                    if (n == 0)
+                        throw new InvalidDataException("Compressed payload is corrupt");
+                    skip -= n;
+                }
+            }
+            finally
+            {
+                ArrayPool<byte>.Shared.Return(scratch);
+            }
+        }
+
+        private DeflateStream Inflate => _inflate ?? throw new ObjectDisposedException(nameof(DecompressionStream));
+
+        public override bool CanRead => _inflate is not null;
+        public override bool CanSeek => false;
+        public override bool CanWrite => false;
+        public override long Length => throw new NotSupportedException();
+
+        public override long Position
+        {
+            get => throw new NotSupportedException();
+            set => throw new NotSupportedException();
+        }
+
+        public override int Read(byte[] buffer, int offset, int count)
+        {
+            var n = Inflate.Read(buffer, offset, count);
+            _adler = Adler32(_adler, buffer.AsSpan(offset, n));
+            if (n == 0 && count > 0)
+                CheckTrailer();
+            return n;
+        }
+
+#if NET8_0_OR_GREATER
+        public override int Read(Span<byte> buffer)
+        {
+            var n = Inflate.Read(buffer);
+            _adler = Adler32(_adler, buffer.Slice(0, n));
+            if (n == 0 && buffer.Length > 0)
+                CheckTrailer();
+            return n;
+        }
+#endif
+
+        // The inflater reads ahead, so the trailer is whatever the input ends with
+        private void CheckTrailer()
+        {
+            if (_checked)
+                return;
+
+            _source.ReadToEnd();
+            if (!_source.HasTail || _source.Tail != _adler)
+                throw new InvalidDataException("Compressed payload failed the Adler-32 check");
+            _checked = true;
+        }
+
+        public override void Flush() { }
+
+        public override long Seek(long offset, SeekOrigin origin) => throw new NotSupportedException();
+
+        public override void SetLength(long value) => throw new NotSupportedException();
+
+        public override void Write(byte[] buffer, int offset, int count) => throw new NotSupportedException();
+
+        protected override void Dispose(bool disposing)
+        {
+            try
+            {
+                if (disposing && _inflate is not null)
+                {
+                    _inflate.Dispose();
+                    _inflate = null;
+                    if (!_leaveOpen)
+                        _input.Dispose();
+                }
+            }
+            finally
+            {
+                base.Dispose(disposing);
+            }
+        }
+    }
+
+    /// <summary>Input of the inflater, the dictionary as a stored block followed by the payload.</summary>
+    private sealed class PrimedSource(byte[] storedBlock, Stream input) : Stream
+    {
+        private int _position;
+        private long _inputRead;
+
+        public uint Tail { get; private set; }
+
+        public bool HasTail => _inputRead >= 4;
+
+        public override bool CanRead => true;
+        public override bool CanSeek => false;
+        public override bool CanWrite => false;
+        public override long Length => throw new NotSupportedException();
+
+        public override long Position
+        {
+            get => throw new NotSupportedException();
+            set => throw new NotSupportedException();
+        }
+
+        public override int Read(byte[] buffer, int offset, int count)
+        {
+            if (_position < storedBlock.Length)
+            {
+                var n = Math.Min(count, storedBlock.Length - _position);
+                Buffer.BlockCopy(storedBlock, _position, buffer, offset, n);
+                _position += n;
+                return n;
+            }
+
+            var read = input.Read(buffer, offset, count);
+            Track(buffer.AsSpan(offset, read));
+            return read;
+        }
+
+#if NET8_0_OR_GREATER
+        public override int Read(Span<byte> buffer)
+        {
+            if (_position < storedBlock.Length)
+            {
+                var n = Math.Min(buffer.Length, storedBlock.Length - _position);
+                storedBlock.AsSpan(_position, n).CopyTo(buffer);
+                _position += n;
+                return n;
+            }
+
+            var read = input.Read(buffer);
+            Track(buffer.Slice(0, read));
+            return read;
+        }
+#endif
+
+        public void ReadToEnd()
+        {
+            var scratch = ArrayPool<byte>.Shared.Rent(4096);
+            try
+            {
+                while (Read(scratch, 0, scratch.Length) > 0) { }
+            }
+            finally
+            {
+                ArrayPool<byte>.Shared.Return(scratch);
+            }
+        }
+
+        private void Track(ReadOnlySpan<byte> read)
+        {
+            _inputRead += read.Length;
+            if (read.Length > 4)
+                read = read.Slice(read.Length - 4);
+            foreach (var b in read)
+                Tail = Tail << 8 | b;
+        }
+
+        public override void Flush() { }
+
+        public override long Seek(long offset, SeekOrigin origin) => throw new NotSupportedException();
+
+        public override void SetLength(long value) => throw new NotSupportedException();
+
+        public override void Write(byte[] buffer, int offset, int count) => throw new NotSupportedException();
+    }
+}
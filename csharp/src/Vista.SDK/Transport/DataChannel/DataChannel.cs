@@ -1,6 +1,7 @@
 using System.Collections;
 using System.Diagnostics.CodeAnalysis;
 using System.Text.RegularExpressions;
+using Vista.SDK.Internal;
 
 namespace Vista.SDK.Transport.DataChannel;
 
@@ -48,26 +49,96 @@ public sealed record VersionInformation
 }
 
 // DataChannelList
-public sealed record DataChannelList() : ICollection<DataChannel>
+public sealed partial record DataChannelList() : ICollection<DataChannel>
 {
     private List<DataChannel> dataChannels = new();
     private Dictionary<string, DataChannel> shortIdMap = new();
+    // UUID shaped ShortIds are also keyed by their 128-bit value, for lookups from parsed TimeSeriesData
+    private ShortIdTable<DataChannel> shortIdKeyMap = new();
     private Dictionary<LocalId, DataChannel> localIdMap = new();
+    private bool isReadOnly;
 
-    public IReadOnlyList<DataChannel> DataChannels => dataChannels.AsReadOnly();
+    public IReadOnlyList<DataChannel> DataChannels
+    {
+        get
+        {
+            if (lazy is { } channels)
+                Materialize(channels);
+            return dataChannels.AsReadOnly();
+        }
+    }
 
     public DataChannelList(IReadOnlyList<DataChannel> dataChannels)
         : this() => Add(dataChannels);
 
-    public int Count => dataChannels.Count;
+    public int Count => lazy?.Entries.Length ?? dataChannels.Count;
 
-    public bool IsReadOnly => false;
+    public bool IsReadOnly => isReadOnly;
 
-    public bool TryGetByShortId(string shortId, [MaybeNullWhen(false)] out DataChannel dataChannel) =>
-        shortIdMap.TryGetValue(shortId, out dataChannel);
+    /// <summary>Makes the list and its channels read-only so they can be shared, modifying them then throws.</summary>
+    /// <remarks>
+    /// Every record of a channel is read-only and its custom dictionaries are returned as copies.
+    /// A copy of a record made with a <c>with</c> expression can be modified, its nested records stay read-only.
+    /// A lazy list stays lazy, its channels are made read-only as they are parsed.
+    /// </remarks>
+    public void MakeReadOnly()
+    {
+        isReadOnly = true;
+        if (lazy is { } channels)
+        {
+            MakeReadOnly(channels);
+            return;
+        }
+        foreach (var dataChannel in dataChannels)
+            dataChannel.MakeReadOnly();
+    }
 
-    public bool TryGetByLocalId(LocalId localId, [MaybeNullWhen(false)] out DataChannel dataChannel) =>
-        localIdMap.TryGetValue(localId, out dataChannel);
+    private void ThrowIfReadOnly()
+    {
+        if (isReadOnly)
+            throw new NotSupportedException("The DataChannelList is read-only");
+    }
+
+    public bool TryGetByShortId(string shortId, [MaybeNullWhen(false)] out DataChannel dataChannel)
+    {
+        if (lazy is { } channels)
+        {
+            var found = channels.ShortIds.TryGetValue(shortId, out var entry);
+            dataChannel = found ? Parse(channels, entry!) : null;
+            return found;
+        }
+        return shortIdMap.TryGetValue(shortId, out dataChannel);
+    }
+
+    /// <summary>Looks up a TimeSeriesData ShortId, using the key parsed along with the package when there is one.</summary>
+    internal bool TryGetByShortId(in Transport.DataChannelId id, [MaybeNullWhen(false)] out DataChannel dataChannel)
+    {
+        if (id.TryGetShortIdKey(out var key))
+        {
+            if (lazy is { } channels)
+            {
+                var found = channels.ShortIdKeys.TryGetValue(key, out var entry);
+                dataChannel = found ? Parse(channels, entry!) : null;
+                return found;
+            }
+            return shortIdKeyMap.TryGetValue(key, out dataChannel);
+        }
+
+        var shortId = id.ShortId;
+        if (shortId is null)
+        {
+            dataChannel = null;
+            return false;
+        }
+        return TryGetByShortId(shortId, out dataChannel);
+    }
+
+    public bool TryGetByLocalId(LocalId localId, [MaybeNullWhen(false)] out DataChannel dataChannel)
+    {
+        if (lazy is { } channels)
+            return TryGetLazy(channels, localId, out dataChannel);
+        return localIdMap.TryGetValue(localId, out dataChannel);
+    }
 
     public void Add(DataChannel dataChannel)
     {
@@ -76,105 +147,270 @@ public void Add(DataChannel dataChannel)
 
     public void Add(IEnumerable<DataChannel> dcs)
     {
+        ThrowIfReadOnly();
+        if (lazy is { } channels)
+            Materialize(channels);
+        if (dcs is IReadOnlyCollection<DataChannel> collection)
+            EnsureCapacity(dataChannels.Count + collection.Count);
+
         foreach (var dataChannel in dcs)
         {
             if (localIdMap.ContainsKey(dataChannel.DataChannelId.LocalId))
                 throw new ArgumentException(
                     $"DataChannel with LocalId {dataChannel.DataChannelId.LocalId} already exists"
                 );
-            if (dataChannel.DataChannelId.ShortId is not null)
+            var shortId = dataChannel.DataChannelId.ShortId;
+            if (shortId is not null)
             {
-                if (shortIdMap.ContainsKey(dataChannel.DataChannelId.ShortId))
-                    throw new ArgumentException(
-                        $"DataChannel with ShortId {dataChannel.DataChannelId.ShortId} already exists"
-                    );
-                shortIdMap.Add(dataChannel.DataChannelId.ShortId, dataChannel);
+                if (shortIdMap.ContainsKey(shortId))
+                    throw new ArgumentException($"DataChannel with ShortId {shortId} already exists");
+                shortIdMap.Add(shortId, dataChannel);
+                if (ShortIdKey.TryParse(shortId.AsSpan(), out var key))
+                    shortIdKeyMap.TryAdd(key, dataChannel);
             }
             dataChannels.Add(dataChannel);
             localIdMap.Add(dataChannel.DataChannelId.LocalId, dataChannel);
         }
     }
 
+    // Size the list and every index once for bulk adds, instead of growing them channel by channel
+    private void EnsureCapacity(int capacity)
+    {
+        if (dataChannels.Capacity >= capacity)
+            return;
+
+        dataChannels.Capacity = capacity;
+        shortIdKeyMap.EnsureCapacity(capacity);
+#if NET8_0_OR_GREATER
+        shortIdMap.EnsureCapacity(capacity);
+        localIdMap.EnsureCapacity(capacity);
+#endif
+    }
+
     public void Clear()
     {
+        ThrowIfReadOnly();
+        lazy = null;
         dataChannels.Clear();
         shortIdMap.Clear();
+        shortIdKeyMap.Clear();
         localIdMap.Clear();
     }
 
-    public bool Contains(DataChannel item) => dataChannels.Contains(item);
+    public bool Contains(DataChannel item)
+    {
+        if (lazy is not null)
+            return TryGetByLocalId(item.DataChannelId.LocalId, out var dataChannel) && dataChannel.Equals(item);
+        return dataChannels.Contains(item);
+    }
 
-    public void CopyTo(DataChannel[] array, int arrayIndex) => dataChannels.CopyTo(array, arrayIndex);
+    public void CopyTo(DataChannel[] array, int arrayIndex)
+    {
+        if (lazy is { } channels)
+            Materialize(channels);
+        dataChannels.CopyTo(array, arrayIndex);
+    }
 
-    public IEnumerator<DataChannel> GetEnumerator() => dataChannels.GetEnumerator();
+    public IEnumerator<DataChannel> GetEnumerator() =>
+        lazy is { } channels ? GetLazyEnumerator(channels) : dataChannels.GetEnumerator();
 
     public bool Remove(DataChannel item)
     {
+        ThrowIfReadOnly();
+        if (lazy is { } channels)
+            Materialize(channels);
         if (!localIdMap.Remove(item.DataChannelId.LocalId))
             return false;
-        if (item.DataChannelId.ShortId is not null && !shortIdMap.Remove(item.DataChannelId.ShortId))
-            return false;
+        var shortId = item.DataChannelId.ShortId;
+        if (shortId is not null)
+        {
+            if (!shortIdMap.Remove(shortId))
+                return false;
+            if (ShortIdKey.TryParse(shortId.AsSpan(), out var key))
+                shortIdKeyMap.Remove(key);
+        }
         return dataChannels.Remove(item);
     }
 
     IEnumerator IEnumerable.GetEnumerator() => GetEnumerator();
 
-    public DataChannel this[string shortId] => shortIdMap[shortId];
-    public DataChannel this[int index] => dataChannels[index];
-    public DataChannel this[LocalId localId] => localIdMap[localId];
+    public DataChannel this[string shortId] =>
+        TryGetByShortId(shortId, out var dataChannel)
+            ? dataChannel
+            : throw new KeyNotFoundException($"The given key '{shortId}' was not present in the dictionary.");
+
+    public DataChannel this[int index] =>
+        lazy is { } channels ? Parse(channels, channels.Entries[index]) : dataChannels[index];
+
+    public DataChannel this[LocalId localId] =>
+        TryGetByLocalId(localId, out var dataChannel)
+            ? dataChannel
+            : throw new KeyNotFoundException($"The given key '{localId}' was not present in the dictionary.");
 }
 
 // DataChannel
 public sealed record DataChannel
 {
+    private DataChannelId dataChannelId = null!;
     private Property? property;
+    private ReadOnlyFlag readOnly;
 
-    public required DataChannelId DataChannelId { get; set; }
+    public required DataChannelId DataChannelId
+    {
+        get => dataChannelId;
+        set => dataChannelId = readOnly.Check(this, value);
+    }
     public required Property Property
     {
         get => property ?? throw new InvalidOperationException("Property property not set");
         set
         {
+            readOnly.Check(this, value);
             if (value.Validate() is ValidateResult.Invalid invalid)
                 throw new ArgumentException($"Invalid property - Messages='[{string.Join(", ", invalid.Messages)}]'");
             property = value;
         }
     }
+
+    /// <summary>Makes the channel and its records read-only, a <c>with</c> copy of it can be modified.</summary>
+    internal void MakeReadOnly()
+    {
+        readOnly.Set(this);
+        dataChannelId.MakeReadOnly();
+        property?.MakeReadOnly();
+    }
 }
 
 // DataChannelId
 public sealed record DataChannelId
 {
-    public required LocalId LocalId { get; set; }
-    public required string? ShortId { get; set; }
-    public NameObject? NameObject { get; set; } = new();
+    private LocalId localId = null!;
+    private string? shortId;
+    private NameObject? nameObject = new();
+    private ReadOnlyFlag readOnly;
+
+    public required LocalId LocalId
+    {
+        get => localId;
+        set => localId = readOnly.Check(this, value);
+    }
+    public required string? ShortId
+    {
+        get => shortId;
+        set => shortId = readOnly.Check(this, value);
+    }
+    public NameObject? NameObject
+    {
+        get => nameObject;
+        set => nameObject = readOnly.Check(this, value);
+    }
+
+    internal void MakeReadOnly()
+    {
+        readOnly.Set(this);
+        nameObject?.MakeReadOnly();
+    }
 }
 
 public sealed record NameObject
 {
     public static readonly string AnnexCNamingRule =
         $"/{VersionInformation.AnnexCNamingRule}-{VersionInformation.AnnexCNamingSchemeVersion}";
-    public string NamingRule { get; set; } = AnnexCNamingRule;
-    public Dictionary<string, object>? CustomNameObjects { get; set; }
+
+    private string namingRule = AnnexCNamingRule;
+    private Dictionary<string, object>? customNameObjects;
+    private ReadOnlyFlag readOnly;
+
+    public string NamingRule
+    {
+        get => namingRule;
+        set => namingRule = readOnly.Check(this, value);
+    }
+
+    /// <remarks>A copy when the name object is read-only.</remarks>
+    public Dictionary<string, object>? CustomNameObjects
+    {
+        get => readOnly.IsSet(this) && customNameObjects is not null ? new(customNameObjects) : customNameObjects;
+        set => customNameObjects = readOnly.Check(this, value);
+    }
+
+    internal void MakeReadOnly() => readOnly.Set(this);
 }
 
 // Property
 public sealed record Property
 {
-    public required DataChannelType DataChannelType { get; set; }
-    public required Format Format { get; set; }
-    public required Range? Range { get; set; }
-    public required Unit? Unit { get; set; }
+    private DataChannelType dataChannelType = null!;
+    private Format format = null!;
+    private Range? range;
+    private Unit? unit;
+    private string? qualityCoding;
+    private string? alertPriority;
+    private string? name;
+    private string? remarks;
+    private Dictionary<string, object>? customProperties;
+    private ReadOnlyFlag readOnly;
+
+    public required DataChannelType DataChannelType
+    {
+        get => dataChannelType;
+        set => dataChannelType = readOnly.Check(this, value);
+    }
+    public required Format Format
+    {
+        get => format;
+        set => format = readOnly.Check(this, value);
+    }
+    public required Range? Range
+    {
+        get => range;
+        set => range = readOnly.Check(this, value);
+    }
+    public required Unit? Unit
+    {
+        get => unit;
+        set => unit = readOnly.Check(this, value);
+    }
 
     // TODO : Validate Quality coding 'In the case of “IEC 61162-STATUS”, “A” (Data valid) and “V” (Data invalid) are used for the data quality.'
-    public string? QualityCoding { get; set; }
+    public string? QualityCoding
+    {
+        get => qualityCoding;
+        set => qualityCoding = readOnly.Check(this, value);
+    }
 
     // TODO : Validate - Priority level and criteria for classification shall be in accordance with IEC 62923-1:2018, 6.2.2.1
-    public required string? AlertPriority { get; set; }
-    public string? Name { get; set; }
-    public string? Remarks { get; set; }
+    public required string? AlertPriority
+    {
+        get => alertPriority;
+        set => alertPriority = readOnly.Check(this, value);
+    }
+    public string? Name
+    {
+        get => name;
+        set => name = readOnly.Check(this, value);
+    }
+    public string? Remarks
+    {
+        get => remarks;
+        set => remarks = readOnly.Check(this, value);
+    }
 
-    public Dictionary<string, object>? CustomProperties { get; set; }
+    /// <remarks>A copy when the property is read-only.</remarks>
+    public Dictionary<string, object>? CustomProperties
+    {
+        get => readOnly.IsSet(this) && customProperties is not null ? new(customProperties) : customProperties;
+        set => customProperties = readOnly.Check(this, value);
+    }
+
+    internal void MakeReadOnly()
+    {
+        readOnly.Set(this);
+        dataChannelType.MakeReadOnly();
+        format.MakeReadOnly();
+        range?.MakeReadOnly();
+        unit?.MakeReadOnly();
+    }
 
     public ValidateResult Validate()
     {
@@ -194,27 +430,34 @@ public ValidateResult Validate()
 
 public sealed record DataChannelType
 {
-    private string? type;
+    private DataChannelTypeName? type;
     private double? updateCycle;
     private double? calculationPeriod;
+    private ReadOnlyFlag readOnly;
 
     public required string Type
     {
-        get => type ?? throw new InvalidOperationException("DataChannelType not set");
+        get => type?.Type ?? throw new InvalidOperationException("DataChannelType not set");
         set
         {
+            readOnly.Check(this, value);
             var names = ISO19848.Instance.GetDataChannelTypeNames(ISO19848.LatestVersion);
             var result = names.Parse(value);
             if (result is not DataChannelTypeNames.ParseResult.Ok ok)
-                throw new ArgumentException($"Invalid data channel type {type}");
-            type = ok.TypeName.Type;
+                throw new ArgumentException($"Invalid data channel type {value}");
+            type = ok.TypeName;
         }
     }
+
+    /// <summary>The resolved <see cref="Type"/>.</summary>
+    public DataChannelTypeKind Kind => type?.Kind ?? throw new InvalidOperationException("DataChannelType not set");
+
     public double? UpdateCycle
     {
         get => updateCycle;
         set
         {
+            readOnly.Check(this, value);
             if (value < 0)
                 throw new ArgumentException($"Invalid update cycle {value}. Should be positive");
             updateCycle = value;
@@ -225,37 +468,48 @@ public sealed record DataChannelType
         get => calculationPeriod;
         set
         {
+            readOnly.Check(this, value);
             if (value < 0)
                 throw new ArgumentException($"Invalid calculation period {value}. Should be positive");
             calculationPeriod = value;
         }
     }
 
-    internal bool IsAlert => Type == "Alert";
+    internal bool IsAlert => Kind == DataChannelTypeKind.Alert;
+
+    internal void MakeReadOnly() => readOnly.Set(this);
 }
 
 public sealed record Format
 {
-    private string? type;
     private FormatDataType? dataType;
+    private Restriction? restriction;
+    private ReadOnlyFlag readOnly;
 
     public required string Type
     {
-        get => type ?? throw new InvalidOperationException("Format type not set");
+        get => dataType?.Type ?? throw new InvalidOperationException("Format type not set");
         set
         {
+            readOnly.Check(this, value);
             var names = ISO19848.Instance.GetFormatDataTypes(ISO19848.LatestVersion);
             var result = names.Parse(value);
             if (result is not FormatDataTypes.ParseResult.Ok ok)
-                throw new ArgumentException($"Invalid format type {type}");
-            type = ok.TypeName.Type;
+                throw new ArgumentException($"Invalid format type {value}");
             dataType = ok.TypeName;
         }
     }
-    public required Restriction? Restriction { get; set; } = null;
+    public required Restriction? Restriction
+    {
+        get => restriction;
+        set => restriction = readOnly.Check(this, value);
+    }
+
+    /// <summary>The resolved <see cref="Type"/>.</summary>
+    public FormatDataTypeKind Kind => DataType.Kind;
 
     internal FormatDataType DataType => dataType ?? throw new InvalidOperationException("Format type not set");
-    internal bool IsDecimal => Type == "Decimal";
+    internal bool IsDecimal => Kind == FormatDataTypeKind.Decimal;
 
     public ValidateResult ValidateValue(string value, out Value parsedValue)
     {
@@ -265,41 +519,99 @@ public ValidateResult ValidateValue(string value, out Value parsedValue)
             return Restriction.ValidateValue(value, this);
         return new ValidateResult.Ok();
     }
+
+    internal void MakeReadOnly()
+    {
+        readOnly.Set(this);
+        restriction?.MakeReadOnly();
+    }
 }
 
 public sealed record Restriction
 {
     private uint? totalDigits;
+    private IReadOnlyList<string>? enumeration;
+    private uint? fractionDigits;
+    private uint? length;
+    private double? maxExclusive;
+    private double? maxInclusive;
+    private uint? maxLength;
+    private double? minExclusive;
+    private double? minInclusive;
+    private uint? minLength;
+    private string? pattern;
+    private WhiteSpace? whiteSpace;
+    private ReadOnlyFlag readOnly;
 
     /// <summary>Defines a list of acceptable values.</summary>
-    public IReadOnlyList<string>? Enumeration { get; set; }
+    public IReadOnlyList<string>? Enumeration
+    {
+        get => enumeration;
+        set => enumeration = readOnly.Check(this, value);
+    }
 
     /// <summary>Specifies the maximum number of decimal places allowed. Shall be equal to or greater than zero.</summary>
-    public uint? FractionDigits { get; set; }
+    public uint? FractionDigits
+    {
+        get => fractionDigits;
+        set => fractionDigits = readOnly.Check(this, value);
+    }
 
     /// <summary>Specifies the exact number of characters or list items allowed. Shall be equal to or greater than zero.</summary>
-    public uint? Length { get; set; }
+    public uint? Length
+    {
+        get => length;
+        set => length = readOnly.Check(this, value);
+    }
 
     /// <summary>Specifies the upper bounds for numeric values (the value shall be less than this value).</summary>
-    public double? MaxExclusive { get; set; }
+    public double? MaxExclusive
+    {
+        get => maxExclusive;
+        set => maxExclusive = readOnly.Check(this, value);
+    }
 
     /// <summary>Specifies the upper bounds for numeric values (the value shall be less than or equal to this value).</summary>
-    public double? MaxInclusive { get; set; }
+    public double? MaxInclusive
+    {
+        get => maxInclusive;
+        set => maxInclusive = readOnly.Check(this, value);
+    }
 
     /// <summary>Specifies the maximum number of characters or list items allowed. Shall be equal to or greater than zero.</summary>
-    public uint? MaxLength { get; set; }
+    public uint? MaxLength
+    {
+        get => maxLength;
+        set => maxLength = readOnly.Check(this, value);
+    }
 
     /// <summary>Specifies the lower bounds for numeric values (the value shall be greater than this value).</summary>
-    public double? MinExclusive { get; set; }
+    public double? MinExclusive
+    {
+        get => minExclusive;
+        set => minExclusive = readOnly.Check(this, value);
+    }
 
     /// <summary>Specifies the lower bounds for numeric values (the value shall be greater than or equal to this value).</summary>
-    public double? MinInclusive { get; set; }
+    public double? MinInclusive
+    {
+        get => minInclusive;
+        set => minInclusive = readOnly.Check(this, value);
+    }
 
     /// <summary>Specifies the minimum number of characters or list items allowed. Shall be equal to or greater than zero.</summary>
-    public uint? MinLength { get; set; }
+    public uint? MinLength
+    {
+        get => minLength;
+        set => minLength = readOnly.Check(this, value);
+    }
 
     /// <summary>Defines the exact sequence of characters that are acceptable.</summary>
-    public string? Pattern { get; set; }
+    public string? Pattern
+    {
+        get => pattern;
+        set => pattern = readOnly.Check(this, value);
+    }
 
     /// <summary>Specifies the exact number of digits allowed. Shall be greater than zero.</summary>
     public uint? TotalDigits
@@ -307,6 +619,7 @@ public sealed record Restriction
         get => totalDigits;
         set
         {
+            readOnly.Check(this, value);
             if (value is not null && value <= 0)
                 throw new ArgumentException("TotalDigits should be greater than zero");
             totalDigits = value;
@@ -314,7 +627,11 @@ public sealed record Restriction
     }
 
     /// <summary>Specifies how white space (line feeds, tabs, spaces, and carriage returns) is handled.</summary>
-    public WhiteSpace? WhiteSpace { get; set; }
+    public WhiteSpace? WhiteSpace
+    {
+        get => whiteSpace;
+        set => whiteSpace = readOnly.Check(this, value);
+    }
 
     public ValidateResult ValidateValue(string value, Format format)
     {
@@ -391,6 +708,14 @@ private ValidateResult ValidateNumber(double number)
         return new ValidateResult.Ok();
     }
 
+    internal void MakeReadOnly()
+    {
+        readOnly.Set(this);
+        // Not modifiable through a cast either
+        if (enumeration is not null)
+            enumeration = Array.AsReadOnly(enumeration.ToArray());
+    }
+
     private static decimal CountDecimalPlaces(decimal dec)
     {
         int[] bits = decimal.GetBits(dec);
@@ -420,12 +745,14 @@ public sealed record Range
 {
     private double low = double.MinValue;
     private double high = double.MaxValue;
+    private ReadOnlyFlag readOnly;
 
     public required double Low
     {
         get => low;
         set
         {
+            readOnly.Check(this, value);
             if (value > High)
                 throw new ArgumentException($"Low value {value} should be less than high value {High}");
             low = value;
@@ -436,18 +763,41 @@ public sealed record Range
         get => high;
         set
         {
+            readOnly.Check(this, value);
             if (value < Low)
                 throw new ArgumentException($"High value {value} should be greater than low value {Low}");
             high = value;
         }
     }
+
+    internal void MakeReadOnly() => readOnly.Set(this);
 }
 
 // TODO : Validate Unit according to ISO 80000, IEC 80000 of Table 4
 public sealed record Unit
 {
-    public required string UnitSymbol { get; set; }
-    public string? QuantityName { get; set; }
+    private string unitSymbol = null!;
+    private string? quantityName;
+    private Dictionary<string, object>? customElements;
+    private ReadOnlyFlag readOnly;
+
+    public required string UnitSymbol
+    {
+        get => unitSymbol;
+        set => unitSymbol = readOnly.Check(this, value);
+    }
+    public string? QuantityName
+    {
+        get => quantityName;
+        set => quantityName = readOnly.Check(this, value);
+    }
+
+    /// <remarks>A copy when the unit is read-only.</remarks>
+    public Dictionary<string, object>? CustomElements
+    {
+        get => readOnly.IsSet(this) && customElements is not null ? new(customElements) : customElements;
+        set => customElements = readOnly.Check(this, value);
+    }
 
-    public Dictionary<string, object>? CustomElements { get; set; }
+    internal void MakeReadOnly() => readOnly.Set(this);
 }
@@ -0,0 +1,234 @@
+using System.Diagnostics.CodeAnalysis;
+using Vista.SDK.Internal;
+
+namespace Vista.SDK.Transport.DataChannel;
+
+public sealed partial record DataChannelList
+{
+    /// <summary>A channel of a lazy list, with the raw ids it's indexed by until the list is materialized.</summary>
+    private sealed class LazyEntry(int index, string localId)
+    {
+        public readonly int Index = index;
+        public readonly string LocalId = localId;
+        public DataChannel? DataChannel;
+    }
+
+    private sealed class LazyChannels(int count, Func<int, DataChannel> parse)
+    {
+        public readonly LazyEntry[] Entries = new LazyEntry[count];
+        public readonly Func<int, DataChannel> Parse = parse;
+        public readonly Dictionary<string, LazyEntry> ShortIds = new(count);
+        public readonly ShortIdTable<LazyEntry> ShortIdKeys = new();
+        public readonly Dictionary<string, LazyEntry> LocalIds = new(count);
+
+        // Some raw LocalId isn't written as LocalId.ToString writes it, so a lookup may miss it by its string
+        public bool NonCanonical;
+
+        // Channels are made read-only as they are parsed
+        public volatile bool ReadOnly;
+    }
+
+    // The metadata tags in the order LocalIdBuilder writes them
+    private static readonly string[] MetadataTagOrder = ["qty", "cnt", "calc", "state", "cmd", "type", "pos", "detail"];
+
+    // Null once every channel is parsed and indexed like the channels of an eager list
+    private volatile LazyChannels? lazy;
+
+    /// <summary>
+    /// Creates a list of channels that are parsed and validated by <paramref name="parse"/> on first access,
+    /// so building the list only costs indexing the raw ids.
+    /// </summary>
+    /// <remarks>
+    /// Lookups by ShortId and by LocalId parse only the channel found, and reading the list is thread safe.
+    /// A LocalId is looked up by its string, and only when a raw LocalId isn't in the canonical form, e.g. in verbose
+    /// mode, is a missing one looked up among all the channels.
+    /// Modifying the list, <see cref="DataChannels"/> and <see cref="ValidateAll"/> parse every channel.
+    /// </remarks>
+    /// <param name="localIds">Raw LocalId of every channel.</param>
+    /// <param name="shortIds">Raw ShortId of every channel, or null.</param>
+    /// <param name="parse">Parses the channel of an index, with the LocalId and ShortId at that index.</param>
+    /// <exception cref="ArgumentException">Two channels have the same raw LocalId or ShortId.</exception>
+    public static DataChannelList CreateLazy(
+        IReadOnlyList<string> localIds,
+        IReadOnlyList<string?> shortIds,
+        Func<int, DataChannel> parse
+    )
+    {
+        if (localIds is null)
+            throw new ArgumentNullException(nameof(localIds));
+        if (shortIds is null)
+            throw new ArgumentNullException(nameof(shortIds));
+        if (parse is null)
+            throw new ArgumentNullException(nameof(parse));
+        if (localIds.Count != shortIds.Count)
+            throw new ArgumentException("Expected a ShortId, or null, for every LocalId", nameof(shortIds));
+
+        var channels = new LazyChannels(localIds.Count, parse);
+        for (var i = 0; i < localIds.Count; i++)
+        {
+            var entry = new LazyEntry(i, localIds[i]);
+            channels.Entries[i] = entry;
+            if (channels.LocalIds.ContainsKey(entry.LocalId))
+                throw new ArgumentException($"DataChannel with LocalId {entry.LocalId} already exists");
+            channels.LocalIds.Add(entry.LocalId, entry);
+            if (!channels.NonCanonical && !IsCanonical(entry.LocalId))
+                channels.NonCanonical = true;
+
+            var shortId = shortIds[i];
+            if (shortId is null)
+                continue;
+            if (channels.ShortIds.ContainsKey(shortId))
+                throw new ArgumentException($"DataChannel with ShortId {shortId} already exists");
+            channels.ShortIds.Add(shortId, entry);
+            if (ShortIdKey.TryParse(shortId.AsSpan(), out var key))
+                channels.ShortIdKeys.TryAdd(key, entry);
+        }
+
+        return new DataChannelList { lazy = channels.Entries.Length > 0 ? channels : null };
+    }
+
+    /// <summary>Parses and validates every channel of a lazy list, and indexes them by their parsed LocalId.</summary>
+    /// <remarks>Does nothing for a list that is already parsed.</remarks>
+    /// <param name="parallel">Parse the channels concurrently, useful for very large lists.</param>
+    /// <exception cref="ArgumentException">A channel is invalid, or two channels have the same LocalId.</exception>
+    public void ValidateAll(bool parallel = false)
+    {
+        var channels = lazy;
+        if (channels is null)
+            return;
+
+        if (parallel)
+        {
+            // Failures are left to the sequential pass below, which throws for the first invalid channel
+            Parallel.For(
+                0,
+                channels.Entries.Length,
+                (i, state) =>
+                {
+                    try
+                    {
+                        Parse(channels, channels.Entries[i]);
+                    }
+                    catch (Exception)
+                    {
+                        state.Break();
+                    }
+                }
+            );
+        }
+
+        Materialize(channels);
+    }
+
+    /// <summary>The number of channels parsed so far, all of them for an eager list.</summary>
+    internal int ParsedCount => lazy?.Entries.Count(e => Volatile.Read(ref e.DataChannel) is not null) ?? Count;
+
+    private static DataChannel Parse(LazyChannels channels, LazyEntry entry)
+    {
+        var dataChannel = Volatile.Read(ref entry.DataChannel);
+        if (dataChannel is not null)
+            return dataChannel;
+
+        // Concurrent first reads may both parse the channel, they all get the first one published
+        dataChannel = channels.Parse(entry.Index);
+        dataChannel = Interlocked.CompareExchange(ref entry.DataChannel, dataChannel, null) ?? dataChannel;
+        // After publishing, so either this or MakeReadOnly sees the channel
+        if (channels.ReadOnly)
+            dataChannel.MakeReadOnly();
+        return dataChannel;
+    }
+
+    private static void MakeReadOnly(LazyChannels channels)
+    {
+        channels.ReadOnly = true;
+        Interlocked.MemoryBarrier();
+        foreach (var entry in channels.Entries)
+            Volatile.Read(ref entry.DataChannel)?.MakeReadOnly();
+    }
+
+    /// <summary>Parses the remaining channels and indexes them all as an eager list, then drops the raw ids.</summary>
+    private void Materialize(LazyChannels channels)
+    {
+        lock (channels)
+        {
+            if (lazy is null)
+                return;
+
+            // Built aside, so concurrent readers keep using the raw ids until the list is complete
+            var list = new DataChannelList();
+            list.EnsureCapacity(channels.Entries.Length);
+            foreach (var entry in channels.Entries)
+                list.Add(Parse(channels, entry));
+
+            dataChannels = list.dataChannels;
+            shortIdMap = list.shortIdMap;
+            shortIdKeyMap = list.shortIdKeyMap;
+            localIdMap = list.localIdMap;
+            lazy = null;
+        }
+    }
+
+    private bool TryGetLazy(
+        LazyChannels channels,
+        LocalId localId,
+        [MaybeNullWhen(false)] out DataChannel dataChannel
+    )
+    {
+        var raw = (localId.VerboseMode ? localId.Builder.WithVerboseMode(false) : localId.Builder).ToString();
+        if (channels.LocalIds.TryGetValue(raw, out var entry))
+        {
+            dataChannel = Parse(channels, entry);
+            if (dataChannel.DataChannelId.LocalId.Equals(localId))
+                return true;
+        }
+
+        if (!channels.NonCanonical)
+        {
+            dataChannel = null;
+            return false;
+        }
+
+        // Maybe written differently in the list, such as in verbose mode
+        Materialize(channels);
+        return localIdMap.TryGetValue(localId, out dataChannel);
+    }
+
+    /// <summary>Whether a raw LocalId is written as <see cref="LocalId.ToString"/> would write it, without parsing it.
+    /// </summary>
+    private static bool IsCanonical(string localId)
+    {
+        // Without metadata tags, the LocalId ends with "/meta"
+        var metaIndex = localId.IndexOf("/meta/", StringComparison.Ordinal);
+        if (metaIndex < 0 && localId.EndsWith("/meta", StringComparison.Ordinal))
+            metaIndex = localId.Length - "/meta".Length;
+        if (metaIndex < 0 || localId.EndsWith("/", StringComparison.Ordinal))
+            return false;
+        // Common names of verbose mode
+        if (localId.IndexOf("/~", 0, metaIndex, StringComparison.Ordinal) >= 0)
+            return false;
+
+        var previous = -1;
+        var start = metaIndex + "/meta/".Length;
+        while (start < localId.Length)
+        {
+            var end = localId.IndexOf('/', start);
+            if (end < 0)
+                end = localId.Length;
+            var separator = localId.IndexOfAny(['-', '~'], start, end - start);
+            if (separator < 0)
+                return false;
+            var order = Array.IndexOf(MetadataTagOrder, localId.Substring(start, separator - start));
+            if (order <= previous)
+                return false;
+            previous = order;
+            start = end + 1;
+        }
+        return true;
+    }
+
+    private IEnumerator<DataChannel> GetLazyEnumerator(LazyChannels channels)
+    {
+        foreach (var entry in channels.Entries)
+            yield return Parse(channels, entry);
+    }
+}
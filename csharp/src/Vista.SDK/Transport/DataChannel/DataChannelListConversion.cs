@@ -0,0 +1,14 @@
+namespace Vista.SDK.Transport.DataChannel;
+
+/// <summary>Result of converting a whole DataChannelList to another VIS version.</summary>
+/// <param name="DataChannelList">The converted channels, in their original order.</param>
+/// <param name="Errors">Channels that could not be converted, and why.</param>
+public sealed record DataChannelListConversionResult(
+    DataChannelList DataChannelList,
+    IReadOnlyList<DataChannelConversionError> Errors
+)
+{
+    public bool IsComplete => Errors.Count == 0;
+}
+
+public sealed record DataChannelConversionError(DataChannel DataChannel, string Message);
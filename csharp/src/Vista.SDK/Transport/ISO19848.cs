@@ -21,44 +21,49 @@ public sealed class ISO19848 : IISO19848
     public static readonly ISO19848Version LatestVersion = ISO19848Version.v2024;
     public static readonly ISO19848 Instance = new ISO19848();
     private readonly MemoryCache _dataChannelTypeNamesDtoCache;
-    private readonly MemoryCache _dataChannelTypeNamesCache;
-
     private readonly MemoryCache _formatDataTypesDtoCache;
-    private readonly MemoryCache _formatDataTypesCache;
+
+    // The vocabularies are small and looked up for every data channel, so they are kept for the process lifetime
+    private readonly Lazy<DataChannelTypeNames>[] _dataChannelTypeNames;
+    private readonly Lazy<FormatDataTypes>[] _formatDataTypes;
 
     private ISO19848()
     {
         _dataChannelTypeNamesDtoCache = new MemoryCache(
             new MemoryCacheOptions { SizeLimit = 10, ExpirationScanFrequency = TimeSpan.FromHours(1), }
         );
-        _dataChannelTypeNamesCache = new MemoryCache(
-            new MemoryCacheOptions { SizeLimit = 10, ExpirationScanFrequency = TimeSpan.FromHours(1), }
-        );
-
         _formatDataTypesDtoCache = new MemoryCache(
             new MemoryCacheOptions { SizeLimit = 10, ExpirationScanFrequency = TimeSpan.FromHours(1), }
         );
-        _formatDataTypesCache = new MemoryCache(
-            new MemoryCacheOptions { SizeLimit = 10, ExpirationScanFrequency = TimeSpan.FromHours(1), }
-        );
+
+        var versions = (ISO19848Version[])Enum.GetValues(typeof(ISO19848Version));
+        _dataChannelTypeNames = versions
+            .Select(version => new Lazy<DataChannelTypeNames>(
+                () =>
+                    new DataChannelTypeNames(
+                        GetDataChannelTypeNamesDto(version)
+                            .Values.Select(x => new DataChannelTypeName(x.Type, x.Description))
+                            .ToList()
+                    )
+            ))
+            .ToArray();
+        _formatDataTypes = versions
+            .Select(version => new Lazy<FormatDataTypes>(
+                () =>
+                    new FormatDataTypes(
+                        GetFormatDataTypesDto(version)
+                            .Values.Select(x => new FormatDataType(x.Type, x.Description))
+                            .ToList()
+                    )
+            ))
+            .ToArray();
     }
 
     public DataChannelTypeNames GetDataChannelTypeNames(ISO19848Version version)
     {
-        return _dataChannelTypeNamesCache.GetOrCreate(
-            version,
-            entry =>
-            {
-                entry.Size = 1;
-                entry.SlidingExpiration = TimeSpan.FromHours(1);
-
-                var dto = GetDataChannelTypeNamesDto(version);
-
-                return new DataChannelTypeNames(
-                    dto.Values.Select(x => new DataChannelTypeName(x.Type, x.Description)).ToList()
-                );
-            }
-        )!;
+        if ((uint)version >= (uint)_dataChannelTypeNames.Length)
+            throw new ArgumentOutOfRangeException(nameof(version), version, null);
+        return _dataChannelTypeNames[(int)version].Value;
     }
 
     internal DataChannelTypeNamesDto GetDataChannelTypeNamesDto(ISO19848Version version)
@@ -91,18 +96,9 @@ version switch
 
     public FormatDataTypes GetFormatDataTypes(ISO19848Version version)
     {
-        return _formatDataTypesCache.GetOrCreate(
-            version,
-            entry =>
-            {
-                entry.Size = 1;
-                entry.SlidingExpiration = TimeSpan.FromHours(1);
-
-                var dto = GetFormatDataTypesDto(version);
-
-                return new FormatDataTypes(dto.Values.Select(x => new FormatDataType(x.Type, x.Description)).ToList());
-            }
-        )!;
+        if ((uint)version >= (uint)_formatDataTypes.Length)
+            throw new ArgumentOutOfRangeException(nameof(version), version, null);
+        return _formatDataTypes[(int)version].Value;
     }
 
     internal FormatDataTypesDto GetFormatDataTypesDto(ISO19848Version version)
@@ -134,20 +130,134 @@ version switch
         );
 }
 
-public sealed record DataChannelTypeName(string Type, string Description);
+/// <summary>Data channel types of all ISO 19848 versions.</summary>
+public enum DataChannelTypeKind : byte
+{
+    Inst,
+    Average,
+    Max,
+    Min,
+    Median,
+    Mode,
+    StandardDeviation,
+    Calculated,
+    SetPoint,
+    Command,
+    Alert,
+    Status,
+    ManualInput,
+
+    // ISO 19848:2018 only
+    ControlOutput,
+    ManuallyInput,
+}
+
+public sealed record DataChannelTypeName(string Type, string Description)
+{
+    private readonly string type = Type;
+
+    // Null for a type of no ISO 19848 version
+    private readonly DataChannelTypeKind? kind = ParseKind(Type);
+
+    public string Type
+    {
+        get => type;
+        init
+        {
+            type = value;
+            kind = ParseKind(value);
+        }
+    }
+
+    /// <summary>The resolved <see cref="Type"/>.</summary>
+    /// <exception cref="InvalidOperationException">The type isn't of any ISO 19848 version.</exception>
+    public DataChannelTypeKind Kind =>
+        kind ?? throw new InvalidOperationException("Unknown data channel type: " + type);
+
+    private static DataChannelTypeKind? ParseKind(string type) =>
+        DataChannelTypeNames.TryParseKind(type.AsSpan(), out var kind) ? kind : null;
+}
 
 public sealed record DataChannelTypeNames : IEnumerable<DataChannelTypeName>
 {
+    private static readonly ParseResult InvalidResult = new ParseResult.Invalid();
+
     private readonly IReadOnlyList<DataChannelTypeName> _values;
 
-    public DataChannelTypeNames(IReadOnlyList<DataChannelTypeName> values) => _values = values;
+    // Parse results of the types of this version by kind, null for types of other versions
+    private readonly ParseResult.Ok?[] _results;
 
-    public ParseResult Parse(string type)
+    public DataChannelTypeNames(IReadOnlyList<DataChannelTypeName> values)
     {
-        var typeName = _values.FirstOrDefault(x => x.Type == type);
-        if (typeName is null)
-            return new ParseResult.Invalid();
-        return new ParseResult.Ok(typeName);
+        _values = values;
+        _results = new ParseResult.Ok?[(int)DataChannelTypeKind.ManuallyInput + 1];
+        foreach (var value in values)
+        {
+            // A type of no version can't be parsed
+            if (TryParseKind(value.Type.AsSpan(), out var kind))
+                _results[(int)kind] = new ParseResult.Ok(value);
+        }
+    }
+
+    public ParseResult Parse(string type) => Parse(type.AsSpan());
+
+    public ParseResult Parse(ReadOnlySpan<char> type) =>
+        TryParseKind(type, out var kind) && _results[(int)kind] is { } ok ? ok : InvalidResult;
+
+    /// <summary>Parses a data channel type of any version, case sensitive.</summary>
+    public static bool TryParseKind(ReadOnlySpan<char> type, out DataChannelTypeKind kind)
+    {
+        switch (type)
+        {
+            case "Inst":
+                kind = DataChannelTypeKind.Inst;
+                return true;
+            case "Average":
+                kind = DataChannelTypeKind.Average;
+                return true;
+            case "Max":
+                kind = DataChannelTypeKind.Max;
+                return true;
+            case "Min":
+                kind = DataChannelTypeKind.Min;
+                return true;
+            case "Median":
+                kind = DataChannelTypeKind.Median;
+                return true;
+            case "Mode":
+                kind = DataChannelTypeKind.Mode;
+                return true;
+            case "StandardDeviation":
+                kind = DataChannelTypeKind.StandardDeviation;
+                return true;
+            case "Calculated":
+                kind = DataChannelTypeKind.Calculated;
+                return true;
+            case "SetPoint":
+                kind = DataChannelTypeKind.SetPoint;
+                return true;
+            case "Command":
+                kind = DataChannelTypeKind.Command;
+                return true;
+            case "Alert":
+                kind = DataChannelTypeKind.Alert;
+                return true;
+            case "Status":
+                kind = DataChannelTypeKind.Status;
+                return true;
+            case "ManualInput":
+                kind = DataChannelTypeKind.ManualInput;
+                return true;
+            case "ControlOutput":
+                kind = DataChannelTypeKind.ControlOutput;
+                return true;
+            case "ManuallyInput":
+                kind = DataChannelTypeKind.ManuallyInput;
+                return true;
+            default:
+                kind = default;
+                return false;
+        }
     }
 
     public IEnumerator<DataChannelTypeName> GetEnumerator() => _values.GetEnumerator();
@@ -164,8 +274,41 @@ public sealed record Invalid : ParseResult;
     }
 }
 
+/// <summary>Format data types of all ISO 19848 versions.</summary>
+public enum FormatDataTypeKind : byte
+{
+    Decimal,
+    Integer,
+    Boolean,
+    String,
+    DateTime,
+}
+
 public sealed record FormatDataType(string Type, string Description)
 {
+    private readonly string type = Type;
+
+    // Null for a type of no ISO 19848 version
+    private readonly FormatDataTypeKind? kind = ParseKind(Type);
+
+    public string Type
+    {
+        get => type;
+        init
+        {
+            type = value;
+            kind = ParseKind(value);
+        }
+    }
+
+    /// <summary>The resolved <see cref="Type"/>.</summary>
+    /// <exception cref="InvalidOperationException">The type isn't of any ISO 19848 version.</exception>
+    public FormatDataTypeKind Kind =>
+        kind ?? throw new InvalidOperationException("Unknown format data type: " + type);
+
+    private static FormatDataTypeKind? ParseKind(string type) =>
+        FormatDataTypes.TryParseKind(type.AsSpan(), out var kind) ? kind : null;
+
     public void Switch(
         string value,
         Action<decimal> onDecimal,
@@ -249,26 +392,26 @@ Action<DateTimeOffset> onDateTime
     public ValidateResult Validate(string value, out Value outValue)
     {
         outValue = new Value.String(value);
-        switch (Type)
+        switch (Kind)
         {
-            case "Decimal":
+            case FormatDataTypeKind.Decimal:
                 if (!decimal.TryParse(value, out var d))
                     return new ValidateResult.Invalid([$"Invalid decimal value - Value='{value}'"]);
                 outValue = new Value.Decimal(d);
                 return new ValidateResult.Ok();
-            case "Integer":
+            case FormatDataTypeKind.Integer:
                 if (!int.TryParse(value, out var i))
                     return new ValidateResult.Invalid([$"Invalid integer value - Value='{value}'"]);
                 outValue = new Value.Integer(i);
                 return new ValidateResult.Ok();
-            case "Boolean":
+            case FormatDataTypeKind.Boolean:
                 if (!bool.TryParse(value, out var b))
                     return new ValidateResult.Invalid([$"Invalid boolean value - Value='{value}'"]);
                 outValue = new Value.Boolean(b);
                 return new ValidateResult.Ok();
-            case "String":
+            case FormatDataTypeKind.String:
                 return new ValidateResult.Ok();
-            case "DateTime":
+            case FormatDataTypeKind.DateTime:
                 var pattern = "yyyy-MM-ddTHH:mm:ssZ";
                 if (
                     !DateTimeOffset.TryParseExact(
@@ -290,16 +433,54 @@ public ValidateResult Validate(string value, out Value outValue)
 
 public sealed record FormatDataTypes : IEnumerable<FormatDataType>
 {
+    private static readonly ParseResult InvalidResult = new ParseResult.Invalid();
+
     private readonly IReadOnlyList<FormatDataType> _values;
 
-    public FormatDataTypes(IReadOnlyList<FormatDataType> values) => _values = values;
+    // Parse results of the types of this version by kind, null for types of other versions
+    private readonly ParseResult.Ok?[] _results;
 
-    public ParseResult Parse(string type)
+    public FormatDataTypes(IReadOnlyList<FormatDataType> values)
     {
-        var typeName = _values.FirstOrDefault(x => x.Type == type);
-        if (typeName is null)
-            return new ParseResult.Invalid();
-        return new ParseResult.Ok(typeName);
+        _values = values;
+        _results = new ParseResult.Ok?[(int)FormatDataTypeKind.DateTime + 1];
+        foreach (var value in values)
+        {
+            // A type of no version can't be parsed
+            if (TryParseKind(value.Type.AsSpan(), out var kind))
+                _results[(int)kind] = new ParseResult.Ok(value);
+        }
+    }
+
+    public ParseResult Parse(string type) => Parse(type.AsSpan());
+
+    public ParseResult Parse(ReadOnlySpan<char> type) =>
+        TryParseKind(type, out var kind) && _results[(int)kind] is { } ok ? ok : InvalidResult;
+
+    /// <summary>Parses a format data type of any version, case sensitive.</summary>
+    public static bool TryParseKind(ReadOnlySpan<char> type, out FormatDataTypeKind kind)
+    {
+        switch (type)
+        {
+            case "Decimal":
+                kind = FormatDataTypeKind.Decimal;
+                return true;
+            case "Integer":
+                kind = FormatDataTypeKind.Integer;
+                return true;
+            case "Boolean":
+                kind = FormatDataTypeKind.Boolean;
+                return true;
+            case "String":
+                kind = FormatDataTypeKind.String;
+                return true;
+            case "DateTime":
+                kind = FormatDataTypeKind.DateTime;
+                return true;
+            default:
+                kind = default;
+                return false;
+        }
     }
 
     public IEnumerator<FormatDataType> GetEnumerator() => _values.GetEnumerator();
@@ -0,0 +1,75 @@
+using Vista.SDK.Transport.DataChannel;
+
+namespace Vista.SDK.Transport.TimeSeries;
+
+/// <summary>Validation of <see cref="TimeSeriesData"/> with the events of alert channels ahead of the rest.</summary>
+/// <remarks>
+/// Alerts are usually a handful of events in a package of thousands of tabular cells, so they are picked out in a
+/// single pass over the events and delivered before any table is looked at. The rest of the package is then
+/// validated as usual.
+/// </remarks>
+internal static class AlertValidation
+{
+    public static ValidateResult Validate(
+        TimeSeriesData data,
+        DataChannelListPackage dcPackage,
+        ValidateData onAlertData,
+        ValidateData onTabularData,
+        ValidateData onEventData,
+        bool parallel,
+        bool ordered
+    )
+    {
+        if (data.DataConfiguration is not null)
+        {
+            if (dcPackage.Package.Header.DataChannelListId.Id != data.DataConfiguration.Id)
+                return new ValidateResult.Invalid(["DataConfiguration Id does not match DataChannelList Id"]);
+        }
+        var events = data.EventData?.DataSet;
+        var hasTables = data.TabularData is { Count: > 0 };
+        if (!hasTables && (events is null || events.Count == 0))
+            return new ValidateResult.Invalid(["Can't ingest timeseries data without data"]);
+
+        var list = dcPackage.Package.DataChannelList;
+        var messages = new List<string>();
+        List<EventDataSet>? others = null;
+        if (events is not null)
+        {
+            others = new List<EventDataSet>(events.Count);
+            foreach (var eventData in events)
+            {
+                var id = eventData.DataChannelId;
+                DataChannel.DataChannel? channel;
+                var found = id.IsLocalId
+                    ? list.TryGetByLocalId(id.LocalId!, out channel)
+                    : list.TryGetByShortId(id, out channel);
+                if (!found || channel is null || !channel.Property.DataChannelType.IsAlert)
+                {
+                    // Unknown channels are reported by the validation of the rest, along with other events
+                    others.Add(eventData);
+                    continue;
+                }
+
+                var validation = channel.Property.Format.ValidateValue(eventData.Value, out var value);
+                if (validation is ValidateResult.Invalid invalid)
+                {
+                    messages.Add($"DataChannel {id} is invalid: {string.Join(", ", invalid.Messages)}");
+                    continue;
+                }
+                var result = onAlertData(eventData.TimeStamp, channel, value, eventData.Quality);
+                if (result is not ValidateResult.Ok)
+                    messages.Add($"DataChannel {id} is invalid: {result}");
+            }
+        }
+
+        if (hasTables || others is { Count: > 0 })
+        {
+            var rest = data with { EventData = others is { Count: > 0 } ? new EventData { DataSet = others } : null };
+            var result = rest.Validate(dcPackage, onTabularData, onEventData, parallel, ordered);
+            if (result is ValidateResult.Invalid invalid)
+                messages.AddRange(invalid.Messages);
+        }
+
+        return messages.Count > 0 ? new ValidateResult.Invalid(messages.ToArray()) : new ValidateResult.Ok();
+    }
+}
@@ -1,3 +1,5 @@
+using Vista.SDK.Internal;
+
 namespace Vista.SDK.Transport;
 
 public readonly record struct DataChannelId
@@ -5,6 +7,8 @@ namespace Vista.SDK.Transport;
     private readonly int _tag;
     private readonly LocalId? _localId;
     private readonly string? _shortId;
+    private readonly bool _hasShortIdKey;
+    private readonly ShortIdKey _shortIdKey;
 
     public readonly bool IsLocalId => _tag == 1;
     public readonly bool IsShortId => _tag == 2;
@@ -25,6 +29,14 @@ private DataChannelId(string value)
         _tag = 2;
         _localId = null;
         _shortId = value;
+        // Parsed once here, so resolving the channel for every tabular value or event is a 16-byte compare
+        _hasShortIdKey = ShortIdKey.TryParse(value.AsSpan(), out _shortIdKey);
+    }
+
+    internal readonly bool TryGetShortIdKey(out ShortIdKey key)
+    {
+        key = _shortIdKey;
+        return _tag == 2 && _hasShortIdKey;
     }
 
     public readonly T Match<T>(Func<LocalId, T> onLocalId, Func<string, T> onShortId)
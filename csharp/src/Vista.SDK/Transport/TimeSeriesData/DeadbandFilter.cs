@@ -0,0 +1,305 @@
+using System.Globalization;
+using System.Runtime.CompilerServices;
+using Vista.SDK.Transport.DataChannel;
+
+namespace Vista.SDK.Transport.TimeSeries;
+
+public enum DeadbandType
+{
+    Absolute = 0,
+    Percent = 1,
+}
+
+/// <summary>How far a numeric value has to move from the last sent value before it is reported again.</summary>
+/// <remarks>
+/// A <see cref="DeadbandType.Percent"/> deadband is a percentage of the channel's <see cref="DataChannel.Range"/> span.
+/// Channels without a Range then have a zero deadband, which reports every change.
+/// </remarks>
+public readonly record struct Deadband
+{
+    public DeadbandType Type { get; }
+
+    public double Value { get; }
+
+    private Deadband(DeadbandType type, double value)
+    {
+        if (double.IsNaN(value) || value < 0)
+            throw new ArgumentException($"Invalid deadband {value}. Should be positive", nameof(value));
+        Type = type;
+        Value = value;
+    }
+
+    /// <summary>Reports every change.</summary>
+    public static Deadband None => default;
+
+    public static Deadband Absolute(double value) => new(DeadbandType.Absolute, value);
+
+    public static Deadband Percent(double percent) => new(DeadbandType.Percent, percent);
+
+    internal double Resolve(DataChannel.Range? range) =>
+        Type switch
+        {
+            DeadbandType.Absolute => Value,
+            _ => range is null ? 0 : (range.High - range.Low) * Value / 100,
+        };
+}
+
+public enum DeadbandTabularMode
+{
+    /// <summary>Keep a whole tabular data set when any of its values exceeds its deadband.</summary>
+    Rows = 0,
+
+    /// <summary>Send only the tabular values exceeding their deadband, as <see cref="EventData"/>.</summary>
+    Events = 1,
+}
+
+/// <summary>Report-by-exception filter for outgoing <see cref="TimeSeriesData"/>.</summary>
+/// <remarks>
+/// Decimal and Integer values are sent when they move more than the channel's deadband from the last sent value,
+/// other values when they change. A value is always sent when its quality changes, or when it is the first value
+/// of the channel. Channels not in the DataChannelList are compared as strings.
+/// The last sent state is kept across calls to <see cref="Filter"/>, so a filter should see a channel's packages
+/// in time order. Not thread safe.
+/// </remarks>
+public sealed class DeadbandFilter
+{
+    private readonly DataChannelList _dataChannelList;
+    private readonly Func<DataChannel.DataChannel, Deadband> _deadband;
+    private readonly DeadbandTabularMode _mode;
+
+    private readonly Dictionary<DataChannel.DataChannel, ChannelState> _states = new(ReferenceComparer.Instance);
+    private readonly Dictionary<string, ChannelState> _unknownStates = new(StringComparer.Ordinal);
+
+    private long _receivedValues;
+    private long _sentValues;
+
+    /// <param name="dataChannelList">The channels being filtered.</param>
+    /// <param name="deadband">Deadband per channel, defaults to 1 % of the channel's Range.</param>
+    /// <param name="mode">How tabular data is reduced.</param>
+    public DeadbandFilter(
+        DataChannelList dataChannelList,
+        Func<DataChannel.DataChannel, Deadband>? deadband = null,
+        DeadbandTabularMode mode = DeadbandTabularMode.Rows
+    )
+    {
+        _dataChannelList = dataChannelList ?? throw new ArgumentNullException(nameof(dataChannelList));
+        _deadband = deadband ?? (_ => Deadband.Percent(1));
+        _mode = mode;
+    }
+
+    /// <summary>Number of values passed to the filter.</summary>
+    public long ReceivedValues => _receivedValues;
+
+    /// <summary>Number of values in the filtered packages, including the unchanged values of kept rows.</summary>
+    public long SentValues => _sentValues;
+
+    /// <summary>Forgets the last sent values, the next value of every channel is sent.</summary>
+    public void Reset()
+    {
+        _states.Clear();
+        _unknownStates.Clear();
+        _receivedValues = 0;
+        _sentValues = 0;
+    }
+
+    /// <summary>Filters a package, keeping its Header and the DataConfiguration of every TimeSeriesData.</summary>
+    /// <remarks>TimeSeriesData left without any data are dropped. The input package is not modified.</remarks>
+    public TimeSeriesDataPackage Filter(TimeSeriesDataPackage package)
+    {
+        if (package is null)
+            throw new ArgumentNullException(nameof(package));
+
+        var timeSeriesData = new List<TimeSeriesData>(package.Package.TimeSeriesData.Count);
+        foreach (var data in package.Package.TimeSeriesData)
+        {
+            var filtered = Filter(data);
+            if (filtered is not null)
+                timeSeriesData.Add(filtered);
+        }
+
+        return new TimeSeriesDataPackage
+        {
+            Package = new Package { Header = package.Package.Header, TimeSeriesData = timeSeriesData },
+        };
+    }
+
+    private TimeSeriesData? Filter(TimeSeriesData data)
+    {
+        List<TabularData>? tables = null;
+        List<EventDataSet>? events = null;
+
+        foreach (var table in data.TabularData ?? [])
+        {
+            if (table?.DataChannelIds is null || table.DataSets is null)
+                continue;
+
+            var states = new ChannelState[table.DataChannelIds.Count];
+            for (var i = 0; i < states.Length; i++)
+                states[i] = GetState(table.DataChannelIds[i]);
+
+            if (_mode == DeadbandTabularMode.Rows)
+            {
+                var dataSets = FilterRows(table, states);
+                if (dataSets.Count > 0)
+                    (tables ??= []).Add(new TabularData { DataChannelIds = table.DataChannelIds, DataSets = dataSets });
+            }
+            else
+            {
+                FilterCells(table, states, ref events);
+            }
+        }
+
+        foreach (var dataSet in data.EventData?.DataSet ?? [])
+        {
+            _receivedValues++;
+            if (!GetState(dataSet.DataChannelId).Update(dataSet.Value, dataSet.Quality))
+                continue;
+
+            (events ??= []).Add(dataSet);
+            _sentValues++;
+        }
+
+        if (events is not null && _mode == DeadbandTabularMode.Events)
+        {
+            // Stable, so events of the same time stamp keep their column order
+            events = events.OrderBy(e => e.TimeStamp).ToList();
+        }
+
+        if (tables is null && events is null)
+            return null;
+
+        return new TimeSeriesData
+        {
+            DataConfiguration = data.DataConfiguration,
+            TabularData = tables,
+            EventData = events is null ? null : new EventData { DataSet = events },
+            CustomDataKinds = data.CustomDataKinds,
+        };
+    }
+
+    private List<TabularDataSet> FilterRows(TabularData table, ChannelState[] states)
+    {
+        var dataSets = new List<TabularDataSet>();
+        foreach (var dataSet in table.DataSets!)
+        {
+            var count = Math.Min(states.Length, dataSet.Value.Count);
+            _receivedValues += count;
+
+            var send = false;
+            for (var i = 0; i < count && !send; i++)
+                send = states[i].Exceeds(dataSet.Value[i], dataSet.Quality?[i]);
+            if (!send)
+                continue;
+
+            for (var i = 0; i < count; i++)
+                states[i].Set(dataSet.Value[i], dataSet.Quality?[i]);
+
+            dataSets.Add(dataSet);
+            _sentValues += count;
+        }
+        return dataSets;
+    }
+
+    private void FilterCells(TabularData table, ChannelState[] states, ref List<EventDataSet>? events)
+    {
+        foreach (var dataSet in table.DataSets!)
+        {
+            var count = Math.Min(states.Length, dataSet.Value.Count);
+            _receivedValues += count;
+
+            for (var i = 0; i < count; i++)
+            {
+                var quality = dataSet.Quality?[i];
+                if (!states[i].Update(dataSet.Value[i], quality))
+                    continue;
+
+                (events ??= []).Add(
+                    new EventDataSet
+                    {
+                        TimeStamp = dataSet.TimeStamp,
+                        DataChannelId = table.DataChannelIds![i],
+                        Value = dataSet.Value[i],
+                        Quality = quality,
+                    }
+                );
+                _sentValues++;
+            }
+        }
+    }
+
+    private ChannelState GetState(in DataChannelId id)
+    {
+        var found = id.IsLocalId
+            ? _dataChannelList.TryGetByLocalId(id.LocalId!, out var dataChannel)
+            : _dataChannelList.TryGetByShortId(id, out dataChannel);
+
+        if (!found)
+        {
+            var key = id.ToString();
+            if (!_unknownStates.TryGetValue(key, out var unknown))
+            {
+                unknown = new ChannelState(isNumeric: false, 0);
+                _unknownStates.Add(key, unknown);
+            }
+            return unknown;
+        }
+
+        if (!_states.TryGetValue(dataChannel!, out var state))
+        {
+            var property = dataChannel!.Property;
+            var isNumeric = property.Format.IsDecimal || property.Format.Type == "Integer";
+            state = new ChannelState(isNumeric, isNumeric ? _deadband(dataChannel).Resolve(property.Range) : 0);
+            _states.Add(dataChannel, state);
+        }
+        return state;
+    }
+
+    private sealed class ChannelState(bool isNumeric, double deadband)
+    {
+        private bool _hasValue;
+        private double _number;
+        private string? _value;
+        private string? _quality;
+
+        public bool Exceeds(string value, string? quality)
+        {
+            if (!_hasValue || !string.Equals(quality, _quality, StringComparison.Ordinal))
+                return true;
+
+            if (isNumeric && TryParse(value, out var number) && !double.IsNaN(_number))
+                return Math.Abs(number - _number) > deadband;
+
+            return !string.Equals(value, _value, StringComparison.Ordinal);
+        }
+
+        public void Set(string value, string? quality)
+        {
+            _hasValue = true;
+            _quality = quality;
+            if (isNumeric)
+                _number = TryParse(value, out var number) ? number : double.NaN;
+            // Numbers are compared by value, the string is only kept for values that did not parse
+            _value = isNumeric && !double.IsNaN(_number) ? null : value;
+        }
+
+        public bool Update(string value, string? quality)
+        {
+            if (!Exceeds(value, quality))
+                return false;
+            Set(value, quality);
+            return true;
+        }
+
+        private static bool TryParse(string value, out double number) =>
+            double.TryParse(value, NumberStyles.Float, CultureInfo.InvariantCulture, out number);
+    }
+
+    private sealed class ReferenceComparer : IEqualityComparer<DataChannel.DataChannel>
+    {
+        public static readonly ReferenceComparer Instance = new();
+
+        public bool Equals(DataChannel.DataChannel? x, DataChannel.DataChannel? y) => ReferenceEquals(x, y);
+
+        public int GetHashCode(DataChannel.DataChannel obj) => RuntimeHelpers.GetHashCode(obj);
+    }
+}
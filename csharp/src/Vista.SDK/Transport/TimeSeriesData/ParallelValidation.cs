@@ -0,0 +1,305 @@
+using System.Runtime.ExceptionServices;
+using Vista.SDK.Transport.DataChannel;
+
+namespace Vista.SDK.Transport.TimeSeries;
+
+/// <summary>Validation of <see cref="TimeSeriesData"/> in concurrent chunks of table rows and of events.</summary>
+/// <remarks>
+/// The channel of every table column is resolved once, before any value is validated. Errors are reported in table,
+/// row and column order, then event order, whatever order the chunks completed in.
+/// </remarks>
+internal static class ParallelValidation
+{
+    // Small enough to balance tables of a few thousand cells over all cores, large enough to amortize scheduling
+    private const int CellsPerChunk = 2048;
+
+    private readonly record struct Column(DataChannelId Id, DataChannel.DataChannel? Channel, string? Error);
+
+    private readonly record struct Error(int Row, int Column, DataChannelId Id, string Cause);
+
+    /// <summary>Rows <see cref="Start"/> to <see cref="End"/> of a table, or of the events without a table.</summary>
+    private sealed class Chunk(TabularData? table, Column[]? columns, int start, int end)
+    {
+        public readonly TabularData? Table = table;
+        public readonly Column[]? Columns = columns;
+        public readonly int Start = start;
+        public readonly int End = end;
+
+        // Parsed values of the valid cells, with their channels for events, kept until they are delivered in order
+        public Value?[]? Values;
+        public DataChannel.DataChannel?[]? Channels;
+
+        public List<Error>? Errors;
+
+        public int Width => Columns?.Length ?? 1;
+
+        public void AddError(int row, int column, DataChannelId id, string cause) =>
+            (Errors ??= []).Add(new Error(row, column, id, cause));
+    }
+
+    public static ValidateResult Validate(
+        TimeSeriesData data,
+        DataChannelListPackage dcPackage,
+        ValidateData onTabularData,
+        ValidateData onEventData,
+        bool ordered
+    )
+    {
+        if (data.DataConfiguration is not null)
+        {
+            if (dcPackage.Package.Header.DataChannelListId.Id != data.DataConfiguration.Id)
+                return new ValidateResult.Invalid(["DataConfiguration Id does not match DataChannelList Id"]);
+        }
+        var events = data.EventData?.DataSet;
+        if ((data.TabularData is null || data.TabularData.Count == 0) && (events is null || events.Count == 0))
+            return new ValidateResult.Invalid(["Can't ingest timeseries data without data"]);
+
+        // Structure of every table first, so nothing is delivered for a package with a malformed table
+        var list = dcPackage.Package.DataChannelList;
+        var chunks = new List<Chunk>();
+        foreach (var table in data.TabularData ?? [])
+        {
+            if (table is null || table.DataSets is null || table.DataChannelIds is null)
+                continue;
+            var result = TabularData.Validate(table);
+            if (result is not ValidateResult.Ok)
+                return result;
+
+            var width = table.DataChannelIds.Count;
+            for (var i = 0; i < table.DataSets.Count; i++)
+            {
+                var count = table.DataSets[i].Value.Count;
+                if (count != width)
+                    return new ValidateResult.Invalid(
+                        [$"Tabular data set {i} expects {width} values, but {count} values are provided"]
+                    );
+            }
+
+            var columns = new Column[width];
+            for (var j = 0; j < width; j++)
+                columns[j] = Resolve(list, table.DataChannelIds[j]);
+
+            var rows = Math.Max(1, CellsPerChunk / width);
+            for (var start = 0; start < table.DataSets.Count; start += rows)
+                chunks.Add(new Chunk(table, columns, start, Math.Min(start + rows, table.DataSets.Count)));
+        }
+
+        if (events is not null)
+        {
+            for (var start = 0; start < events.Count; start += CellsPerChunk)
+                chunks.Add(new Chunk(null, null, start, Math.Min(start + CellsPerChunk, events.Count)));
+        }
+
+        if (ordered)
+        {
+            // Waves of a few chunks per core bound the parsed values held for delivery
+            var wave = Environment.ProcessorCount * 4;
+            for (var first = 0; first < chunks.Count; first += wave)
+            {
+                var end = Math.Min(first + wave, chunks.Count);
+                For(first, end, i => ValidateChunk(list, events, chunks[i], null, null));
+                for (var i = first; i < end; i++)
+                    Deliver(events, chunks[i], onTabularData, onEventData);
+            }
+        }
+        else
+        {
+            For(0, chunks.Count, i => ValidateChunk(list, events, chunks[i], onTabularData, onEventData));
+        }
+
+        var messages = new List<string>();
+        foreach (var chunk in chunks)
+        {
+            if (chunk.Errors is null)
+                continue;
+            // Callback errors of ordered delivery are added after all validation errors of the chunk
+            var errors = chunk.Errors.ToArray();
+            var order = Enumerable.Range(0, errors.Length).ToArray();
+            Array.Sort(
+                order,
+                (a, b) =>
+                    errors[a].Row != errors[b].Row ? errors[a].Row - errors[b].Row
+                    : errors[a].Column != errors[b].Column ? errors[a].Column - errors[b].Column
+                    : a - b
+            );
+            foreach (var i in order)
+                messages.Add($"DataChannel {errors[i].Id} is invalid: {errors[i].Cause}");
+        }
+
+        return messages.Count > 0 ? new ValidateResult.Invalid(messages.ToArray()) : new ValidateResult.Ok();
+    }
+
+    /// <summary>Runs <paramref name="body"/> for the chunks concurrently.</summary>
+    /// <remarks>
+    /// When chunks throw, the loop breaks, which lets every lower chunk complete, and the exception of the lowest
+    /// one is rethrown. That's the first failing cell in table, row and column order, then event order, as with the
+    /// sequential validation, though callbacks of later cells may have run concurrently.
+    /// </remarks>
+    private static void For(int from, int to, Action<int> body)
+    {
+        Exception? failure = null;
+        var failedIndex = int.MaxValue;
+        var gate = new object();
+        Parallel.For(
+            from,
+            to,
+            (i, state) =>
+            {
+                try
+                {
+                    body(i);
+                }
+                catch (Exception e)
+                {
+                    lock (gate)
+                    {
+                        if (i < failedIndex)
+                            (failedIndex, failure) = (i, e);
+                    }
+                    state.Break();
+                }
+            }
+        );
+        if (failure is not null)
+            ExceptionDispatchInfo.Capture(failure).Throw();
+    }
+
+    private static Column Resolve(DataChannelList list, in DataChannelId id)
+    {
+        if (id.IsLocalId)
+        {
+            return list.TryGetByLocalId(id.LocalId!, out var byLocalId)
+                ? new Column(id, byLocalId, null)
+                : new Column(id, null, $"Data channel with localId '{id.LocalId}' not found");
+        }
+        return list.TryGetByShortId(id, out var byShortId)
+            ? new Column(id, byShortId, null)
+            : new Column(id, null, $"Data channel with short id '{id.ShortId}' not found");
+    }
+
+    /// <summary>
+    /// Validates the cells of a chunk, invoking the callbacks right away when there are any,
+    /// or keeping the parsed values for <see cref="Deliver"/>.
+    /// </summary>
+    private static void ValidateChunk(
+        DataChannelList list,
+        List<EventDataSet>? events,
+        Chunk chunk,
+        ValidateData? onTabularData,
+        ValidateData? onEventData
+    )
+    {
+        var deliver = onTabularData is not null;
+        if (!deliver)
+            chunk.Values = new Value?[(chunk.End - chunk.Start) * chunk.Width];
+
+        if (chunk.Table is null)
+        {
+            if (!deliver)
+                chunk.Channels = new DataChannel.DataChannel?[chunk.End - chunk.Start];
+
+            for (var row = chunk.Start; row < chunk.End; row++)
+            {
+                var eventData = events![row];
+                var column = Resolve(list, eventData.DataChannelId);
+                if (column.Channel is null)
+                {
+                    chunk.AddError(row, 0, column.Id, column.Error!);
+                    continue;
+                }
+                if (!TryValidate(chunk, row, 0, column, eventData.Value, out var value))
+                    continue;
+
+                if (!deliver)
+                {
+                    chunk.Values![row - chunk.Start] = value;
+                    chunk.Channels![row - chunk.Start] = column.Channel;
+                    continue;
+                }
+                var result = onEventData!(eventData.TimeStamp, column.Channel, value, eventData.Quality);
+                if (result is not ValidateResult.Ok)
+                    chunk.AddError(row, 0, column.Id, result.ToString());
+            }
+            return;
+        }
+
+        var columns = chunk.Columns!;
+        for (var row = chunk.Start; row < chunk.End; row++)
+        {
+            var dataSet = chunk.Table.DataSets![row];
+            for (var j = 0; j < columns.Length; j++)
+            {
+                var column = columns[j];
+                if (column.Channel is null)
+                {
+                    chunk.AddError(row, j, column.Id, column.Error!);
+                    continue;
+                }
+                if (!TryValidate(chunk, row, j, column, dataSet.Value[j], out var value))
+                    continue;
+
+                if (!deliver)
+                {
+                    chunk.Values![(row - chunk.Start) * columns.Length + j] = value;
+                    continue;
+                }
+                var result = onTabularData!(dataSet.TimeStamp, column.Channel, value, dataSet.Quality?[j]);
+                if (result is not ValidateResult.Ok)
+                    chunk.AddError(row, j, column.Id, result.ToString());
+            }
+        }
+    }
+
+    private static bool TryValidate(Chunk chunk, int row, int j, in Column column, string text, out Value value)
+    {
+        var validation = column.Channel!.Property.Format.ValidateValue(text, out value);
+        if (validation is not ValidateResult.Invalid invalid)
+            return true;
+        chunk.AddError(row, j, column.Id, string.Join(", ", invalid.Messages));
+        return false;
+    }
+
+    /// <summary>Invokes the callbacks for the valid cells of a chunk, in row and column order.</summary>
+    private static void Deliver(
+        List<EventDataSet>? events,
+        Chunk chunk,
+        ValidateData onTabularData,
+        ValidateData onEventData
+    )
+    {
+        var values = chunk.Values!;
+        chunk.Values = null;
+
+        if (chunk.Table is null)
+        {
+            var channels = chunk.Channels!;
+            chunk.Channels = null;
+            for (var row = chunk.Start; row < chunk.End; row++)
+            {
+                var value = values[row - chunk.Start];
+                if (value is null)
+                    continue;
+                var eventData = events![row];
+                var result = onEventData(eventData.TimeStamp, channels[row - chunk.Start]!, value, eventData.Quality);
+                if (result is not ValidateResult.Ok)
+                    chunk.AddError(row, 0, eventData.DataChannelId, result.ToString());
+            }
+            return;
+        }
+
+        var columns = chunk.Columns!;
+        for (var row = chunk.Start; row < chunk.End; row++)
+        {
+            var dataSet = chunk.Table.DataSets![row];
+            for (var j = 0; j < columns.Length; j++)
+            {
+                var value = values[(row - chunk.Start) * columns.Length + j];
+                if (value is null)
+                    continue;
+                var result = onTabularData(dataSet.TimeStamp, columns[j].Channel!, value, dataSet.Quality?[j]);
+                if (result is not ValidateResult.Ok)
+                    chunk.AddError(row, j, columns[j].Id, result.ToString());
+            }
+        }
+    }
+}
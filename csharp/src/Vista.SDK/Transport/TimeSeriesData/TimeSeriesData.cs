@@ -50,6 +50,47 @@ public sealed record TimeSeriesData
     public required EventData? EventData { get; set; }
     public Dictionary<string, object>? CustomDataKinds { get; set; }
 
+    /// <summary>
+    /// Validates the data like <see cref="Validate(DataChannelListPackage, ValidateData, ValidateData)"/>.
+    /// </summary>
+    /// <remarks>
+    /// With <paramref name="parallel"/>, tables are split in chunks of rows, and events in chunks of events, validated
+    /// concurrently. The structure of every table is checked before any value, so no callback is invoked for a package
+    /// with a malformed table. Errors are reported in table, row and column order, then event order.
+    /// With <paramref name="ordered"/>, the callbacks are invoked on the calling thread in that order. Otherwise they
+    /// are invoked concurrently from the worker threads, as soon as a value is validated, and have to be thread safe.
+    /// An exception thrown by a callback is rethrown for the first failing value in that order, as sequentially, but
+    /// without <paramref name="ordered"/> callbacks of later values may have run by then.
+    /// </remarks>
+    public ValidateResult Validate(
+        DataChannelListPackage dcPackage,
+        ValidateData onTabularData,
+        ValidateData onEventData,
+        bool parallel,
+        bool ordered = true
+    ) =>
+        parallel
+            ? ParallelValidation.Validate(this, dcPackage, onTabularData, onEventData, ordered)
+            : Validate(dcPackage, onTabularData, onEventData);
+
+    /// <summary>
+    /// Validates the data like <see cref="Validate(DataChannelListPackage, ValidateData, ValidateData, bool, bool)"/>,
+    /// but the events of alert channels first, delivered to <paramref name="onAlertData"/> before any table is read.
+    /// </summary>
+    /// <remarks>
+    /// Alerts don't wait behind the tabular data, and are delivered even if a table turns out to be malformed.
+    /// Events of other channels are delivered to <paramref name="onEventData"/> with the rest of the package.
+    /// Errors of alerts are reported first.
+    /// </remarks>
+    public ValidateResult ValidateAlertsFirst(
+        DataChannelListPackage dcPackage,
+        ValidateData onAlertData,
+        ValidateData onTabularData,
+        ValidateData onEventData,
+        bool parallel = false,
+        bool ordered = true
+    ) => AlertValidation.Validate(this, dcPackage, onAlertData, onTabularData, onEventData, parallel, ordered);
+
     public ValidateResult Validate(
         DataChannelListPackage dcPackage,
         ValidateData onTabularData,
@@ -111,7 +152,10 @@ ValidateData onEventData
                         },
                         onShortId: shortId =>
                         {
-                            if (!dcPackage.Package.DataChannelList.TryGetByShortId(shortId, out var dc) || dc is null)
+                            if (
+                                !dcPackage.Package.DataChannelList.TryGetByShortId(dataChannelId, out var dc)
+                                || dc is null
+                            )
                             {
                                 errorneousDataChannels.Add(
                                     (dataChannelId, $"Data channel with short id '{shortId}' not found")
@@ -144,61 +188,64 @@ ValidateData onEventData
                     }
                 }
             }
+        }
 
-            // Validate event data
-            if (EventData is not null)
+        // Validate event data once, after every table
+        if (EventData is not null)
+        {
+            foreach (var eventData in EventData.DataSet ?? [])
             {
-                foreach (var eventData in EventData.DataSet ?? [])
-                {
-                    DataChannel.DataChannel? dataChannel = eventData
-                        .DataChannelId
-                        .Match(
-                            onLocalId: id =>
-                            {
-                                if (!dcPackage.Package.DataChannelList.TryGetByLocalId(id, out var dc) || dc is null)
-                                {
-                                    errorneousDataChannels.Add(
-                                        (eventData.DataChannelId, $"Data channel with localId '{id}' not found")
-                                    );
-                                    return null;
-                                }
-                                return dc;
-                            },
-                            onShortId: shortId =>
+                DataChannel.DataChannel? dataChannel = eventData
+                    .DataChannelId
+                    .Match(
+                        onLocalId: id =>
+                        {
+                            if (!dcPackage.Package.DataChannelList.TryGetByLocalId(id, out var dc) || dc is null)
                             {
-                                if (
-                                    !dcPackage.Package.DataChannelList.TryGetByShortId(shortId, out var dc)
-                                    || dc is null
+                                errorneousDataChannels.Add(
+                                    (eventData.DataChannelId, $"Data channel with localId '{id}' not found")
+                                );
+                                return null;
+                            }
+                            return dc;
+                        },
+                        onShortId: shortId =>
+                        {
+                            if (
+                                !dcPackage.Package.DataChannelList.TryGetByShortId(
+                                    eventData.DataChannelId,
+                                    out var dc
                                 )
-                                {
-                                    errorneousDataChannels.Add(
-                                        (eventData.DataChannelId, $"Data channel with short id '{shortId}' not found")
-                                    );
-                                    return null;
-                                }
-                                return dc;
+                                || dc is null
+                            )
+                            {
+                                errorneousDataChannels.Add(
+                                    (eventData.DataChannelId, $"Data channel with short id '{shortId}' not found")
+                                );
+                                return null;
                             }
-                        );
-                    if (dataChannel is null)
-                        continue;
-
-                    var typeValidation = dataChannel
-                        .Property
-                        .Format
-                        .ValidateValue(eventData.Value, out var parsedValue);
-                    if (typeValidation is ValidateResult.Invalid invalid)
-                    {
-                        errorneousDataChannels.Add((eventData.DataChannelId, string.Join(", ", invalid.Messages)));
-                        continue;
-                    }
+                            return dc;
+                        }
+                    );
+                if (dataChannel is null)
+                    continue;
+
+                var typeValidation = dataChannel
+                    .Property
+                    .Format
+                    .ValidateValue(eventData.Value, out var parsedValue);
+                if (typeValidation is ValidateResult.Invalid invalid)
+                {
+                    errorneousDataChannels.Add((eventData.DataChannelId, string.Join(", ", invalid.Messages)));
+                    continue;
+                }
 
-                    result = onEventData(eventData.TimeStamp, dataChannel, parsedValue, eventData.Quality);
+                var result = onEventData(eventData.TimeStamp, dataChannel, parsedValue, eventData.Quality);
 
-                    if (result is not ValidateResult.Ok)
-                    {
-                        errorneousDataChannels.Add((eventData.DataChannelId, result.ToString()));
-                        continue;
-                    }
+                if (result is not ValidateResult.Ok)
+                {
+                    errorneousDataChannels.Add((eventData.DataChannelId, result.ToString()));
+                    continue;
                 }
             }
         }
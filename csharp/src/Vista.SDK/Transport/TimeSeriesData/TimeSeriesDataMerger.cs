@@ -0,0 +1,643 @@
+using System.Runtime.CompilerServices;
+
+namespace Vista.SDK.Transport.TimeSeries;
+
+/// <summary>A single value of a DataChannel, from either tabular or event data.</summary>
+public readonly record struct TimeSeriesValue(
+    DateTimeOffset TimeStamp,
+    DataChannelId DataChannelId,
+    string Value,
+    string? Quality
+);
+
+/// <summary>Time ordered k-way merge of TimeSeriesData streams, e.g. from redundant gateways.</summary>
+/// <remarks>
+/// Every input is a stream of packages in time order, values inside a package may be in any order.
+/// Values with the same DataChannelId and time stamp are merged into one: the value with the best quality rank wins,
+/// ties go to the input listed first. LocalId and ShortId of the same channel are different DataChannelIds.
+/// Memory is bounded by one package per input plus the values of a single time stamp, or the package being merged to.
+/// A value older than what has already been merged, e.g. a package sent again by the same gateway, can no longer be
+/// ordered and is counted in <see cref="LateValues"/> instead. Not thread safe.
+/// </remarks>
+public sealed class TimeSeriesDataMerger
+{
+    private readonly Func<string?, int> _qualityRank;
+
+    private long _receivedValues;
+    private long _duplicateValues;
+    private long _lateValues;
+
+    /// <param name="qualityRank">
+    /// Ranks a quality, lower is better. Defaults to <see cref="DefaultQualityRank"/>.
+    /// </param>
+    public TimeSeriesDataMerger(Func<string?, int>? qualityRank = null)
+    {
+        _qualityRank = qualityRank ?? DefaultQualityRank;
+    }
+
+    /// <summary>Missing, "0" (OPC good) and "A" (IEC 61162 data valid) rank before any other quality.</summary>
+    public static int DefaultQualityRank(string? quality) => quality is null or "0" or "A" ? 0 : 1;
+
+    public long ReceivedValues => _receivedValues;
+
+    /// <summary>Values dropped because another input had the same channel and time stamp.</summary>
+    public long DuplicateValues => _duplicateValues;
+
+    /// <summary>Values dropped because they were older than the merged output.</summary>
+    public long LateValues => _lateValues;
+
+    /// <summary>Merges the inputs into one time ordered stream of values, without duplicates.</summary>
+    /// <remarks>Inputs are read lazily, while the result is enumerated.</remarks>
+    public IEnumerable<TimeSeriesValue> Merge(IReadOnlyList<IEnumerable<TimeSeriesDataPackage>> inputs)
+    {
+        if (inputs is null)
+            throw new ArgumentNullException(nameof(inputs));
+
+        return MergeIterator(inputs);
+    }
+
+    /// <summary>Merges the inputs into packages of about <paramref name="maxValues"/> values each.</summary>
+    /// <remarks>
+    /// Packages are built while the result is enumerated, the values of a time stamp are never split over two packages.
+    /// Tabular values are written as tables again, one per set of DataChannelIds of the input tables. The values of a
+    /// row that isn't complete, e.g. when an event of another input won a duplicate, or that mixes values with and
+    /// without quality, are written as event data along with the values of the input event data.
+    /// </remarks>
+    /// <param name="header">Header of every package, its TimeSpan is set to the time span of the package.</param>
+    /// <param name="dataConfiguration">The DataChannelList the inputs refer to.</param>
+    /// <param name="maxValues">Values after which a package is complete.</param>
+    public IEnumerable<TimeSeriesDataPackage> MergeToPackages(
+        IReadOnlyList<IEnumerable<TimeSeriesDataPackage>> inputs,
+        Header header,
+        ConfigurationReference? dataConfiguration,
+        int maxValues = 100_000
+    )
+    {
+        if (inputs is null)
+            throw new ArgumentNullException(nameof(inputs));
+        if (header is null)
+            throw new ArgumentNullException(nameof(header));
+        if (maxValues <= 0)
+            throw new ArgumentOutOfRangeException(nameof(maxValues), "Expected a positive number of values");
+
+        return MergeToPackagesIterator(inputs, header, dataConfiguration, maxValues);
+    }
+
+    private IEnumerable<TimeSeriesValue> MergeIterator(IReadOnlyList<IEnumerable<TimeSeriesDataPackage>> inputs)
+    {
+        foreach (var group in MergeGroups(inputs))
+        {
+            foreach (var candidate in group)
+                yield return candidate.Value;
+        }
+    }
+
+    private IEnumerable<TimeSeriesDataPackage> MergeToPackagesIterator(
+        IReadOnlyList<IEnumerable<TimeSeriesDataPackage>> inputs,
+        Header header,
+        ConfigurationReference? dataConfiguration,
+        int maxValues
+    )
+    {
+        var builder = new PackageBuilder();
+        foreach (var group in MergeGroups(inputs))
+        {
+            builder.Add(group);
+            if (builder.Count >= maxValues)
+                yield return builder.Build(header, dataConfiguration);
+        }
+
+        if (builder.Count > 0)
+            yield return builder.Build(header, dataConfiguration);
+    }
+
+    /// <summary>Yields the merged values of every time stamp, the list is reused for the next time stamp.</summary>
+    private IEnumerable<List<Candidate>> MergeGroups(IReadOnlyList<IEnumerable<TimeSeriesDataPackage>> inputs)
+    {
+        var cursors = new List<Cursor>(inputs.Count);
+        try
+        {
+            for (var i = 0; i < inputs.Count; i++)
+                cursors.Add(new Cursor(i, inputs[i].GetEnumerator()));
+
+            var heap = new CursorHeap(cursors.Count);
+            foreach (var cursor in cursors)
+            {
+                if (cursor.MoveNext(ref _receivedValues))
+                    heap.Push(cursor);
+            }
+
+            var group = new List<Candidate>();
+            var groupIndex = new Dictionary<DataChannelId, int>();
+            var groupTicks = long.MinValue;
+
+            while (heap.Count > 0)
+            {
+                var cursor = heap.Peek();
+                var value = cursor.Current;
+                var ticks = cursor.CurrentTicks;
+
+                if (ticks > groupTicks)
+                {
+                    if (group.Count > 0)
+                        yield return group;
+                    group.Clear();
+                    groupIndex.Clear();
+                    groupTicks = ticks;
+                }
+
+                if (ticks < groupTicks)
+                {
+                    _lateValues++;
+                }
+                else
+                {
+                    var rank = _qualityRank(value.Quality);
+                    var candidate = new Candidate(value, rank, cursor.CurrentTable, cursor.CurrentColumn);
+                    if (groupIndex.TryGetValue(value.DataChannelId, out var index))
+                    {
+                        _duplicateValues++;
+                        if (rank < group[index].Rank)
+                            group[index] = candidate;
+                    }
+                    else
+                    {
+                        groupIndex.Add(value.DataChannelId, group.Count);
+                        group.Add(candidate);
+                    }
+                }
+
+                if (cursor.MoveNext(ref _receivedValues))
+                    heap.ReplaceTop(cursor);
+                else
+                    heap.Pop();
+            }
+
+            if (group.Count > 0)
+                yield return group;
+        }
+        finally
+        {
+            foreach (var cursor in cursors)
+                cursor.Dispose();
+        }
+    }
+
+    /// <summary>A merged value, with the DataChannelIds and column of the table it's from, if any.</summary>
+    private readonly record struct Candidate(TimeSeriesValue Value, int Rank, List<DataChannelId>? Table, int Column);
+
+    /// <summary>Builds the packages of <see cref="MergeToPackages"/>, one time stamp at a time.</summary>
+    private sealed class PackageBuilder
+    {
+        private readonly Dictionary<List<DataChannelId>, TableBuilder> _tables = new(ChannelSetComparer.Instance);
+        private readonly List<TableBuilder> _tableOrder = [];
+
+        // The tables of the input tables merged into the package, so a set of DataChannelIds is compared once per table
+        private readonly Dictionary<List<DataChannelId>, TableBuilder> _inputTables = new(ReferenceComparer.Instance);
+        private readonly List<TableBuilder> _rows = [];
+
+        private List<EventDataSet> _events = [];
+        private DateTimeOffset _start;
+        private DateTimeOffset _end;
+
+        public int Count { get; private set; }
+
+        public void Add(List<Candidate> group)
+        {
+            var timeStamp = group[0].Value.TimeStamp;
+            foreach (var candidate in group)
+            {
+                if (candidate.Table is null)
+                {
+                    _events.Add(ToEvent(candidate.Value));
+                    continue;
+                }
+
+                var table = GetTable(candidate.Table);
+                if (table.Filled == 0)
+                    _rows.Add(table);
+                table.Set(candidate.Column, candidate.Value);
+            }
+
+            foreach (var table in _rows)
+                table.EndRow(timeStamp, _events);
+            _rows.Clear();
+
+            if (Count == 0)
+                _start = timeStamp;
+            _end = timeStamp;
+            Count += group.Count;
+        }
+
+        public TimeSeriesDataPackage Build(Header header, ConfigurationReference? dataConfiguration)
+        {
+            List<TabularData>? tables = null;
+            foreach (var table in _tableOrder)
+            {
+                if (table.DataSets.Count == 0)
+                    continue;
+                (tables ??= []).Add(
+                    new TabularData { DataChannelIds = [.. table.DataChannelIds], DataSets = table.DataSets }
+                );
+                table.DataSets = [];
+            }
+
+            var package = new TimeSeriesDataPackage
+            {
+                Package = new Package
+                {
+                    Header = header with { TimeSpan = new TimeSpan { Start = _start, End = _end } },
+                    TimeSeriesData =
+                    [
+                        new TimeSeriesData
+                        {
+                            DataConfiguration = dataConfiguration,
+                            TabularData = tables,
+                            EventData = _events.Count > 0 ? new EventData { DataSet = _events } : null,
+                        },
+                    ],
+                },
+            };
+
+            _events = [];
+            _inputTables.Clear();
+            Count = 0;
+            return package;
+        }
+
+        private TableBuilder GetTable(List<DataChannelId> ids)
+        {
+            if (_inputTables.TryGetValue(ids, out var table))
+                return table;
+
+            if (!_tables.TryGetValue(ids, out table))
+            {
+                table = new TableBuilder([.. ids]);
+                _tables.Add(table.DataChannelIds, table);
+                _tableOrder.Add(table);
+            }
+            _inputTables.Add(ids, table);
+            return table;
+        }
+
+        public static EventDataSet ToEvent(TimeSeriesValue value) =>
+            new()
+            {
+                TimeStamp = value.TimeStamp,
+                DataChannelId = value.DataChannelId,
+                Value = value.Value,
+                Quality = value.Quality,
+            };
+    }
+
+    /// <summary>The rows of one set of DataChannelIds, and the row of the current time stamp.</summary>
+    private sealed class TableBuilder(List<DataChannelId> dataChannelIds)
+    {
+        private readonly TimeSeriesValue?[] _row = new TimeSeriesValue?[dataChannelIds.Count];
+        private int _withQuality;
+
+        public List<DataChannelId> DataChannelIds { get; } = dataChannelIds;
+
+        public List<TabularDataSet> DataSets { get; set; } = [];
+
+        public int Filled { get; private set; }
+
+        public void Set(int column, TimeSeriesValue value)
+        {
+            _row[column] = value;
+            Filled++;
+            if (value.Quality is not null)
+                _withQuality++;
+        }
+
+        public void EndRow(DateTimeOffset timeStamp, List<EventDataSet> events)
+        {
+            if (Filled == _row.Length && (_withQuality == 0 || _withQuality == Filled))
+            {
+                var values = new List<string>(_row.Length);
+                var quality = _withQuality > 0 ? new List<string>(_row.Length) : null;
+                foreach (var value in _row)
+                {
+                    values.Add(value!.Value.Value);
+                    quality?.Add(value.Value.Quality!);
+                }
+                DataSets.Add(
+                    new TabularDataSet
+                    {
+                        TimeStamp = timeStamp,
+                        Value = values,
+                        Quality = quality,
+                    }
+                );
+            }
+            else
+            {
+                foreach (var value in _row)
+                {
+                    if (value is not null)
+                        events.Add(PackageBuilder.ToEvent(value.Value));
+                }
+            }
+
+            Array.Clear(_row, 0, _row.Length);
+            Filled = 0;
+            _withQuality = 0;
+        }
+    }
+
+    private sealed class ChannelSetComparer : IEqualityComparer<List<DataChannelId>>
+    {
+        public static readonly ChannelSetComparer Instance = new();
+
+        public bool Equals(List<DataChannelId>? x, List<DataChannelId>? y) =>
+            ReferenceEquals(x, y) || (x is not null && y is not null && x.SequenceEqual(y));
+
+        public int GetHashCode(List<DataChannelId> obj)
+        {
+            var hash = obj.Count;
+            foreach (var id in obj)
+                hash = unchecked(hash * 31 + id.GetHashCode());
+            return hash;
+        }
+    }
+
+    private sealed class ReferenceComparer : IEqualityComparer<List<DataChannelId>>
+    {
+        public static readonly ReferenceComparer Instance = new();
+
+        public bool Equals(List<DataChannelId>? x, List<DataChannelId>? y) => ReferenceEquals(x, y);
+
+        public int GetHashCode(List<DataChannelId> obj) => RuntimeHelpers.GetHashCode(obj);
+    }
+
+    /// <summary>Position in one input, walking the values of its current package in time order.</summary>
+    /// <remarks>
+    /// Packages are usually already in time order and are walked in place. Otherwise the positions of the values,
+    /// not the values themselves, are sorted.
+    /// </remarks>
+    private sealed class Cursor(int input, IEnumerator<TimeSeriesDataPackage> packages) : IDisposable
+    {
+        private readonly List<Segment> _segments = [];
+        private int _count;
+
+        private int _segment;
+        private int _row;
+        private int _column;
+
+        // Only used for packages that are not in time order
+        private bool _sorted;
+        private long[] _ticks = [];
+        private int[] _order = [];
+        private Position[] _positions = [];
+        private int _index;
+
+        public int Input { get; } = input;
+
+        public long CurrentTicks { get; private set; }
+
+        /// <summary>DataChannelIds of the table of the current value, null for event data.</summary>
+        public List<DataChannelId>? CurrentTable => _segments[_segment].Ids;
+
+        public int CurrentColumn => _column;
+
+        public TimeSeriesValue Current
+        {
+            get
+            {
+                var segment = _segments[_segment];
+                if (segment.Events is not null)
+                {
+                    var e = segment.Events[_row];
+                    return new TimeSeriesValue(e.TimeStamp, e.DataChannelId, e.Value, e.Quality);
+                }
+
+                var row = segment.Rows![_row];
+                return new TimeSeriesValue(
+                    row.TimeStamp,
+                    segment.Ids![_column],
+                    row.Value[_column],
+                    row.Quality?[_column]
+                );
+            }
+        }
+
+        public bool MoveNext(ref long receivedValues)
+        {
+            if (_count > 0 && (_sorted ? MoveNextSorted() : MoveNextInPlace()))
+                return true;
+
+            while (packages.MoveNext())
+            {
+                Load(packages.Current);
+                receivedValues += _count;
+                if (_count > 0)
+                    return true;
+            }
+            return false;
+        }
+
+        private bool MoveNextInPlace()
+        {
+            _column++;
+            while (_segment < _segments.Count)
+            {
+                var segment = _segments[_segment];
+                if (_row >= segment.Length)
+                {
+                    _segment++;
+                    _row = 0;
+                    _column = 0;
+                }
+                else if (_column >= segment.Width(_row))
+                {
+                    _row++;
+                    _column = 0;
+                }
+                else
+                {
+                    CurrentTicks = segment.Ticks(_row);
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        private bool MoveNextSorted()
+        {
+            if (++_index >= _count)
+                return false;
+
+            var position = _positions[_order[_index]];
+            _segment = position.Segment;
+            _row = position.Row;
+            _column = position.Column;
+            CurrentTicks = _ticks[_index];
+            return true;
+        }
+
+        private void Load(TimeSeriesDataPackage package)
+        {
+            _segments.Clear();
+            _count = 0;
+
+            var inOrder = true;
+            var last = long.MinValue;
+            foreach (var data in package.Package.TimeSeriesData)
+            {
+                foreach (var table in data.TabularData ?? [])
+                {
+                    if (table?.DataChannelIds is not null && table.DataSets is not null)
+                        _segments.Add(new Segment(table.DataChannelIds, table.DataSets, null));
+                }
+                if (data.EventData?.DataSet is { } events)
+                    _segments.Add(new Segment(null, null, events));
+            }
+
+            foreach (var segment in _segments)
+            {
+                for (var row = 0; row < segment.Length; row++)
+                {
+                    var ticks = segment.Ticks(row);
+                    inOrder &= ticks >= last;
+                    last = ticks;
+                    _count += segment.Width(row);
+                }
+            }
+
+            _sorted = !inOrder;
+            if (_count == 0)
+                return;
+
+            if (inOrder)
+            {
+                _segment = 0;
+                _row = 0;
+                _column = -1;
+                MoveNextInPlace();
+            }
+            else
+            {
+                Sort();
+            }
+        }
+
+        private void Sort()
+        {
+            if (_ticks.Length < _count)
+            {
+                _ticks = new long[_count];
+                _order = new int[_count];
+                _positions = new Position[_count];
+            }
+
+            var index = 0;
+            for (var segment = 0; segment < _segments.Count; segment++)
+            {
+                var s = _segments[segment];
+                for (var row = 0; row < s.Length; row++)
+                {
+                    var ticks = s.Ticks(row);
+                    var width = s.Width(row);
+                    for (var column = 0; column < width; column++)
+                    {
+                        _ticks[index] = ticks;
+                        _order[index] = index;
+                        _positions[index] = new Position(segment, row, column);
+                        index++;
+                    }
+                }
+            }
+
+            Array.Sort(_ticks, _order, 0, _count);
+
+            // Array.Sort isn't stable, restore package order within equal time stamps so the first duplicate wins
+            for (var start = 0; start < _count; )
+            {
+                var end = start + 1;
+                while (end < _count && _ticks[end] == _ticks[start])
+                    end++;
+                if (end - start > 1)
+                    Array.Sort(_order, start, end - start);
+                start = end;
+            }
+
+            _index = -1;
+            MoveNextSorted();
+        }
+
+        public void Dispose() => packages.Dispose();
+    }
+
+    private readonly record struct Position(int Segment, int Row, int Column);
+
+    /// <summary>A table, or the event data, of a package.</summary>
+    private readonly record struct Segment(
+        List<DataChannelId>? Ids,
+        List<TabularDataSet>? Rows,
+        List<EventDataSet>? Events
+    )
+    {
+        public int Length => Events?.Count ?? Rows!.Count;
+
+        // Rows with fewer values than channels only contribute the values they have
+        public int Width(int row) => Events is null ? Math.Min(Ids!.Count, Rows![row].Value.Count) : 1;
+
+        public long Ticks(int row) => Events is null ? Rows![row].TimeStamp.UtcTicks : Events[row].TimeStamp.UtcTicks;
+    }
+
+    /// <summary>Binary min heap of cursors, ordered by time stamp and then by input.</summary>
+    private sealed class CursorHeap(int capacity)
+    {
+        private readonly Cursor[] _items = new Cursor[capacity];
+
+        public int Count { get; private set; }
+
+        public Cursor Peek() => _items[0];
+
+        public void Push(Cursor cursor)
+        {
+            var i = Count++;
+            while (i > 0)
+            {
+                var parent = (i - 1) / 2;
+                if (!Less(cursor, _items[parent]))
+                    break;
+                _items[i] = _items[parent];
+                i = parent;
+            }
+            _items[i] = cursor;
+        }
+
+        public void Pop()
+        {
+            var last = _items[--Count];
+            _items[Count] = null!;
+            if (Count > 0)
+                SiftDown(last);
+        }
+
+        /// <summary>Restores the heap after the top cursor moved to its next value.</summary>
+        public void ReplaceTop(Cursor cursor) => SiftDown(cursor);
+
+        private void SiftDown(Cursor cursor)
+        {
+            var i = 0;
+            while (true)
+            {
+                var child = i * 2 + 1;
+                if (child >= Count)
+                    break;
+                if (child + 1 < Count && Less(_items[child + 1], _items[child]))
+                    child++;
+                if (!Less(_items[child], cursor))
+                    break;
+                _items[i] = _items[child];
+                i = child;
+            }
+            _items[i] = cursor;
+        }
+
+        private static bool Less(Cursor x, Cursor y) =>
+            x.CurrentTicks < y.CurrentTicks || (x.CurrentTicks == y.CurrentTicks && x.Input < y.Input);
+    }
+}
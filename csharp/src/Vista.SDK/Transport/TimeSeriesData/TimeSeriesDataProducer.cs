@@ -0,0 +1,391 @@
+using System.Globalization;
+using Vista.SDK.Transport.DataChannel;
+
+namespace Vista.SDK.Transport.TimeSeries;
+
+/// <summary>Buffers raw readings of the channels of a DataChannelList into <see cref="TimeSeriesDataPackage"/>s.</summary>
+/// <remarks>
+/// Readings are addressed by the channel's ShortId. Channels are grouped by <see cref="DataChannelType.UpdateCycle"/>,
+/// each group becoming one TabularData whose rows are the time slots of the update cycle. A reading is placed in the
+/// slot its time stamp falls in, a later reading of the same channel and slot replaces it. Channels without an update
+/// cycle share a group whose rows are their exact time stamps. Only the channels with readings are columns of a
+/// table. Rows without a reading of some channel are sent in another table of the channels they have, so every row is
+/// complete and the package validates against the DataChannelList.
+///
+/// A package is emitted when a reading falls outside the time window of the buffered readings, when the number of
+/// buffered readings reaches the size limit, or on <see cref="Flush"/>. Windows are aligned on multiples of the
+/// interval since the Unix epoch. Cells are kept in buffers sized for a window and reused across packages.
+/// The channels are read once, on construction. Not thread safe.
+/// </remarks>
+public sealed class TimeSeriesDataProducer
+{
+    private readonly DataChannelListPackage _dataChannelListPackage;
+    private readonly Action<TimeSeriesDataPackage> _onPackage;
+    private readonly long _intervalTicks;
+    private readonly int _maxReadings;
+    private readonly string? _author;
+
+    private readonly Dictionary<string, (Table Table, int Column)> _channels = new(StringComparer.Ordinal);
+    private readonly Table[] _tables;
+
+    private long _windowStart = long.MinValue;
+    private int _readings;
+
+    private long _receivedReadings;
+    private long _rejectedReadings;
+    private long _emittedPackages;
+
+    /// <param name="dataChannelListPackage">The channels readings are accepted for.</param>
+    /// <param name="onPackage">Receives the emitted packages.</param>
+    /// <param name="interval">The time window of a package.</param>
+    /// <param name="maxReadings">Number of buffered readings emitting a package before the end of its window.</param>
+    /// <param name="author">Author of the emitted packages.</param>
+    public TimeSeriesDataProducer(
+        DataChannelListPackage dataChannelListPackage,
+        Action<TimeSeriesDataPackage> onPackage,
+        System.TimeSpan interval,
+        int maxReadings = 100_000,
+        string? author = null
+    )
+    {
+        _dataChannelListPackage =
+            dataChannelListPackage ?? throw new ArgumentNullException(nameof(dataChannelListPackage));
+        _onPackage = onPackage ?? throw new ArgumentNullException(nameof(onPackage));
+        if (interval <= System.TimeSpan.Zero)
+            throw new ArgumentOutOfRangeException(nameof(interval), interval, "Should be positive");
+        if (maxReadings <= 0)
+            throw new ArgumentOutOfRangeException(nameof(maxReadings), maxReadings, "Should be positive");
+        _intervalTicks = interval.Ticks;
+        _maxReadings = maxReadings;
+        _author = author;
+
+        var tables = new Dictionary<double, Table>();
+        Table? unaligned = null;
+        foreach (var dataChannel in dataChannelListPackage.DataChannelList)
+        {
+            var shortId = dataChannel.DataChannelId.ShortId;
+            if (shortId is null)
+                continue;
+
+            var updateCycle = dataChannel.Property.DataChannelType.UpdateCycle;
+            Table? table;
+            if (updateCycle is not { } cycle || cycle <= 0)
+            {
+                table = unaligned ??= new Table(slotTicks: 0);
+            }
+            else if (!tables.TryGetValue(cycle, out table))
+            {
+                table = new Table(Math.Max(1, (long)(cycle * System.TimeSpan.TicksPerSecond)));
+                tables.Add(cycle, table);
+            }
+
+            _channels.Add(shortId, (table, table.AddColumn(dataChannel.DataChannelId.LocalId)));
+        }
+
+        var ordered = tables.OrderBy(t => t.Key).Select(t => t.Value).ToList();
+        if (unaligned is not null)
+            ordered.Add(unaligned);
+        _tables = ordered.ToArray();
+        foreach (var table in _tables)
+            table.Allocate(_intervalTicks, _maxReadings);
+    }
+
+    /// <summary>Number of readings passed to the producer.</summary>
+    public long ReceivedReadings => _receivedReadings;
+
+    /// <summary>Number of readings of channels not in the DataChannelList, or without a ShortId.</summary>
+    public long RejectedReadings => _rejectedReadings;
+
+    /// <summary>Number of packages passed to the package callback.</summary>
+    public long EmittedPackages => _emittedPackages;
+
+    /// <summary>Number of readings waiting for the next package.</summary>
+    public int BufferedReadings => _readings;
+
+    /// <summary>Buffers a reading, emitting the buffered package first when it falls outside of its window.</summary>
+    /// <returns>False when the channel is unknown.</returns>
+    public bool TryAdd(string shortId, DateTimeOffset timeStamp, string value, string? quality = null)
+    {
+        if (shortId is null)
+            throw new ArgumentNullException(nameof(shortId));
+        if (value is null)
+            throw new ArgumentNullException(nameof(value));
+
+        _receivedReadings++;
+        if (!_channels.TryGetValue(shortId, out var channel))
+        {
+            _rejectedReadings++;
+            return false;
+        }
+
+        var ticks = timeStamp.UtcTicks;
+        var windowStart = ticks - Mod(ticks, _intervalTicks);
+        if (windowStart != _windowStart)
+        {
+            Flush();
+            _windowStart = windowStart;
+        }
+
+        if (channel.Table.Set(ticks, channel.Column, value, quality))
+            _readings++;
+
+        if (_readings >= _maxReadings)
+            Flush();
+        return true;
+    }
+
+    /// <inheritdoc cref="TryAdd(string, DateTimeOffset, string, string?)"/>
+    public bool TryAdd(string shortId, DateTimeOffset timeStamp, double value, string? quality = null) =>
+        TryAdd(shortId, timeStamp, value.ToString("R", CultureInfo.InvariantCulture), quality);
+
+    /// <summary>Emits the buffered package when its window ended before <paramref name="now"/>.</summary>
+    /// <remarks>For timers, so the last readings before a pause are not held back until the next reading.</remarks>
+    public void FlushIfDue(DateTimeOffset now)
+    {
+        if (_readings > 0 && now.UtcTicks - _windowStart >= _intervalTicks)
+            Flush();
+    }
+
+    /// <summary>Emits the buffered readings, if any.</summary>
+    public void Flush()
+    {
+        if (_readings == 0)
+            return;
+
+        var tabularData = new List<TabularData>(_tables.Length);
+        var start = long.MaxValue;
+        var end = long.MinValue;
+        foreach (var table in _tables)
+        {
+            if (table.Rows == 0)
+                continue;
+            table.AddTabularData(tabularData, ref start, ref end);
+            table.Clear();
+        }
+        _readings = 0;
+
+        var package = new TimeSeriesDataPackage
+        {
+            Package = new Package
+            {
+                Header = new Header
+                {
+                    ShipId = _dataChannelListPackage.Package.Header.ShipId,
+                    TimeSpan = new TimeSpan
+                    {
+                        Start = new DateTimeOffset(start, System.TimeSpan.Zero),
+                        End = new DateTimeOffset(end, System.TimeSpan.Zero),
+                    },
+                    Author = _author,
+                },
+                TimeSeriesData =
+                [
+                    new TimeSeriesData
+                    {
+                        DataConfiguration = ConfigurationReference.From(_dataChannelListPackage),
+                        TabularData = tabularData,
+                        EventData = null,
+                    },
+                ],
+            },
+        };
+
+        _emittedPackages++;
+        _onPackage(package);
+    }
+
+    private static long Mod(long ticks, long divisor)
+    {
+        var mod = ticks % divisor;
+        return mod < 0 ? mod + divisor : mod;
+    }
+
+    /// <summary>The cells of the channels of one update cycle, in row-major arrays.</summary>
+    private sealed class Table(long slotTicks)
+    {
+        private readonly List<DataChannelId> _ids = [];
+
+        private long[] _slots = [];
+        private string?[] _values = [];
+        private string?[] _qualities = [];
+        private int[] _cells = [];
+        private bool[] _used = [];
+        private int _usedColumns;
+
+        // Rows by slot, the last row is checked first as readings mostly come in time order
+        private readonly Dictionary<long, int> _rowsBySlot = new();
+        private bool _sorted = true;
+
+        public int Rows { get; private set; }
+
+        private int Width => _ids.Count;
+
+        public int AddColumn(LocalId localId)
+        {
+            _ids.Add(localId);
+            return _ids.Count - 1;
+        }
+
+        /// <summary>Sizes the buffers for the slots of a window, capped by the readings of a package.</summary>
+        public void Allocate(long intervalTicks, int maxReadings)
+        {
+            var rows = slotTicks > 0 ? Math.Min(intervalTicks / slotTicks + 1, maxReadings / Width + 1) : 16;
+            Grow((int)Math.Min(rows, 4096));
+            _used = new bool[Width];
+        }
+
+        /// <returns>True for a new cell, false when replacing the reading of a cell.</returns>
+        public bool Set(long ticks, int column, string value, string? quality)
+        {
+            var slot = slotTicks > 0 ? ticks - Mod(ticks, slotTicks) : ticks;
+
+            int row;
+            if (Rows > 0 && _slots[Rows - 1] == slot)
+            {
+                row = Rows - 1;
+            }
+            else if (!_rowsBySlot.TryGetValue(slot, out row))
+            {
+                if (Rows == _slots.Length)
+                    Grow(_slots.Length * 2);
+                row = Rows++;
+                _slots[row] = slot;
+                _rowsBySlot.Add(slot, row);
+                if (row > 0 && _slots[row - 1] > slot)
+                    _sorted = false;
+            }
+
+            var cell = row * Width + column;
+            var isNew = _values[cell] is null;
+            _values[cell] = value;
+            _qualities[cell] = quality;
+            if (isNew)
+                _cells[row]++;
+            if (!_used[column])
+            {
+                _used[column] = true;
+                _usedColumns++;
+            }
+            return isNew;
+        }
+
+        /// <summary>Adds the rows as one table, or one table per set of channels the rows have readings of.</summary>
+        public void AddTabularData(List<TabularData> tabularData, ref long start, ref long end)
+        {
+            var order = Enumerable.Range(0, Rows).ToArray();
+            if (!_sorted)
+            {
+                var slots = new long[Rows];
+                Array.Copy(_slots, slots, Rows);
+                Array.Sort(slots, order);
+            }
+            start = Math.Min(start, _slots[order[0]]);
+            end = Math.Max(end, _slots[order[Rows - 1]]);
+
+            var complete = true;
+            for (var row = 0; row < Rows && complete; row++)
+                complete = _cells[row] == _usedColumns;
+            if (complete)
+            {
+                tabularData.Add(CreateTabularData(order));
+                return;
+            }
+
+            // Rows are grouped by a mask of their columns, 16 columns per char
+            var groups = new Dictionary<string, List<int>>(StringComparer.Ordinal);
+            var keys = new List<string>();
+            var mask = new char[(Width + 15) / 16];
+            foreach (var row in order)
+            {
+                Array.Clear(mask, 0, mask.Length);
+                for (var column = 0; column < Width; column++)
+                {
+                    if (_values[row * Width + column] is not null)
+                        mask[column / 16] |= (char)(1 << (column % 16));
+                }
+
+                var key = new string(mask);
+                if (!groups.TryGetValue(key, out var rows))
+                {
+                    groups.Add(key, rows = []);
+                    keys.Add(key);
+                }
+                rows.Add(row);
+            }
+
+            foreach (var key in keys)
+                tabularData.Add(CreateTabularData(groups[key]));
+        }
+
+        /// <summary>Creates a table of rows that all have readings of the same channels.</summary>
+        private TabularData CreateTabularData(IReadOnlyList<int> rows)
+        {
+            var first = rows[0] * Width;
+            var columns = new List<int>(_cells[rows[0]]);
+            var ids = new List<DataChannelId>(columns.Capacity);
+            for (var column = 0; column < Width; column++)
+            {
+                if (_values[first + column] is null)
+                    continue;
+                columns.Add(column);
+                ids.Add(_ids[column]);
+            }
+
+            var hasQuality = false;
+            var dataSets = new List<TabularDataSet>(rows.Count);
+            foreach (var row in rows)
+            {
+                var values = new List<string>(columns.Count);
+                foreach (var column in columns)
+                {
+                    var cell = row * Width + column;
+                    values.Add(_values[cell]!);
+                    hasQuality |= _qualities[cell] is not null;
+                }
+                dataSets.Add(
+                    new TabularDataSet
+                    {
+                        TimeStamp = new DateTimeOffset(_slots[row], System.TimeSpan.Zero),
+                        Value = values,
+                        Quality = null,
+                    }
+                );
+            }
+
+            // Only tables with qualities carry a quality per value
+            if (hasQuality)
+            {
+                for (var i = 0; i < rows.Count; i++)
+                {
+                    var qualities = new List<string>(columns.Count);
+                    foreach (var column in columns)
+                        qualities.Add(_qualities[rows[i] * Width + column] ?? "");
+                    dataSets[i].Quality = qualities;
+                }
+            }
+
+            return new TabularData { DataChannelIds = ids, DataSets = dataSets };
+        }
+
+        public void Clear()
+        {
+            Array.Clear(_values, 0, Rows * Width);
+            Array.Clear(_qualities, 0, Rows * Width);
+            Array.Clear(_cells, 0, Rows);
+            Array.Clear(_used, 0, _used.Length);
+            _rowsBySlot.Clear();
+            _usedColumns = 0;
+            _sorted = true;
+            Rows = 0;
+        }
+
+        private void Grow(int rows)
+        {
+            rows = Math.Max(rows, 1);
+            Array.Resize(ref _slots, rows);
+            Array.Resize(ref _values, rows * Width);
+            Array.Resize(ref _qualities, rows * Width);
+            Array.Resize(ref _cells, rows);
+        }
+    }
+}
@@ -1,5 +1,6 @@
 using System.Text;
 using Microsoft.Extensions.Caching.Memory;
+using Vista.SDK.Transport.DataChannel;
 
 namespace Vista.SDK;
 
@@ -28,6 +29,20 @@ public interface IVIS
 /// </summary>
 public static partial class VisVersionExtensions { }
 
+/// <summary>
+/// Extensions for any <see cref="IVIS"/>, kept out of the interface so existing implementations don't break
+/// </summary>
+public static class VISExtensions
+{
+    /// <summary>Resolves the Gmod, Codebooks and Locations of a VIS version in one go.</summary>
+    public static VisContext GetContext(this IVIS vis, VisVersion visVersion)
+    {
+        if (vis is null)
+            throw new ArgumentNullException(nameof(vis));
+        return new VisContext(vis.GetGmod(visVersion), vis.GetCodebooks(visVersion), vis.GetLocations(visVersion));
+    }
+}
+
 public sealed class VIS : IVIS
 {
     public static readonly VisVersion LatestVisVersion = VisVersion.v3_10a;
@@ -126,23 +141,18 @@ public Gmod GetGmod(VisVersion visVersion)
         return gmods.ToDictionary(t => t.Version, t => t.Gmod);
     }
 
-    private Dictionary<string, GmodVersioningDto> GetGmodVersioningDto()
+    private GmodVersioningDto? GetGmodVersioningDto(VisVersion visVersion)
     {
         return _gmodVersioningDtoCache.GetOrCreate(
-            _versioning,
+            visVersion,
             entry =>
             {
                 entry.Size = 1;
                 entry.SlidingExpiration = TimeSpan.FromHours(1);
 
-                var dtos = EmbeddedResource.GetGmodVersioning();
-
-                if (dtos is null)
-                    throw new ArgumentException("Invalid state");
-
-                return dtos;
+                return EmbeddedResource.GetGmodVersioning(visVersion.ToVersionString());
             }
-        )!;
+        );
     }
 
     private GmodVersioning GetGmodVersioning()
@@ -154,9 +164,7 @@ private GmodVersioning GetGmodVersioning()
                 entry.Size = 1;
                 entry.SlidingExpiration = TimeSpan.FromHours(1);
 
-                var dto = GetGmodVersioningDto();
-
-                return new GmodVersioning(dto);
+                return new GmodVersioning(GetGmodVersioningDto, GetGmod);
             }
         )!;
     }
@@ -256,6 +264,10 @@ public Locations GetLocations(VisVersion visversion)
         return locations.ToDictionary(t => t.Version, t => t.Locations);
     }
 
+    /// <summary>Resolves the Gmod, Codebooks and Locations of a VIS version in one go.</summary>
+    public VisContext GetContext(VisVersion visVersion) =>
+        new VisContext(GetGmod(visVersion), GetCodebooks(visVersion), GetLocations(visVersion));
+
     public IEnumerable<VisVersion> GetVisVersions()
     {
         return (VisVersion[])Enum.GetValues(typeof(VisVersion));
@@ -279,6 +291,17 @@ public IEnumerable<VisVersion> GetVisVersions()
     public LocalId? ConvertLocalId(LocalId sourceLocalId, VisVersion targetVersion) =>
         GetGmodVersioning().ConvertLocalId(sourceLocalId, targetVersion);
 
+    /// <summary>Converts all channels of a DataChannelList to the target VIS version.</summary>
+    /// <remarks>
+    /// Node and path conversions are memoized across the list, and channels are converted in parallel by default.
+    /// Channels that can't be converted are left out of the resulting list and reported in the result.
+    /// </remarks>
+    public DataChannelListConversionResult ConvertDataChannelList(
+        DataChannelList sourceList,
+        VisVersion targetVersion,
+        bool parallel = true
+    ) => GetGmodVersioning().ConvertDataChannelList(sourceList, targetVersion, parallel);
+
     /// <summary>Rules according to: "ISO19848 5.2.1, Note 1" and "RFC3986 2.3 - Unreserved characters"</summary>
     internal static bool MatchISOLocalIdString(StringBuilder builder)
     {
@@ -0,0 +1,43 @@
+namespace Vista.SDK;
+
+/// <summary>The Gmod, Codebooks and Locations of a single VIS version.</summary>
+/// <remarks>
+/// Resolve a context once, e.g. with <see cref="VIS.GetContext(VisVersion)"/>, and pass it to parsing APIs
+/// inside loops instead of having every call look up the VIS caches.
+/// Contexts can also be built from standalone instances, e.g. a Gmod subset, independent of <see cref="VIS.Instance"/>.
+/// </remarks>
+public sealed class VisContext
+{
+    public VisVersion VisVersion { get; }
+
+    public Gmod Gmod { get; }
+
+    public Codebooks Codebooks { get; }
+
+    public Locations Locations { get; }
+
+    public VisContext(Gmod gmod, Codebooks codebooks, Locations locations)
+    {
+        if (gmod is null)
+            throw new ArgumentNullException(nameof(gmod));
+        if (codebooks is null)
+            throw new ArgumentNullException(nameof(codebooks));
+        if (locations is null)
+            throw new ArgumentNullException(nameof(locations));
+        if (codebooks.VisVersion != gmod.VisVersion)
+            throw new ArgumentException(
+                $"Codebooks are VIS version {codebooks.VisVersion}, expected {gmod.VisVersion}",
+                nameof(codebooks)
+            );
+        if (locations.VisVersion != gmod.VisVersion)
+            throw new ArgumentException(
+                $"Locations are VIS version {locations.VisVersion}, expected {gmod.VisVersion}",
+                nameof(locations)
+            );
+
+        VisVersion = gmod.VisVersion;
+        Gmod = gmod;
+        Codebooks = codebooks;
+        Locations = locations;
+    }
+}
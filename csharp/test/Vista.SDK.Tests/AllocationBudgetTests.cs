@@ -0,0 +1,120 @@
+using Vista.SDK.Internal;
+
+namespace Vista.SDK.Tests;
+
+/// <summary>Bytes allocated per operation of hot APIs, against declared budgets.</summary>
+/// <remarks>
+/// Budgets are averages over the inputs from testdata, after a warm up pass that fills caches and lazy state.
+/// A failure means an operation allocates more than it used to, lower the budget when an operation gets cheaper.
+/// </remarks>
+public class AllocationBudgetTests
+{
+    private static readonly Lazy<GmodPath[]> GmodPaths = new(() =>
+        VistaSDKTestData
+            .AddValidGmodPathsData()
+            .Select(data => (GmodPathTestItem)data[0])
+            .Select(item => GmodPath.Parse(item.Path, VisVersions.Parse(item.VisVersion)))
+            .ToArray()
+    );
+
+    private static readonly Lazy<LocalId[]> LocalIds = new(() =>
+        File.ReadLines("testdata/LocalIds.txt")
+            .Select(line => LocalIdBuilder.TryParse(line, out var localId) ? localId.Build() : null)
+            .OfType<LocalId>()
+            .ToArray()
+    );
+
+    [Fact]
+    public void Test_GmodPath_TryParse()
+    {
+        var inputs = GmodPaths.Value.Select(p => (Path: p.ToString(), p.VisVersion)).ToArray();
+        AssertBudget(
+            Budgets.GmodPathTryParse,
+            inputs,
+            input => GmodPath.TryParse(input.Path, input.VisVersion, out _)
+        );
+    }
+
+    [Fact]
+    public void Test_LocalIdBuilder_TryParse()
+    {
+        var inputs = LocalIds.Value.Select(l => l.ToString()).ToArray();
+        AssertBudget(Budgets.LocalIdBuilderTryParse, inputs, input => LocalIdBuilder.TryParse(input, out _));
+    }
+
+    [Fact]
+    public void Test_LocalId_ToString()
+    {
+        AssertBudget(Budgets.LocalIdToString, LocalIds.Value, localId => localId.ToString());
+    }
+
+    [Fact]
+    public void Test_Locations_TryParse()
+    {
+        var inputs = LocalIds
+            .Value.SelectMany(l => l.PrimaryItem.GetFullPath())
+            .Select(n => n.Node.Location)
+            .OfType<Location>()
+            .Select(l => l.ToString())
+            .ToArray();
+        Assert.NotEmpty(inputs);
+
+        var locations = VIS.Instance.GetLocations(VisVersion.v3_4a);
+        AssertBudget(Budgets.LocationsTryParse, inputs, input => locations.TryParse(input, out _));
+    }
+
+    [Fact]
+    public void Test_Codebook_ValidatePosition()
+    {
+        var inputs = LocalIds.Value.Select(l => l.Position?.Value).OfType<string>().ToArray();
+        Assert.NotEmpty(inputs);
+
+        var positions = VIS.Instance.GetCodebooks(VisVersion.v3_4a)[CodebookName.Position];
+        AssertBudget(Budgets.CodebookValidatePosition, inputs, input => positions.ValidatePosition(input));
+    }
+
+    [Fact]
+    public void Test_ChdDictionary_TryGetValue()
+    {
+        var inputs = GmodPaths.Value.SelectMany(p => p.GetFullPath()).Select(n => n.Node.Code).ToArray();
+
+        var gmod = VIS.Instance.GetGmod(VisVersion.v3_4a);
+        var dictionary = new ChdDictionary<GmodNode>(gmod.Select(n => (n.Code, n)).ToArray());
+        AssertBudget(Budgets.ChdDictionaryTryGetValue, inputs, input => dictionary.TryGetValue(input, out _));
+    }
+
+    private static void AssertBudget<T>(int budget, IReadOnlyList<T> inputs, Action<T> operation)
+    {
+        Assert.NotEmpty(inputs);
+
+        foreach (var input in inputs)
+            operation(input);
+
+        var before = GC.GetAllocatedBytesForCurrentThread();
+        foreach (var input in inputs)
+            operation(input);
+        var perOperation = (GC.GetAllocatedBytesForCurrentThread() - before) / inputs.Count;
+
+        Assert.True(perOperation <= budget, $"{perOperation} bytes per operation, budget is {budget} bytes");
+    }
+
+    /// <summary>Average bytes allocated per operation, with some room for runtime differences.</summary>
+    private static class Budgets
+    {
+        // About 2.9 KB on .NET 8
+        public const int GmodPathTryParse = 3400;
+
+        // About 5.6 KB on .NET 8
+        public const int LocalIdBuilderTryParse = 6400;
+
+        // The string itself, built in a pooled StringBuilder, about 220 bytes on .NET 8
+        public const int LocalIdToString = 280;
+
+        public const int LocationsTryParse = 0;
+
+        // Multi part positions are split, about 55 bytes on .NET 8
+        public const int CodebookValidatePosition = 80;
+
+        public const int ChdDictionaryTryGetValue = 0;
+    }
+}
@@ -168,4 +168,82 @@ public void Test_Detail_Tag(string validCustomTag, string firstInvalidCustomTag,
         Assert.Throws<ArgumentException>(() => codebook.CreateTag(firstInvalidCustomTag));
         Assert.Throws<ArgumentException>(() => codebook.CreateTag(secondInvalidCustomTag));
     }
+
+    [Fact]
+    public void Test_Fuzzy_Lookup()
+    {
+        var codebooks = VIS.Instance.GetCodebooks(VisVersion.v3_10a);
+
+        var quantities = codebooks[CodebookName.Quantity];
+        var matches = quantities.StandardValues.FindClosest("Temprature", maxEdits: 1);
+        Assert.Equal(new CodebookValueMatch("temperature", 1), Assert.Single(matches));
+        Assert.Equal(0, quantities.StandardValues.FindClosest("density")[0].Distance);
+        Assert.Empty(quantities.StandardValues.FindClosest("zzzzzzzzzzzz"));
+
+        var states = codebooks[CodebookName.State];
+        Assert.Contains(new CodebookValueMatch("By-passed", 1), states.Groups.FindClosest("bypassed"));
+
+        Assert.Throws<ArgumentNullException>(() => quantities.StandardValues.FindClosest(null!));
+        Assert.Throws<ArgumentOutOfRangeException>(() => quantities.Groups.FindClosest("a", -1));
+    }
+
+    [Fact]
+    public void Test_Fuzzy_Lookup_Matches_Scan()
+    {
+        var random = new Random(42);
+        foreach (var visVersion in VisVersions.All)
+        {
+            var codebooks = VIS.Instance.GetCodebooks(visVersion);
+            foreach (CodebookName name in Enum.GetValues(typeof(CodebookName)))
+            {
+                // Older versions don't have every codebook
+                var codebook = codebooks[name];
+                if (codebook is null)
+                    continue;
+
+                var values = codebook.StandardValues.ToArray();
+                foreach (var value in values.Take(50))
+                {
+                    // Up to two random edits of a standard value
+                    var query = value;
+                    for (var edits = random.Next(3); edits > 0 && query.Length > 0; edits--)
+                    {
+                        var at = random.Next(query.Length);
+                        query = random.Next(2) == 0 ? query.Remove(at, 1) : query.Insert(at, "x");
+                    }
+
+                    for (var maxEdits = 0; maxEdits <= 3; maxEdits++)
+                    {
+                        var expected = values
+                            .Select(v => new CodebookValueMatch(v, Levenshtein(query, v)))
+                            .Where(m => m.Distance <= maxEdits)
+                            .OrderBy(m => m.Distance)
+                            .ThenBy(m => m.Value, StringComparer.Ordinal)
+                            .ToList();
+                        Assert.Equal(expected, codebook.StandardValues.FindClosest(query, maxEdits));
+                    }
+                }
+            }
+        }
+    }
+
+    private static int Levenshtein(string a, string b)
+    {
+        a = a.ToLowerInvariant();
+        b = b.ToLowerInvariant();
+        var d = new int[a.Length + 1, b.Length + 1];
+        for (var i = 0; i <= a.Length; i++)
+            d[i, 0] = i;
+        for (var j = 0; j <= b.Length; j++)
+            d[0, j] = j;
+        for (var i = 1; i <= a.Length; i++)
+        {
+            for (var j = 1; j <= b.Length; j++)
+            {
+                var cost = a[i - 1] == b[j - 1] ? 0 : 1;
+                d[i, j] = Math.Min(Math.Min(d[i - 1, j] + 1, d[i, j - 1] + 1), d[i - 1, j - 1] + cost);
+            }
+        }
+        return d[a.Length, b.Length];
+    }
 }
@@ -0,0 +1,97 @@
+using Vista.SDK.Internal;
+
+namespace Vista.SDK.Tests;
+
+public class GmodSearchTests
+{
+    [Fact]
+    public void Test_Code_Search()
+    {
+        var gmod = VIS.Instance.GetGmod(VisVersion.v3_4a);
+
+        var exact = gmod.Search("411.1");
+        Assert.Equal("411.1", exact[0].Node.Code);
+        Assert.Equal(GmodSearchIndex.CodeExact, exact[0].Score);
+
+        var prefix = gmod.Search("c101.", maxResults: 20);
+        Assert.Equal(20, prefix.Count);
+        Assert.True(prefix.All(r => r.Node.Code.StartsWith("C101.", StringComparison.Ordinal)));
+        // Shortest codes first
+        Assert.True(prefix.Zip(prefix.Skip(1), (a, b) => a.Node.Code.Length <= b.Node.Code.Length).All(x => x));
+    }
+
+    [Fact]
+    public void Test_Word_Search()
+    {
+        var gmod = VIS.Instance.GetGmod(VisVersion.v3_4a);
+
+        var results = gmod.Search("fuel oil pump", maxResults: 50);
+        Assert.NotEmpty(results);
+        Assert.Equal("621.22", results[0].Node.Code);
+        foreach (var result in results)
+        {
+            var text = Text(result.Node);
+            Assert.Contains("fuel", text);
+            Assert.Contains("oil", text);
+            Assert.Contains("pump", text);
+        }
+
+        // Inside words
+        Assert.True(gmod.Search("ngine", maxResults: 1000).Any(r => r.Node.Code == "C101"));
+
+        Assert.Empty(gmod.Search("  "));
+        Assert.Empty(gmod.Search("zzzz"));
+        Assert.Throws<ArgumentNullException>(() => gmod.Search(null!));
+    }
+
+    [Theory]
+    [InlineData("4")]
+    [InlineData("c")]
+    [InlineData("C101")]
+    [InlineData("pu")]
+    [InlineData("pum")]
+    [InlineData("lubricat")]
+    [InlineData("main eng")]
+    [InlineData("Fuel, oil")]
+    [InlineData("411.1/c")]
+    public void Test_Search_Matches_Scan(string query)
+    {
+        foreach (var visVersion in VisVersions.All)
+        {
+            var gmod = VIS.Instance.GetGmod(visVersion);
+
+            var results = gmod.Search(query, int.MaxValue);
+            for (var i = 1; i < results.Count; i++)
+                Assert.True(results[i - 1].Score >= results[i].Score);
+
+            var expected = gmod.Where(n => Matches(n, query)).Select(n => n.Code).OrderBy(c => c).ToList();
+            var actual = results.Select(r => r.Node.Code).OrderBy(c => c).ToList();
+            Assert.Equal(expected, actual);
+        }
+    }
+
+    private static string Text(GmodNode node) =>
+        string.Join(
+                " ",
+                node.Metadata.Name,
+                node.Metadata.CommonName,
+                node.Metadata.Definition,
+                node.Metadata.CommonDefinition
+            )
+            .ToLowerInvariant();
+
+    // Query semantics without the index
+    private static bool Matches(GmodNode node, string query)
+    {
+        var text = query.Trim().ToLowerInvariant();
+        if (node.Code.StartsWith(text, StringComparison.OrdinalIgnoreCase))
+            return true;
+
+        var tokens = GmodSearchIndex.Tokenize(text);
+        var words = GmodSearchIndex.Tokenize(Text(node));
+        return tokens.Count > 0
+            && tokens.All(
+                t => words.Any(w => t.Length < 3 ? w.StartsWith(t, StringComparison.Ordinal) : w.Contains(t))
+            );
+    }
+}
@@ -394,6 +394,91 @@ public void Test_Full_Traversal_From()
         Assert.True(completed);
     }
 
+    [Fact]
+    public void Test_Subset()
+    {
+        var (_, vis) = VISTests.GetVis();
+
+        var version = VisVersion.v3_4a;
+        var gmod = vis.GetGmod(version);
+        var codebooks = vis.GetCodebooks(version);
+        var locations = vis.GetLocations(version);
+
+        var localIdStrs = new[]
+        {
+            "/dnv-v2/vis-3-4a/411.1/C101.31-2/meta/qty-temperature/cnt-exhaust.gas/pos-inlet",
+            "/dnv-v2/vis-3-4a/652.31/S90.3/S61/sec/652.1i-1P/meta/cnt-sea.water/state-opened",
+            "/dnv-v2/vis-3-4a/511.11-21O/C101.67/S208/meta/qty-pressure/cnt-air/state-low",
+        };
+        var localIds = localIdStrs.Select(s => (ILocalId)LocalIdBuilder.Parse(s).Build()).ToArray();
+
+        var subset = gmod.CreateSubset(localIds);
+        Assert.Equal(version, subset.VisVersion);
+        Assert.Equal("VE", subset.RootNode.Code);
+        Assert.True(subset.Count() < 100);
+        Assert.False(subset.TryGetNode("1031", out _));
+
+        foreach (var localId in localIds)
+        {
+            foreach (var path in new[] { localId.PrimaryItem, localId.SecondaryItem })
+            {
+                if (path is null)
+                    continue;
+                for (int i = 0; i < path.Length; i++)
+                    Assert.True(subset.TryGetNode(path[i].Code, out _));
+
+                Assert.True(GmodPath.TryParse(path.ToString(), subset, locations, out var parsed));
+                Assert.Equal(path.ToFullPathString(), parsed.ToFullPathString());
+                Assert.Equal(path.IsMappable, parsed.IsMappable);
+                Assert.True(subset.TryParseFromFullPath(path.ToFullPathString(), out parsed));
+                Assert.Equal(path.ToString(), parsed.ToString());
+            }
+        }
+
+        // Product selections of function leaves are projected, e.g. CS1 of 411.1, which the path 411.1/C101.31 skips
+        Assert.Equal("CS1", subset["411.1"].ProductSelection?.Code);
+        foreach (var node in subset)
+        {
+            var full = gmod[node.Code];
+            Assert.Equal(full.IsMappable, node.IsMappable);
+            Assert.Equal(full.ProductType?.Code, node.ProductType?.Code);
+            Assert.Equal(full.ProductSelection?.Code, node.ProductSelection?.Code);
+        }
+
+        foreach (var localIdStr in localIdStrs)
+        {
+            var parsed = LocalIdBuilder.Parse(localIdStr, subset, codebooks);
+            Assert.Equal(localIdStr, parsed.ToString());
+        }
+        Assert.False(
+            LocalIdBuilder.TryParse("/dnv-v2/vis-3-4a/1031/meta/cnt-refrigerant/state-leaking", subset, codebooks, out _)
+        );
+        Assert.False(
+            LocalIdBuilder.TryParse(localIdStrs[0], vis.GetGmod(VisVersion.v3_5a), vis.GetCodebooks(VisVersion.v3_5a), out _)
+        );
+
+        using var stream = new MemoryStream();
+        subset.Serialize(stream);
+        stream.Position = 0;
+        var deserialized = Gmod.Deserialize(stream);
+
+        Assert.Equal(version, deserialized.VisVersion);
+        Assert.Equal(subset.Select(n => n.Code).OrderBy(c => c), deserialized.Select(n => n.Code).OrderBy(c => c));
+        foreach (var node in subset)
+        {
+            var other = deserialized[node.Code];
+            Assert.Equal(node.Metadata.FullType, other.Metadata.FullType);
+            Assert.Equal(node.Children.Select(c => c.Code), other.Children.Select(c => c.Code));
+            Assert.Equal(
+                node.Parents.Select(c => c.Code).OrderBy(c => c),
+                other.Parents.Select(c => c.Code).OrderBy(c => c)
+            );
+        }
+
+        foreach (var localIdStr in localIdStrs)
+            Assert.Equal(localIdStr, LocalIdBuilder.Parse(localIdStr, deserialized, codebooks).ToString());
+    }
+
     private sealed record TraversalState(int StopAfter)
     {
         public int NodeCount { get; set; }
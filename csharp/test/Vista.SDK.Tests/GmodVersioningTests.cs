@@ -1,3 +1,4 @@
+using Vista.SDK.Transport.DataChannel;
 using Xunit.Abstractions;
 
 namespace Vista.SDK.Tests;
@@ -237,6 +238,71 @@ public void ConvertLocalId(string sourceLocalIdStr, string targetLocalIdStr)
         Assert.Equal(targetLocalIdStr, convertedLocalId!.ToString());
     }
 
+    [Fact]
+    public void Test_Convert_DataChannelList()
+    {
+        var vis = VIS.Instance;
+        var targetVersion = VisVersion.v3_6a;
+
+        var localIds = File.ReadLines("testdata/LocalIds.txt")
+            .Where(l => l.StartsWith("/dnv-v2/vis-3-4a/"))
+            .Distinct()
+            .Take(2000)
+            .Select(LocalId.Parse)
+            .Append(LocalId.Parse("/dnv-v2/vis-3-6a/411.1/C101.31-2/meta/qty-temperature/cnt-exhaust.gas/pos-inlet"))
+            .ToArray();
+
+        var sourceList = new DataChannelList(
+            localIds
+                .Select(
+                    (localId, i) =>
+                        new DataChannel
+                        {
+                            DataChannelId = new DataChannelId { LocalId = localId, ShortId = i.ToString("X4") },
+                            Property = new Property
+                            {
+                                DataChannelType = new DataChannelType { Type = "Inst" },
+                                Format = new Format { Type = "String", Restriction = null },
+                                Range = null,
+                                Unit = null,
+                                AlertPriority = null,
+                            }
+                        }
+                )
+                .ToArray()
+        );
+
+        var result = vis.ConvertDataChannelList(sourceList, targetVersion);
+        var sequential = vis.ConvertDataChannelList(sourceList, targetVersion, parallel: false);
+
+        Assert.Equal(sourceList.Count, result.DataChannelList.Count + result.Errors.Count);
+        Assert.Equal(
+            sequential.DataChannelList.Select(c => c.DataChannelId.LocalId),
+            result.DataChannelList.Select(c => c.DataChannelId.LocalId)
+        );
+        Assert.Equal(sequential.Errors.Count, result.Errors.Count);
+
+        foreach (var channel in result.DataChannelList)
+        {
+            var sourceChannel = sourceList[channel.DataChannelId.ShortId!];
+            Assert.Equal(targetVersion, channel.DataChannelId.LocalId.VisVersion);
+            Assert.Same(sourceChannel.Property, channel.Property);
+            if (sourceChannel.DataChannelId.LocalId.VisVersion == targetVersion)
+                Assert.Same(sourceChannel, channel);
+            else
+                Assert.Equal(
+                    vis.ConvertLocalId(sourceChannel.DataChannelId.LocalId, targetVersion),
+                    channel.DataChannelId.LocalId
+                );
+        }
+
+        foreach (var error in result.Errors)
+        {
+            Assert.False(string.IsNullOrEmpty(error.Message));
+            Assert.False(result.DataChannelList.TryGetByShortId(error.DataChannel.DataChannelId.ShortId!, out _));
+        }
+    }
+
     [Theory]
     [MemberData(nameof(VistaSDKTestData.AddValidGmodPathsData), MemberType = typeof(VistaSDKTestData))]
     public void Test_Valid_GmodPath_To_Latest(GmodPathTestItem item)
@@ -0,0 +1,130 @@
+using Vista.SDK.Internal;
+using Vista.SDK.Transport.Json;
+using Vista.SDK.Transport.Json.DataChannel;
+using TsDataChannelId = Vista.SDK.Transport.DataChannelId;
+
+namespace Vista.SDK.Tests.Internal;
+
+public class ShortIdTableTests
+{
+    [Theory]
+    [InlineData("aa9279e1-d61c-5382-ada4-ab30a6bbdc0b", true)]
+    [InlineData("00000000-0000-0000-0000-000000000000", true)]
+    [InlineData("AA9279E1-D61C-5382-ADA4-AB30A6BBDC0B", false)]
+    [InlineData("aa9279e1d61c5382ada4ab30a6bbdc0b", false)]
+    [InlineData("aa9279e1-d61c-5382-ada4-ab30a6bbdc0", false)]
+    [InlineData("aa9279e1-d61c-5382-ada4_ab30a6bbdc0b", false)]
+    [InlineData("aa9279e1-d61c-5382-ada4-ab30a6bbdc0g", false)]
+    [InlineData("0010", false)]
+    [InlineData("", false)]
+    public void Test_ShortIdKey_Parse(string value, bool expected)
+    {
+        Assert.Equal(expected, ShortIdKey.TryParse(value.AsSpan(), out var key));
+        if (!expected)
+            return;
+
+        var bytes = Guid.Parse(value).ToString("N");
+        Assert.Equal(Convert.ToUInt64(bytes.Substring(0, 16), 16), key.High);
+        Assert.Equal(Convert.ToUInt64(bytes.Substring(16), 16), key.Low);
+    }
+
+    [Fact]
+    public void Test_Add_Get_Remove()
+    {
+        var random = new Random(1);
+        var table = new ShortIdTable<string>();
+        var expected = new Dictionary<ShortIdKey, string>();
+
+        for (var i = 0; i < 10_000; i++)
+        {
+            var key = new ShortIdKey((ulong)random.Next(64), (ulong)random.Next(64));
+            var value = i.ToString();
+            switch (random.Next(3))
+            {
+                case 0:
+                case 1:
+                    Assert.Equal(!expected.ContainsKey(key), table.TryAdd(key, value));
+                    if (!expected.ContainsKey(key))
+                        expected.Add(key, value);
+                    break;
+                default:
+                    Assert.Equal(expected.Remove(key), table.Remove(key));
+                    break;
+            }
+
+            Assert.Equal(expected.Count, table.Count);
+        }
+
+        foreach (var kvp in expected)
+        {
+            Assert.True(table.TryGetValue(kvp.Key, out var value));
+            Assert.Equal(kvp.Value, value);
+        }
+        for (ulong high = 0; high < 64; high++)
+        {
+            var key = new ShortIdKey(high, 64);
+            Assert.False(table.TryGetValue(key, out _));
+        }
+
+        table.Clear();
+        Assert.Equal(0, table.Count);
+        Assert.All(expected.Keys, k => Assert.False(table.TryGetValue(k, out _)));
+    }
+
+    [Fact]
+    public void Test_Ensure_Capacity()
+    {
+        var table = new ShortIdTable<string>();
+        table.TryAdd(new ShortIdKey(1, 1), "1");
+        table.EnsureCapacity(1_000);
+        table.EnsureCapacity(10);
+        for (ulong i = 2; i <= 1_000; i++)
+            Assert.True(table.TryAdd(new ShortIdKey(i, i), i.ToString()));
+
+        Assert.Equal(1_000, table.Count);
+        Assert.True(table.TryGetValue(new ShortIdKey(1, 1), out var value));
+        Assert.Equal("1", value);
+    }
+
+    [Fact]
+    public void Test_DataChannelList_Uuid_ShortIds()
+    {
+        var text = File.ReadAllText("schemas/json/DataChannelList.sample.compact.json");
+        var list = Serializer.DeserializeDataChannelList(text)!.ToDomainModel().DataChannelList;
+
+        var uuids = 0;
+        foreach (var dataChannel in list)
+        {
+            var shortId = dataChannel.DataChannelId.ShortId!;
+            var id = TsDataChannelId.Parse(shortId);
+            if (id.TryGetShortIdKey(out _))
+                uuids++;
+
+            Assert.Same(dataChannel, list[shortId]);
+            Assert.True(list.TryGetByShortId(id, out var byId));
+            Assert.Same(dataChannel, byId);
+        }
+        Assert.True(uuids > 0);
+
+        // Keys only match the exact string, like the string lookup they replace
+        var first = list[0].DataChannelId.ShortId!;
+        Assert.False(list.TryGetByShortId(first.ToUpperInvariant(), out _));
+        Assert.False(list.TryGetByShortId(TsDataChannelId.Parse(first.ToUpperInvariant()), out _));
+
+        var channel = list[0];
+        Assert.True(list.Remove(channel));
+        Assert.False(list.TryGetByShortId(first, out _));
+
+        list.Add(channel);
+        Assert.Same(channel, list[first]);
+
+        var duplicate = channel with
+        {
+            DataChannelId = channel.DataChannelId with
+            {
+                LocalId = LocalId.Parse("/dnv-v2/vis-3-4a/411.1/C101.31-2/meta/qty-temperature")
+            }
+        };
+        Assert.Throws<ArgumentException>(() => list.Add(duplicate));
+    }
+}
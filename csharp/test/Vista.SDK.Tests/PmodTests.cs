@@ -0,0 +1,221 @@
+using System.Text.Json;
+
+namespace Vista.SDK.Tests;
+
+public class PmodTests
+{
+    private static readonly string[] _paths =
+    [
+        "411.1/C101.31-2",
+        "411.1/C101.31-5",
+        "411.1/C101.72/I101",
+        "411.1/C101.63/S206",
+        "511.11-21O/C101.67/S208",
+        "1021.1i-6P/H123",
+    ];
+
+    private sealed record PmodTestData(string[] FullPaths, string[] LocalIds);
+
+    public static IEnumerable<object[]> PmodData()
+    {
+        var json = File.ReadAllText("testdata/PmodData.json");
+        var data =
+            JsonSerializer.Deserialize<Dictionary<string, PmodTestData>>(
+                json,
+                new JsonSerializerOptions { PropertyNameCaseInsensitive = true }
+            ) ?? throw new Exception("Couldn't deserialize PmodData");
+
+        foreach (var kvp in data)
+            yield return new object[] { kvp.Key, kvp.Value.LocalIds };
+    }
+
+    private static GmodPath[] ParsePaths(VisVersion visVersion) =>
+        _paths.Select(p => GmodPath.Parse(p, visVersion)).ToArray();
+
+    [Fact]
+    public void Test_Create_From_Paths()
+    {
+        var version = VisVersion.v3_4a;
+        var paths = ParsePaths(version);
+
+        var pmod = Pmod.CreateFromPaths(version, paths);
+
+        Assert.Equal("VE", pmod.RootNode.Code);
+        Assert.True(pmod.RootNode.IsRoot);
+        Assert.Equal(paths.Max(p => p.Length - 1), pmod.MaxDepth);
+
+        foreach (var path in paths)
+        {
+            Assert.True(pmod.TryGetNode(path, out var node));
+            Assert.Equal(path.Node, node.Node);
+            Assert.Equal(path.Length - 1, node.Depth);
+            Assert.Equal(path.ToFullPathString(), node.Path.ToFullPathString());
+        }
+
+        // Every node in the pmod is reached exactly once through enumeration
+        Assert.Equal(pmod.NodeCount, pmod.Count());
+        Assert.Equal(pmod.NodeCount, pmod.Select(n => n.Path.ToFullPathString()).Distinct().Count());
+    }
+
+    [Fact]
+    public void Test_Add_Duplicate()
+    {
+        var version = VisVersion.v3_4a;
+        var path = GmodPath.Parse("411.1/C101.72/I101", version);
+
+        var pmod = Pmod.Create(version);
+        Assert.Equal(1, pmod.NodeCount);
+
+        Assert.True(pmod.Add(path));
+        var count = pmod.NodeCount;
+        Assert.Equal(path.Length, count);
+
+        Assert.False(pmod.Add(GmodPath.Parse("411.1/C101.72/I101", version)));
+        Assert.Equal(count, pmod.NodeCount);
+
+        Assert.False(pmod.Contains(GmodPath.Parse("411.1/C101.31-2", version)));
+        Assert.True(pmod.Add(GmodPath.Parse("411.1/C101.31-2", version)));
+        Assert.True(pmod.NodeCount > count);
+    }
+
+    [Fact]
+    public void Test_Add_Wrong_Version()
+    {
+        var pmod = Pmod.Create(VisVersion.v3_4a);
+        var path = GmodPath.Parse("411.1/C101.72/I101", VisVersion.v3_5a);
+
+        Assert.Throws<ArgumentException>(() => pmod.Add(path));
+    }
+
+    [Fact]
+    public void Test_Individualized_Nodes_Are_Separate()
+    {
+        var version = VisVersion.v3_4a;
+        var pmod = Pmod.CreateFromPaths(version, ParsePaths(version));
+
+        var nodes = pmod.GetNodesByCode("C101.31");
+        Assert.Equal(2, nodes.Count);
+        Assert.NotEqual(nodes[0], nodes[1]);
+        Assert.Equal("2", nodes[0].Location?.ToString());
+        Assert.Equal("5", nodes[1].Location?.ToString());
+
+        Assert.Empty(pmod.GetNodesByCode("C102"));
+    }
+
+    [Fact]
+    public void Test_Traverse()
+    {
+        var version = VisVersion.v3_4a;
+        var pmod = Pmod.CreateFromPaths(version, ParsePaths(version));
+
+        var visited = 0;
+        var completed = pmod.Traverse(
+            node =>
+            {
+                visited++;
+                return TraversalHandlerResult.Continue;
+            }
+        );
+        Assert.True(completed);
+        Assert.Equal(pmod.NodeCount, visited);
+
+        var codes = new List<string>();
+        completed = pmod.Traverse(
+            codes,
+            (codes, node) =>
+            {
+                codes.Add(node.Code);
+                return node.Code == "411.1" ? TraversalHandlerResult.SkipSubtree : TraversalHandlerResult.Continue;
+            }
+        );
+        Assert.True(completed);
+        Assert.Contains("411.1", codes);
+        Assert.DoesNotContain("C101.72", codes);
+        Assert.Contains("S208", codes);
+
+        visited = 0;
+        completed = pmod.Traverse(
+            node =>
+            {
+                visited++;
+                return node.Code == "C101.72" ? TraversalHandlerResult.Stop : TraversalHandlerResult.Continue;
+            }
+        );
+        Assert.False(completed);
+        Assert.True(visited < pmod.NodeCount);
+    }
+
+    [Fact]
+    public void Test_Children_And_Parent()
+    {
+        var version = VisVersion.v3_4a;
+        var pmod = Pmod.CreateFromPaths(version, ParsePaths(version));
+
+        Assert.Null(pmod.RootNode.Parent);
+
+        foreach (var node in pmod)
+        {
+            foreach (var child in node.Children)
+            {
+                Assert.Equal(node, child.Parent);
+                Assert.Equal(node.Depth + 1, child.Depth);
+            }
+        }
+    }
+
+    [Theory]
+    [MemberData(nameof(PmodData))]
+    public void Test_Create_From_LocalIds(string visVersionStr, string[] localIdStrs)
+    {
+        var version = VisVersions.Parse(visVersionStr);
+        var localIds = localIdStrs.Select(s => (ILocalId)LocalIdBuilder.Parse(s).Build()).ToArray();
+
+        var sequential = Pmod.CreateFromLocalIds(version, localIds);
+        var parallel = Pmod.CreateFromLocalIds(version, localIds, parallel: true);
+
+        var maxDepth = localIds
+            .SelectMany(l => new[] { l.PrimaryItem, l.SecondaryItem })
+            .Max(p => p is null ? 0 : p.Length - 1);
+        Assert.Equal(maxDepth, sequential.MaxDepth);
+
+        foreach (var localId in localIds)
+        {
+            Assert.True(sequential.Contains(localId.PrimaryItem!));
+            if (localId.SecondaryItem is not null)
+                Assert.True(sequential.Contains(localId.SecondaryItem));
+        }
+
+        // Parallel build produces the exact same tree layout as the sequential one
+        Assert.Equal(sequential.NodeCount, parallel.NodeCount);
+        Assert.Equal(sequential.MaxDepth, parallel.MaxDepth);
+        Assert.Equal(
+            sequential.Select(n => n.Path.ToFullPathString()),
+            parallel.Select(n => n.Path.ToFullPathString())
+        );
+    }
+
+    [Fact]
+    public void Test_Parallel_Build_Large()
+    {
+        var version = VisVersion.v3_4a;
+        var gmod = VIS.Instance.GetGmod(version);
+
+        var paths = new List<GmodPath>();
+        gmod.Traverse(
+            paths,
+            (paths, parents, node) =>
+            {
+                if (node.IsLeafNode)
+                    paths.Add(new GmodPath(parents.ToList(), node, skipVerify: true));
+                return paths.Count < 20_000 ? TraversalHandlerResult.Continue : TraversalHandlerResult.Stop;
+            }
+        );
+
+        var sequential = Pmod.CreateFromPaths(version, paths);
+        var parallel = Pmod.CreateFromPaths(version, paths, parallel: true);
+
+        Assert.Equal(sequential.NodeCount, parallel.NodeCount);
+        Assert.Equal(sequential.Select(n => n.Path.ToString()), parallel.Select(n => n.Path.ToString()));
+        Assert.All(paths, p => Assert.True(parallel.Contains(p)));
+    }
+}
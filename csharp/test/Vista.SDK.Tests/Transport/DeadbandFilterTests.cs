@@ -0,0 +1,180 @@
+using Vista.SDK.Transport;
+using Vista.SDK.Transport.Json;
+using Vista.SDK.Transport.TimeSeries;
+using DataChannel = Vista.SDK.Transport.DataChannel;
+using JsonDataChannel = Vista.SDK.Transport.Json.DataChannel;
+
+namespace Vista.SDK.Tests.Transport;
+
+public class DeadbandFilterTests
+{
+    private static readonly DateTimeOffset Start = new(2024, 1, 1, 0, 0, 0, System.TimeSpan.Zero);
+
+    private static DataChannel.DataChannelListPackage LoadDataChannelList()
+    {
+        var text = File.ReadAllText("schemas/json/DataChannelList.sample.compact.json");
+        return JsonDataChannel.Extensions.ToDomainModel(Serializer.DeserializeDataChannelList(text)!);
+    }
+
+    private static TimeSeriesDataPackage CreatePackage(
+        DataChannel.DataChannelListPackage dcPackage,
+        string[][] rows,
+        List<EventDataSet>? events = null
+    )
+    {
+        var list = dcPackage.Package.DataChannelList;
+        var ids = new List<DataChannelId>
+        {
+            DataChannelId.Parse(list[0].DataChannelId.ShortId!),
+            DataChannelId.Parse(list[1].DataChannelId.ShortId!),
+        };
+
+        return new TimeSeriesDataPackage
+        {
+            Package = new Package
+            {
+                Header = new Header
+                {
+                    ShipId = ShipId.Parse("IMO1234567"),
+                    TimeSpan = new SDK.Transport.TimeSeries.TimeSpan
+                    {
+                        Start = Start,
+                        End = Start.AddSeconds(rows.Length),
+                    },
+                    Author = "Deadband",
+                },
+                TimeSeriesData =
+                [
+                    new TimeSeriesData
+                    {
+                        DataConfiguration = ConfigurationReference.From(dcPackage),
+                        TabularData =
+                        [
+                            new TabularData
+                            {
+                                DataChannelIds = ids,
+                                DataSets = rows.Select(
+                                        (values, i) =>
+                                            new TabularDataSet
+                                            {
+                                                TimeStamp = Start.AddSeconds(i),
+                                                Value = values.ToList(),
+                                                Quality = null,
+                                            }
+                                    )
+                                    .ToList(),
+                            },
+                        ],
+                        EventData = events is null ? null : new EventData { DataSet = events },
+                    },
+                ],
+            },
+        };
+    }
+
+    [Fact]
+    public void Test_Rows()
+    {
+        var dcPackage = LoadDataChannelList();
+        // The sample channels have a 0 - 100 Range, so the default deadband is 1
+        var filter = new DeadbandFilter(dcPackage.Package.DataChannelList);
+
+        var package = CreatePackage(
+            dcPackage,
+            [
+                ["10.0", "50.0"],
+                ["10.5", "50.5"],
+                ["10.9", "50.2"],
+                ["11.1", "50.0"],
+                ["11.5", "50.0"],
+                ["11.5", "48.0"],
+            ]
+        );
+        var filtered = filter.Filter(package);
+
+        Assert.Same(package.Package.Header, filtered.Package.Header);
+        var data = Assert.Single(filtered.Package.TimeSeriesData);
+        Assert.Equal(package.Package.TimeSeriesData[0].DataConfiguration, data.DataConfiguration);
+        var table = Assert.Single(data.TabularData!);
+        Assert.Equal(new[] { "10.0", "11.1", "11.5" }, table.DataSets!.Select(s => s.Value[0]).ToArray());
+        Assert.Equal(12, filter.ReceivedValues);
+        Assert.Equal(6, filter.SentValues);
+
+        // Last sent state is kept between packages
+        filtered = filter.Filter(CreatePackage(dcPackage, [["11.6", "48.5"]]));
+        Assert.Empty(filtered.Package.TimeSeriesData);
+
+        filter.Reset();
+        filtered = filter.Filter(CreatePackage(dcPackage, [["11.6", "48.5"]]));
+        Assert.Single(filtered.Package.TimeSeriesData);
+    }
+
+    [Fact]
+    public void Test_Events()
+    {
+        var dcPackage = LoadDataChannelList();
+        var filter = new DeadbandFilter(
+            dcPackage.Package.DataChannelList,
+            _ => Deadband.Absolute(5),
+            DeadbandTabularMode.Events
+        );
+
+        var filtered = filter.Filter(
+            CreatePackage(
+                dcPackage,
+                [
+                    ["10", "50"],
+                    ["14", "56"],
+                    ["16", "56"],
+                    ["16", "60"],
+                ]
+            )
+        );
+
+        var data = Assert.Single(filtered.Package.TimeSeriesData);
+        Assert.Null(data.TabularData);
+        var events = data.EventData!.DataSet!;
+        Assert.Equal(
+            new[] { (0, "10"), (0, "50"), (1, "56"), (2, "16") },
+            events.Select(e => ((int)(e.TimeStamp - Start).TotalSeconds, e.Value)).ToArray()
+        );
+        Assert.Equal(8, filter.ReceivedValues);
+        Assert.Equal(4, filter.SentValues);
+    }
+
+    [Fact]
+    public void Test_Quality_And_Unknown_Channels()
+    {
+        var dcPackage = LoadDataChannelList();
+        var filter = new DeadbandFilter(dcPackage.Package.DataChannelList, _ => Deadband.Percent(10));
+
+        var unknown = DataChannelId.Parse("not-in-the-list");
+        var events = new List<EventDataSet>
+        {
+            new() { TimeStamp = Start, DataChannelId = unknown, Value = "1.0", Quality = null },
+            new() { TimeStamp = Start.AddSeconds(1), DataChannelId = unknown, Value = "1.0", Quality = null },
+            new() { TimeStamp = Start.AddSeconds(2), DataChannelId = unknown, Value = "1.00", Quality = null },
+            new() { TimeStamp = Start.AddSeconds(3), DataChannelId = unknown, Value = "1.00", Quality = "V" },
+        };
+        var package = CreatePackage(dcPackage, [["10", "50"], ["11", "51"]], events);
+        package.Package.TimeSeriesData[0].TabularData![0].DataSets![1].Quality = ["0", "0"];
+
+        var filtered = filter.Filter(package);
+
+        var data = Assert.Single(filtered.Package.TimeSeriesData);
+        Assert.Equal(2, data.TabularData![0].DataSets!.Count);
+        Assert.Equal(new[] { 0, 2, 3 }, data.EventData!.DataSet!.Select(e => events.IndexOf(e)).ToArray());
+    }
+
+    [Fact]
+    public void Test_Deadband()
+    {
+        var range = new DataChannel.Range { Low = -20, High = 180 };
+        Assert.Equal(2, Deadband.Absolute(2).Resolve(range));
+        Assert.Equal(1, Deadband.Percent(0.5).Resolve(range));
+        Assert.Equal(0, Deadband.Percent(0.5).Resolve(null));
+        Assert.Equal(0, Deadband.None.Resolve(range));
+        Assert.Throws<ArgumentException>(() => Deadband.Absolute(-1));
+        Assert.Throws<ArgumentException>(() => Deadband.Percent(double.NaN));
+    }
+}
@@ -0,0 +1,123 @@
+using System.IO.Compression;
+using System.Text;
+using Vista.SDK.Transport.Compression;
+
+namespace Vista.SDK.Tests.Transport;
+
+public class DictionaryCompressionTests
+{
+    public static IEnumerable<object[]> VisVersionsData => VisVersions.All.Select(v => new object[] { v });
+
+    [Theory]
+    [MemberData(nameof(VisVersionsData))]
+    public void Test_Shipped_Dictionary_Matches_Training(VisVersion visVersion)
+    {
+        var vis = VIS.Instance;
+        var dictionary = CompressionDictionary.Get(visVersion);
+
+        var trained = CompressionDictionary.Train(vis.GetGmod(visVersion), vis.GetCodebooks(visVersion));
+        Assert.Equal(trained, dictionary.Data);
+        Assert.Equal(visVersion, dictionary.VisVersion);
+        Assert.True(dictionary.Length <= CompressionDictionary.MaxLength);
+    }
+
+    [Theory]
+    [InlineData("schemas/json/DataChannelList.sample.compact.json")]
+    [InlineData("schemas/json/TimeSeriesData.sample.json")]
+    public void Test_Roundtrip(string file)
+    {
+        var json = File.ReadAllBytes(file);
+
+        var gzip = new MemoryStream();
+        using (var stream = new GZipStream(gzip, CompressionLevel.Optimal, leaveOpen: true))
+            stream.Write(json, 0, json.Length);
+
+        foreach (var visVersion in VisVersions.All)
+        {
+            var payload = DictionaryCompression.Compress(json, visVersion);
+            Assert.True(payload.Length < gzip.Length, $"{payload.Length} bytes, gzip {gzip.Length} bytes");
+            Assert.Equal(json, DictionaryCompression.Decompress(payload));
+        }
+    }
+
+    [Fact]
+    public void Test_Streaming()
+    {
+        var json = File.ReadAllBytes("schemas/json/DataChannelList.sample.compact.json");
+
+        var payload = new MemoryStream();
+        using (var stream = DictionaryCompression.CreateCompressionStream(payload, VisVersion.v3_4a, leaveOpen: true))
+        {
+            for (var i = 0; i < json.Length; i += 100)
+                stream.Write(json, i, Math.Min(100, json.Length - i));
+        }
+        Assert.Equal(DictionaryCompression.Compress(json, VisVersion.v3_4a), payload.ToArray());
+
+        // zlib header with a preset dictionary, DICTID of the dictionary
+        var bytes = payload.ToArray();
+        var id = CompressionDictionary.Get(VisVersion.v3_4a).Id;
+        Assert.Equal(0x78, bytes[0]);
+        Assert.Equal(0, (bytes[0] << 8 | bytes[1]) % 31);
+        Assert.Equal(id, (uint)(bytes[2] << 24 | bytes[3] << 16 | bytes[4] << 8 | bytes[5]));
+
+        payload.Position = 0;
+        var output = new MemoryStream();
+        using (var stream = DictionaryCompression.CreateDecompressionStream(payload))
+        {
+            var buffer = new byte[7];
+            int read;
+            while ((read = stream.Read(buffer, 0, buffer.Length)) > 0)
+                output.Write(buffer, 0, read);
+        }
+        Assert.Equal(json, output.ToArray());
+    }
+
+    [Fact]
+    public void Test_Reads_Zlib_Payload()
+    {
+        // Compressed by zlib 1.x from Python: zlib.compressobj(9, zdict=dictionary)
+        var json = File.ReadAllBytes("schemas/json/TimeSeriesData.sample.json");
+        var payload = File.ReadAllBytes("testdata/DictionaryCompression.zlib.bin");
+
+        Assert.Equal(json, DictionaryCompression.Decompress(payload));
+    }
+
+    [Fact]
+    public void Test_Writes_Zlib_Payload()
+    {
+        // Written by Compress, python/tests/transport/test_dictionary_compression.py inflates it with zlib.
+        // The deflate blocks depend on the runtime's zlib, the header and trailer don't.
+        var json = File.ReadAllBytes("schemas/json/TimeSeriesData.sample.json");
+        var fixture = File.ReadAllBytes("testdata/DictionaryCompression.sdk.bin");
+        var payload = DictionaryCompression.Compress(json, VisVersion.v3_4a);
+
+        Assert.Equal(fixture.AsSpan(0, 6).ToArray(), payload.AsSpan(0, 6).ToArray());
+        Assert.Equal(fixture.AsSpan(fixture.Length - 4).ToArray(), payload.AsSpan(payload.Length - 4).ToArray());
+        Assert.Equal(json, DictionaryCompression.Decompress(fixture));
+    }
+
+    [Fact]
+    public void Test_Invalid_Payloads()
+    {
+        var json = Encoding.UTF8.GetBytes("{\"Package\":{}}");
+        var payload = DictionaryCompression.Compress(json, VisVersion.v3_4a);
+
+        var trailer = payload.ToArray();
+        trailer[trailer.Length - 1] ^= 1;
+        Assert.Throws<InvalidDataException>(() => DictionaryCompression.Decompress(trailer));
+
+        var unknown = payload.ToArray();
+        unknown[5] ^= 1;
+        Assert.Throws<InvalidDataException>(() => DictionaryCompression.Decompress(unknown));
+
+        var gzip = new MemoryStream();
+        using (var stream = new GZipStream(gzip, CompressionLevel.Optimal))
+            stream.Write(json, 0, json.Length);
+        Assert.Throws<InvalidDataException>(() => DictionaryCompression.Decompress(gzip.ToArray()));
+
+        Assert.Throws<InvalidDataException>(() => DictionaryCompression.Decompress(payload.AsSpan(0, 4).ToArray()));
+        Assert.Throws<InvalidDataException>(
+            () => DictionaryCompression.Decompress(payload.AsSpan(0, payload.Length - 2).ToArray())
+        );
+    }
+}
@@ -170,4 +170,70 @@ public void Test_FormatDataType_Parse_Valid(string type, string value, bool expe
             });
         }
     }
+
+    [Theory]
+    [MemberData(nameof(Test_Iso_Versions))]
+    public void Test_Vocabularies_Interned(ISO19848Version version)
+    {
+        var iso = ISO19848.Instance;
+        Assert.Same(iso.GetDataChannelTypeNames(version), iso.GetDataChannelTypeNames(version));
+        Assert.Same(iso.GetFormatDataTypes(version), iso.GetFormatDataTypes(version));
+
+        var typeNames = iso.GetDataChannelTypeNames(version);
+        foreach (var typeName in typeNames)
+        {
+            Assert.Equal(typeName.Type, typeName.Kind.ToString());
+            var ok = Assert.IsType<DataChannelTypeNames.ParseResult.Ok>(typeNames.Parse(typeName.Type.AsSpan()));
+            Assert.Same(typeName, ok.TypeName);
+            Assert.Same(ok, typeNames.Parse(typeName.Type));
+        }
+
+        var formatTypes = iso.GetFormatDataTypes(version);
+        foreach (var formatType in formatTypes)
+        {
+            Assert.Equal(formatType.Type, formatType.Kind.ToString());
+            var ok = Assert.IsType<FormatDataTypes.ParseResult.Ok>(formatTypes.Parse(formatType.Type.AsSpan()));
+            Assert.Same(formatType, ok.TypeName);
+        }
+    }
+
+    [Fact]
+    public void Test_Kind_Follows_Type()
+    {
+        var typeName = new DataChannelTypeName("Inst", "Instantaneous value");
+        Assert.Equal(DataChannelTypeKind.Alert, (typeName with { Type = "Alert" }).Kind);
+        Assert.Equal(typeName, typeName with { Type = "Alert" } with { Type = "Inst" });
+        var unknownTypeName = new DataChannelTypeName("Unknown", "Not an ISO 19848 type");
+        Assert.Throws<InvalidOperationException>(() => unknownTypeName.Kind);
+        Assert.Equal(DataChannelTypeKind.Max, (unknownTypeName with { Type = "Max" }).Kind);
+
+        var formatType = new FormatDataType("String", "Text");
+        Assert.Equal(FormatDataTypeKind.Integer, (formatType with { Type = "Integer" }).Kind);
+        Assert.IsType<ValidateResult.Invalid>((formatType with { Type = "Integer" }).Validate("text", out _));
+        var unknownFormatType = new FormatDataType("Unknown", "Not an ISO 19848 type");
+        Assert.Throws<InvalidOperationException>(() => unknownFormatType.Kind);
+
+        // Types of no version are skipped
+        var typeNames = new DataChannelTypeNames([typeName, unknownTypeName]);
+        Assert.IsType<DataChannelTypeNames.ParseResult.Invalid>(typeNames.Parse("Unknown"));
+        Assert.IsType<DataChannelTypeNames.ParseResult.Ok>(typeNames.Parse("Inst"));
+    }
+
+    [Fact]
+    public void Test_DataChannelTypeNames_Parse_Other_Version()
+    {
+        var iso = ISO19848.Instance;
+        Assert.IsType<DataChannelTypeNames.ParseResult.Ok>(
+            iso.GetDataChannelTypeNames(ISO19848Version.v2018).Parse("ManuallyInput")
+        );
+        Assert.IsType<DataChannelTypeNames.ParseResult.Invalid>(
+            iso.GetDataChannelTypeNames(ISO19848Version.v2024).Parse("ManuallyInput")
+        );
+        Assert.IsType<DataChannelTypeNames.ParseResult.Invalid>(
+            iso.GetDataChannelTypeNames(ISO19848Version.v2018).Parse("Median")
+        );
+        Assert.IsType<DataChannelTypeNames.ParseResult.Invalid>(
+            iso.GetDataChannelTypeNames(ISO19848Version.v2024).Parse("Inst".AsSpan(0, 3))
+        );
+    }
 }
@@ -0,0 +1,174 @@
+using System.Text;
+using System.Text.Json;
+using System.Text.Json.Nodes;
+using Vista.SDK.Transport.Json;
+using Vista.SDK.Transport.Json.DataChannel;
+
+namespace Vista.SDK.Tests.Transport.Json;
+
+public class DataChannelListCacheTests
+{
+    private static byte[] LoadJson() => File.ReadAllBytes("schemas/json/DataChannelList.sample.json");
+
+    private static byte[] WithVersion(byte[] json, string version)
+    {
+        var node = JsonNode.Parse(json)!;
+        node["Package"]!["Header"]!["DataChannelListID"]!["Version"] = version;
+        return Encoding.UTF8.GetBytes(node.ToJsonString());
+    }
+
+    [Fact]
+    public void Test_Cache_Hit()
+    {
+        using var cache = new DataChannelListCache();
+        var json = LoadJson();
+
+        var first = cache.GetOrDeserialize(json)!;
+        var second = cache.GetOrDeserialize(json.ToArray())!;
+
+        Assert.Same(first.DataChannelList, second.DataChannelList);
+        Assert.True(first.DataChannelList.IsReadOnly);
+        // Every caller gets its own header
+        Assert.NotSame(first.Package.Header, second.Package.Header);
+        Assert.Equal(first.Package.Header, second.Package.Header);
+
+        var statistics = cache.Statistics;
+        Assert.Equal(1, statistics.Hits);
+        Assert.Equal(1, statistics.Misses);
+        Assert.Equal(1, statistics.Count);
+        Assert.Equal(json.Length, statistics.Size);
+        Assert.Equal(0.5, statistics.HitRate);
+    }
+
+    [Fact]
+    public void Test_Cache_Miss_On_Different_Content()
+    {
+        using var cache = new DataChannelListCache();
+        var json = LoadJson();
+
+        var first = cache.GetOrDeserialize(json)!;
+        var other = cache.GetOrDeserialize(WithVersion(json, "2.0"))!;
+        var reformatted = cache.GetOrDeserialize(Encoding.UTF8.GetBytes(JsonNode.Parse(json)!.ToJsonString()))!;
+
+        Assert.NotSame(first.DataChannelList, other.DataChannelList);
+        Assert.NotSame(first.DataChannelList, reformatted.DataChannelList);
+        Assert.Equal("2.0", other.Package.Header.DataChannelListId.Version);
+        Assert.Equal(3, cache.Statistics.Misses);
+        Assert.Equal(3, cache.Statistics.Count);
+        Assert.Equal(0, cache.Statistics.Hits);
+    }
+
+    [Fact]
+    public void Test_Cached_List_Is_Read_Only()
+    {
+        using var cache = new DataChannelListCache();
+        var json = LoadJson();
+        var expected = cache.GetOrDeserialize(json)!.Serialize();
+        var list = cache.GetOrDeserialize(json)!.DataChannelList;
+        var channel = list[7];
+
+        Assert.Throws<NotSupportedException>(() => list.Remove(channel));
+        Assert.Throws<NotSupportedException>(() => list.Add(channel));
+        Assert.Throws<NotSupportedException>(() => list.Clear());
+        Assert.Same(channel, list[7]);
+
+        var property = channel.Property;
+        Assert.Throws<NotSupportedException>(() => channel.Property = property);
+        Assert.Throws<NotSupportedException>(() => channel.DataChannelId.ShortId = "modified");
+        Assert.Throws<NotSupportedException>(() => property.DataChannelType.Type = "Alert");
+        Assert.Throws<NotSupportedException>(() => property.DataChannelType.UpdateCycle = 42);
+        Assert.Throws<NotSupportedException>(() => property.Format.Type = "String");
+        Assert.Throws<NotSupportedException>(() => property.Range!.High = 1000);
+        Assert.Throws<NotSupportedException>(() => property.Unit!.UnitSymbol = "modified");
+        Assert.Throws<NotSupportedException>(() => property.AlertPriority = "Warning");
+        Assert.Throws<NotSupportedException>(() => property.CustomProperties = new());
+
+        // Copies can be modified, and are still equal to the channel until they are
+        var copy = channel with { Property = property with { Name = "modified" } };
+        copy.DataChannelId = copy.DataChannelId with { ShortId = "modified" };
+        Assert.Equal(channel, channel with { });
+        Assert.NotEqual(channel, copy);
+        Assert.Throws<NotSupportedException>(() => copy.Property.Range!.High = 1000);
+
+        Assert.Equal(expected, cache.GetOrDeserialize(json)!.Serialize());
+    }
+
+    [Fact]
+    public void Test_Read_Only_Custom_Dictionaries()
+    {
+        var list = Serializer.DeserializeDataChannelList(Encoding.UTF8.GetString(LoadJson()))!
+            .ToDomainModel()
+            .DataChannelList;
+        var property = list[0].Property;
+        property.CustomProperties = new() { ["Custom"] = "value" };
+        var enumeration = new List<string> { "a", "b" };
+        property.Format.Restriction = new SDK.Transport.DataChannel.Restriction { Enumeration = enumeration };
+        list.MakeReadOnly();
+
+        property.CustomProperties!["Custom"] = "modified";
+        Assert.Equal("value", property.CustomProperties["Custom"]);
+        Assert.False(property.Format.Restriction!.Enumeration is List<string>);
+        enumeration.Add("c");
+        Assert.Equal(["a", "b"], property.Format.Restriction.Enumeration!);
+    }
+
+    [Fact]
+    public void Test_Cache_Invalid_And_Null_Packages()
+    {
+        using var cache = new DataChannelListCache();
+        Assert.Null(cache.GetOrDeserialize("null"u8));
+        Assert.ThrowsAny<JsonException>(() => cache.GetOrDeserialize("""{"Package":"""u8));
+
+        var node = JsonNode.Parse(LoadJson())!;
+        // Decimal channels require a Range
+        node["Package"]!["DataChannelList"]!["DataChannel"]![7]!["Property"]!.AsObject().Remove("Range");
+        var invalid = Encoding.UTF8.GetBytes(node.ToJsonString());
+        Assert.Throws<ArgumentException>(() => cache.GetOrDeserialize(invalid));
+        Assert.Throws<ArgumentException>(() => cache.GetOrDeserialize(invalid));
+
+        Assert.Equal(0, cache.Statistics.Count);
+        Assert.Equal(0, cache.Statistics.Hits);
+    }
+
+    [Fact]
+    public void Test_Cache_Size_Limit()
+    {
+        var packages = Enumerable.Range(0, 10).Select(i => WithVersion(LoadJson(), $"{i}.0")).ToList();
+        using var cache = new DataChannelListCache(sizeLimit: packages[0].Length * 2 + 100);
+
+        foreach (var package in packages)
+            cache.GetOrDeserialize(package);
+
+        // Evictions are reported in the background
+        var statistics = cache.Statistics;
+        for (var i = 0; i < 100 && statistics.Evictions == 0; i++)
+        {
+            Thread.Sleep(10);
+            statistics = cache.Statistics;
+        }
+        Assert.True(statistics.Count <= 2);
+        Assert.True(statistics.Evictions > 0);
+        Assert.Equal(10, statistics.Misses);
+
+        Assert.Throws<ArgumentOutOfRangeException>(() => new DataChannelListCache(0));
+    }
+
+    [Fact]
+    public void Test_Cache_Package_Larger_Than_Limit()
+    {
+        var json = LoadJson();
+        using var cache = new DataChannelListCache(sizeLimit: json.Length - 1);
+
+        Assert.NotNull(cache.GetOrDeserialize(json));
+        Assert.NotNull(cache.GetOrDeserialize(json));
+
+        // Never cached, so never evicted
+        Thread.Sleep(50);
+        var statistics = cache.Statistics;
+        Assert.Equal(0, statistics.Hits);
+        Assert.Equal(2, statistics.Misses);
+        Assert.Equal(0, statistics.Evictions);
+        Assert.Equal(0, statistics.Count);
+        Assert.Equal(0, statistics.Size);
+    }
+}
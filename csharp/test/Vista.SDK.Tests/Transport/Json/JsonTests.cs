@@ -188,6 +188,49 @@ public async Task Test_DataChannelList_Domain_Model_Roundtrip(string file)
         dto.Should().BeEquivalentTo(package, DataChannelListEquivalency);
     }
 
+    [Theory]
+    [InlineData("Transport/Json/_files/DataChannelList.json")]
+    [InlineData("schemas/json/DataChannelList.sample.json")]
+    [InlineData("schemas/json/DataChannelList.sample.compact.json")]
+    public async Task Test_DataChannelList_Parallel_Domain_Model(string file)
+    {
+        await using var reader = new FileStream(file, FileMode.Open, FileAccess.Read, FileShare.Read);
+
+        var package = await Serializer.DeserializeDataChannelListAsync(reader);
+        Assert.NotNull(package);
+
+        var sequential = package.ToDomainModel();
+        var parallel = package.ToDomainModel(parallel: true);
+
+        Assert.Equal(sequential.DataChannelList.Count, parallel.DataChannelList.Count);
+        for (int i = 0; i < sequential.DataChannelList.Count; i++)
+        {
+            var channel = parallel.DataChannelList[i];
+            Assert.Equal(sequential.DataChannelList[i].DataChannelId.LocalId, channel.DataChannelId.LocalId);
+            Assert.Same(channel, parallel.DataChannelList[channel.DataChannelId.LocalId]);
+        }
+        Assert.Equal(sequential.Serialize(), parallel.Serialize());
+    }
+
+    [Fact]
+    public void Test_DataChannelList_Parallel_Domain_Model_Error()
+    {
+        // Every channel after the first few is invalid, the parallel conversion throws for the first of them
+        var node = System.Text.Json.Nodes.JsonNode.Parse(File.ReadAllText("schemas/json/DataChannelList.sample.json"))!;
+        var channels = node["Package"]!["DataChannelList"]!["DataChannel"]!.AsArray();
+        for (var i = 3; i < channels.Count; i++)
+            channels[i]!["DataChannelID"]!["LocalID"] = $"/invalid/{i}";
+        var package = Serializer.DeserializeDataChannelList(node.ToJsonString())!;
+
+        var expected = Assert.ThrowsAny<Exception>(() => package.ToDomainModel());
+        for (var run = 0; run < 20; run++)
+        {
+            var actual = Assert.ThrowsAny<Exception>(() => package.ToDomainModel(parallel: true));
+            Assert.Equal(expected.GetType(), actual.GetType());
+            Assert.Equal(expected.Message, actual.Message);
+        }
+    }
+
     [Theory]
     [InlineData("Transport/Json/_files/DataChannelList.json")]
     [InlineData("schemas/json/DataChannelList.sample.json")]
@@ -0,0 +1,153 @@
+using System.Text;
+using System.Text.Json.Nodes;
+using Vista.SDK.Transport.Json;
+using Vista.SDK.Transport.Json.DataChannel;
+
+namespace Vista.SDK.Tests.Transport.Json;
+
+public class LazyDataChannelListTests
+{
+    private static string LoadJson() => File.ReadAllText("schemas/json/DataChannelList.sample.json");
+
+    [Fact]
+    public void Test_Lazy_Lookups()
+    {
+        var json = LoadJson();
+        var eager = Serializer.DeserializeDataChannelList(json)!.ToDomainModel().DataChannelList;
+        var lazy = Serializer.DeserializeDataChannelListLazy(json)!.DataChannelList;
+
+        Assert.Equal(eager.Count, lazy.Count);
+        Assert.Equal(0, lazy.ParsedCount);
+
+        var expected = eager[5];
+        Assert.True(lazy.TryGetByShortId(expected.DataChannelId.ShortId!, out var byShortId));
+        Assert.Equal(expected, byShortId);
+        Assert.Equal(1, lazy.ParsedCount);
+
+        // Parsed once, the same channel for every lookup
+        Assert.Same(byShortId, lazy[expected.DataChannelId.LocalId]);
+        Assert.Same(byShortId, lazy[5]);
+        Assert.True(lazy.Contains(expected));
+        Assert.Equal(1, lazy.ParsedCount);
+
+        Assert.False(lazy.TryGetByShortId("unknown", out _));
+        Assert.Throws<KeyNotFoundException>(() => lazy["unknown"]);
+        Assert.Equal(1, lazy.ParsedCount);
+
+        Assert.Equal(eager, lazy);
+        Assert.Equal(lazy.Count, lazy.ParsedCount);
+    }
+
+    [Fact]
+    public void Test_Lazy_Verbose_LocalId_Lookup()
+    {
+        var json = LoadJson();
+        var lazy = Serializer.DeserializeDataChannelListLazy(json)!.DataChannelList;
+        var eager = Serializer.DeserializeDataChannelList(json)!.ToDomainModel().DataChannelList;
+        var localId = eager[3].DataChannelId.LocalId;
+
+        var verbose = localId.Builder.WithVerboseMode(true).Build();
+        Assert.True(lazy.TryGetByLocalId(verbose, out var dataChannel));
+        Assert.Equal(localId, dataChannel!.DataChannelId.LocalId);
+        Assert.Equal(1, lazy.ParsedCount);
+    }
+
+    [Fact]
+    public void Test_Lazy_Unknown_LocalId_Lookup()
+    {
+        var lazy = Serializer.DeserializeDataChannelListLazy(LoadJson())!.DataChannelList;
+
+        var unknown = LocalId.Parse("/dnv-v2/vis-3-4a/1014.21/meta/detail-unknown");
+        Assert.False(lazy.TryGetByLocalId(unknown, out _));
+        Assert.False(lazy.TryGetByLocalId(unknown.Builder.WithVerboseMode(true).Build(), out _));
+        Assert.Equal(0, lazy.ParsedCount);
+    }
+
+    [Fact]
+    public void Test_Lazy_Non_Canonical_LocalId_Lookup()
+    {
+        var node = JsonNode.Parse(LoadJson())!;
+        var channels = node["Package"]!["DataChannelList"]!["DataChannel"]!.AsArray();
+        var dataChannelId = channels[3]!["DataChannelID"]!;
+        var localId = LocalId.Parse(dataChannelId["LocalID"]!.GetValue<string>());
+        dataChannelId["LocalID"] = localId.Builder.WithVerboseMode(true).ToString();
+        var lazy = Serializer.DeserializeDataChannelListLazy(node.ToJsonString())!.DataChannelList;
+
+        // Only found among the parsed channels
+        Assert.True(lazy.TryGetByLocalId(localId, out var dataChannel));
+        Assert.Equal(localId, dataChannel!.DataChannelId.LocalId);
+        Assert.Equal(lazy.Count, lazy.ParsedCount);
+    }
+
+    [Theory]
+    [InlineData(false)]
+    [InlineData(true)]
+    public void Test_Lazy_ValidateAll(bool parallel)
+    {
+        var node = JsonNode.Parse(LoadJson())!;
+        var channels = node["Package"]!["DataChannelList"]!["DataChannel"]!.AsArray();
+        // Decimal channels require a Range
+        channels[7]!["Property"]!.AsObject().Remove("Range");
+        channels[9]!["Property"]!.AsObject().Remove("Unit");
+        var json = node.ToJsonString();
+
+        Assert.Throws<ArgumentException>(() => Serializer.DeserializeDataChannelList(json)!.ToDomainModel());
+
+        var lazy = Serializer
+            .DeserializeDataChannelListLazy(new MemoryStream(Encoding.UTF8.GetBytes(json)))!
+            .DataChannelList;
+        Assert.NotNull(lazy[6]);
+        var expected = Assert.Throws<ArgumentException>(() => lazy[7]);
+        // The first invalid channel, as sequentially
+        for (var i = 0; i < 20; i++)
+        {
+            var list = Serializer.DeserializeDataChannelListLazy(json)!.DataChannelList;
+            Assert.Equal(expected.Message, Assert.Throws<ArgumentException>(() => list.ValidateAll(parallel)).Message);
+        }
+
+        var valid = Serializer.DeserializeDataChannelListLazy(LoadJson())!.DataChannelList;
+        valid.ValidateAll(parallel);
+        Assert.Equal(valid.Count, valid.ParsedCount);
+        Assert.Equal(valid.Count, valid.DataChannels.Count);
+    }
+
+    [Fact]
+    public void Test_Lazy_Concurrent_First_Access()
+    {
+        var lazy = Serializer.DeserializeDataChannelListLazy(LoadJson())!.DataChannelList;
+        var results = new SDK.Transport.DataChannel.DataChannel[64];
+        Parallel.For(0, results.Length, i => results[i] = lazy[i % lazy.Count]);
+        for (var i = 0; i < results.Length; i++)
+            Assert.Same(lazy[i % lazy.Count], results[i]);
+    }
+
+    [Fact]
+    public void Test_Lazy_Read_Only()
+    {
+        var lazy = Serializer.DeserializeDataChannelListLazy(LoadJson())!.DataChannelList;
+        var parsed = lazy[0];
+        lazy.MakeReadOnly();
+        Assert.Equal(1, lazy.ParsedCount);
+
+        Assert.Throws<NotSupportedException>(() => parsed.DataChannelId.ShortId = "modified");
+        Assert.Throws<NotSupportedException>(() => lazy[5].Property.Name = "modified");
+        Assert.Throws<NotSupportedException>(() => lazy.DataChannels[7].Property.Range!.Low = -1);
+    }
+
+    [Fact]
+    public void Test_Lazy_Duplicates_And_Modification()
+    {
+        var node = JsonNode.Parse(LoadJson())!;
+        var channels = node["Package"]!["DataChannelList"]!["DataChannel"]!.AsArray();
+        channels.Add(channels[0]!.DeepClone());
+        Assert.Throws<ArgumentException>(() => Serializer.DeserializeDataChannelListLazy(node.ToJsonString()));
+
+        var lazy = Serializer.DeserializeDataChannelListLazy(LoadJson())!.DataChannelList;
+        var first = lazy[0];
+        Assert.True(lazy.Remove(first));
+        Assert.Equal(lazy.Count, lazy.ParsedCount);
+        Assert.False(lazy.TryGetByShortId(first.DataChannelId.ShortId!, out _));
+        lazy.Add(first);
+        Assert.Same(first, lazy[lazy.Count - 1]);
+    }
+}
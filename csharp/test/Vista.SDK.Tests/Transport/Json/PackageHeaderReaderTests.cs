@@ -0,0 +1,125 @@
+using System.Text;
+using System.Text.Json;
+using System.Text.Json.Nodes;
+using Vista.SDK.Transport.Json;
+
+namespace Vista.SDK.Tests.Transport.Json;
+
+public class PackageHeaderReaderTests
+{
+    // Returns a few bytes per read, so tokens and skipped values span buffers
+    private sealed class TrickleStream(byte[] buffer) : MemoryStream(buffer)
+    {
+        public override int Read(byte[] buffer, int offset, int count) => base.Read(buffer, offset, Math.Min(count, 7));
+    }
+
+    private static byte[] HeaderLast(string json)
+    {
+        var node = JsonNode.Parse(json)!;
+        var package = node["Package"]!.AsObject();
+        var header = package["Header"];
+        package.Remove("Header");
+        package.Add("Header", header);
+        return Encoding.UTF8.GetBytes(node.ToJsonString());
+    }
+
+    [Theory]
+    [InlineData(false)]
+    [InlineData(true)]
+    public void Test_Peek_TimeSeriesData(bool headerLast)
+    {
+        var json = File.ReadAllText("schemas/json/TimeSeriesData.sample.json");
+        var expected = Serializer.DeserializeTimeSeriesData(json)!.Package;
+        var bytes = headerLast ? HeaderLast(json) : Encoding.UTF8.GetBytes(json);
+
+        foreach (
+            var header in new[]
+            {
+                Serializer.PeekTimeSeriesDataHeader(bytes),
+                Serializer.PeekTimeSeriesDataHeader(new TrickleStream(bytes)),
+            }
+        )
+        {
+            Assert.NotNull(header);
+            Assert.Equal(expected.Header!.ShipID, header.ShipId);
+            Assert.Equal(expected.Header.TimeSpan!.Start, header.TimeSpan!.Start);
+            Assert.Equal(expected.Header.TimeSpan.End, header.TimeSpan.End);
+
+            var configurations = expected.TimeSeriesData.Select(d => d.DataConfiguration).OfType<object>().ToList();
+            Assert.Equal(2, configurations.Count);
+            Assert.Equal(
+                expected.TimeSeriesData.Select(d => (d.DataConfiguration!.ID, d.DataConfiguration.TimeStamp)),
+                header.DataConfigurations.Select(c => (c.ID, c.TimeStamp))
+            );
+        }
+    }
+
+    [Theory]
+    [InlineData(false)]
+    [InlineData(true)]
+    public void Test_Peek_DataChannelList(bool headerLast)
+    {
+        var json = File.ReadAllText("schemas/json/DataChannelList.sample.json");
+        var expected = Serializer.DeserializeDataChannelList(json)!.Package.Header;
+        var bytes = headerLast ? HeaderLast(json) : Encoding.UTF8.GetBytes(json);
+
+        foreach (
+            var header in new[]
+            {
+                Serializer.PeekDataChannelListHeader(bytes),
+                Serializer.PeekDataChannelListHeader(new TrickleStream(bytes)),
+            }
+        )
+        {
+            Assert.NotNull(header);
+            Assert.Equal(expected.ShipID, header.ShipId);
+            Assert.Equal(expected.DataChannelListID.ID, header.DataChannelListId!.ID);
+            Assert.Equal(expected.DataChannelListID.Version, header.DataChannelListId.Version);
+            Assert.Equal(expected.DataChannelListID.TimeStamp, header.DataChannelListId.TimeStamp);
+        }
+    }
+
+    [Fact]
+    public void Test_Peek_Stops_After_Header()
+    {
+        // The data channels after the header are not read, so they are not validated either
+        var json = Encoding.UTF8.GetBytes(
+            """{"Package":{"Header":{"ShipID":"IMO1234567","DataChannelListID":"""
+                + """{"ID":"list","TimeStamp":"2024-01-01T00:00:00Z"}},"DataChannelList":"""
+                + """{"DataChannel":[{"""
+        );
+
+        var header = Serializer.PeekDataChannelListHeader(new MemoryStream(json));
+        Assert.Equal("IMO1234567", header!.ShipId);
+        Assert.Equal("list", header.DataChannelListId!.ID);
+        Assert.Null(header.DataChannelListId.Version);
+    }
+
+    [Fact]
+    public void Test_Peek_Without_Header()
+    {
+        Assert.Null(Serializer.PeekTimeSeriesDataHeader("null"u8));
+        Assert.Null(Serializer.PeekTimeSeriesDataHeader("""{"Package":{"TimeSeriesData":[]}}"""u8));
+
+        var header = Serializer.PeekTimeSeriesDataHeader("""{"Package":{"Header":{"ShipID":"IMO1234567"}}}"""u8);
+        Assert.Equal("IMO1234567", header!.ShipId);
+        Assert.Null(header.TimeSpan);
+        Assert.Empty(header.DataConfigurations);
+    }
+
+    [Fact]
+    public void Test_Peek_Invalid_Json()
+    {
+        Assert.ThrowsAny<JsonException>(() => Serializer.PeekTimeSeriesDataHeader(""u8));
+        Assert.ThrowsAny<JsonException>(() => Serializer.PeekTimeSeriesDataHeader(new MemoryStream()));
+        Assert.ThrowsAny<JsonException>(
+            () => Serializer.PeekTimeSeriesDataHeader("""{"Package":{"TimeSeriesData":[{"""u8)
+        );
+        Assert.ThrowsAny<JsonException>(
+            () =>
+                Serializer.PeekTimeSeriesDataHeader(
+                    """{"Package":{"Header":{"ShipID":"IMO1234567","TimeSpan":{"Start":"yesterday"}}}}"""u8
+                )
+        );
+    }
+}
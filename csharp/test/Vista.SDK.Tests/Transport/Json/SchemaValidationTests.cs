@@ -0,0 +1,169 @@
+using System.Text;
+using System.Text.Json;
+using System.Text.Json.Nodes;
+using Vista.SDK.Transport.Json;
+
+namespace Vista.SDK.Tests.Transport.Json;
+
+public class SchemaValidationTests
+{
+    // Returns a few bytes per read, so tokens span reads, whichever Read or ReadAsync overload the reader calls
+    private sealed class TrickleStream(byte[] buffer) : MemoryStream(buffer)
+    {
+        private const int MaxRead = 7;
+
+        public override int Read(byte[] buffer, int offset, int count) =>
+            base.Read(buffer, offset, Math.Min(count, MaxRead));
+
+        public override int Read(Span<byte> buffer) => base.Read(buffer.Slice(0, Math.Min(buffer.Length, MaxRead)));
+
+        public override Task<int> ReadAsync(
+            byte[] buffer,
+            int offset,
+            int count,
+            CancellationToken cancellationToken
+        ) => base.ReadAsync(buffer, offset, Math.Min(count, MaxRead), cancellationToken);
+
+        public override ValueTask<int> ReadAsync(Memory<byte> buffer, CancellationToken cancellationToken = default) =>
+            base.ReadAsync(buffer.Slice(0, Math.Min(buffer.Length, MaxRead)), cancellationToken);
+    }
+
+    private static Stream Open(string json) => new TrickleStream(Encoding.UTF8.GetBytes(json));
+
+    private static string Modify(string file, Action<JsonNode> modify)
+    {
+        var node = JsonNode.Parse(File.ReadAllText(file))!;
+        modify(node);
+        return node.ToJsonString();
+    }
+
+    [Theory]
+    [InlineData("schemas/json/DataChannelList.sample.json")]
+    [InlineData("schemas/json/DataChannelList.sample.compact.json")]
+    public async Task Test_Valid_DataChannelList(string file)
+    {
+        var json = File.ReadAllText(file);
+        var expected = Serializer.DeserializeDataChannelList(json)!.Serialize();
+
+        Assert.Equal(expected, Serializer.DeserializeDataChannelList(Open(json), validateSchema: true)!.Serialize());
+        var package = await Serializer.DeserializeDataChannelListAsync(Open(json), validateSchema: true);
+        Assert.Equal(expected, package!.Serialize());
+
+        var lazy = Serializer.DeserializeDataChannelListLazy(Open(json), validateSchema: true)!;
+        Assert.Equal(expected, lazy.Serialize());
+    }
+
+    [Fact]
+    public async Task Test_Valid_TimeSeriesData()
+    {
+        var json = File.ReadAllText("schemas/json/TimeSeriesData.sample.json");
+        var expected = Serializer.DeserializeTimeSeriesData(json)!.Serialize();
+
+        Assert.Equal(expected, Serializer.DeserializeTimeSeriesData(Open(json), validateSchema: true)!.Serialize());
+        var package = await Serializer.DeserializeTimeSeriesDataAsync(Open(json), validateSchema: true);
+        Assert.Equal(expected, package!.Serialize());
+    }
+
+    [Fact]
+    public void Test_Additional_Properties_Are_Skipped()
+    {
+        // Header allows additional properties, with values of any shape
+        var json = Modify(
+            "schemas/json/DataChannelList.sample.json",
+            n =>
+                n["Package"]!["Header"]!["Custom"] = JsonNode.Parse(
+                    """{"Nested":[{"Package":1},[true,null]],"Value":"x"}"""
+                )
+        );
+
+        Assert.NotNull(Serializer.DeserializeDataChannelList(Open(json), validateSchema: true));
+    }
+
+    public static IEnumerable<object[]> DataChannelListViolations =>
+        new object[][]
+        {
+            ["Missing", "required property 'Format' is missing at $.Package.DataChannelList.DataChannel[1].Property"],
+            ["Unknown", "property 'Priority' is not allowed at $.Package.DataChannelList.DataChannel[1].Property."],
+            ["Type", "expected a string, found a number at $.Package.DataChannelList.DataChannel[1].DataChannelID."],
+            ["DateTime", "'yesterday' is not an ISO 8601 date-time at $.Package.Header.DataChannelListID.TimeStamp"],
+            ["Enum", "'Trim' is not one of Preserve, Replace, Collapse at $.Package.DataChannelList.DataChannel[1]"],
+            ["Integer", "1.5 is not an integer at $.Package.DataChannelList.DataChannel[1]"],
+            ["Minimum", "-1 is less than 0 at $.Package.DataChannelList.DataChannel[1]"],
+        };
+
+    [Theory]
+    [MemberData(nameof(DataChannelListViolations))]
+    public void Test_DataChannelList_Violations(string violation, string message)
+    {
+        var json = Modify(
+            "schemas/json/DataChannelList.sample.json",
+            n =>
+            {
+                var channel = n["Package"]!["DataChannelList"]!["DataChannel"]![1]!;
+                var property = channel["Property"]!.AsObject();
+                switch (violation)
+                {
+                    case "Missing":
+                        property.Remove("Format");
+                        break;
+                    case "Unknown":
+                        property["DataChannelType"]!["Priority"] = 1;
+                        break;
+                    case "Type":
+                        channel["DataChannelID"]!["LocalID"] = 5;
+                        break;
+                    case "DateTime":
+                        n["Package"]!["Header"]!["DataChannelListID"]!["TimeStamp"] = "yesterday";
+                        break;
+                    case "Enum":
+                        property["Format"]!["Restriction"] = new JsonObject { ["WhiteSpace"] = "Trim" };
+                        break;
+                    case "Integer":
+                        property["Format"]!["Restriction"] = new JsonObject { ["FractionDigits"] = 1.5 };
+                        break;
+                    case "Minimum":
+                        property["Format"]!["Restriction"] = new JsonObject { ["MaxLength"] = -1 };
+                        break;
+                }
+            }
+        );
+
+        var e = Assert.ThrowsAny<JsonException>(
+            () => Serializer.DeserializeDataChannelList(Open(json), validateSchema: true)
+        );
+        Assert.StartsWith("DataChannelListPackage: ", e.Message);
+        Assert.Contains(message, e.Message);
+        Assert.ThrowsAny<JsonException>(
+            () => Serializer.DeserializeDataChannelListLazy(Open(json), validateSchema: true)
+        );
+    }
+
+    [Fact]
+    public async Task Test_TimeSeriesData_Violations()
+    {
+        var json = Modify(
+            "schemas/json/TimeSeriesData.sample.json",
+            n => n["Package"]!["TimeSeriesData"]![0]!["TabularData"]![0]!["DataSet"]![1]!["Unit"] = "%"
+        );
+
+        var e = await Assert.ThrowsAnyAsync<JsonException>(
+            async () => await Serializer.DeserializeTimeSeriesDataAsync(Open(json), validateSchema: true)
+        );
+        Assert.Equal("$.Package.TimeSeriesData[0].TabularData[0].DataSet[1]", e.Path);
+        Assert.Contains("property 'Unit' is not allowed", e.Message);
+
+        // Without schema validation the unknown property is ignored
+        Assert.NotNull(Serializer.DeserializeTimeSeriesData(Open(json), validateSchema: false));
+    }
+
+    [Fact]
+    public void Test_Invalid_Documents()
+    {
+        Assert.ThrowsAny<JsonException>(() => Serializer.DeserializeDataChannelList(Open("null"), true));
+        Assert.ThrowsAny<JsonException>(() => Serializer.DeserializeDataChannelList(Open(""), true));
+        Assert.ThrowsAny<JsonException>(
+            () => Serializer.DeserializeTimeSeriesData(Open("""{"Package":{"TimeSeriesData":[]"""), true)
+        );
+        Assert.ThrowsAny<JsonException>(() => Serializer.DeserializeTimeSeriesData(Open("{}"), validateSchema: true));
+    }
+}
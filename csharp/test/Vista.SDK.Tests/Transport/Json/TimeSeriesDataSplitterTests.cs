@@ -0,0 +1,167 @@
+using System.Text;
+using Vista.SDK.Transport.Json;
+using Vista.SDK.Transport.Json.TimeSeriesData;
+using TsDomain = Vista.SDK.Transport.TimeSeries;
+
+namespace Vista.SDK.Tests.Transport.Json;
+
+public class TimeSeriesDataSplitterTests
+{
+    private static TsDomain.TimeSeriesDataPackage LoadPackage()
+    {
+        var text = File.ReadAllText("schemas/json/TimeSeriesData.sample.json");
+        var package = Serializer.DeserializeTimeSeriesData(text)!.ToDomainModel();
+        package.Package.TimeSeriesData[1].CustomDataKinds = new() { ["Source"] = "Gateway 1" };
+        return package;
+    }
+
+    // Data sets of every TimeSeriesData entry in order, as JSON, with the DataConfiguration they belong to
+    private static List<string> DataSets(TimeSeriesDataPackage package) =>
+        package
+            .Package
+            .TimeSeriesData
+            .SelectMany(t =>
+            {
+                var configuration = $"{t.DataConfiguration?.ID} {t.CustomData?.Count}";
+                var tabular = (t.TabularData ?? [])
+                    .SelectMany(
+                        table =>
+                            table.DataSet!.Select(
+                                d => $"{configuration} {string.Join(",", table.DataChannelID!)} {d.TimeStamp:o} "
+                                    + string.Join(",", d.Value)
+                            )
+                    );
+                var events = (t.EventData?.DataSet ?? [])
+                    .Select(d => $"{configuration} {d.DataChannelID} {d.TimeStamp:o} {d.Value}");
+                return tabular.Concat(events);
+            })
+            .ToList();
+
+    [Fact]
+    public void Test_Unsplit_Package()
+    {
+        var package = LoadPackage();
+        var json = Encoding.UTF8.GetBytes(package.Serialize());
+
+        var chunk = Assert.Single(package.SerializeChunked(json.Length));
+        Assert.Equal(json, chunk);
+        Assert.Throws<ArgumentException>(() => package.SerializeChunked(100).ToList());
+    }
+
+    [Fact]
+    public void Test_Split_Package()
+    {
+        var package = LoadPackage();
+        var json = Encoding.UTF8.GetBytes(package.Serialize());
+        var expected = DataSets(package.ToJsonDto());
+
+        var budgets = 0;
+        for (var maxBytes = json.Length - 1; maxBytes > 0; maxBytes -= 7)
+        {
+            List<byte[]> chunks;
+            try
+            {
+                chunks = package.SerializeChunked(maxBytes).ToList();
+            }
+            catch (ArgumentException)
+            {
+                break;
+            }
+            budgets++;
+
+            Assert.True(chunks.Count > 1);
+            var dataSets = new List<string>();
+            foreach (var chunk in chunks)
+            {
+                Assert.True(chunk.Length <= maxBytes, $"Chunk of {chunk.Length} bytes, budget {maxBytes}");
+
+                // Every chunk is a valid package, written exactly like the serializer would
+                var text = Encoding.UTF8.GetString(chunk);
+                var dto = Serializer.DeserializeTimeSeriesData(text)!;
+                Assert.Equal(text, dto.Serialize());
+
+                var domain = dto.ToDomainModel();
+                var header = domain.Package.Header!;
+                Assert.Equal(package.Package.Header!.ShipId, header.ShipId);
+                Assert.Equal(package.Package.Header.Author, header.Author);
+                Assert.Equal(2, header.SystemConfiguration!.Count);
+
+                var timeStamps = domain
+                    .Package
+                    .TimeSeriesData
+                    .SelectMany(
+                        t =>
+                            (t.TabularData ?? [])
+                                .SelectMany(d => d.DataSets!.Select(s => s.TimeStamp))
+                                .Concat((t.EventData?.DataSet ?? []).Select(s => s.TimeStamp))
+                    )
+                    .ToList();
+                Assert.Equal(timeStamps.Min(), header.TimeSpan!.Start);
+                Assert.Equal(timeStamps.Max(), header.TimeSpan.End);
+
+                dataSets.AddRange(DataSets(dto));
+            }
+
+            Assert.Equal(expected, dataSets);
+        }
+
+        Assert.True(budgets > 10);
+    }
+
+    [Fact]
+    public void Test_Split_Escaped_Strings_And_Custom_Data()
+    {
+        // Escaped in the JSON, so their size differs from their length
+        const string escaped = "\"quoted\" back\\slash\ttab\n\u0001 æøå °C <tag> & 🚢";
+        var package = LoadPackage();
+        foreach (var data in package.Package.TimeSeriesData)
+        {
+            foreach (var dataSet in (data.TabularData ?? []).SelectMany(t => t.DataSets!))
+            {
+                for (var i = 0; i < dataSet.Value.Count; i++)
+                    dataSet.Value[i] += escaped;
+                dataSet.Quality = dataSet.Value.Select(_ => escaped).ToList();
+            }
+            foreach (var dataSet in data.EventData?.DataSet ?? [])
+            {
+                dataSet.Value += escaped;
+                dataSet.Quality = escaped;
+            }
+            data.CustomDataKinds = new()
+            {
+                ["Source"] = escaped,
+                ["Nested"] = new Dictionary<string, object> { [escaped] = new[] { 1.5, -2e10 } },
+            };
+        }
+        var json = Encoding.UTF8.GetBytes(package.Serialize());
+        var expected = DataSets(package.ToJsonDto());
+
+        var budgets = 0;
+        for (var maxBytes = json.Length; maxBytes > 0; maxBytes -= 13)
+        {
+            List<byte[]> chunks;
+            try
+            {
+                chunks = package.SerializeChunked(maxBytes).ToList();
+            }
+            catch (ArgumentException)
+            {
+                break;
+            }
+            budgets++;
+
+            var dataSets = new List<string>();
+            foreach (var chunk in chunks)
+            {
+                Assert.True(chunk.Length <= maxBytes, $"Chunk of {chunk.Length} bytes, budget {maxBytes}");
+                var text = Encoding.UTF8.GetString(chunk);
+                var dto = Serializer.DeserializeTimeSeriesData(text)!;
+                Assert.Equal(text, dto.Serialize());
+                dataSets.AddRange(DataSets(dto));
+            }
+            Assert.Equal(expected, dataSets);
+        }
+
+        Assert.True(budgets > 10);
+    }
+}
@@ -0,0 +1,273 @@
+using Vista.SDK.Transport;
+using Vista.SDK.Transport.Archive;
+using Vista.SDK.Transport.Json;
+using Vista.SDK.Transport.TimeSeries;
+using DataChannel = Vista.SDK.Transport.DataChannel;
+using JsonDataChannel = Vista.SDK.Transport.Json.DataChannel;
+
+namespace Vista.SDK.Tests.Transport;
+
+public class TimeSeriesArchiveTests : IDisposable
+{
+    // Ten minutes before midnight, so the rows span two segments
+    private static readonly DateTimeOffset Start = new(2024, 1, 1, 23, 50, 0, System.TimeSpan.Zero);
+
+    private readonly string _directory = Path.Combine(Path.GetTempPath(), "vista-archive-" + Guid.NewGuid());
+
+    public void Dispose()
+    {
+        if (Directory.Exists(_directory))
+            Directory.Delete(_directory, recursive: true);
+    }
+
+    private static DataChannel.DataChannelListPackage LoadDataChannelList()
+    {
+        var text = File.ReadAllText("schemas/json/DataChannelList.sample.compact.json");
+        return JsonDataChannel.Extensions.ToDomainModel(Serializer.DeserializeDataChannelList(text)!);
+    }
+
+    /// <summary>A table of every channel, a row every 30 seconds, and an event per row on the first channel.</summary>
+    private static TimeSeriesData CreateData(DataChannel.DataChannelListPackage dcPackage, int rows, int firstRow = 0)
+    {
+        var ids = dcPackage.Package.DataChannelList.Select(c => DataChannelId.Parse(c.DataChannelId.ShortId!)).ToList();
+        var dataSets = Enumerable
+            .Range(firstRow, rows)
+            .Select(row => new TabularDataSet
+            {
+                TimeStamp = Start.AddSeconds(30 * row),
+                Value = ids.Select((_, column) => $"{row}.{column}").ToList(),
+                Quality = row % 3 == 0 ? null : ids.Select(_ => row % 3 == 1 ? "Good" : "Bad").ToList(),
+            })
+            .ToList();
+        var events = Enumerable
+            .Range(firstRow, rows)
+            .Select(row => new EventDataSet
+            {
+                // Out of order, archived sorted
+                TimeStamp = Start.AddSeconds(30 * row + 15 - (row % 2) * 10),
+                DataChannelId = ids[0],
+                Value = $"-{row}",
+                Quality = null,
+            })
+            .ToList();
+
+        return new TimeSeriesData
+        {
+            DataConfiguration = ConfigurationReference.From(dcPackage),
+            TabularData = [new TabularData { DataChannelIds = ids, DataSets = dataSets }],
+            EventData = new EventData { DataSet = events },
+        };
+    }
+
+    private static List<ArchivedValue> Expected(
+        DataChannel.DataChannelListPackage dcPackage,
+        params TimeSeriesData[] data
+    )
+    {
+        var expected = new List<ArchivedValue>();
+        ValidateData add = (timeStamp, channel, value, quality) =>
+        {
+            expected.Add(new ArchivedValue(channel.DataChannelId.LocalId, timeStamp.ToUniversalTime(), value, quality));
+            return new ValidateResult.Ok();
+        };
+        foreach (var d in data)
+            Assert.IsType<ValidateResult.Ok>(d.Validate(dcPackage, add, add, parallel: true));
+        return expected;
+    }
+
+    private static IEnumerable<(string, DateTimeOffset, Value, string?)> Normalize(IEnumerable<ArchivedValue> values) =>
+        values
+            .Select(v => (v.LocalId.ToString(), v.TimeStamp, v.Value, v.Quality))
+            .OrderBy(v => v.Item1, StringComparer.Ordinal)
+            .ThenBy(v => v.TimeStamp)
+            .ThenBy(v => v.Value.ToString(), StringComparer.Ordinal);
+
+    [Fact]
+    public void Test_Round_Trip()
+    {
+        var dcPackage = LoadDataChannelList();
+        var data = CreateData(dcPackage, 40);
+        using (var writer = new TimeSeriesArchiveWriter(_directory))
+            Assert.IsType<ValidateResult.Ok>(writer.Append(data, dcPackage));
+
+        using var reader = TimeSeriesArchiveReader.Open(_directory);
+        Assert.Equal(
+            new[] { new DateTime(2024, 1, 1), new DateTime(2024, 1, 2) },
+            reader.Days
+        );
+
+        var channels = dcPackage.Package.DataChannelList.Select(c => c.DataChannelId.LocalId).ToList();
+        var all = reader.Scan(channels, DateTimeOffset.MinValue, DateTimeOffset.MaxValue).ToList();
+        var expected = Expected(dcPackage, data);
+        Assert.Equal(channels.Count * 40 + 40, all.Count);
+        Assert.Equal(Normalize(expected), Normalize(all));
+
+        // Within a block, the values of a channel are sorted
+        var first = all.Where(v => v.LocalId == channels[0] && v.TimeStamp < Start.AddMinutes(10)).ToList();
+        Assert.Equal(first.Select(v => v.TimeStamp).OrderBy(t => t), first.Select(v => v.TimeStamp));
+        Assert.All(all, v => Assert.Equal(System.TimeSpan.Zero, v.TimeStamp.Offset));
+    }
+
+    [Fact]
+    public void Test_Scan_Channels_And_Range()
+    {
+        var dcPackage = LoadDataChannelList();
+        var data = CreateData(dcPackage, 40);
+        using (var writer = new TimeSeriesArchiveWriter(_directory))
+        {
+            var package = new TimeSeriesDataPackage { Package = new() { Header = null, TimeSeriesData = [data] } };
+            Assert.IsType<ValidateResult.Ok>(writer.Append(package, dcPackage));
+        }
+
+        var channels = dcPackage.Package.DataChannelList.Select(c => c.DataChannelId.LocalId).ToList();
+        var requested = new[] { channels[1], channels[3] };
+        var from = Start.AddMinutes(5);
+        var to = Start.AddMinutes(15);
+
+        using var reader = TimeSeriesArchiveReader.Open(_directory);
+        var scanned = reader.Scan(requested, from, to).ToList();
+        var expected = Expected(dcPackage, data)
+            .Where(v => requested.Contains(v.LocalId) && v.TimeStamp >= from && v.TimeStamp < to);
+        Assert.Equal(2 * 20, scanned.Count);
+        Assert.Equal(Normalize(expected), Normalize(scanned));
+        // A column per channel and day, the other channels are not decoded
+        Assert.Equal(4, reader.DecodedColumns);
+
+        Assert.Empty(reader.Scan(requested, Start.AddDays(2), Start.AddDays(3)));
+        Assert.Empty(reader.Scan(requested, to, from));
+        var unknown = LocalId.Parse("/dnv-v2/vis-3-4a/1031/meta/cnt-refrigerant/state-leaking");
+        Assert.Empty(reader.Scan([unknown], from, to));
+        Assert.Equal(4, reader.DecodedColumns);
+    }
+
+    [Fact]
+    public void Test_Appends()
+    {
+        var dcPackage = LoadDataChannelList();
+        var first = CreateData(dcPackage, 10);
+        var second = CreateData(dcPackage, 30, firstRow: 10);
+        var third = CreateData(dcPackage, 5, firstRow: 40);
+        using (var writer = new TimeSeriesArchiveWriter(_directory, maxBufferedValues: 100))
+        {
+            writer.Append(first, dcPackage);
+            writer.Append(second, dcPackage);
+        }
+
+        // A reader sees the segments as they were when it first scanned them
+        var channels = dcPackage.Package.DataChannelList.Select(c => c.DataChannelId.LocalId).ToList();
+        using var before = TimeSeriesArchiveReader.Open(_directory);
+        Assert.Equal(40, before.Scan([channels[0]], Start.AddMinutes(10), Start.AddMinutes(30)).Count());
+
+        using (var writer = new TimeSeriesArchiveWriter(_directory))
+            writer.Append(third, dcPackage);
+
+        using var reader = TimeSeriesArchiveReader.Open(_directory);
+        var all = reader.Scan(channels, DateTimeOffset.MinValue, DateTimeOffset.MaxValue);
+        Assert.Equal(Normalize(Expected(dcPackage, first, second, third)), Normalize(all));
+        Assert.Equal(40, before.Scan([channels[0]], Start.AddMinutes(10), Start.AddMinutes(30)).Count());
+    }
+
+    [Fact]
+    public void Test_Interrupted_Flush()
+    {
+        var dcPackage = LoadDataChannelList();
+        var first = CreateData(dcPackage, 10);
+        var second = CreateData(dcPackage, 5, firstRow: 10);
+        using (var writer = new TimeSeriesArchiveWriter(_directory))
+            writer.Append(first, dcPackage);
+
+        // A block cut short by a crash
+        var segment = Path.Combine(_directory, "2024-01-01.vsa");
+        var length = new FileInfo(segment).Length;
+        using (var file = new FileStream(segment, FileMode.Append))
+            file.Write([0x56, 0x42, 0x4C, 0x4B, 0xFF, 0x00, 0x00, 0x00, 0x01, 0x02], 0, 10);
+
+        var channels = dcPackage.Package.DataChannelList.Select(c => c.DataChannelId.LocalId).ToList();
+        using (var reader = TimeSeriesArchiveReader.Open(_directory))
+        {
+            var all = reader.Scan(channels, DateTimeOffset.MinValue, DateTimeOffset.MaxValue);
+            Assert.Equal(Normalize(Expected(dcPackage, first)), Normalize(all));
+        }
+
+        using (var writer = new TimeSeriesArchiveWriter(_directory))
+            writer.Append(second, dcPackage);
+        Assert.True(new FileInfo(segment).Length > length);
+
+        using (var reader = TimeSeriesArchiveReader.Open(_directory))
+        {
+            var all = reader.Scan(channels, DateTimeOffset.MinValue, DateTimeOffset.MaxValue);
+            Assert.Equal(Normalize(Expected(dcPackage, first, second)), Normalize(all));
+        }
+    }
+
+    [Fact]
+    public void Test_Invalid_Data_Is_Not_Archived()
+    {
+        var dcPackage = LoadDataChannelList();
+        var valid = CreateData(dcPackage, 5);
+        var invalid = CreateData(dcPackage, 5, firstRow: 5);
+        invalid.TabularData![0].DataSets![2].Value[1] = "not a number";
+
+        using (var writer = new TimeSeriesArchiveWriter(_directory))
+        {
+            var package = new TimeSeriesDataPackage
+            {
+                Package = new() { Header = null, TimeSeriesData = [valid, invalid] },
+            };
+            var result = writer.Append(package, dcPackage);
+            Assert.IsType<ValidateResult.Invalid>(result);
+            Assert.IsType<ValidateResult.Ok>(writer.Append(valid, dcPackage));
+        }
+
+        var channels = dcPackage.Package.DataChannelList.Select(c => c.DataChannelId.LocalId).ToList();
+        using var reader = TimeSeriesArchiveReader.Open(_directory);
+        var all = reader.Scan(channels, DateTimeOffset.MinValue, DateTimeOffset.MaxValue);
+        Assert.Equal(Normalize(Expected(dcPackage, valid)), Normalize(all));
+    }
+
+    public static IEnumerable<object[]> Values =>
+        [
+            [
+                new Value[]
+                {
+                    new Value.String("a"),
+                    new Value.String(""),
+                    new Value.String("æøå"),
+                    new Value.String("a"),
+                },
+            ],
+            [new Value[] { new Value.Char('x'), new Value.Char('€') }],
+            [new Value[] { new Value.Boolean(true), new Value.Boolean(false), new Value.Boolean(true) }],
+            [new Value[] { new Value.Integer(int.MinValue), new Value.Integer(int.MaxValue), new Value.Integer(0) }],
+            [new Value[] { new Value.UnsignedInteger(uint.MaxValue), new Value.UnsignedInteger(0) }],
+            [new Value[] { new Value.Long(long.MinValue), new Value.Long(long.MaxValue), new Value.Long(-1) }],
+            [new Value[] { new Value.Double(1.5), new Value.Double(double.NaN), new Value.Double(-0.0) }],
+            [new Value[] { new Value.Decimal(1.50m), new Value.Decimal(decimal.MinValue), new Value.Decimal(0.1m) }],
+            [
+                new Value[]
+                {
+                    new Value.DateTime(Start),
+                    new Value.DateTime(Start.ToOffset(System.TimeSpan.FromHours(-5.5))),
+                    new Value.DateTime(DateTimeOffset.MinValue),
+                },
+            ],
+        ];
+
+    [Theory]
+    [MemberData(nameof(Values))]
+    public void Test_Value_Encoding(Value[] values)
+    {
+        var kind = ArchiveFormat.KindOf(values[0]);
+        var buffer = new ArchiveBuffer(1);
+        ArchiveFormat.EncodeValues(buffer, kind, values);
+        var data = buffer.Array.AsSpan(0, buffer.Length);
+
+        Assert.Equal(values, ArchiveFormat.DecodeValues(data, kind, 0, values.Length));
+        Assert.Equal(values.Skip(1), ArchiveFormat.DecodeValues(data, kind, 1, values.Length));
+        var dateTimes = ArchiveFormat.DecodeValues(data, kind, 0, values.Length).OfType<Value.DateTime>();
+        Assert.Equal(
+            values.OfType<Value.DateTime>().Select(v => v.Value.Offset),
+            dateTimes.Select(v => v.Value.Offset)
+        );
+    }
+}
@@ -0,0 +1,249 @@
+using Vista.SDK.Transport;
+using Vista.SDK.Transport.TimeSeries;
+
+namespace Vista.SDK.Tests.Transport;
+
+public class TimeSeriesDataMergerTests
+{
+    private static readonly DateTimeOffset Start = new(2024, 1, 1, 0, 0, 0, System.TimeSpan.Zero);
+
+    private static readonly DataChannelId A = DataChannelId.Parse("a");
+    private static readonly DataChannelId B = DataChannelId.Parse("b");
+
+    private static Header CreateHeader() =>
+        new()
+        {
+            ShipId = ShipId.Parse("IMO1234567"),
+            TimeSpan = null,
+            Author = "Merge",
+        };
+
+    private static TimeSeriesDataPackage CreatePackage(
+        params (int Second, DataChannelId Id, string Value, string? Quality)[] events
+    ) =>
+        new()
+        {
+            Package = new Package
+            {
+                Header = CreateHeader(),
+                TimeSeriesData =
+                [
+                    new TimeSeriesData
+                    {
+                        DataConfiguration = null,
+                        TabularData = null,
+                        EventData = new EventData
+                        {
+                            DataSet = events
+                                .Select(e => new EventDataSet
+                                {
+                                    TimeStamp = Start.AddSeconds(e.Second),
+                                    DataChannelId = e.Id,
+                                    Value = e.Value,
+                                    Quality = e.Quality,
+                                })
+                                .ToList(),
+                        },
+                    },
+                ],
+            },
+        };
+
+    private static string[] Format(IEnumerable<TimeSeriesValue> values) =>
+        values.Select(v => $"{(v.TimeStamp - Start).TotalSeconds} {v.DataChannelId} {v.Value}").ToArray();
+
+    [Fact]
+    public void Test_Merge_Deduplicates_By_Quality()
+    {
+        var first = new[]
+        {
+            CreatePackage((0, A, "1", "0"), (1, A, "2", "1"), (1, B, "x", null)),
+            CreatePackage((3, A, "4", "0")),
+        };
+        var second = new[]
+        {
+            CreatePackage((1, A, "2b", "0"), (1, B, "xb", "0"), (2, A, "3b", null)),
+            CreatePackage((3, A, "4b", "1"), (4, B, "y", "0")),
+        };
+
+        var merger = new TimeSeriesDataMerger();
+        var merged = Format(merger.Merge([first, second]));
+
+        Assert.Equal(new[] { "0 a 1", "1 a 2b", "1 b x", "2 a 3b", "3 a 4", "4 b y" }, merged);
+        Assert.Equal(9, merger.ReceivedValues);
+        Assert.Equal(3, merger.DuplicateValues);
+        Assert.Equal(0, merger.LateValues);
+    }
+
+    [Fact]
+    public void Test_Merge_Custom_Quality_Rank()
+    {
+        var first = new[] { CreatePackage((0, A, "1", "A")) };
+        var second = new[] { CreatePackage((0, A, "2", "V")) };
+
+        // Later inputs win, e.g. when the second gateway is the primary one
+        var merger = new TimeSeriesDataMerger(q => q == "V" ? 0 : 1);
+        Assert.Equal(new[] { "0 a 2" }, Format(merger.Merge([first, second])));
+    }
+
+    [Fact]
+    public void Test_Merge_Orders_Package_Values()
+    {
+        var package = CreatePackage((2, A, "3b", null), (0, B, "x", null));
+        package.Package.TimeSeriesData[0].TabularData =
+        [
+            new TabularData
+            {
+                DataChannelIds = [A, B],
+                DataSets =
+                [
+                    new TabularDataSet { TimeStamp = Start.AddSeconds(1), Value = ["2", "y"], Quality = null },
+                    new TabularDataSet { TimeStamp = Start.AddSeconds(0), Value = ["1", "x2"], Quality = null },
+                    new TabularDataSet { TimeStamp = Start.AddSeconds(2), Value = ["3"], Quality = null },
+                ],
+            },
+        ];
+
+        var merger = new TimeSeriesDataMerger();
+        Assert.Equal(
+            new[] { "0 a 1", "0 b x2", "1 a 2", "1 b y", "2 a 3" },
+            Format(merger.Merge([new[] { package }]))
+        );
+        Assert.Equal(2, merger.DuplicateValues);
+    }
+
+    [Fact]
+    public void Test_Merge_Late_Values()
+    {
+        var input = new[] { CreatePackage((0, A, "1", null), (5, A, "2", null)), CreatePackage((3, A, "late", null)) };
+
+        var merger = new TimeSeriesDataMerger();
+        Assert.Equal(new[] { "0 a 1", "5 a 2" }, Format(merger.Merge([input])));
+        Assert.Equal(1, merger.LateValues);
+    }
+
+    [Fact]
+    public void Test_Merge_Is_Lazy()
+    {
+        var pulled = 0;
+        IEnumerable<TimeSeriesDataPackage> Input()
+        {
+            for (var i = 0; i < 1000; i++)
+            {
+                pulled++;
+                yield return CreatePackage((i, A, i.ToString(), null));
+            }
+        }
+
+        var merger = new TimeSeriesDataMerger();
+        var values = merger.Merge([Input(), Input()]).Take(10).ToArray();
+
+        Assert.Equal(10, values.Length);
+        Assert.True(pulled < 30, $"Pulled {pulled} packages");
+    }
+
+    private static TimeSeriesDataPackage CreateTablePackage(
+        DataChannelId[] ids,
+        params (int Second, string[] Values, string[]? Quality)[] rows
+    )
+    {
+        var package = CreatePackage();
+        package.Package.TimeSeriesData[0].EventData = null;
+        package.Package.TimeSeriesData[0].TabularData =
+        [
+            new TabularData
+            {
+                DataChannelIds = [.. ids],
+                DataSets = rows.Select(r => new TabularDataSet
+                    {
+                        TimeStamp = Start.AddSeconds(r.Second),
+                        Value = [.. r.Values],
+                        Quality = r.Quality?.ToList(),
+                    })
+                    .ToList(),
+            },
+        ];
+        return package;
+    }
+
+    [Fact]
+    public void Test_MergeToPackages()
+    {
+        var first = new[] { CreatePackage((1, A, "1", null), (4, B, "x", null)) };
+        var second = new[] { CreatePackage((2, A, "2", null), (4, A, "4", null)) };
+        var configuration = new ConfigurationReference { Id = "list", TimeStamp = Start };
+
+        var merger = new TimeSeriesDataMerger();
+        var packages = merger.MergeToPackages([first, second], CreateHeader(), configuration, maxValues: 2).ToArray();
+
+        // The values of a time stamp stay in one package
+        Assert.Equal(2, packages.Length);
+        Assert.Equal(Start.AddSeconds(1), packages[0].Package.Header!.TimeSpan!.Start);
+        Assert.Equal(Start.AddSeconds(2), packages[0].Package.Header!.TimeSpan!.End);
+        Assert.Equal(Start.AddSeconds(4), packages[1].Package.Header!.TimeSpan!.Start);
+        Assert.Equal(Start.AddSeconds(4), packages[1].Package.Header!.TimeSpan!.End);
+        var data = Assert.Single(packages[0].Package.TimeSeriesData);
+        Assert.Same(configuration, data.DataConfiguration);
+        Assert.Null(data.TabularData);
+        Assert.Equal(new[] { "1", "2" }, data.EventData!.DataSet!.Select(e => e.Value).ToArray());
+        Assert.Equal(
+            new[] { "x", "4" },
+            packages[1].Package.TimeSeriesData[0].EventData!.DataSet!.Select(e => e.Value).ToArray()
+        );
+    }
+
+    [Fact]
+    public void Test_MergeToPackages_Keeps_Tabular_Data()
+    {
+        var first = new[]
+        {
+            CreateTablePackage([A, B], (0, ["1", "x"], null), (1, ["2", "y"], null)),
+            CreateTablePackage([B], (1, ["y"], null), (3, ["w"], null)),
+        };
+        var second = new[]
+        {
+            CreateTablePackage([A, B], (1, ["2b", "yb"], null), (2, ["3", "z"], null)),
+            CreateTablePackage([B], (2, ["z"], null)),
+        };
+
+        var merger = new TimeSeriesDataMerger();
+        var package = Assert.Single(merger.MergeToPackages([first, second], CreateHeader(), null));
+
+        var data = Assert.Single(package.Package.TimeSeriesData);
+        Assert.Null(data.EventData);
+        Assert.Equal(2, data.TabularData!.Count);
+        Assert.Equal(new[] { A, B }, data.TabularData[0].DataChannelIds!);
+        Assert.Equal(
+            new[] { "0 1 x", "1 2 y", "2 3 z" },
+            data.TabularData[0]
+                .DataSets!.Select(r => $"{(r.TimeStamp - Start).TotalSeconds} {string.Join(" ", r.Value)}")
+                .ToArray()
+        );
+        Assert.All(data.TabularData[0].DataSets!, r => Assert.Null(r.Quality));
+        // The duplicates of B in the table of only B are merged away
+        Assert.Equal(new[] { B }, data.TabularData[1].DataChannelIds!);
+        var row = Assert.Single(data.TabularData[1].DataSets!);
+        Assert.Equal(Start.AddSeconds(3), row.TimeStamp);
+        Assert.Equal(new[] { "w" }, row.Value);
+    }
+
+    [Fact]
+    public void Test_MergeToPackages_Incomplete_Rows_As_Events()
+    {
+        var first = new[] { CreateTablePackage([A, B], (0, ["1", "x"], ["1", "1"]), (1, ["2", "y"], ["0", "0"])) };
+        var second = new[] { CreatePackage((0, A, "1b", "0")) };
+
+        var merger = new TimeSeriesDataMerger();
+        var package = Assert.Single(merger.MergeToPackages([first, second], CreateHeader(), null));
+
+        var data = Assert.Single(package.Package.TimeSeriesData);
+        var row = Assert.Single(Assert.Single(data.TabularData!).DataSets!);
+        Assert.Equal(new[] { "2", "y" }, row.Value);
+        Assert.Equal(new[] { "0", "0" }, row.Quality!);
+        Assert.Equal(
+            new[] { "0 a 1b", "0 b x" },
+            data.EventData!.DataSet!.Select(e => $"{(e.TimeStamp - Start).TotalSeconds} {e.DataChannelId} {e.Value}")
+                .ToArray()
+        );
+    }
+}
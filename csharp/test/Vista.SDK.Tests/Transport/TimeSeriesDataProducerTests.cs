@@ -0,0 +1,230 @@
+using Vista.SDK.Transport;
+using Vista.SDK.Transport.Json;
+using Vista.SDK.Transport.TimeSeries;
+using DataChannel = Vista.SDK.Transport.DataChannel;
+using JsonDataChannel = Vista.SDK.Transport.Json.DataChannel;
+
+namespace Vista.SDK.Tests.Transport;
+
+public class TimeSeriesDataProducerTests
+{
+    private static readonly DateTimeOffset Start = new(2024, 1, 1, 0, 0, 0, System.TimeSpan.Zero);
+
+    private static DataChannel.DataChannelListPackage LoadDataChannelList()
+    {
+        var text = File.ReadAllText("schemas/json/DataChannelList.sample.compact.json");
+        var dcPackage = JsonDataChannel.Extensions.ToDomainModel(Serializer.DeserializeDataChannelList(text)!);
+
+        // Channels 0 and 1 keep their 1 s update cycle
+        var list = dcPackage.Package.DataChannelList;
+        list[2].Property.DataChannelType.UpdateCycle = 10;
+        list[3].Property.DataChannelType.UpdateCycle = null;
+        return dcPackage;
+    }
+
+    private static string ShortId(DataChannel.DataChannelListPackage dcPackage, int index) =>
+        dcPackage.Package.DataChannelList[index].DataChannelId.ShortId!;
+
+    [Fact]
+    public void Test_Groups_By_Update_Cycle()
+    {
+        var dcPackage = LoadDataChannelList();
+        var packages = new List<TimeSeriesDataPackage>();
+        var producer = new TimeSeriesDataProducer(dcPackage, packages.Add, System.TimeSpan.FromMinutes(1));
+
+        Assert.True(producer.TryAdd(ShortId(dcPackage, 0), Start.AddMilliseconds(200), 1.5));
+        Assert.True(producer.TryAdd(ShortId(dcPackage, 1), Start.AddMilliseconds(900), "2"));
+        Assert.True(producer.TryAdd(ShortId(dcPackage, 0), Start.AddSeconds(1.1), "3"));
+        Assert.True(producer.TryAdd(ShortId(dcPackage, 2), Start.AddSeconds(12), "4"));
+        Assert.True(producer.TryAdd(ShortId(dcPackage, 3), Start.AddSeconds(1.25), "5"));
+        Assert.False(producer.TryAdd("unknown", Start, "6"));
+        Assert.Equal(5, producer.BufferedReadings);
+
+        producer.Flush();
+
+        var package = Assert.Single(packages);
+        Assert.Equal(dcPackage.Package.Header.ShipId, package.Package.Header!.ShipId);
+        Assert.Equal(Start, package.Package.Header.TimeSpan!.Start);
+        Assert.Equal(Start.AddSeconds(10), package.Package.Header.TimeSpan.End);
+
+        var data = Assert.Single(package.Package.TimeSeriesData);
+        Assert.Equal(dcPackage.Package.Header.DataChannelListId.Id, data.DataConfiguration!.Id);
+        Assert.Equal(4, data.TabularData!.Count);
+
+        // 1 s cycle, aligned on whole seconds
+        var table = data.TabularData[0];
+        Assert.Equal(2, table.DataChannelIds!.Count);
+        Assert.Equal(dcPackage.Package.DataChannelList[0].DataChannelId.LocalId, table.DataChannelIds[0].LocalId);
+        var dataSet = Assert.Single(table.DataSets!);
+        Assert.Equal(Start, dataSet.TimeStamp);
+        Assert.Equal(["1.5", "2"], dataSet.Value);
+
+        // The row without a reading of the second channel is in a table of its own
+        table = data.TabularData[1];
+        Assert.Equal(dcPackage.Package.DataChannelList[0].DataChannelId.LocalId, table.DataChannelIds![0].LocalId);
+        dataSet = Assert.Single(table.DataSets!);
+        Assert.Equal(Start.AddSeconds(1), dataSet.TimeStamp);
+        Assert.Equal(["3"], dataSet.Value);
+        Assert.Null(dataSet.Quality);
+
+        // 10 s cycle
+        table = data.TabularData[2];
+        dataSet = Assert.Single(table.DataSets!);
+        Assert.Equal(Start.AddSeconds(10), dataSet.TimeStamp);
+        Assert.Null(dataSet.Quality);
+
+        // No update cycle, exact time stamps
+        table = data.TabularData[3];
+        dataSet = Assert.Single(table.DataSets!);
+        Assert.Equal(Start.AddSeconds(1.25), dataSet.TimeStamp);
+        Assert.Equal(["5"], dataSet.Value);
+
+        Assert.Equal(6, producer.ReceivedReadings);
+        Assert.Equal(1, producer.RejectedReadings);
+        Assert.Equal(0, producer.BufferedReadings);
+    }
+
+    [Fact]
+    public void Test_Time_Trigger()
+    {
+        var dcPackage = LoadDataChannelList();
+        var packages = new List<TimeSeriesDataPackage>();
+        var producer = new TimeSeriesDataProducer(dcPackage, packages.Add, System.TimeSpan.FromSeconds(10));
+
+        for (var i = 0; i < 25; i++)
+            producer.TryAdd(ShortId(dcPackage, 0), Start.AddSeconds(i), i, "0");
+
+        Assert.Equal(2, packages.Count);
+        Assert.Equal(5, producer.BufferedReadings);
+        foreach (var (package, i) in packages.Select((p, i) => (p, i)))
+        {
+            var table = Assert.Single(package.Package.TimeSeriesData[0].TabularData!);
+            Assert.Equal(10, table.DataSets!.Count);
+            Assert.Equal(Start.AddSeconds(10 * i), package.Package.Header!.TimeSpan!.Start);
+            Assert.Equal(["0"], table.DataSets[0].Quality);
+        }
+
+        producer.FlushIfDue(Start.AddSeconds(29));
+        Assert.Equal(2, packages.Count);
+        producer.FlushIfDue(Start.AddSeconds(30));
+        Assert.Equal(3, packages.Count);
+        Assert.Equal(3, producer.EmittedPackages);
+    }
+
+    [Fact]
+    public void Test_Size_Trigger_And_Order()
+    {
+        var dcPackage = LoadDataChannelList();
+        var packages = new List<TimeSeriesDataPackage>();
+        var producer = new TimeSeriesDataProducer(
+            dcPackage,
+            packages.Add,
+            System.TimeSpan.FromHours(1),
+            maxReadings: 4
+        );
+
+        // Out of order, and a replaced reading of the same slot
+        producer.TryAdd(ShortId(dcPackage, 0), Start.AddSeconds(3), "3");
+        producer.TryAdd(ShortId(dcPackage, 0), Start.AddSeconds(1), "1");
+        producer.TryAdd(ShortId(dcPackage, 0), Start.AddSeconds(1.5), "1.5");
+        producer.TryAdd(ShortId(dcPackage, 0), Start.AddSeconds(2), "2");
+        Assert.Empty(packages);
+        producer.TryAdd(ShortId(dcPackage, 0), Start, "0");
+
+        var table = Assert.Single(Assert.Single(packages).Package.TimeSeriesData[0].TabularData!);
+        Assert.Equal(["0", "1.5", "2", "3"], table.DataSets!.Select(d => d.Value[0]));
+        Assert.Equal(
+            [Start, Start.AddSeconds(1), Start.AddSeconds(2), Start.AddSeconds(3)],
+            table.DataSets!.Select(d => d.TimeStamp)
+        );
+
+        // The buffers are reused for the next package
+        producer.TryAdd(ShortId(dcPackage, 1), Start.AddSeconds(5), "5");
+        producer.Flush();
+        table = Assert.Single(packages[1].Package.TimeSeriesData[0].TabularData!);
+        Assert.Equal(dcPackage.Package.DataChannelList[1].DataChannelId.LocalId, table.DataChannelIds![0].LocalId);
+        Assert.Equal(["5"], Assert.Single(table.DataSets!).Value);
+    }
+
+    [Fact]
+    public void Test_Validates_Against_DataChannelList()
+    {
+        var dcPackage = LoadDataChannelList();
+        var packages = new List<TimeSeriesDataPackage>();
+        var producer = new TimeSeriesDataProducer(dcPackage, packages.Add, System.TimeSpan.FromMinutes(1));
+
+        // Both 1 s channels every 500 ms, so every row is complete
+        for (var i = 0; i < 1000; i++)
+            producer.TryAdd(ShortId(dcPackage, i % 2), Start.AddMilliseconds(i * 250), i * 0.1);
+        producer.Flush();
+
+        Assert.Equal(5, packages.Count);
+        var values = 0;
+        foreach (var package in packages)
+        {
+            var result = package
+                .Package
+                .TimeSeriesData[0]
+                .Validate(
+                    dcPackage,
+                    (_, _, _, _) =>
+                    {
+                        values++;
+                        return new ValidateResult.Ok();
+                    },
+                    (_, _, _, _) => new ValidateResult.Ok()
+                );
+            Assert.IsType<ValidateResult.Ok>(result);
+
+            var table = Assert.Single(package.Package.TimeSeriesData[0].TabularData!);
+            Assert.All(table.DataSets!, r => Assert.Equal(0, r.TimeStamp.UtcTicks % System.TimeSpan.TicksPerSecond));
+        }
+        Assert.Equal(500, values);
+    }
+
+    [Fact]
+    public void Test_Rows_With_Gaps_Validate()
+    {
+        var dcPackage = LoadDataChannelList();
+        var packages = new List<TimeSeriesDataPackage>();
+        var producer = new TimeSeriesDataProducer(dcPackage, packages.Add, System.TimeSpan.FromMinutes(1));
+
+        // The second channel misses every third second, the first has a quality every fifth
+        var readings = 0;
+        for (var i = 0; i < 100; i++)
+        {
+            producer.TryAdd(ShortId(dcPackage, 0), Start.AddSeconds(i), i * 0.1, i % 5 == 0 ? "0" : null);
+            readings++;
+            if (i % 3 == 0)
+                continue;
+            producer.TryAdd(ShortId(dcPackage, 1), Start.AddSeconds(i), i * 0.2);
+            readings++;
+        }
+        producer.Flush();
+
+        Assert.Equal(2, packages.Count);
+        var values = 0;
+        foreach (var package in packages)
+        {
+            var data = package.Package.TimeSeriesData[0];
+            var result = data.Validate(
+                dcPackage,
+                (_, _, _, _) =>
+                {
+                    values++;
+                    return new ValidateResult.Ok();
+                },
+                (_, _, _, _) => new ValidateResult.Ok()
+            );
+            Assert.IsType<ValidateResult.Ok>(result);
+
+            // Tables in the order of their first row, both windows start with a second the second channel misses
+            Assert.Equal(2, data.TabularData!.Count);
+            Assert.Single(data.TabularData[0].DataChannelIds!);
+            Assert.Equal(2, data.TabularData[1].DataChannelIds!.Count);
+            foreach (var table in data.TabularData)
+                Assert.All(table.DataSets!, r => Assert.Equal(table.DataChannelIds!.Count, r.Value.Count));
+        }
+        Assert.Equal(readings, values);
+    }
+}
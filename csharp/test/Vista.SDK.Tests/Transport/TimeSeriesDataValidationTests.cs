@@ -0,0 +1,350 @@
+using System.Collections.Concurrent;
+using Vista.SDK.Transport;
+using Vista.SDK.Transport.Json;
+using Vista.SDK.Transport.TimeSeries;
+using DataChannel = Vista.SDK.Transport.DataChannel;
+using JsonDataChannel = Vista.SDK.Transport.Json.DataChannel;
+
+namespace Vista.SDK.Tests.Transport;
+
+public class TimeSeriesDataValidationTests
+{
+    private static readonly DateTimeOffset Start = new(2024, 1, 1, 0, 0, 0, System.TimeSpan.Zero);
+
+    private static DataChannel.DataChannelListPackage LoadDataChannelList()
+    {
+        var text = File.ReadAllText("schemas/json/DataChannelList.sample.compact.json");
+        return JsonDataChannel.Extensions.ToDomainModel(Serializer.DeserializeDataChannelList(text)!);
+    }
+
+    /// <summary>A table of every channel plus an unknown one, with an invalid value every 97 cells.</summary>
+    private static TimeSeriesData CreateData(DataChannel.DataChannelListPackage dcPackage, int rows, int events = 0)
+    {
+        var list = dcPackage.Package.DataChannelList;
+        var ids = list.Select(c => DataChannelId.Parse(c.DataChannelId.ShortId!)).ToList();
+        ids.Add(DataChannelId.Parse("unknown"));
+
+        var dataSets = new List<TabularDataSet>(rows);
+        for (var row = 0; row < rows; row++)
+        {
+            var values = new List<string>(ids.Count);
+            for (var column = 0; column < ids.Count; column++)
+                values.Add((row * ids.Count + column) % 97 == 0 ? "not a number" : $"{(row + column) % 100}.5");
+            dataSets.Add(
+                new TabularDataSet
+                {
+                    TimeStamp = Start.AddSeconds(row),
+                    Value = values,
+                    Quality = null,
+                }
+            );
+        }
+
+        return new TimeSeriesData
+        {
+            DataConfiguration = ConfigurationReference.From(dcPackage),
+            TabularData = [new TabularData { DataChannelIds = ids, DataSets = dataSets }],
+            EventData =
+                events == 0
+                    ? null
+                    : new EventData
+                    {
+                        DataSet = Enumerable
+                            .Range(0, events)
+                            .Select(i => new EventDataSet
+                            {
+                                TimeStamp = Start.AddSeconds(i),
+                                DataChannelId = ids[i % ids.Count],
+                                Value = "1.5",
+                                Quality = null,
+                            })
+                            .ToList(),
+                    },
+        };
+    }
+
+    [Theory]
+    [InlineData(1)]
+    [InlineData(1000)]
+    public void Test_Parallel_Matches_Sequential(int rows)
+    {
+        var dcPackage = LoadDataChannelList();
+        var data = CreateData(dcPackage, rows);
+
+        var sequential = new List<(DateTimeOffset, string)>();
+        var expected = data.Validate(
+            dcPackage,
+            (timeStamp, channel, _, _) =>
+            {
+                sequential.Add((timeStamp, channel.DataChannelId.ShortId!));
+                // Callback errors are reported along with the invalid values
+                return timeStamp.Second % 7 == 0 ? new ValidateResult.Invalid(["rejected"]) : new ValidateResult.Ok();
+            },
+            (_, _, _, _) => new ValidateResult.Ok()
+        );
+
+        var ordered = new List<(DateTimeOffset, string)>();
+        var result = data.Validate(
+            dcPackage,
+            (timeStamp, channel, _, _) =>
+            {
+                ordered.Add((timeStamp, channel.DataChannelId.ShortId!));
+                return timeStamp.Second % 7 == 0 ? new ValidateResult.Invalid(["rejected"]) : new ValidateResult.Ok();
+            },
+            (_, _, _, _) => new ValidateResult.Ok(),
+            parallel: true
+        );
+        Assert.Equal(sequential, ordered);
+        var messages = Assert.IsType<ValidateResult.Invalid>(expected).Messages;
+        Assert.Equal(messages, Assert.IsType<ValidateResult.Invalid>(result).Messages);
+
+        var unordered = new ConcurrentBag<(DateTimeOffset, string)>();
+        result = data.Validate(
+            dcPackage,
+            (timeStamp, channel, _, _) =>
+            {
+                unordered.Add((timeStamp, channel.DataChannelId.ShortId!));
+                return timeStamp.Second % 7 == 0 ? new ValidateResult.Invalid(["rejected"]) : new ValidateResult.Ok();
+            },
+            (_, _, _, _) => new ValidateResult.Ok(),
+            parallel: true,
+            ordered: false
+        );
+        Assert.Equal(sequential.OrderBy(x => x), unordered.OrderBy(x => x));
+        Assert.Equal(messages, Assert.IsType<ValidateResult.Invalid>(result).Messages);
+    }
+
+    [Fact]
+    public void Test_Parallel_Events()
+    {
+        var dcPackage = LoadDataChannelList();
+        var data = CreateData(dcPackage, rows: 10, events: 5000);
+
+        var events = new List<DateTimeOffset>();
+        var result = data.Validate(
+            dcPackage,
+            (_, _, _, _) => new ValidateResult.Ok(),
+            (timeStamp, _, _, _) =>
+            {
+                events.Add(timeStamp);
+                return new ValidateResult.Ok();
+            },
+            parallel: true
+        );
+
+        // Every event of a known channel, in order
+        var known = data.EventData!.DataSet!.Where(e => e.DataChannelId.ShortId != "unknown").ToList();
+        Assert.Equal(known.Select(e => e.TimeStamp), events);
+
+        var messages = Assert.IsType<ValidateResult.Invalid>(result).Messages;
+        var unknownEvents = data.EventData.DataSet!.Count - known.Count;
+        Assert.Equal(unknownEvents, messages.Count(m => m.Contains("short id 'unknown'")) - 10);
+    }
+
+    [Fact]
+    public void Test_Parallel_Malformed_Table()
+    {
+        var dcPackage = LoadDataChannelList();
+        var data = CreateData(dcPackage, rows: 5000);
+        data.TabularData![0].DataSets![4000].Value.RemoveAt(0);
+
+        var calls = 0;
+        var result = data.Validate(
+            dcPackage,
+            (_, _, _, _) =>
+            {
+                Interlocked.Increment(ref calls);
+                return new ValidateResult.Ok();
+            },
+            (_, _, _, _) => new ValidateResult.Ok(),
+            parallel: true
+        );
+
+        var invalid = Assert.IsType<ValidateResult.Invalid>(result);
+        var message = Assert.Single(invalid.Messages);
+        Assert.Equal("Tabular data set 4000 expects 15 values, but 14 values are provided", message);
+        Assert.Equal(0, calls);
+    }
+
+    [Theory]
+    [InlineData(false)]
+    [InlineData(true)]
+    public void Test_Parallel_Callback_Exception(bool ordered)
+    {
+        var dcPackage = LoadDataChannelList();
+        var data = CreateData(dcPackage, rows: 2000, events: 100);
+
+        // Every value from row 500 throws, the exception of the first one is rethrown
+        ValidateData onValue = (timeStamp, channel, _, _) =>
+            timeStamp >= Start.AddSeconds(500)
+                ? throw new InvalidOperationException($"{timeStamp:O} {channel.DataChannelId.ShortId}")
+                : new ValidateResult.Ok();
+        var expected = Assert.Throws<InvalidOperationException>(() => data.Validate(dcPackage, onValue, onValue));
+        for (var run = 0; run < 10; run++)
+        {
+            var actual = Assert.Throws<InvalidOperationException>(
+                () => data.Validate(dcPackage, onValue, onValue, parallel: true, ordered)
+            );
+            Assert.Equal(expected.Message, actual.Message);
+        }
+    }
+
+    /// <summary>Makes every third channel of the list an alert channel.</summary>
+    private static HashSet<string> MakeAlerts(DataChannel.DataChannelListPackage dcPackage)
+    {
+        var alerts = new HashSet<string>();
+        var list = dcPackage.Package.DataChannelList;
+        for (var i = 0; i < list.Count; i += 3)
+        {
+            list[i].Property.DataChannelType.Type = "Alert";
+            list[i].Property.AlertPriority = "Alarm";
+            alerts.Add(list[i].DataChannelId.ShortId!);
+        }
+        return alerts;
+    }
+
+    [Theory]
+    [InlineData(false)]
+    [InlineData(true)]
+    public void Test_Alerts_First(bool parallel)
+    {
+        var dcPackage = LoadDataChannelList();
+        var alerts = MakeAlerts(dcPackage);
+        var data = CreateData(dcPackage, rows: 100, events: 500);
+
+        var calls = new List<(string Kind, DateTimeOffset TimeStamp, string ShortId)>();
+        ValidateData Record(string kind) =>
+            (timeStamp, channel, _, _) =>
+            {
+                calls.Add((kind, timeStamp, channel.DataChannelId.ShortId!));
+                return new ValidateResult.Ok();
+            };
+        var result = data.ValidateAlertsFirst(
+            dcPackage,
+            Record("alert"),
+            Record("tabular"),
+            Record("event"),
+            parallel
+        );
+
+        // Every alert event, in order, before anything else
+        var expectedAlerts = data.EventData!
+            .DataSet!
+            .Where(e => alerts.Contains(e.DataChannelId.ShortId!))
+            .Select(e => ("alert", e.TimeStamp, e.DataChannelId.ShortId!))
+            .ToList();
+        Assert.Equal(expectedAlerts, calls.Take(expectedAlerts.Count));
+        Assert.DoesNotContain("alert", calls.Skip(expectedAlerts.Count).Select(c => c.Kind));
+        Assert.Empty(calls.Where(c => c.Kind == "event" && alerts.Contains(c.ShortId)));
+
+        // The rest is validated as without the fast lane
+        var expected = new List<(string, DateTimeOffset, string)>();
+        var expectedResult = data.Validate(
+            dcPackage,
+            (timeStamp, channel, _, _) =>
+            {
+                expected.Add(("tabular", timeStamp, channel.DataChannelId.ShortId!));
+                return new ValidateResult.Ok();
+            },
+            (timeStamp, channel, _, _) =>
+            {
+                if (!alerts.Contains(channel.DataChannelId.ShortId!))
+                    expected.Add(("event", timeStamp, channel.DataChannelId.ShortId!));
+                return new ValidateResult.Ok();
+            },
+            parallel
+        );
+        Assert.Equal(expected, calls.Skip(expectedAlerts.Count));
+        Assert.Equal(
+            Assert.IsType<ValidateResult.Invalid>(expectedResult).Messages,
+            Assert.IsType<ValidateResult.Invalid>(result).Messages
+        );
+    }
+
+    [Fact]
+    public void Test_Alerts_First_Malformed_Table()
+    {
+        var dcPackage = LoadDataChannelList();
+        var alerts = MakeAlerts(dcPackage);
+        var data = CreateData(dcPackage, rows: 10, events: 30);
+        data.TabularData![0].DataSets![5].Value.RemoveAt(0);
+        var alert = data.EventData!.DataSet!.First(e => alerts.Contains(e.DataChannelId.ShortId!));
+        alert.Value = "not a number";
+
+        var delivered = 0;
+        var result = data.ValidateAlertsFirst(
+            dcPackage,
+            (_, _, _, _) =>
+            {
+                delivered++;
+                return new ValidateResult.Ok();
+            },
+            (_, _, _, _) => new ValidateResult.Ok(),
+            (_, _, _, _) => new ValidateResult.Ok(),
+            parallel: true
+        );
+
+        // Alerts don't wait for the tables, and their errors come first
+        Assert.Equal(data.EventData.DataSet!.Count(e => alerts.Contains(e.DataChannelId.ShortId!)) - 1, delivered);
+        var messages = Assert.IsType<ValidateResult.Invalid>(result).Messages;
+        Assert.StartsWith($"DataChannel {alert.DataChannelId} is invalid: ", messages[0]);
+        Assert.Equal("Tabular data set 5 expects 15 values, but 14 values are provided", messages[^1]);
+    }
+
+    [Theory]
+    [InlineData(false)]
+    [InlineData(true)]
+    public void Test_Alerts_First_Events_Only(bool parallel)
+    {
+        var dcPackage = LoadDataChannelList();
+        var alerts = MakeAlerts(dcPackage);
+        var data = CreateData(dcPackage, rows: 1, events: 30);
+        data.TabularData = null;
+
+        var delivered = new List<string>();
+        ValidateData Record(string kind) =>
+            (_, _, _, _) =>
+            {
+                delivered.Add(kind);
+                return new ValidateResult.Ok();
+            };
+        data.ValidateAlertsFirst(dcPackage, Record("alert"), Record("tabular"), Record("event"), parallel);
+
+        // Every event once, with no table to validate them after
+        var known = data.EventData!.DataSet!.Where(e => e.DataChannelId.ShortId != "unknown").ToList();
+        Assert.Equal(known.Count(e => alerts.Contains(e.DataChannelId.ShortId!)), delivered.Count(k => k == "alert"));
+        Assert.Equal(known.Count(e => !alerts.Contains(e.DataChannelId.ShortId!)), delivered.Count(k => k == "event"));
+        Assert.DoesNotContain("tabular", delivered);
+    }
+
+    [Theory]
+    [InlineData(false)]
+    [InlineData(true)]
+    public void Test_Alerts_First_Two_Tables(bool parallel)
+    {
+        var dcPackage = LoadDataChannelList();
+        var alerts = MakeAlerts(dcPackage);
+        var data = CreateData(dcPackage, rows: 10, events: 30);
+        data.TabularData!.Add(CreateData(dcPackage, rows: 5).TabularData![0]);
+
+        var events = new List<DateTimeOffset>();
+        data.ValidateAlertsFirst(
+            dcPackage,
+            (_, _, _, _) => new ValidateResult.Ok(),
+            (_, _, _, _) => new ValidateResult.Ok(),
+            (timeStamp, _, _, _) =>
+            {
+                events.Add(timeStamp);
+                return new ValidateResult.Ok();
+            },
+            parallel
+        );
+
+        // Events are delivered once, not once per table
+        var expected = data.EventData!
+            .DataSet!
+            .Where(e => e.DataChannelId.ShortId != "unknown" && !alerts.Contains(e.DataChannelId.ShortId!))
+            .Select(e => e.TimeStamp);
+        Assert.Equal(expected, events);
+    }
+}
@@ -67,4 +67,35 @@ public void Test_OrderedVisVersions()
         var index310 = sortedVersions.IndexOf("3-10a");
         Assert.True(index34 < index310);
     }
+
+    [Fact]
+    public void Test_VisContext()
+    {
+        var (_, vis) = GetVis();
+        var context = vis.GetContext(VisVersion.v3_4a);
+
+        Assert.Equal(VisVersion.v3_4a, context.VisVersion);
+        Assert.Same(vis.GetGmod(VisVersion.v3_4a), context.Gmod);
+        Assert.Same(vis.GetCodebooks(VisVersion.v3_4a), context.Codebooks);
+        Assert.Same(vis.GetLocations(VisVersion.v3_4a), context.Locations);
+
+        var localIds = File.ReadLines("testdata/LocalIds.txt").Where(l => l.Contains("/vis-3-4a/")).Take(500);
+        foreach (var localIdStr in localIds)
+        {
+            var expected = LocalIdBuilder.Parse(localIdStr);
+            Assert.True(LocalIdBuilder.TryParse(localIdStr, context, out var errors, out var localId), errors.ToString());
+            Assert.Equal(expected, localId);
+            Assert.Equal(expected.PrimaryItem, GmodPath.Parse(expected.PrimaryItem!.ToString(), context));
+        }
+
+        Assert.False(LocalIdBuilder.TryParse("/dnv-v2/vis-3-5a/411.1/C101.31-2/meta/qty-temperature", context, out _));
+        Assert.Throws<ArgumentException>(
+            () =>
+                new VisContext(
+                    vis.GetGmod(VisVersion.v3_4a),
+                    vis.GetCodebooks(VisVersion.v3_5a),
+                    vis.GetLocations(VisVersion.v3_4a)
+                )
+        );
+    }
 }
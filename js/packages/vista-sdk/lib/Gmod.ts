@@ -1,5 +1,6 @@
 import { GmodNode } from "./GmodNode";
 import { GmodPath } from "./GmodPath";
+import { GmodSearchIndex, GmodSearchResult } from "./internal/GmodSearchIndex";
 import { Locations } from "./Location";
 import {
     GmodTuple,
@@ -21,6 +22,7 @@ export class Gmod {
     public visVersion: VisVersion;
     private _rootNode: GmodNode;
     private _nodeMap: Map<string, GmodNode>;
+    private _searchIndex?: GmodSearchIndex;
 
     public constructor(visVersion: VisVersion, dto: GmodDto) {
         this.visVersion = visVersion;
@@ -267,6 +269,23 @@ export class Gmod {
         return TraversalHandlerResult.Continue;
     }
 
+    /**
+     * Searches nodes by code prefix, and by words of their names and
+     * definitions.
+     *
+     * Matching is case insensitive. Nodes whose code starts with the query rank
+     * first, shortest codes first. Otherwise every word of the query has to
+     * match a word of the node, exactly, as a prefix, or inside it for query
+     * words of 3 or more characters. Names weigh more than definitions. The
+     * index is built on the first search and kept for the lifetime of the Gmod.
+     */
+    public search(query: string, maxResults = 10): GmodSearchResult[] {
+        if (maxResults < 0)
+            throw new Error("Invalid maxResults: " + maxResults);
+        this._searchIndex ??= new GmodSearchIndex(this);
+        return this._searchIndex.search(query, maxResults);
+    }
+
     public *[Symbol.iterator](): Generator<GmodNode> {
         for (const [_, value] of this._nodeMap) yield value;
     }
@@ -15,6 +15,7 @@ import { GmodVersioning } from "./GmodVersioning";
 import { ILocalId, ILocalIdGeneric } from "./ILocalId";
 import { ILocalIdBuilder, ILocalIdBuilderGeneric } from "./ILocalIdBuilder";
 import { ImoNumber } from "./ImoNumber";
+import { GmodSearchResult } from "./internal/GmodSearchIndex";
 import { LocalIdParsingErrorBuilder } from "./internal/LocalIdParsingErrorBuilder";
 import { parseVisVersion } from "./internal/Parsing";
 import { LocalId } from "./LocalId";
@@ -47,6 +48,7 @@ import {
     DataChannelListDto,
     JSONExtensions,
     JSONSerializer,
+    SchemaValidationError,
     TimeSeriesDto,
 } from "./transport/json";
 import { TraversalHandlerResult } from "./types/Gmod";
@@ -69,7 +71,7 @@ import { VIS } from "./VIS";
 import { VisVersion, VisVersionExtension, VisVersions } from "./VisVersion";
 
 // Types
-export type { GmodNodeMetadata, PmodInfo, TreeNode };
+export type { GmodNodeMetadata, GmodSearchResult, PmodInfo, TreeNode };
 // VisVersion
 export { VisVersion, VisVersionExtension, VisVersions };
 // VIS
@@ -139,6 +141,7 @@ export {
     DataChannelListDto,
     JSONExtensions,
     JSONSerializer,
+    SchemaValidationError,
     ShipId,
     TimeSeries,
     TimeSeriesDto,
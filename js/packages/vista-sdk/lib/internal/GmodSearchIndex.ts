@@ -0,0 +1,268 @@
+import { GmodNode } from "../GmodNode";
+
+/** A Gmod node matching a search, higher scores rank first. */
+export interface GmodSearchResult {
+    readonly node: GmodNode;
+    readonly score: number;
+}
+
+type Posting = { node: number; weight: number };
+
+const NameWeight = 3;
+const DefinitionWeight = 1;
+
+const ExactWord = 3;
+const PrefixWord = 2;
+const InsideWord = 1;
+
+const MinTrigramLength = 3;
+
+const isLetterOrDigit = (c: string) =>
+    (c >= "0" && c <= "9") || c.toLowerCase() !== c.toUpperCase();
+
+const lowerBound = (sorted: string[], value: string) => {
+    let lo = 0;
+    let hi = sorted.length;
+    while (lo < hi) {
+        const mid = (lo + hi) >>> 1;
+        if (sorted[mid] < value) lo = mid + 1;
+        else hi = mid;
+    }
+    return lo;
+};
+
+const before = (x: GmodSearchResult, y: GmodSearchResult) => {
+    if (x.score !== y.score) return x.score > y.score;
+    if (x.node.code.length !== y.node.code.length)
+        return x.node.code.length < y.node.code.length;
+    return x.node.code < y.node.code;
+};
+
+/**
+ * Search index over the codes, names and definitions of the nodes of a Gmod.
+ *
+ * Codes are kept sorted, so the nodes with a code prefix are a contiguous range
+ * found by binary search. Names and definitions are split into lowercase words
+ * with postings to their nodes. Short query words match word prefixes from the
+ * sorted word list, longer ones are looked up through trigram postings of the
+ * words.
+ */
+export class GmodSearchIndex {
+    public static readonly CodeExact = 1000;
+    public static readonly CodePrefix = 500;
+
+    private readonly _nodes: GmodNode[];
+    private readonly _codes: string[];
+    private readonly _codeNodes: number[];
+    private readonly _words: string[];
+    private readonly _postings: Posting[][];
+    private readonly _trigrams = new Map<string, number[]>();
+
+    public constructor(nodes: Iterable<GmodNode>) {
+        this._nodes = Array.from(nodes);
+
+        const codes = this._nodes.map((node, i) => ({
+            code: node.code.toLowerCase(),
+            node: i,
+        }));
+        codes.sort((a, b) => (a.code < b.code ? -1 : a.code > b.code ? 1 : 0));
+        this._codes = codes.map((c) => c.code);
+        this._codeNodes = codes.map((c) => c.node);
+
+        const words = new Map<string, Posting[]>();
+        this._nodes.forEach((node, i) => {
+            const metadata = node.metadata;
+            GmodSearchIndex.addWords(words, i, metadata.name, NameWeight);
+            GmodSearchIndex.addWords(words, i, metadata.commonName, NameWeight);
+            GmodSearchIndex.addWords(
+                words,
+                i,
+                metadata.definition,
+                DefinitionWeight,
+            );
+            GmodSearchIndex.addWords(
+                words,
+                i,
+                metadata.commonDefinition,
+                DefinitionWeight,
+            );
+        });
+
+        this._words = Array.from(words.keys()).sort();
+        this._postings = this._words.map((w) => words.get(w)!);
+
+        this._words.forEach((word, w) => {
+            for (let i = 0; i + MinTrigramLength <= word.length; i++) {
+                const key = word.substring(i, i + MinTrigramLength);
+                let list = this._trigrams.get(key);
+                if (!list) this._trigrams.set(key, (list = []));
+                // Words are visited in order, a repeated trigram of the same
+                // word is always the last entry
+                if (list.length === 0 || list[list.length - 1] !== w)
+                    list.push(w);
+            }
+        });
+    }
+
+    public search(query: string, maxResults: number): GmodSearchResult[] {
+        const text = query.trim().toLowerCase();
+        if (text.length === 0 || maxResults === 0) return [];
+
+        const first = lowerBound(this._codes, text);
+        let end = first;
+        while (end < this._codes.length && this._codes[end].startsWith(text))
+            end++;
+
+        // Code matches always outrank word matches, there is only room for
+        // words when few codes match
+        const tokens =
+            end - first < maxResults ? GmodSearchIndex.tokenize(text) : [];
+        const scores =
+            tokens.length > 0
+                ? this.matchTokens(tokens)
+                : new Map<number, number>();
+
+        const results: GmodSearchResult[] = [];
+        const offer = (result: GmodSearchResult) => {
+            if (
+                results.length === maxResults &&
+                !before(result, results[results.length - 1])
+            )
+                return;
+            let i = results.length;
+            while (i > 0 && before(result, results[i - 1])) i--;
+            if (results.length === maxResults) results.pop();
+            results.splice(i, 0, result);
+        };
+
+        for (let i = first; i < end; i++) {
+            const node = this._codeNodes[i];
+            const code = this._codes[i];
+            let score =
+                code.length === text.length
+                    ? GmodSearchIndex.CodeExact
+                    : GmodSearchIndex.CodePrefix -
+                      Math.min(code.length - text.length, 100);
+            const textScore = scores.get(node);
+            if (textScore !== undefined) {
+                score = Math.max(score, textScore);
+                scores.delete(node);
+            }
+            offer({ node: this._nodes[node], score });
+        }
+
+        for (const [node, score] of scores)
+            offer({ node: this._nodes[node], score });
+
+        return results;
+    }
+
+    /** Scores the nodes matching every token, by the best word of each. */
+    private matchTokens(tokens: string[]): Map<number, number> {
+        let matched: Map<number, number> | undefined = undefined;
+        for (const token of tokens) {
+            const best = new Map<number, number>();
+            for (const [w, kind] of this.matchWords(token)) {
+                for (const posting of this._postings[w]) {
+                    if (matched && !matched.has(posting.node)) continue;
+                    const score = kind * posting.weight;
+                    if ((best.get(posting.node) ?? 0) < score)
+                        best.set(posting.node, score);
+                }
+            }
+            if (matched) {
+                for (const [node, score] of best)
+                    best.set(node, score + matched.get(node)!);
+            }
+            matched = best;
+            if (matched.size === 0) break;
+        }
+        return matched ?? new Map<number, number>();
+    }
+
+    /** The indexes of the words matching the token, with the kind of match. */
+    private matchWords(token: string): [number, number][] {
+        const matches: [number, number][] = [];
+
+        if (token.length < MinTrigramLength) {
+            for (
+                let w = lowerBound(this._words, token);
+                w < this._words.length;
+                w++
+            ) {
+                const word = this._words[w];
+                if (!word.startsWith(token)) break;
+                matches.push([
+                    w,
+                    word.length === token.length ? ExactWord : PrefixWord,
+                ]);
+            }
+            return matches;
+        }
+
+        // Every word containing the token is in the postings of each of its
+        // trigrams, the rarest is enough
+        let rarest: number[] | undefined = undefined;
+        for (let i = 0; i + MinTrigramLength <= token.length; i++) {
+            const words = this._trigrams.get(
+                token.substring(i, i + MinTrigramLength),
+            );
+            if (!words) return matches;
+            if (!rarest || words.length < rarest.length) rarest = words;
+        }
+
+        for (const w of rarest!) {
+            const word = this._words[w];
+            const at = word.indexOf(token);
+            if (at < 0) continue;
+            matches.push([
+                w,
+                at > 0
+                    ? InsideWord
+                    : word.length === token.length
+                      ? ExactWord
+                      : PrefixWord,
+            ]);
+        }
+        return matches;
+    }
+
+    private static addWords(
+        words: Map<string, Posting[]>,
+        node: number,
+        text: string | undefined,
+        weight: number,
+    ) {
+        if (!text) return;
+
+        for (const word of GmodSearchIndex.tokenize(text.toLowerCase())) {
+            let postings = words.get(word);
+            if (!postings) words.set(word, (postings = []));
+
+            // Nodes are added in order, a word seen again for the same node
+            // keeps its best weight
+            const last = postings[postings.length - 1];
+            if (last && last.node === node) {
+                if (last.weight < weight) last.weight = weight;
+            } else {
+                postings.push({ node, weight });
+            }
+        }
+    }
+
+    /** Splits lowercase text into words of letters and digits. */
+    public static tokenize(text: string): string[] {
+        const words: string[] = [];
+        let start = -1;
+        for (let i = 0; i <= text.length; i++) {
+            const isWord = i < text.length && isLetterOrDigit(text[i]);
+            if (isWord && start < 0) {
+                start = i;
+            } else if (!isWord && start >= 0) {
+                words.push(text.substring(start, i));
+                start = -1;
+            }
+        }
+        return words;
+    }
+}
@@ -0,0 +1,331 @@
+type Schema = { [keyword: string]: any };
+
+export type SchemaFile = { fileName: string; schema: Schema };
+
+const schemaExtension = ".schema.json";
+
+// Keywords without effect on validation
+const annotations = new Set([
+    "$schema",
+    "$id",
+    "title",
+    "description",
+    "definitions",
+]);
+const keywords = new Set([
+    "type",
+    "properties",
+    "required",
+    "additionalProperties",
+    "items",
+    "minimum",
+    "enum",
+    "format",
+]);
+
+const camelCase = (name: string) =>
+    name.charAt(0).toLowerCase() + name.slice(1);
+
+// Emits a throw, wrapped like prettier would
+const fail = (message: string, indent = "        ") => {
+    const line = `${indent}throw new SchemaValidationError(${message});`;
+    if (line.length <= 80) return [line];
+    return [
+        `${indent}throw new SchemaValidationError(`,
+        `${indent}    ${message},`,
+        `${indent});`,
+    ];
+};
+
+const template = (message: string) =>
+    message.includes("${") ? "`" + message + "`" : JSON.stringify(message);
+
+/**
+ * Compiles one schema to functions, numbered in the order they're reached.
+ * Mirrors the C# SchemaGenerator, with references resolved at build time.
+ */
+class SchemaCompiler {
+    private readonly nodes: string[][] = [];
+    private readonly definitions = new Map<string, string>();
+    public readonly tables: string[] = [];
+
+    public constructor(
+        private readonly root: Schema,
+        private readonly prefix: string,
+        private readonly fileName: string,
+    ) {}
+
+    public compile() {
+        this.compileNode(this.root, "#");
+        return this.nodes.map((lines) => lines.join("\n"));
+    }
+
+    private compileNode(schema: Schema, pointer: string): string {
+        if (schema.$ref !== undefined) return this.define(schema.$ref);
+        return this.add(schema, pointer, this.prefix + this.nodes.length);
+    }
+
+    private define(reference: string) {
+        const prefix = "#/definitions/";
+        const defined = this.definitions.get(reference);
+        if (defined !== undefined) return defined;
+        const name = reference.slice(prefix.length);
+        const definitions = this.root.definitions ?? {};
+        if (!reference.startsWith(prefix) || definitions[name] === undefined)
+            throw this.unsupported(reference, "$ref");
+
+        // Reserved before compiling, so recursive references resolve to it
+        const fn = this.prefix + this.nodes.length;
+        this.definitions.set(reference, fn);
+        return this.add(definitions[name], reference, fn);
+    }
+
+    private add(schema: Schema, pointer: string, fn: string) {
+        const lines = [
+            `function ${fn}(value: unknown): void {`,
+            `    // Compiled from ${pointer}`,
+        ];
+        this.nodes.push(lines);
+        lines.push(...this.body(schema, pointer, fn), "}");
+        return fn;
+    }
+
+    private body(schema: Schema, pointer: string, fn: string): string[] {
+        for (const keyword of Object.keys(schema)) {
+            if (!keywords.has(keyword) && !annotations.has(keyword))
+                throw this.unsupported(pointer, keyword);
+        }
+
+        switch (schema.type) {
+            case undefined:
+                return [];
+            case "object":
+                return this.object(schema, pointer, fn);
+            case "array":
+                return this.array(schema, pointer);
+            case "string":
+                return this.string(schema);
+            case "number":
+            case "integer":
+                return this.number(schema);
+            default:
+                throw this.unsupported(pointer, `type ${schema.type}`);
+        }
+    }
+
+    private array(schema: Schema, pointer: string) {
+        const lines = [
+            "    if (!Array.isArray(value)) {",
+            ...fail(template("expected an array, found ${describe(value)}")),
+            "    }",
+        ];
+        if (schema.items === undefined) return lines;
+        const items = this.compileNode(schema.items, pointer + "/items");
+        return [
+            ...lines,
+            "    for (let i = 0; i < value.length; i++) {",
+            "        try {",
+            `            ${items}(value[i]);`,
+            "        } catch (e) {",
+            "            if (e instanceof SchemaValidationError) e.prependIndex(i);",
+            "            throw e;",
+            "        }",
+            "    }",
+        ];
+    }
+
+    private string(schema: Schema) {
+        const dateTime = schema.format === "date-time";
+        const expected = dateTime ? "a date-time string" : "a string";
+        const lines = [
+            '    if (typeof value !== "string") {',
+            ...fail(
+                template(`expected ${expected}, found \${describe(value)}`),
+            ),
+            "    }",
+        ];
+        if (dateTime) {
+            return [
+                ...lines,
+                "    if (!isDateTime(value)) {",
+                ...fail(template("'${value}' is not an ISO 8601 date-time")),
+                "    }",
+            ];
+        }
+        if (schema.enum === undefined) return lines;
+        const values: string[] = schema.enum;
+        const condition = values
+            .map((v) => `value !== ${JSON.stringify(v)}`)
+            .join(" && ");
+        return [
+            ...lines,
+            `    if (${condition}) {`,
+            ...fail(
+                template(`'\${value}' is not one of ${values.join(", ")}`),
+            ),
+            "    }",
+        ];
+    }
+
+    private number(schema: Schema) {
+        const expected = schema.type === "integer" ? "an integer" : "a number";
+        const lines = [
+            '    if (typeof value !== "number") {',
+            ...fail(
+                template(`expected ${expected}, found \${describe(value)}`),
+            ),
+            "    }",
+        ];
+        if (schema.type === "integer") {
+            lines.push(
+                "    if (!Number.isInteger(value)) {",
+                ...fail(template("${value} is not an integer")),
+                "    }",
+            );
+        }
+        if (schema.minimum !== undefined) {
+            lines.push(
+                `    if (value < ${schema.minimum}) {`,
+                ...fail(template(`\${value} is less than ${schema.minimum}`)),
+                "    }",
+            );
+        }
+        return lines;
+    }
+
+    private object(schema: Schema, pointer: string, fn: string) {
+        const required: string[] = schema.required ?? [];
+        const additional = schema.additionalProperties ?? true;
+        if (typeof additional === "object")
+            throw this.unsupported(pointer, "additionalProperties schema");
+
+        const properties = Object.entries<Schema>(schema.properties ?? {}).map(
+            ([name, property]) => [
+                name,
+                this.compileNode(property, `${pointer}/properties/${name}`),
+            ],
+        );
+        const missing = required.filter(
+            (name) => !properties.some(([p]) => p === name),
+        );
+        if (missing.length > 0)
+            throw this.unsupported(
+                pointer,
+                `required property without a schema ${missing[0]}`,
+            );
+
+        const lines = [
+            "    if (!isObject(value)) {",
+            ...fail(template("expected an object, found ${describe(value)}")),
+            "    }",
+        ];
+        if (properties.length > 0) {
+            // Defined after all functions, as the table references them
+            this.tables.push(
+                [
+                    `const ${fn}Properties = new Map<string, Validate>([`,
+                    ...properties.map(([n, f]) => `    ["${n}", ${f}],`),
+                    "]);",
+                ].join("\n"),
+            );
+            lines.push(
+                "    for (const name of Object.keys(value)) {",
+                `        const validate = ${fn}Properties.get(name);`,
+                "        if (validate === undefined) {",
+                ...(additional === false
+                    ? fail(
+                          template("property '${name}' is not allowed"),
+                          " ".repeat(12),
+                      )
+                    : ["            continue;"]),
+                "        }",
+                "        try {",
+                "            validate(value[name]);",
+                "        } catch (e) {",
+                "            if (e instanceof SchemaValidationError) e.prependProperty(name);",
+                "            throw e;",
+                "        }",
+                "    }",
+            );
+        } else if (additional === false) {
+            lines.push(
+                "    for (const name of Object.keys(value)) {",
+                ...fail(template("property '${name}' is not allowed")),
+                "    }",
+            );
+        }
+        for (const name of required) {
+            lines.push(
+                `    if (!("${name}" in value)) {`,
+                ...fail(template(`required property '${name}' is missing`)),
+                "    }",
+            );
+        }
+        return lines;
+    }
+
+    private unsupported(pointer: string, keyword: string) {
+        return new Error(
+            `Unsupported JSON schema keyword '${keyword}' at ${pointer} in ${this.fileName}`,
+        );
+    }
+}
+
+export class SchemaGenerator {
+    /**
+     * Compiles the ISO19848 JSON schemas to a validator per package, for
+     * JSONSerializer. Every schema node becomes a function, so nothing is
+     * interpreted when a package is validated.
+     */
+    public static assembleSchemaValidatorsFile(files: SchemaFile[]) {
+        const sections: string[] = [];
+        const tables: string[] = [];
+        for (const { fileName, schema } of [...files].sort((a, b) =>
+            a.fileName < b.fileName ? -1 : 1,
+        )) {
+            if (!fileName.endsWith(schemaExtension))
+                throw new Error(`Not a JSON schema: ${fileName}`);
+            const name = fileName.slice(0, -schemaExtension.length);
+            const compiler = new SchemaCompiler(
+                schema,
+                camelCase(name),
+                fileName,
+            );
+            const functions = compiler.compile();
+            tables.push(...compiler.tables);
+            sections.push(
+                [
+                    `/** Validates a package from JSON.parse against ${fileName} */`,
+                    `export function validate${name}(value: unknown) {`,
+                    "    try {",
+                    `        ${camelCase(name)}0(value);`,
+                    "    } catch (e) {",
+                    "        if (e instanceof SchemaValidationError) {",
+                    `            e.complete(${JSON.stringify(schema.title ?? name)});`,
+                    "        }",
+                    "        throw e;",
+                    "    }",
+                    "}",
+                ].join("\n"),
+                ...functions,
+            );
+        }
+
+        return `// AUTO-GENERATED FILE - DO NOT EDIT MANUALLY
+// Generated from the JSON schemas in schemas/json/ by prebuild.ts
+
+import {
+    SchemaValidationError,
+    describe,
+    isDateTime,
+    isObject,
+} from "./SchemaValidationError";
+
+type Validate = (value: unknown) => void;
+
+${sections.join("\n\n")}
+
+${tables.join("\n\n")}
+`;
+    }
+}
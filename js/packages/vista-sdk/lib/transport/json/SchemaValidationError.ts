@@ -0,0 +1,82 @@
+const dateTimePattern =
+    /^(\d{4})-(\d{2})-(\d{2})T(\d{2}):(\d{2}):(\d{2})(?:\.\d+)?(?:Z|[+-](\d{2}):(\d{2}))$/;
+
+/**
+ * Thrown when a package doesn't conform to its ISO19848 JSON schema.
+ * The path is built while the error propagates out of the generated
+ * validators in SchemaValidators.ts, so conforming packages don't pay for it.
+ */
+export class SchemaValidationError extends Error {
+    public title = "";
+    private readonly segments: string[] = [];
+
+    public constructor(public readonly reason: string) {
+        super(reason);
+        this.name = "SchemaValidationError";
+    }
+
+    /** The JSON path of the offending value, like $.Package.Header.ShipID */
+    public get path() {
+        return "$" + this.segments.slice().reverse().join("");
+    }
+
+    public prependProperty(name: string) {
+        this.segments.push("." + name);
+    }
+
+    public prependIndex(index: number) {
+        this.segments.push(`[${index}]`);
+    }
+
+    public complete(title: string) {
+        this.title = title;
+        this.message = `${title}: ${this.reason} at ${this.path}`;
+    }
+}
+
+export function isObject(value: unknown): value is Record<string, unknown> {
+    return typeof value === "object" && value !== null && !Array.isArray(value);
+}
+
+export function describe(value: unknown) {
+    if (Array.isArray(value)) return "an array";
+    switch (typeof value) {
+        case "object":
+            return value === null ? "null" : "an object";
+        case "string":
+            return "a string";
+        case "boolean":
+            return "a boolean";
+        case "number":
+            return "a number";
+        default:
+            return "null";
+    }
+}
+
+/**
+ * Checks an ISO 8601 date-time as the deserializers accept it, with seconds
+ * and an offset (Z or +HH:MM), like the C# DateTimeOffset converter.
+ */
+export function isDateTime(value: string) {
+    const match = dateTimePattern.exec(value);
+    if (!match) return false;
+    const [year, month, day, hour, minute, second] = match
+        .slice(1, 7)
+        .map(Number);
+    const date = new Date(0);
+    date.setUTCFullYear(year, month - 1, day);
+    if (
+        year < 1 ||
+        date.getUTCMonth() !== month - 1 ||
+        date.getUTCDate() !== day ||
+        hour > 23 ||
+        minute > 59 ||
+        second > 59
+    )
+        return false;
+    if (match[7] === undefined) return true;
+    const offsetHours = Number(match[7]);
+    const offsetMinutes = Number(match[8]);
+    return offsetMinutes < 60 && offsetHours * 60 + offsetMinutes <= 14 * 60;
+}
@@ -0,0 +1,1660 @@
+// AUTO-GENERATED FILE - DO NOT EDIT MANUALLY
+// Generated from the JSON schemas in schemas/json/ by prebuild.ts
+
+import {
+    SchemaValidationError,
+    describe,
+    isDateTime,
+    isObject,
+} from "./SchemaValidationError";
+
+type Validate = (value: unknown) => void;
+
+/** Validates a package from JSON.parse against DataChannelList.schema.json */
+export function validateDataChannelList(value: unknown) {
+    try {
+        dataChannelList0(value);
+    } catch (e) {
+        if (e instanceof SchemaValidationError) {
+            e.complete("DataChannelListPackage");
+        }
+        throw e;
+    }
+}
+
+function dataChannelList0(value: unknown): void {
+    // Compiled from #
+    if (!isObject(value)) {
+        throw new SchemaValidationError(
+            `expected an object, found ${describe(value)}`,
+        );
+    }
+    for (const name of Object.keys(value)) {
+        const validate = dataChannelList0Properties.get(name);
+        if (validate === undefined) {
+            throw new SchemaValidationError(
+                `property '${name}' is not allowed`,
+            );
+        }
+        try {
+            validate(value[name]);
+        } catch (e) {
+            if (e instanceof SchemaValidationError) e.prependProperty(name);
+            throw e;
+        }
+    }
+    if (!("Package" in value)) {
+        throw new SchemaValidationError(
+            "required property 'Package' is missing",
+        );
+    }
+}
+
+function dataChannelList1(value: unknown): void {
+    // Compiled from #/definitions/Package
+    if (!isObject(value)) {
+        throw new SchemaValidationError(
+            `expected an object, found ${describe(value)}`,
+        );
+    }
+    for (const name of Object.keys(value)) {
+        const validate = dataChannelList1Properties.get(name);
+        if (validate === undefined) {
+            throw new SchemaValidationError(
+                `property '${name}' is not allowed`,
+            );
+        }
+        try {
+            validate(value[name]);
+        } catch (e) {
+            if (e instanceof SchemaValidationError) e.prependProperty(name);
+            throw e;
+        }
+    }
+    if (!("Header" in value)) {
+        throw new SchemaValidationError(
+            "required property 'Header' is missing",
+        );
+    }
+    if (!("DataChannelList" in value)) {
+        throw new SchemaValidationError(
+            "required property 'DataChannelList' is missing",
+        );
+    }
+}
+
+function dataChannelList2(value: unknown): void {
+    // Compiled from #/definitions/Header
+    if (!isObject(value)) {
+        throw new SchemaValidationError(
+            `expected an object, found ${describe(value)}`,
+        );
+    }
+    for (const name of Object.keys(value)) {
+        const validate = dataChannelList2Properties.get(name);
+        if (validate === undefined) {
+            continue;
+        }
+        try {
+            validate(value[name]);
+        } catch (e) {
+            if (e instanceof SchemaValidationError) e.prependProperty(name);
+            throw e;
+        }
+    }
+    if (!("ShipID" in value)) {
+        throw new SchemaValidationError(
+            "required property 'ShipID' is missing",
+        );
+    }
+    if (!("DataChannelListID" in value)) {
+        throw new SchemaValidationError(
+            "required property 'DataChannelListID' is missing",
+        );
+    }
+}
+
+function dataChannelList3(value: unknown): void {
+    // Compiled from #/definitions/Header/properties/ShipID
+    if (typeof value !== "string") {
+        throw new SchemaValidationError(
+            `expected a string, found ${describe(value)}`,
+        );
+    }
+}
+
+function dataChannelList4(value: unknown): void {
+    // Compiled from #/definitions/ConfigurationReference
+    if (!isObject(value)) {
+        throw new SchemaValidationError(
+            `expected an object, found ${describe(value)}`,
+        );
+    }
+    for (const name of Object.keys(value)) {
+        const validate = dataChannelList4Properties.get(name);
+        if (validate === undefined) {
+            throw new SchemaValidationError(
+                `property '${name}' is not allowed`,
+            );
+        }
+        try {
+            validate(value[name]);
+        } catch (e) {
+            if (e instanceof SchemaValidationError) e.prependProperty(name);
+            throw e;
+        }
+    }
+    if (!("ID" in value)) {
+        throw new SchemaValidationError("required property 'ID' is missing");
+    }
+    if (!("TimeStamp" in value)) {
+        throw new SchemaValidationError(
+            "required property 'TimeStamp' is missing",
+        );
+    }
+}
+
+function dataChannelList5(value: unknown): void {
+    // Compiled from #/definitions/ConfigurationReference/properties/ID
+    if (typeof value !== "string") {
+        throw new SchemaValidationError(
+            `expected a string, found ${describe(value)}`,
+        );
+    }
+}
+
+function dataChannelList6(value: unknown): void {
+    // Compiled from #/definitions/ConfigurationReference/properties/Version
+    if (typeof value !== "string") {
+        throw new SchemaValidationError(
+            `expected a string, found ${describe(value)}`,
+        );
+    }
+}
+
+function dataChannelList7(value: unknown): void {
+    // Compiled from #/definitions/ConfigurationReference/properties/TimeStamp
+    if (typeof value !== "string") {
+        throw new SchemaValidationError(
+            `expected a date-time string, found ${describe(value)}`,
+        );
+    }
+    if (!isDateTime(value)) {
+        throw new SchemaValidationError(
+            `'${value}' is not an ISO 8601 date-time`,
+        );
+    }
+}
+
+function dataChannelList8(value: unknown): void {
+    // Compiled from #/definitions/VersionInformation
+    if (!isObject(value)) {
+        throw new SchemaValidationError(
+            `expected an object, found ${describe(value)}`,
+        );
+    }
+    for (const name of Object.keys(value)) {
+        const validate = dataChannelList8Properties.get(name);
+        if (validate === undefined) {
+            throw new SchemaValidationError(
+                `property '${name}' is not allowed`,
+            );
+        }
+        try {
+            validate(value[name]);
+        } catch (e) {
+            if (e instanceof SchemaValidationError) e.prependProperty(name);
+            throw e;
+        }
+    }
+    if (!("NamingRule" in value)) {
+        throw new SchemaValidationError(
+            "required property 'NamingRule' is missing",
+        );
+    }
+    if (!("NamingSchemeVersion" in value)) {
+        throw new SchemaValidationError(
+            "required property 'NamingSchemeVersion' is missing",
+        );
+    }
+}
+
+function dataChannelList9(value: unknown): void {
+    // Compiled from #/definitions/VersionInformation/properties/NamingRule
+    if (typeof value !== "string") {
+        throw new SchemaValidationError(
+            `expected a string, found ${describe(value)}`,
+        );
+    }
+}
+
+function dataChannelList10(value: unknown): void {
+    // Compiled from #/definitions/VersionInformation/properties/NamingSchemeVersion
+    if (typeof value !== "string") {
+        throw new SchemaValidationError(
+            `expected a string, found ${describe(value)}`,
+        );
+    }
+}
+
+function dataChannelList11(value: unknown): void {
+    // Compiled from #/definitions/VersionInformation/properties/ReferenceURL
+    if (typeof value !== "string") {
+        throw new SchemaValidationError(
+            `expected a string, found ${describe(value)}`,
+        );
+    }
+}
+
+function dataChannelList12(value: unknown): void {
+    // Compiled from #/definitions/Header/properties/Author
+    if (typeof value !== "string") {
+        throw new SchemaValidationError(
+            `expected a string, found ${describe(value)}`,
+        );
+    }
+}
+
+function dataChannelList13(value: unknown): void {
+    // Compiled from #/definitions/Header/properties/DateCreated
+    if (typeof value !== "string") {
+        throw new SchemaValidationError(
+            `expected a date-time string, found ${describe(value)}`,
+        );
+    }
+    if (!isDateTime(value)) {
+        throw new SchemaValidationError(
+            `'${value}' is not an ISO 8601 date-time`,
+        );
+    }
+}
+
+function dataChannelList14(value: unknown): void {
+    // Compiled from #/definitions/DataChannelList
+    if (!isObject(value)) {
+        throw new SchemaValidationError(
+            `expected an object, found ${describe(value)}`,
+        );
+    }
+    for (const name of Object.keys(value)) {
+        const validate = dataChannelList14Properties.get(name);
+        if (validate === undefined) {
+            throw new SchemaValidationError(
+                `property '${name}' is not allowed`,
+            );
+        }
+        try {
+            validate(value[name]);
+        } catch (e) {
+            if (e instanceof SchemaValidationError) e.prependProperty(name);
+            throw e;
+        }
+    }
+    if (!("DataChannel" in value)) {
+        throw new SchemaValidationError(
+            "required property 'DataChannel' is missing",
+        );
+    }
+}
+
+function dataChannelList15(value: unknown): void {
+    // Compiled from #/definitions/DataChannelList/properties/DataChannel
+    if (!Array.isArray(value)) {
+        throw new SchemaValidationError(
+            `expected an array, found ${describe(value)}`,
+        );
+    }
+    for (let i = 0; i < value.length; i++) {
+        try {
+            dataChannelList16(value[i]);
+        } catch (e) {
+            if (e instanceof SchemaValidationError) e.prependIndex(i);
+            throw e;
+        }
+    }
+}
+
+function dataChannelList16(value: unknown): void {
+    // Compiled from #/definitions/DataChannel
+    if (!isObject(value)) {
+        throw new SchemaValidationError(
+            `expected an object, found ${describe(value)}`,
+        );
+    }
+    for (const name of Object.keys(value)) {
+        const validate = dataChannelList16Properties.get(name);
+        if (validate === undefined) {
+            throw new SchemaValidationError(
+                `property '${name}' is not allowed`,
+            );
+        }
+        try {
+            validate(value[name]);
+        } catch (e) {
+            if (e instanceof SchemaValidationError) e.prependProperty(name);
+            throw e;
+        }
+    }
+    if (!("DataChannelID" in value)) {
+        throw new SchemaValidationError(
+            "required property 'DataChannelID' is missing",
+        );
+    }
+    if (!("Property" in value)) {
+        throw new SchemaValidationError(
+            "required property 'Property' is missing",
+        );
+    }
+}
+
+function dataChannelList17(value: unknown): void {
+    // Compiled from #/definitions/DataChannelID
+    if (!isObject(value)) {
+        throw new SchemaValidationError(
+            `expected an object, found ${describe(value)}`,
+        );
+    }
+    for (const name of Object.keys(value)) {
+        const validate = dataChannelList17Properties.get(name);
+        if (validate === undefined) {
+            throw new SchemaValidationError(
+                `property '${name}' is not allowed`,
+            );
+        }
+        try {
+            validate(value[name]);
+        } catch (e) {
+            if (e instanceof SchemaValidationError) e.prependProperty(name);
+            throw e;
+        }
+    }
+    if (!("LocalID" in value)) {
+        throw new SchemaValidationError(
+            "required property 'LocalID' is missing",
+        );
+    }
+}
+
+function dataChannelList18(value: unknown): void {
+    // Compiled from #/definitions/DataChannelID/properties/LocalID
+    if (typeof value !== "string") {
+        throw new SchemaValidationError(
+            `expected a string, found ${describe(value)}`,
+        );
+    }
+}
+
+function dataChannelList19(value: unknown): void {
+    // Compiled from #/definitions/DataChannelID/properties/ShortID
+    if (typeof value !== "string") {
+        throw new SchemaValidationError(
+            `expected a string, found ${describe(value)}`,
+        );
+    }
+}
+
+function dataChannelList20(value: unknown): void {
+    // Compiled from #/definitions/NameObject
+    if (!isObject(value)) {
+        throw new SchemaValidationError(
+            `expected an object, found ${describe(value)}`,
+        );
+    }
+    for (const name of Object.keys(value)) {
+        const validate = dataChannelList20Properties.get(name);
+        if (validate === undefined) {
+            continue;
+        }
+        try {
+            validate(value[name]);
+        } catch (e) {
+            if (e instanceof SchemaValidationError) e.prependProperty(name);
+            throw e;
+        }
+    }
+    if (!("NamingRule" in value)) {
+        throw new SchemaValidationError(
+            "required property 'NamingRule' is missing",
+        );
+    }
+}
+
+function dataChannelList21(value: unknown): void {
+    // Compiled from #/definitions/NameObject/properties/NamingRule
+    if (typeof value !== "string") {
+        throw new SchemaValidationError(
+            `expected a string, found ${describe(value)}`,
+        );
+    }
+}
+
+function dataChannelList22(value: unknown): void {
+    // Compiled from #/definitions/Property
+    if (!isObject(value)) {
+        throw new SchemaValidationError(
+            `expected an object, found ${describe(value)}`,
+        );
+    }
+    for (const name of Object.keys(value)) {
+        const validate = dataChannelList22Properties.get(name);
+        if (validate === undefined) {
+            continue;
+        }
+        try {
+            validate(value[name]);
+        } catch (e) {
+            if (e instanceof SchemaValidationError) e.prependProperty(name);
+            throw e;
+        }
+    }
+    if (!("DataChannelType" in value)) {
+        throw new SchemaValidationError(
+            "required property 'DataChannelType' is missing",
+        );
+    }
+    if (!("Format" in value)) {
+        throw new SchemaValidationError(
+            "required property 'Format' is missing",
+        );
+    }
+}
+
+function dataChannelList23(value: unknown): void {
+    // Compiled from #/definitions/DataChannelType
+    if (!isObject(value)) {
+        throw new SchemaValidationError(
+            `expected an object, found ${describe(value)}`,
+        );
+    }
+    for (const name of Object.keys(value)) {
+        const validate = dataChannelList23Properties.get(name);
+        if (validate === undefined) {
+            throw new SchemaValidationError(
+                `property '${name}' is not allowed`,
+            );
+        }
+        try {
+            validate(value[name]);
+        } catch (e) {
+            if (e instanceof SchemaValidationError) e.prependProperty(name);
+            throw e;
+        }
+    }
+    if (!("Type" in value)) {
+        throw new SchemaValidationError("required property 'Type' is missing");
+    }
+}
+
+function dataChannelList24(value: unknown): void {
+    // Compiled from #/definitions/DataChannelType/properties/Type
+    if (typeof value !== "string") {
+        throw new SchemaValidationError(
+            `expected a string, found ${describe(value)}`,
+        );
+    }
+}
+
+function dataChannelList25(value: unknown): void {
+    // Compiled from #/definitions/DataChannelType/properties/UpdateCycle
+    if (typeof value !== "number") {
+        throw new SchemaValidationError(
+            `expected a number, found ${describe(value)}`,
+        );
+    }
+}
+
+function dataChannelList26(value: unknown): void {
+    // Compiled from #/definitions/DataChannelType/properties/CalculationPeriod
+    if (typeof value !== "number") {
+        throw new SchemaValidationError(
+            `expected a number, found ${describe(value)}`,
+        );
+    }
+}
+
+function dataChannelList27(value: unknown): void {
+    // Compiled from #/definitions/Format
+    if (!isObject(value)) {
+        throw new SchemaValidationError(
+            `expected an object, found ${describe(value)}`,
+        );
+    }
+    for (const name of Object.keys(value)) {
+        const validate = dataChannelList27Properties.get(name);
+        if (validate === undefined) {
+            throw new SchemaValidationError(
+                `property '${name}' is not allowed`,
+            );
+        }
+        try {
+            validate(value[name]);
+        } catch (e) {
+            if (e instanceof SchemaValidationError) e.prependProperty(name);
+            throw e;
+        }
+    }
+    if (!("Type" in value)) {
+        throw new SchemaValidationError("required property 'Type' is missing");
+    }
+}
+
+function dataChannelList28(value: unknown): void {
+    // Compiled from #/definitions/Format/properties/Type
+    if (typeof value !== "string") {
+        throw new SchemaValidationError(
+            `expected a string, found ${describe(value)}`,
+        );
+    }
+}
+
+function dataChannelList29(value: unknown): void {
+    // Compiled from #/definitions/Restriction
+    if (!isObject(value)) {
+        throw new SchemaValidationError(
+            `expected an object, found ${describe(value)}`,
+        );
+    }
+    for (const name of Object.keys(value)) {
+        const validate = dataChannelList29Properties.get(name);
+        if (validate === undefined) {
+            throw new SchemaValidationError(
+                `property '${name}' is not allowed`,
+            );
+        }
+        try {
+            validate(value[name]);
+        } catch (e) {
+            if (e instanceof SchemaValidationError) e.prependProperty(name);
+            throw e;
+        }
+    }
+}
+
+function dataChannelList30(value: unknown): void {
+    // Compiled from #/definitions/Restriction/properties/Enumeration
+    if (!Array.isArray(value)) {
+        throw new SchemaValidationError(
+            `expected an array, found ${describe(value)}`,
+        );
+    }
+    for (let i = 0; i < value.length; i++) {
+        try {
+            dataChannelList31(value[i]);
+        } catch (e) {
+            if (e instanceof SchemaValidationError) e.prependIndex(i);
+            throw e;
+        }
+    }
+}
+
+function dataChannelList31(value: unknown): void {
+    // Compiled from #/definitions/Restriction/properties/Enumeration/items
+    if (typeof value !== "string") {
+        throw new SchemaValidationError(
+            `expected a string, found ${describe(value)}`,
+        );
+    }
+}
+
+function dataChannelList32(value: unknown): void {
+    // Compiled from #/definitions/Restriction/properties/FractionDigits
+    if (typeof value !== "number") {
+        throw new SchemaValidationError(
+            `expected an integer, found ${describe(value)}`,
+        );
+    }
+    if (!Number.isInteger(value)) {
+        throw new SchemaValidationError(`${value} is not an integer`);
+    }
+    if (value < 0) {
+        throw new SchemaValidationError(`${value} is less than 0`);
+    }
+}
+
+function dataChannelList33(value: unknown): void {
+    // Compiled from #/definitions/Restriction/properties/Length
+    if (typeof value !== "number") {
+        throw new SchemaValidationError(
+            `expected an integer, found ${describe(value)}`,
+        );
+    }
+    if (!Number.isInteger(value)) {
+        throw new SchemaValidationError(`${value} is not an integer`);
+    }
+    if (value < 0) {
+        throw new SchemaValidationError(`${value} is less than 0`);
+    }
+}
+
+function dataChannelList34(value: unknown): void {
+    // Compiled from #/definitions/Restriction/properties/MaxExclusive
+    if (typeof value !== "number") {
+        throw new SchemaValidationError(
+            `expected a number, found ${describe(value)}`,
+        );
+    }
+}
+
+function dataChannelList35(value: unknown): void {
+    // Compiled from #/definitions/Restriction/properties/MaxInclusive
+    if (typeof value !== "number") {
+        throw new SchemaValidationError(
+            `expected a number, found ${describe(value)}`,
+        );
+    }
+}
+
+function dataChannelList36(value: unknown): void {
+    // Compiled from #/definitions/Restriction/properties/MaxLength
+    if (typeof value !== "number") {
+        throw new SchemaValidationError(
+            `expected an integer, found ${describe(value)}`,
+        );
+    }
+    if (!Number.isInteger(value)) {
+        throw new SchemaValidationError(`${value} is not an integer`);
+    }
+    if (value < 0) {
+        throw new SchemaValidationError(`${value} is less than 0`);
+    }
+}
+
+function dataChannelList37(value: unknown): void {
+    // Compiled from #/definitions/Restriction/properties/MinExclusive
+    if (typeof value !== "number") {
+        throw new SchemaValidationError(
+            `expected a number, found ${describe(value)}`,
+        );
+    }
+}
+
+function dataChannelList38(value: unknown): void {
+    // Compiled from #/definitions/Restriction/properties/MinInclusive
+    if (typeof value !== "number") {
+        throw new SchemaValidationError(
+            `expected a number, found ${describe(value)}`,
+        );
+    }
+}
+
+function dataChannelList39(value: unknown): void {
+    // Compiled from #/definitions/Restriction/properties/MinLength
+    if (typeof value !== "number") {
+        throw new SchemaValidationError(
+            `expected an integer, found ${describe(value)}`,
+        );
+    }
+    if (!Number.isInteger(value)) {
+        throw new SchemaValidationError(`${value} is not an integer`);
+    }
+    if (value < 0) {
+        throw new SchemaValidationError(`${value} is less than 0`);
+    }
+}
+
+function dataChannelList40(value: unknown): void {
+    // Compiled from #/definitions/Restriction/properties/Pattern
+    if (typeof value !== "string") {
+        throw new SchemaValidationError(
+            `expected a string, found ${describe(value)}`,
+        );
+    }
+}
+
+function dataChannelList41(value: unknown): void {
+    // Compiled from #/definitions/Restriction/properties/TotalDigits
+    if (typeof value !== "number") {
+        throw new SchemaValidationError(
+            `expected an integer, found ${describe(value)}`,
+        );
+    }
+    if (!Number.isInteger(value)) {
+        throw new SchemaValidationError(`${value} is not an integer`);
+    }
+    if (value < 1) {
+        throw new SchemaValidationError(`${value} is less than 1`);
+    }
+}
+
+function dataChannelList42(value: unknown): void {
+    // Compiled from #/definitions/Restriction/properties/WhiteSpace
+    if (typeof value !== "string") {
+        throw new SchemaValidationError(
+            `expected a string, found ${describe(value)}`,
+        );
+    }
+    if (value !== "Preserve" && value !== "Replace" && value !== "Collapse") {
+        throw new SchemaValidationError(
+            `'${value}' is not one of Preserve, Replace, Collapse`,
+        );
+    }
+}
+
+function dataChannelList43(value: unknown): void {
+    // Compiled from #/definitions/Range
+    if (!isObject(value)) {
+        throw new SchemaValidationError(
+            `expected an object, found ${describe(value)}`,
+        );
+    }
+    for (const name of Object.keys(value)) {
+        const validate = dataChannelList43Properties.get(name);
+        if (validate === undefined) {
+            throw new SchemaValidationError(
+                `property '${name}' is not allowed`,
+            );
+        }
+        try {
+            validate(value[name]);
+        } catch (e) {
+            if (e instanceof SchemaValidationError) e.prependProperty(name);
+            throw e;
+        }
+    }
+    if (!("High" in value)) {
+        throw new SchemaValidationError("required property 'High' is missing");
+    }
+    if (!("Low" in value)) {
+        throw new SchemaValidationError("required property 'Low' is missing");
+    }
+}
+
+function dataChannelList44(value: unknown): void {
+    // Compiled from #/definitions/Range/properties/High
+    if (typeof value !== "number") {
+        throw new SchemaValidationError(
+            `expected a number, found ${describe(value)}`,
+        );
+    }
+}
+
+function dataChannelList45(value: unknown): void {
+    // Compiled from #/definitions/Range/properties/Low
+    if (typeof value !== "number") {
+        throw new SchemaValidationError(
+            `expected a number, found ${describe(value)}`,
+        );
+    }
+}
+
+function dataChannelList46(value: unknown): void {
+    // Compiled from #/definitions/Unit
+    if (!isObject(value)) {
+        throw new SchemaValidationError(
+            `expected an object, found ${describe(value)}`,
+        );
+    }
+    for (const name of Object.keys(value)) {
+        const validate = dataChannelList46Properties.get(name);
+        if (validate === undefined) {
+            continue;
+        }
+        try {
+            validate(value[name]);
+        } catch (e) {
+            if (e instanceof SchemaValidationError) e.prependProperty(name);
+            throw e;
+        }
+    }
+    if (!("UnitSymbol" in value)) {
+        throw new SchemaValidationError(
+            "required property 'UnitSymbol' is missing",
+        );
+    }
+}
+
+function dataChannelList47(value: unknown): void {
+    // Compiled from #/definitions/Unit/properties/UnitSymbol
+    if (typeof value !== "string") {
+        throw new SchemaValidationError(
+            `expected a string, found ${describe(value)}`,
+        );
+    }
+}
+
+function dataChannelList48(value: unknown): void {
+    // Compiled from #/definitions/Unit/properties/QuantityName
+    if (typeof value !== "string") {
+        throw new SchemaValidationError(
+            `expected a string, found ${describe(value)}`,
+        );
+    }
+}
+
+function dataChannelList49(value: unknown): void {
+    // Compiled from #/definitions/Property/properties/QualityCoding
+    if (typeof value !== "string") {
+        throw new SchemaValidationError(
+            `expected a string, found ${describe(value)}`,
+        );
+    }
+}
+
+function dataChannelList50(value: unknown): void {
+    // Compiled from #/definitions/Property/properties/AlertPriority
+    if (typeof value !== "string") {
+        throw new SchemaValidationError(
+            `expected a string, found ${describe(value)}`,
+        );
+    }
+}
+
+function dataChannelList51(value: unknown): void {
+    // Compiled from #/definitions/Property/properties/Name
+    if (typeof value !== "string") {
+        throw new SchemaValidationError(
+            `expected a string, found ${describe(value)}`,
+        );
+    }
+}
+
+function dataChannelList52(value: unknown): void {
+    // Compiled from #/definitions/Property/properties/Remarks
+    if (typeof value !== "string") {
+        throw new SchemaValidationError(
+            `expected a string, found ${describe(value)}`,
+        );
+    }
+}
+
+/** Validates a package from JSON.parse against TimeSeriesData.schema.json */
+export function validateTimeSeriesData(value: unknown) {
+    try {
+        timeSeriesData0(value);
+    } catch (e) {
+        if (e instanceof SchemaValidationError) {
+            e.complete("TimeSeriesDataPackage");
+        }
+        throw e;
+    }
+}
+
+function timeSeriesData0(value: unknown): void {
+    // Compiled from #
+    if (!isObject(value)) {
+        throw new SchemaValidationError(
+            `expected an object, found ${describe(value)}`,
+        );
+    }
+    for (const name of Object.keys(value)) {
+        const validate = timeSeriesData0Properties.get(name);
+        if (validate === undefined) {
+            throw new SchemaValidationError(
+                `property '${name}' is not allowed`,
+            );
+        }
+        try {
+            validate(value[name]);
+        } catch (e) {
+            if (e instanceof SchemaValidationError) e.prependProperty(name);
+            throw e;
+        }
+    }
+    if (!("Package" in value)) {
+        throw new SchemaValidationError(
+            "required property 'Package' is missing",
+        );
+    }
+}
+
+function timeSeriesData1(value: unknown): void {
+    // Compiled from #/definitions/Package
+    if (!isObject(value)) {
+        throw new SchemaValidationError(
+            `expected an object, found ${describe(value)}`,
+        );
+    }
+    for (const name of Object.keys(value)) {
+        const validate = timeSeriesData1Properties.get(name);
+        if (validate === undefined) {
+            throw new SchemaValidationError(
+                `property '${name}' is not allowed`,
+            );
+        }
+        try {
+            validate(value[name]);
+        } catch (e) {
+            if (e instanceof SchemaValidationError) e.prependProperty(name);
+            throw e;
+        }
+    }
+    if (!("TimeSeriesData" in value)) {
+        throw new SchemaValidationError(
+            "required property 'TimeSeriesData' is missing",
+        );
+    }
+}
+
+function timeSeriesData2(value: unknown): void {
+    // Compiled from #/definitions/Header
+    if (!isObject(value)) {
+        throw new SchemaValidationError(
+            `expected an object, found ${describe(value)}`,
+        );
+    }
+    for (const name of Object.keys(value)) {
+        const validate = timeSeriesData2Properties.get(name);
+        if (validate === undefined) {
+            continue;
+        }
+        try {
+            validate(value[name]);
+        } catch (e) {
+            if (e instanceof SchemaValidationError) e.prependProperty(name);
+            throw e;
+        }
+    }
+    if (!("ShipID" in value)) {
+        throw new SchemaValidationError(
+            "required property 'ShipID' is missing",
+        );
+    }
+}
+
+function timeSeriesData3(value: unknown): void {
+    // Compiled from #/definitions/Header/properties/ShipID
+    if (typeof value !== "string") {
+        throw new SchemaValidationError(
+            `expected a string, found ${describe(value)}`,
+        );
+    }
+}
+
+function timeSeriesData4(value: unknown): void {
+    // Compiled from #/definitions/TimeSpan
+    if (!isObject(value)) {
+        throw new SchemaValidationError(
+            `expected an object, found ${describe(value)}`,
+        );
+    }
+    for (const name of Object.keys(value)) {
+        const validate = timeSeriesData4Properties.get(name);
+        if (validate === undefined) {
+            throw new SchemaValidationError(
+                `property '${name}' is not allowed`,
+            );
+        }
+        try {
+            validate(value[name]);
+        } catch (e) {
+            if (e instanceof SchemaValidationError) e.prependProperty(name);
+            throw e;
+        }
+    }
+    if (!("Start" in value)) {
+        throw new SchemaValidationError("required property 'Start' is missing");
+    }
+    if (!("End" in value)) {
+        throw new SchemaValidationError("required property 'End' is missing");
+    }
+}
+
+function timeSeriesData5(value: unknown): void {
+    // Compiled from #/definitions/TimeSpan/properties/Start
+    if (typeof value !== "string") {
+        throw new SchemaValidationError(
+            `expected a date-time string, found ${describe(value)}`,
+        );
+    }
+    if (!isDateTime(value)) {
+        throw new SchemaValidationError(
+            `'${value}' is not an ISO 8601 date-time`,
+        );
+    }
+}
+
+function timeSeriesData6(value: unknown): void {
+    // Compiled from #/definitions/TimeSpan/properties/End
+    if (typeof value !== "string") {
+        throw new SchemaValidationError(
+            `expected a date-time string, found ${describe(value)}`,
+        );
+    }
+    if (!isDateTime(value)) {
+        throw new SchemaValidationError(
+            `'${value}' is not an ISO 8601 date-time`,
+        );
+    }
+}
+
+function timeSeriesData7(value: unknown): void {
+    // Compiled from #/definitions/Header/properties/DateCreated
+    if (typeof value !== "string") {
+        throw new SchemaValidationError(
+            `expected a date-time string, found ${describe(value)}`,
+        );
+    }
+    if (!isDateTime(value)) {
+        throw new SchemaValidationError(
+            `'${value}' is not an ISO 8601 date-time`,
+        );
+    }
+}
+
+function timeSeriesData8(value: unknown): void {
+    // Compiled from #/definitions/Header/properties/DateModified
+    if (typeof value !== "string") {
+        throw new SchemaValidationError(
+            `expected a date-time string, found ${describe(value)}`,
+        );
+    }
+    if (!isDateTime(value)) {
+        throw new SchemaValidationError(
+            `'${value}' is not an ISO 8601 date-time`,
+        );
+    }
+}
+
+function timeSeriesData9(value: unknown): void {
+    // Compiled from #/definitions/Header/properties/Author
+    if (typeof value !== "string") {
+        throw new SchemaValidationError(
+            `expected a string, found ${describe(value)}`,
+        );
+    }
+}
+
+function timeSeriesData10(value: unknown): void {
+    // Compiled from #/definitions/Header/properties/SystemConfiguration
+    if (!Array.isArray(value)) {
+        throw new SchemaValidationError(
+            `expected an array, found ${describe(value)}`,
+        );
+    }
+    for (let i = 0; i < value.length; i++) {
+        try {
+            timeSeriesData11(value[i]);
+        } catch (e) {
+            if (e instanceof SchemaValidationError) e.prependIndex(i);
+            throw e;
+        }
+    }
+}
+
+function timeSeriesData11(value: unknown): void {
+    // Compiled from #/definitions/ConfigurationReference
+    if (!isObject(value)) {
+        throw new SchemaValidationError(
+            `expected an object, found ${describe(value)}`,
+        );
+    }
+    for (const name of Object.keys(value)) {
+        const validate = timeSeriesData11Properties.get(name);
+        if (validate === undefined) {
+            throw new SchemaValidationError(
+                `property '${name}' is not allowed`,
+            );
+        }
+        try {
+            validate(value[name]);
+        } catch (e) {
+            if (e instanceof SchemaValidationError) e.prependProperty(name);
+            throw e;
+        }
+    }
+    if (!("ID" in value)) {
+        throw new SchemaValidationError("required property 'ID' is missing");
+    }
+    if (!("TimeStamp" in value)) {
+        throw new SchemaValidationError(
+            "required property 'TimeStamp' is missing",
+        );
+    }
+}
+
+function timeSeriesData12(value: unknown): void {
+    // Compiled from #/definitions/ConfigurationReference/properties/ID
+    if (typeof value !== "string") {
+        throw new SchemaValidationError(
+            `expected a string, found ${describe(value)}`,
+        );
+    }
+}
+
+function timeSeriesData13(value: unknown): void {
+    // Compiled from #/definitions/ConfigurationReference/properties/TimeStamp
+    if (typeof value !== "string") {
+        throw new SchemaValidationError(
+            `expected a date-time string, found ${describe(value)}`,
+        );
+    }
+    if (!isDateTime(value)) {
+        throw new SchemaValidationError(
+            `'${value}' is not an ISO 8601 date-time`,
+        );
+    }
+}
+
+function timeSeriesData14(value: unknown): void {
+    // Compiled from #/definitions/Package/properties/TimeSeriesData
+    if (!Array.isArray(value)) {
+        throw new SchemaValidationError(
+            `expected an array, found ${describe(value)}`,
+        );
+    }
+    for (let i = 0; i < value.length; i++) {
+        try {
+            timeSeriesData15(value[i]);
+        } catch (e) {
+            if (e instanceof SchemaValidationError) e.prependIndex(i);
+            throw e;
+        }
+    }
+}
+
+function timeSeriesData15(value: unknown): void {
+    // Compiled from #/definitions/TimeSeriesData
+    if (!isObject(value)) {
+        throw new SchemaValidationError(
+            `expected an object, found ${describe(value)}`,
+        );
+    }
+    for (const name of Object.keys(value)) {
+        const validate = timeSeriesData15Properties.get(name);
+        if (validate === undefined) {
+            continue;
+        }
+        try {
+            validate(value[name]);
+        } catch (e) {
+            if (e instanceof SchemaValidationError) e.prependProperty(name);
+            throw e;
+        }
+    }
+}
+
+function timeSeriesData16(value: unknown): void {
+    // Compiled from #/definitions/TimeSeriesData/properties/TabularData
+    if (!Array.isArray(value)) {
+        throw new SchemaValidationError(
+            `expected an array, found ${describe(value)}`,
+        );
+    }
+    for (let i = 0; i < value.length; i++) {
+        try {
+            timeSeriesData17(value[i]);
+        } catch (e) {
+            if (e instanceof SchemaValidationError) e.prependIndex(i);
+            throw e;
+        }
+    }
+}
+
+function timeSeriesData17(value: unknown): void {
+    // Compiled from #/definitions/TabularData
+    if (!isObject(value)) {
+        throw new SchemaValidationError(
+            `expected an object, found ${describe(value)}`,
+        );
+    }
+    for (const name of Object.keys(value)) {
+        const validate = timeSeriesData17Properties.get(name);
+        if (validate === undefined) {
+            throw new SchemaValidationError(
+                `property '${name}' is not allowed`,
+            );
+        }
+        try {
+            validate(value[name]);
+        } catch (e) {
+            if (e instanceof SchemaValidationError) e.prependProperty(name);
+            throw e;
+        }
+    }
+}
+
+function timeSeriesData18(value: unknown): void {
+    // Compiled from #/definitions/TabularData/properties/NumberOfDataSet
+    if (typeof value !== "number") {
+        throw new SchemaValidationError(
+            `expected an integer, found ${describe(value)}`,
+        );
+    }
+    if (!Number.isInteger(value)) {
+        throw new SchemaValidationError(`${value} is not an integer`);
+    }
+    if (value < 0) {
+        throw new SchemaValidationError(`${value} is less than 0`);
+    }
+}
+
+function timeSeriesData19(value: unknown): void {
+    // Compiled from #/definitions/TabularData/properties/NumberOfDataChannel
+    if (typeof value !== "number") {
+        throw new SchemaValidationError(
+            `expected an integer, found ${describe(value)}`,
+        );
+    }
+    if (!Number.isInteger(value)) {
+        throw new SchemaValidationError(`${value} is not an integer`);
+    }
+    if (value < 0) {
+        throw new SchemaValidationError(`${value} is less than 0`);
+    }
+}
+
+function timeSeriesData20(value: unknown): void {
+    // Compiled from #/definitions/TabularData/properties/DataChannelID
+    if (!Array.isArray(value)) {
+        throw new SchemaValidationError(
+            `expected an array, found ${describe(value)}`,
+        );
+    }
+    for (let i = 0; i < value.length; i++) {
+        try {
+            timeSeriesData21(value[i]);
+        } catch (e) {
+            if (e instanceof SchemaValidationError) e.prependIndex(i);
+            throw e;
+        }
+    }
+}
+
+function timeSeriesData21(value: unknown): void {
+    // Compiled from #/definitions/TabularData/properties/DataChannelID/items
+    if (typeof value !== "string") {
+        throw new SchemaValidationError(
+            `expected a string, found ${describe(value)}`,
+        );
+    }
+}
+
+function timeSeriesData22(value: unknown): void {
+    // Compiled from #/definitions/TabularData/properties/DataSet
+    if (!Array.isArray(value)) {
+        throw new SchemaValidationError(
+            `expected an array, found ${describe(value)}`,
+        );
+    }
+    for (let i = 0; i < value.length; i++) {
+        try {
+            timeSeriesData23(value[i]);
+        } catch (e) {
+            if (e instanceof SchemaValidationError) e.prependIndex(i);
+            throw e;
+        }
+    }
+}
+
+function timeSeriesData23(value: unknown): void {
+    // Compiled from #/definitions/DataSet_Tabular
+    if (!isObject(value)) {
+        throw new SchemaValidationError(
+            `expected an object, found ${describe(value)}`,
+        );
+    }
+    for (const name of Object.keys(value)) {
+        const validate = timeSeriesData23Properties.get(name);
+        if (validate === undefined) {
+            throw new SchemaValidationError(
+                `property '${name}' is not allowed`,
+            );
+        }
+        try {
+            validate(value[name]);
+        } catch (e) {
+            if (e instanceof SchemaValidationError) e.prependProperty(name);
+            throw e;
+        }
+    }
+    if (!("TimeStamp" in value)) {
+        throw new SchemaValidationError(
+            "required property 'TimeStamp' is missing",
+        );
+    }
+    if (!("Value" in value)) {
+        throw new SchemaValidationError("required property 'Value' is missing");
+    }
+}
+
+function timeSeriesData24(value: unknown): void {
+    // Compiled from #/definitions/DataSet_Tabular/properties/TimeStamp
+    if (typeof value !== "string") {
+        throw new SchemaValidationError(
+            `expected a date-time string, found ${describe(value)}`,
+        );
+    }
+    if (!isDateTime(value)) {
+        throw new SchemaValidationError(
+            `'${value}' is not an ISO 8601 date-time`,
+        );
+    }
+}
+
+function timeSeriesData25(value: unknown): void {
+    // Compiled from #/definitions/DataSet_Tabular/properties/Value
+    if (!Array.isArray(value)) {
+        throw new SchemaValidationError(
+            `expected an array, found ${describe(value)}`,
+        );
+    }
+    for (let i = 0; i < value.length; i++) {
+        try {
+            timeSeriesData26(value[i]);
+        } catch (e) {
+            if (e instanceof SchemaValidationError) e.prependIndex(i);
+            throw e;
+        }
+    }
+}
+
+function timeSeriesData26(value: unknown): void {
+    // Compiled from #/definitions/DataSet_Tabular/properties/Value/items
+    if (typeof value !== "string") {
+        throw new SchemaValidationError(
+            `expected a string, found ${describe(value)}`,
+        );
+    }
+}
+
+function timeSeriesData27(value: unknown): void {
+    // Compiled from #/definitions/DataSet_Tabular/properties/Quality
+    if (!Array.isArray(value)) {
+        throw new SchemaValidationError(
+            `expected an array, found ${describe(value)}`,
+        );
+    }
+    for (let i = 0; i < value.length; i++) {
+        try {
+            timeSeriesData28(value[i]);
+        } catch (e) {
+            if (e instanceof SchemaValidationError) e.prependIndex(i);
+            throw e;
+        }
+    }
+}
+
+function timeSeriesData28(value: unknown): void {
+    // Compiled from #/definitions/DataSet_Tabular/properties/Quality/items
+    if (typeof value !== "string") {
+        throw new SchemaValidationError(
+            `expected a string, found ${describe(value)}`,
+        );
+    }
+}
+
+function timeSeriesData29(value: unknown): void {
+    // Compiled from #/definitions/EventData
+    if (!isObject(value)) {
+        throw new SchemaValidationError(
+            `expected an object, found ${describe(value)}`,
+        );
+    }
+    for (const name of Object.keys(value)) {
+        const validate = timeSeriesData29Properties.get(name);
+        if (validate === undefined) {
+            throw new SchemaValidationError(
+                `property '${name}' is not allowed`,
+            );
+        }
+        try {
+            validate(value[name]);
+        } catch (e) {
+            if (e instanceof SchemaValidationError) e.prependProperty(name);
+            throw e;
+        }
+    }
+}
+
+function timeSeriesData30(value: unknown): void {
+    // Compiled from #/definitions/EventData/properties/NumberOfDataSet
+    if (typeof value !== "number") {
+        throw new SchemaValidationError(
+            `expected an integer, found ${describe(value)}`,
+        );
+    }
+    if (!Number.isInteger(value)) {
+        throw new SchemaValidationError(`${value} is not an integer`);
+    }
+    if (value < 0) {
+        throw new SchemaValidationError(`${value} is less than 0`);
+    }
+}
+
+function timeSeriesData31(value: unknown): void {
+    // Compiled from #/definitions/EventData/properties/DataSet
+    if (!Array.isArray(value)) {
+        throw new SchemaValidationError(
+            `expected an array, found ${describe(value)}`,
+        );
+    }
+    for (let i = 0; i < value.length; i++) {
+        try {
+            timeSeriesData32(value[i]);
+        } catch (e) {
+            if (e instanceof SchemaValidationError) e.prependIndex(i);
+            throw e;
+        }
+    }
+}
+
+function timeSeriesData32(value: unknown): void {
+    // Compiled from #/definitions/DataSet_Event
+    if (!isObject(value)) {
+        throw new SchemaValidationError(
+            `expected an object, found ${describe(value)}`,
+        );
+    }
+    for (const name of Object.keys(value)) {
+        const validate = timeSeriesData32Properties.get(name);
+        if (validate === undefined) {
+            throw new SchemaValidationError(
+                `property '${name}' is not allowed`,
+            );
+        }
+        try {
+            validate(value[name]);
+        } catch (e) {
+            if (e instanceof SchemaValidationError) e.prependProperty(name);
+            throw e;
+        }
+    }
+    if (!("TimeStamp" in value)) {
+        throw new SchemaValidationError(
+            "required property 'TimeStamp' is missing",
+        );
+    }
+    if (!("DataChannelID" in value)) {
+        throw new SchemaValidationError(
+            "required property 'DataChannelID' is missing",
+        );
+    }
+    if (!("Value" in value)) {
+        throw new SchemaValidationError("required property 'Value' is missing");
+    }
+}
+
+function timeSeriesData33(value: unknown): void {
+    // Compiled from #/definitions/DataSet_Event/properties/TimeStamp
+    if (typeof value !== "string") {
+        throw new SchemaValidationError(
+            `expected a date-time string, found ${describe(value)}`,
+        );
+    }
+    if (!isDateTime(value)) {
+        throw new SchemaValidationError(
+            `'${value}' is not an ISO 8601 date-time`,
+        );
+    }
+}
+
+function timeSeriesData34(value: unknown): void {
+    // Compiled from #/definitions/DataSet_Event/properties/DataChannelID
+    if (typeof value !== "string") {
+        throw new SchemaValidationError(
+            `expected a string, found ${describe(value)}`,
+        );
+    }
+}
+
+function timeSeriesData35(value: unknown): void {
+    // Compiled from #/definitions/DataSet_Event/properties/Value
+    if (typeof value !== "string") {
+        throw new SchemaValidationError(
+            `expected a string, found ${describe(value)}`,
+        );
+    }
+}
+
+function timeSeriesData36(value: unknown): void {
+    // Compiled from #/definitions/DataSet_Event/properties/Quality
+    if (typeof value !== "string") {
+        throw new SchemaValidationError(
+            `expected a string, found ${describe(value)}`,
+        );
+    }
+}
+
+const dataChannelList4Properties = new Map<string, Validate>([
+    ["ID", dataChannelList5],
+    ["Version", dataChannelList6],
+    ["TimeStamp", dataChannelList7],
+]);
+
+const dataChannelList8Properties = new Map<string, Validate>([
+    ["NamingRule", dataChannelList9],
+    ["NamingSchemeVersion", dataChannelList10],
+    ["ReferenceURL", dataChannelList11],
+]);
+
+const dataChannelList2Properties = new Map<string, Validate>([
+    ["ShipID", dataChannelList3],
+    ["DataChannelListID", dataChannelList4],
+    ["VersionInformation", dataChannelList8],
+    ["Author", dataChannelList12],
+    ["DateCreated", dataChannelList13],
+]);
+
+const dataChannelList20Properties = new Map<string, Validate>([
+    ["NamingRule", dataChannelList21],
+]);
+
+const dataChannelList17Properties = new Map<string, Validate>([
+    ["LocalID", dataChannelList18],
+    ["ShortID", dataChannelList19],
+    ["NameObject", dataChannelList20],
+]);
+
+const dataChannelList23Properties = new Map<string, Validate>([
+    ["Type", dataChannelList24],
+    ["UpdateCycle", dataChannelList25],
+    ["CalculationPeriod", dataChannelList26],
+]);
+
+const dataChannelList29Properties = new Map<string, Validate>([
+    ["Enumeration", dataChannelList30],
+    ["FractionDigits", dataChannelList32],
+    ["Length", dataChannelList33],
+    ["MaxExclusive", dataChannelList34],
+    ["MaxInclusive", dataChannelList35],
+    ["MaxLength", dataChannelList36],
+    ["MinExclusive", dataChannelList37],
+    ["MinInclusive", dataChannelList38],
+    ["MinLength", dataChannelList39],
+    ["Pattern", dataChannelList40],
+    ["TotalDigits", dataChannelList41],
+    ["WhiteSpace", dataChannelList42],
+]);
+
+const dataChannelList27Properties = new Map<string, Validate>([
+    ["Type", dataChannelList28],
+    ["Restriction", dataChannelList29],
+]);
+
+const dataChannelList43Properties = new Map<string, Validate>([
+    ["High", dataChannelList44],
+    ["Low", dataChannelList45],
+]);
+
+const dataChannelList46Properties = new Map<string, Validate>([
+    ["UnitSymbol", dataChannelList47],
+    ["QuantityName", dataChannelList48],
+]);
+
+const dataChannelList22Properties = new Map<string, Validate>([
+    ["DataChannelType", dataChannelList23],
+    ["Format", dataChannelList27],
+    ["Range", dataChannelList43],
+    ["Unit", dataChannelList46],
+    ["QualityCoding", dataChannelList49],
+    ["AlertPriority", dataChannelList50],
+    ["Name", dataChannelList51],
+    ["Remarks", dataChannelList52],
+]);
+
+const dataChannelList16Properties = new Map<string, Validate>([
+    ["DataChannelID", dataChannelList17],
+    ["Property", dataChannelList22],
+]);
+
+const dataChannelList14Properties = new Map<string, Validate>([
+    ["DataChannel", dataChannelList15],
+]);
+
+const dataChannelList1Properties = new Map<string, Validate>([
+    ["Header", dataChannelList2],
+    ["DataChannelList", dataChannelList14],
+]);
+
+const dataChannelList0Properties = new Map<string, Validate>([
+    ["Package", dataChannelList1],
+]);
+
+const timeSeriesData4Properties = new Map<string, Validate>([
+    ["Start", timeSeriesData5],
+    ["End", timeSeriesData6],
+]);
+
+const timeSeriesData11Properties = new Map<string, Validate>([
+    ["ID", timeSeriesData12],
+    ["TimeStamp", timeSeriesData13],
+]);
+
+const timeSeriesData2Properties = new Map<string, Validate>([
+    ["ShipID", timeSeriesData3],
+    ["TimeSpan", timeSeriesData4],
+    ["DateCreated", timeSeriesData7],
+    ["DateModified", timeSeriesData8],
+    ["Author", timeSeriesData9],
+    ["SystemConfiguration", timeSeriesData10],
+]);
+
+const timeSeriesData23Properties = new Map<string, Validate>([
+    ["TimeStamp", timeSeriesData24],
+    ["Value", timeSeriesData25],
+    ["Quality", timeSeriesData27],
+]);
+
+const timeSeriesData17Properties = new Map<string, Validate>([
+    ["NumberOfDataSet", timeSeriesData18],
+    ["NumberOfDataChannel", timeSeriesData19],
+    ["DataChannelID", timeSeriesData20],
+    ["DataSet", timeSeriesData22],
+]);
+
+const timeSeriesData32Properties = new Map<string, Validate>([
+    ["TimeStamp", timeSeriesData33],
+    ["DataChannelID", timeSeriesData34],
+    ["Value", timeSeriesData35],
+    ["Quality", timeSeriesData36],
+]);
+
+const timeSeriesData29Properties = new Map<string, Validate>([
+    ["NumberOfDataSet", timeSeriesData30],
+    ["DataSet", timeSeriesData31],
+]);
+
+const timeSeriesData15Properties = new Map<string, Validate>([
+    ["DataConfiguration", timeSeriesData11],
+    ["TabularData", timeSeriesData16],
+    ["EventData", timeSeriesData29],
+]);
+
+const timeSeriesData1Properties = new Map<string, Validate>([
+    ["Header", timeSeriesData2],
+    ["TimeSeriesData", timeSeriesData14],
+]);
+
+const timeSeriesData0Properties = new Map<string, Validate>([
+    ["Package", timeSeriesData1],
+]);
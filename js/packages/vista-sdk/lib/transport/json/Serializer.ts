@@ -1,17 +1,33 @@
 import { DataChannelListDto } from "./data-channel/DataChannelList";
+import {
+    validateDataChannelList,
+    validateTimeSeriesData,
+} from "./SchemaValidators";
 import { TimeSeriesDto } from "./time-series-data/TimeSeriesData";
 
 export class Serializer {
+    /**
+     * @param validateSchema validates the parsed package against the ISO19848
+     * JSON schema, compiled to SchemaValidators.ts by prebuild.ts. Throws a
+     * SchemaValidationError if it doesn't conform.
+     */
     public static deserializeDataChannelList(
         payload: string,
+        validateSchema = false,
     ): DataChannelListDto.DataChannelListPackage {
-        return JSON.parse(payload);
+        const dataChannelList = JSON.parse(payload);
+        if (validateSchema) validateDataChannelList(dataChannelList);
+        return dataChannelList;
     }
 
+    /** @param validateSchema as for deserializeDataChannelList */
     public static deserializeTimeSeriesData(
         payload: string,
+        validateSchema = false,
     ): TimeSeriesDto.TimeSeriesDataPackage {
-        return JSON.parse(payload.toString());
+        const timeSeriesData = JSON.parse(payload.toString());
+        if (validateSchema) validateTimeSeriesData(timeSeriesData);
+        return timeSeriesData;
     }
 
     public static serializeDataChannelList(
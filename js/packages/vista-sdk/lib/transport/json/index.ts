@@ -16,5 +16,6 @@ class JSONExtensions {
 
 export { JSONExtensions };
 
+export { SchemaValidationError } from "./SchemaValidationError";
 export { Serializer as JSONSerializer } from "./Serializer";
 export { DataChannelListDto, TimeSeriesDto };
@@ -3,6 +3,7 @@ import * as fs from "fs-extra";
 // import DataListDto from "../schemas/json/experimental/DataList.schema.json";
 // import TimeSeriesDto from "../schemas/json/experimental/TimeSeriesData.schema.json";
 import { EmbeddedResource } from "./lib/source-generator/EmbeddedResource";
+import { SchemaGenerator } from "./lib/source-generator/SchemaGenerator";
 import { VisGenerator } from "./lib/source-generator/VisGenerator";
 
 module.exports = (async () => {
@@ -59,6 +60,23 @@ module.exports = (async () => {
         });
     }
 
+    /* Generate SchemaValidators.ts */
+    const schemaDir = "../../../schemas/json";
+    if (fs.existsSync(schemaDir)) {
+        const schemas = fs
+            .readdirSync(schemaDir)
+            .filter((fileName) => fileName.endsWith(".schema.json"))
+            .map((fileName) => ({
+                fileName,
+                schema: fs.readJsonSync(`${schemaDir}/${fileName}`),
+            }));
+        console.log("> Write SchemaValidators.ts");
+        fs.writeFileSync(
+            "./lib/transport/json/SchemaValidators.ts",
+            SchemaGenerator.assembleSchemaValidatorsFile(schemas),
+        );
+    }
+
     /* Generate VisVersion.ts */
     const out_path = "./lib/VisVersion.ts";
     // Remove existing file
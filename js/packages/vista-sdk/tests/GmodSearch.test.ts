@@ -0,0 +1,100 @@
+import { GmodNode, VIS, VisVersion, VisVersions } from "../lib";
+import { GmodSearchIndex } from "../lib/internal/GmodSearchIndex";
+
+const text = (node: GmodNode) =>
+    [
+        node.metadata.name,
+        node.metadata.commonName,
+        node.metadata.definition,
+        node.metadata.commonDefinition,
+    ]
+        .join(" ")
+        .toLowerCase();
+
+// Query semantics without the index
+const matches = (node: GmodNode, query: string) => {
+    const q = query.trim().toLowerCase();
+    if (node.code.toLowerCase().startsWith(q)) return true;
+
+    const tokens = GmodSearchIndex.tokenize(q);
+    const words = GmodSearchIndex.tokenize(text(node));
+    return (
+        tokens.length > 0 &&
+        tokens.every((t) =>
+            words.some((w) =>
+                t.length < 3 ? w.startsWith(t) : w.includes(t),
+            ),
+        )
+    );
+};
+
+describe("GmodSearch", () => {
+    it("Code search", async () => {
+        const { gmod } = await VIS.instance.getVIS(VisVersion.v3_4a);
+
+        const exact = gmod.search("411.1");
+        expect(exact[0].node.code).toBe("411.1");
+        expect(exact[0].score).toBe(GmodSearchIndex.CodeExact);
+
+        const prefix = gmod.search("c101.", 20);
+        expect(prefix).toHaveLength(20);
+        expect(prefix.every((r) => r.node.code.startsWith("C101."))).toBe(true);
+        // Shortest codes first
+        for (let i = 1; i < prefix.length; i++)
+            expect(prefix[i - 1].node.code.length).toBeLessThanOrEqual(
+                prefix[i].node.code.length,
+            );
+    });
+
+    it("Word search", async () => {
+        const { gmod } = await VIS.instance.getVIS(VisVersion.v3_4a);
+
+        const results = gmod.search("fuel oil pump", 50);
+        expect(results.length).toBeGreaterThan(0);
+        expect(results[0].node.code).toBe("621.22");
+        for (const result of results) {
+            const t = text(result.node);
+            expect(t).toContain("fuel");
+            expect(t).toContain("oil");
+            expect(t).toContain("pump");
+        }
+
+        // Inside words
+        const inside = gmod.search("ngine", 1000);
+        expect(inside.some((r) => r.node.code === "C101")).toBe(true);
+
+        expect(gmod.search("  ")).toHaveLength(0);
+        expect(gmod.search("zzzz")).toHaveLength(0);
+        expect(() => gmod.search("c", -1)).toThrow();
+    });
+
+    it.each(VisVersions.all)("Search matches scan %s", async (version) => {
+        const { gmod } = await VIS.instance.getVIS(version);
+        const nodes = Array.from(gmod);
+
+        for (const query of [
+            "4",
+            "c",
+            "C101",
+            "pu",
+            "pum",
+            "lubricat",
+            "main eng",
+            "Fuel, oil",
+            "411.1/c",
+        ]) {
+            const results = gmod.search(query, Number.MAX_SAFE_INTEGER);
+            for (let i = 1; i < results.length; i++)
+                expect(results[i - 1].score).toBeGreaterThanOrEqual(
+                    results[i].score,
+                );
+
+            const expected = nodes
+                .filter((n) => matches(n, query))
+                .map((n) => n.code)
+                .sort();
+            const actual = results.map((r) => r.node.code).sort();
+            expect(actual).toEqual(expected);
+        }
+    });
+});
@@ -0,0 +1,166 @@
+import * as fs from "fs-extra";
+import * as path from "path";
+import { JSONSerializer, SchemaValidationError } from "../../lib";
+import { SchemaGenerator } from "../../lib/source-generator/SchemaGenerator";
+import { isDateTime } from "../../lib/transport/json/SchemaValidationError";
+import { Schemas } from "../fixtures";
+
+const modify = (file: string, change: (p: any) => void) => {
+    const sample = JSON.parse(fs.readFileSync(file).toString());
+    change(sample);
+    return JSON.stringify(sample);
+};
+
+const channel = (p: any) => p.Package.DataChannelList.DataChannel[1];
+
+const restriction =
+    "$.Package.DataChannelList.DataChannel[1].Property.Format.Restriction";
+
+describe("Schema validation", () => {
+    it("Valid packages", () => {
+        const dataChannelList = fs
+            .readFileSync(Schemas.DataChannelListSample)
+            .toString();
+        expect(
+            JSONSerializer.deserializeDataChannelList(dataChannelList, true),
+        ).toEqual(JSONSerializer.deserializeDataChannelList(dataChannelList));
+
+        const timeSeriesData = fs
+            .readFileSync(Schemas.TimeSeriesDataSample)
+            .toString();
+        expect(
+            JSONSerializer.deserializeTimeSeriesData(timeSeriesData, true),
+        ).toEqual(JSONSerializer.deserializeTimeSeriesData(timeSeriesData));
+    });
+
+    it("Additional properties are skipped", () => {
+        // Header allows additional properties, with values of any shape
+        const payload = modify(Schemas.DataChannelListSample, (p) => {
+            p.Package.Header.Custom = {
+                Nested: [{ Package: 1 }, [true, null]],
+            };
+        });
+
+        expect(
+            JSONSerializer.deserializeDataChannelList(payload, true),
+        ).toBeDefined();
+    });
+
+    it.each<[(p: any) => void, string, string]>([
+        [
+            (p) => delete channel(p).Property.Format,
+            "required property 'Format' is missing",
+            "$.Package.DataChannelList.DataChannel[1].Property",
+        ],
+        [
+            (p) => (channel(p).Property.DataChannelType.Priority = 1),
+            "property 'Priority' is not allowed",
+            "$.Package.DataChannelList.DataChannel[1].Property.DataChannelType",
+        ],
+        [
+            (p) => (channel(p).DataChannelID.LocalID = 5),
+            "expected a string, found a number",
+            "$.Package.DataChannelList.DataChannel[1].DataChannelID.LocalID",
+        ],
+        [
+            (p) => (p.Package.Header.DataChannelListID.TimeStamp = "yesterday"),
+            "'yesterday' is not an ISO 8601 date-time",
+            "$.Package.Header.DataChannelListID.TimeStamp",
+        ],
+        [
+            (p) =>
+                (channel(p).Property.Format.Restriction = {
+                    WhiteSpace: "Trim",
+                }),
+            "'Trim' is not one of Preserve, Replace, Collapse",
+            restriction + ".WhiteSpace",
+        ],
+        [
+            (p) =>
+                (channel(p).Property.Format.Restriction = {
+                    FractionDigits: 1.5,
+                }),
+            "1.5 is not an integer",
+            restriction + ".FractionDigits",
+        ],
+        [
+            (p) => (channel(p).Property.Format.Restriction = { MaxLength: -1 }),
+            "-1 is less than 0",
+            restriction + ".MaxLength",
+        ],
+    ])("DataChannelList violation %#", (change, reason, jsonPath) => {
+        const payload = modify(Schemas.DataChannelListSample, change);
+
+        let error: unknown;
+        try {
+            JSONSerializer.deserializeDataChannelList(payload, true);
+        } catch (e) {
+            error = e;
+        }
+        expect(error).toBeInstanceOf(SchemaValidationError);
+        const e = error as SchemaValidationError;
+        expect(e.reason).toEqual(reason);
+        expect(e.path).toEqual(jsonPath);
+        expect(e.message).toEqual(
+            `DataChannelListPackage: ${reason} at ${jsonPath}`,
+        );
+    });
+
+    it("TimeSeriesData violation", () => {
+        const payload = modify(Schemas.TimeSeriesDataSample, (p) => {
+            p.Package.TimeSeriesData[0].TabularData[0].DataSet[1].Unit = "%";
+        });
+
+        expect(() =>
+            JSONSerializer.deserializeTimeSeriesData(payload, true),
+        ).toThrow("property 'Unit' is not allowed");
+        // Without schema validation the unknown property is ignored
+        expect(
+            JSONSerializer.deserializeTimeSeriesData(payload),
+        ).toBeDefined();
+    });
+
+    it.each(["null", "[]", "{}", '{"Package":null}'])(
+        "Invalid document %s",
+        (payload) => {
+            expect(() =>
+                JSONSerializer.deserializeTimeSeriesData(payload, true),
+            ).toThrow(SchemaValidationError);
+        },
+    );
+
+    it.each([
+        ["2022-04-04T20:44:31Z", true],
+        ["2022-04-04T20:44:31.1234567+00:00", true],
+        ["2024-02-29T00:00:00Z", true],
+        ["2023-02-29T00:00:00Z", false],
+        ["2022-04-04T24:00:00Z", false],
+        ["2022-04-04T20:44Z", false],
+        ["2022-04-04T20:44:31", false],
+        ["2022-04-04T20:44:31+14:01", false],
+    ])("Date-time %s", (value, expected) => {
+        expect(isDateTime(value)).toEqual(expected);
+    });
+
+    it("Generated validators are up to date", () => {
+        const files = fs
+            .readdirSync(Schemas.dir)
+            .filter((fileName) => fileName.endsWith(".schema.json"))
+            .map((fileName) => ({
+                fileName,
+                schema: fs.readJsonSync(path.join(Schemas.dir, fileName)),
+            }));
+        const committed = fs
+            .readFileSync(
+                path.join(
+                    __dirname,
+                    "../../lib/transport/json/SchemaValidators.ts",
+                ),
+            )
+            .toString();
+
+        expect(SchemaGenerator.assembleSchemaValidatorsFile(files)).toEqual(
+            committed,
+        );
+    });
+});
@@ -18,6 +18,7 @@ from vista_sdk.gmod_dto import GmodDto
 from vista_sdk.gmod_node import GmodNode, GmodNodeMetadata
 from vista_sdk.gmod_path import GmodPath
 from vista_sdk.internal.dictionary import Dictionary
+from vista_sdk.internal.gmod_search_index import GmodSearchIndex, GmodSearchResult
 from vista_sdk.traversal_handler_result import TraversalHandlerResult
 from vista_sdk.vis_version import VisVersion
 
@@ -84,6 +85,7 @@ class Gmod:
             )
         self._root_node: GmodNode = root_node
         self._node_map = Dictionary(list(node_map.items()))
+        self._search_index: GmodSearchIndex | None = None
 
     @property
     def root_node(self) -> GmodNode:
@@ -98,6 +100,24 @@ class Gmod:
         """Return the number of nodes in the GMOD."""
         return len(self._node_map)
 
+    def search(self, query: str, max_results: int = 10) -> list[GmodSearchResult]:
+        """Search nodes by code prefix, and by words of their names and definitions.
+
+        Matching is case insensitive. Nodes whose code starts with the query rank
+        first, shortest codes first. Otherwise every word of the query has to match
+        a word of the node, exactly, as a prefix, or inside it for query words of 3
+        or more characters. Names weigh more than definitions.
+        The index is built on the first search and kept with the Gmod.
+        """
+        if query is None:
+            raise ValueError("query cannot be None")
+        if max_results < 0:
+            raise ValueError("max_results cannot be negative")
+
+        if self._search_index is None:
+            self._search_index = GmodSearchIndex(self)
+        return self._search_index.search(query, max_results)
+
     @staticmethod
     def is_potential_parent(type_str: str) -> bool:
         """Check if the given type string is a potential parent scope type."""
@@ -0,0 +1,170 @@
+"""Search index over the codes, names and definitions of the nodes of a Gmod.
+
+Codes are kept sorted, so the nodes with a code prefix are a contiguous range
+found by bisection. Names and definitions are split into lowercase words with
+postings to their nodes. Short query words match word prefixes from the sorted
+word list, longer ones are looked up through trigram postings of the words.
+"""
+
+from __future__ import annotations
+
+import bisect
+import heapq
+import re
+from collections.abc import Iterable, Iterator
+from dataclasses import dataclass
+
+from vista_sdk.gmod_node import GmodNode
+
+CODE_EXACT = 1000
+CODE_PREFIX = 500
+
+_NAME_WEIGHT = 3
+_DEFINITION_WEIGHT = 1
+
+_EXACT_WORD = 3
+_PREFIX_WORD = 2
+_INSIDE_WORD = 1
+
+_MIN_TRIGRAM_LENGTH = 3
+
+_WORD = re.compile(r"[^\W_]+")
+
+
+@dataclass(frozen=True)
+class GmodSearchResult:
+    """A Gmod node matching a search, higher scores rank first."""
+
+    node: GmodNode
+    score: int
+
+
+def tokenize(text: str) -> list[str]:
+    """Split lowercase text into words of letters and digits."""
+    return _WORD.findall(text)
+
+
+class GmodSearchIndex:
+    """Immutable search index, safe to share between threads."""
+
+    def __init__(self, nodes: Iterable[GmodNode]) -> None:
+        """Build the index over the given nodes."""
+        self._nodes = list(nodes)
+
+        codes = sorted((node.code.lower(), i) for i, node in enumerate(self._nodes))
+        self._codes = [code for code, _ in codes]
+        self._code_nodes = [i for _, i in codes]
+
+        # Best weight of each word per node
+        words: dict[str, dict[int, int]] = {}
+        for i, node in enumerate(self._nodes):
+            metadata = node.metadata
+            for text, weight in (
+                (metadata.name, _NAME_WEIGHT),
+                (metadata.common_name, _NAME_WEIGHT),
+                (metadata.definition, _DEFINITION_WEIGHT),
+                (metadata.common_definition, _DEFINITION_WEIGHT),
+            ):
+                if not text:
+                    continue
+                for word in tokenize(text.lower()):
+                    postings = words.setdefault(word, {})
+                    if postings.get(i, 0) < weight:
+                        postings[i] = weight
+
+        self._words = sorted(words)
+        self._postings = [list(words[word].items()) for word in self._words]
+
+        self._trigrams: dict[str, list[int]] = {}
+        for w, word in enumerate(self._words):
+            for i in range(len(word) - _MIN_TRIGRAM_LENGTH + 1):
+                words_of = self._trigrams.setdefault(word[i : i + 3], [])
+                # Words are visited in order, a repeated trigram is the last entry
+                if not words_of or words_of[-1] != w:
+                    words_of.append(w)
+
+    def search(self, query: str, max_results: int) -> list[GmodSearchResult]:
+        """Return the best matches of the query, see Gmod.search."""
+        text = query.strip().lower()
+        if not text or max_results == 0:
+            return []
+
+        first = bisect.bisect_left(self._codes, text)
+        end = first
+        while end < len(self._codes) and self._codes[end].startswith(text):
+            end += 1
+
+        # Code matches always outrank word matches,
+        # there is only room for words when few codes match
+        tokens = tokenize(text) if end - first < max_results else []
+        scores = self._match_tokens(tokens) if tokens else {}
+
+        results: list[GmodSearchResult] = []
+        for i in range(first, end):
+            node = self._code_nodes[i]
+            code = self._codes[i]
+            if len(code) == len(text):
+                score = CODE_EXACT
+            else:
+                score = CODE_PREFIX - min(len(code) - len(text), 100)
+            score = max(score, scores.pop(node, 0))
+            results.append(GmodSearchResult(self._nodes[node], score))
+
+        results.extend(
+            GmodSearchResult(self._nodes[node], score) for node, score in scores.items()
+        )
+        return heapq.nsmallest(
+            max_results,
+            results,
+            key=lambda r: (-r.score, len(r.node.code), r.node.code),
+        )
+
+    def _match_tokens(self, tokens: list[str]) -> dict[int, int]:
+        """Score the nodes matching every token, by the best word of each token."""
+        matched: dict[int, int] | None = None
+        for token in tokens:
+            best: dict[int, int] = {}
+            for w, kind in self._match_words(token):
+                for node, weight in self._postings[w]:
+                    if matched is not None and node not in matched:
+                        continue
+                    score = kind * weight
+                    if best.get(node, 0) < score:
+                        best[node] = score
+            if matched is not None:
+                for node in best:
+                    best[node] += matched[node]
+            matched = best
+            if not matched:
+                break
+        return matched or {}
+
+    def _match_words(self, token: str) -> Iterator[tuple[int, int]]:
+        """Yield the indexes of the words matching the token, with the kind of match."""
+        if len(token) < _MIN_TRIGRAM_LENGTH:
+            for w in range(bisect.bisect_left(self._words, token), len(self._words)):
+                word = self._words[w]
+                if not word.startswith(token):
+                    break
+                yield w, _EXACT_WORD if len(word) == len(token) else _PREFIX_WORD
+            return
+
+        # Every word containing the token is in the postings of each of its
+        # trigrams, the rarest is enough
+        rarest: list[int] | None = None
+        for i in range(len(token) - _MIN_TRIGRAM_LENGTH + 1):
+            words = self._trigrams.get(token[i : i + 3])
+            if words is None:
+                return
+            if rarest is None or len(words) < len(rarest):
+                rarest = words
+
+        for w in rarest or []:
+            word = self._words[w]
+            at = word.find(token)
+            if at < 0:
+                continue
+            if at > 0:
+                yield w, _INSIDE_WORD
+            else:
+                yield w, _EXACT_WORD if len(word) == len(token) else _PREFIX_WORD
@@ -39,6 +39,8 @@ class LocalId:
                 "LocalId cannot be constructed from invalid LocalIdBuilder"
             )
         self._builder = builder
+        # Builders are immutable, hashing all the paths and tags of one is not cheap
+        self._hash: int | None = None
 
     @property
     def builder(self) -> LocalIdBuilder:
@@ -126,7 +128,9 @@ class LocalId:
 
     def __hash__(self) -> int:
         """Get the hash code for this LocalId."""
-        return hash(self._builder)
+        if self._hash is None:
+            self._hash = hash(self._builder)
+        return self._hash
 
     def __str__(self) -> str:
         """Convert this LocalId to its string representation."""
@@ -0,0 +1,315 @@
+"""This module generates validators for the ISO19848 package JSON schemas.
+
+Mirrors the C# SchemaGenerator: every schema node, with references resolved, is
+compiled to a function, so nothing is interpreted when a package is validated.
+"""
+
+import argparse
+import json
+import re
+from pathlib import Path
+from typing import Any
+
+SCHEMA_EXTENSION = ".schema.json"
+
+# Keywords without effect on validation
+ANNOTATIONS = {"$schema", "$id", "title", "description", "definitions"}
+KEYWORDS = {
+    "type",
+    "properties",
+    "required",
+    "additionalProperties",
+    "items",
+    "minimum",
+    "enum",
+    "format",
+}
+
+
+def _snake_case(name: str) -> str:
+    return re.sub(r"(?<!^)(?=[A-Z])", "_", name).lower()
+
+
+def _raise(message: str, indent: str = "        ") -> list[str]:
+    """Emit a raise with an f-string message, wrapped like ruff format would."""
+    prefix = "f" if "{" in message else ""
+    message = f'{prefix}"{message}"'
+    line = f"{indent}raise SchemaValidationError({message})"
+    if len(line) <= 88:
+        return [line]
+    return [
+        f"{indent}raise SchemaValidationError(",
+        f"{indent}    {message}",
+        f"{indent})",
+    ]
+
+
+class _SchemaCompiler:
+    """Compiles one schema to functions, numbered in the order they're first reached."""
+
+    def __init__(self, root: dict[str, Any], name: str, file_name: str) -> None:
+        self._root = root
+        self._prefix = "_" + _snake_case(name)
+        self._file_name = file_name
+        self._nodes: list[list[str]] = []
+        self._definitions: dict[str, str] = {}
+        self.tables: list[str] = []
+
+    def compile(self) -> list[str]:
+        self._compile(self._root, "#")
+        return ["\n".join(lines) for lines in self._nodes]
+
+    def _compile(self, schema: dict[str, Any], pointer: str) -> str:
+        if "$ref" in schema:
+            return self._define(schema["$ref"])
+        return self._add(schema, pointer)
+
+    def _define(self, reference: str) -> str:
+        prefix = "#/definitions/"
+        if reference in self._definitions:
+            return self._definitions[reference]
+        definitions = self._root.get("definitions", {})
+        name = reference[len(prefix) :]
+        if not reference.startswith(prefix) or name not in definitions:
+            raise self._unsupported(reference, "$ref")
+
+        # Reserved before compiling the definition, so recursive references resolve to it
+        function = f"{self._prefix}_{len(self._nodes)}"
+        self._definitions[reference] = function
+        return self._add(definitions[name], reference, function)
+
+    def _add(
+        self, schema: dict[str, Any], pointer: str, function: str | None = None
+    ) -> str:
+        function = function or f"{self._prefix}_{len(self._nodes)}"
+        lines = [
+            f"def {function}(value: object) -> None:",
+            f"    # Compiled from {pointer}",
+        ]
+        self._nodes.append(lines)
+        lines.extend(self._body(schema, pointer, function))
+        return function
+
+    def _body(self, schema: dict[str, Any], pointer: str, function: str) -> list[str]:
+        for keyword in schema:
+            if keyword not in KEYWORDS and keyword not in ANNOTATIONS:
+                raise self._unsupported(pointer, keyword)
+
+        schema_type = schema.get("type")
+        if schema_type is None:
+            return ["    return"]
+        if schema_type == "object":
+            return self._object(schema, pointer, function)
+        if schema_type == "array":
+            lines = [
+                "    if type(value) is not list:",
+                *_raise("expected an array, found {describe(value)}"),
+            ]
+            if "items" not in schema:
+                return lines
+            items = self._compile(schema["items"], pointer + "/items")
+            return [
+                *lines,
+                "    for i, item in enumerate(value):",
+                "        try:",
+                f"            {items}(item)",
+                "        except SchemaValidationError as e:",
+                "            e.prepend_index(i)",
+                "            raise",
+            ]
+        if schema_type == "string":
+            return self._string(schema)
+        if schema_type in ("number", "integer"):
+            return self._number(schema, schema_type)
+        raise self._unsupported(pointer, f"type {schema_type}")
+
+    def _string(self, schema: dict[str, Any]) -> list[str]:
+        date_time = schema.get("format") == "date-time"
+        expected = "a date-time string" if date_time else "a string"
+        lines = [
+            "    if type(value) is not str:",
+            *_raise(f"expected {expected}, found {{describe(value)}}"),
+        ]
+        if date_time:
+            return [
+                *lines,
+                "    if not is_date_time(value):",
+                *_raise("'{value}' is not an ISO 8601 date-time"),
+            ]
+        if "enum" not in schema:
+            return lines
+        values = schema["enum"]
+        return [
+            *lines,
+            f"    if value not in ({', '.join(json.dumps(v) for v in values)}):",
+            *_raise(f"'{{value}}' is not one of {', '.join(values)}"),
+        ]
+
+    def _number(self, schema: dict[str, Any], schema_type: str) -> list[str]:
+        # bool is a subclass of int, but not a JSON number
+        expected = "an integer" if schema_type == "integer" else "a number"
+        lines = [
+            "    if type(value) is not int and type(value) is not float:",
+            *_raise(f"expected {expected}, found {{describe(value)}}"),
+        ]
+        if schema_type == "integer":
+            lines += [
+                "    if type(value) is float and not value.is_integer():",
+                *_raise("{value} is not an integer"),
+            ]
+        if "minimum" in schema:
+            minimum = schema["minimum"]
+            lines += [
+                f"    if value < {minimum!r}:",
+                *_raise(f"{{value}} is less than {minimum}"),
+            ]
+        return lines
+
+    def _object(self, schema: dict[str, Any], pointer: str, function: str) -> list[str]:
+        required = list(schema.get("required", []))
+        additional = schema.get("additionalProperties", True)
+        if isinstance(additional, dict):
+            raise self._unsupported(pointer, "additionalProperties schema")
+
+        properties = {
+            name: self._compile(property_schema, f"{pointer}/properties/{name}")
+            for name, property_schema in schema.get("properties", {}).items()
+        }
+        missing = [name for name in required if name not in properties]
+        if missing:
+            raise self._unsupported(
+                pointer, f"required property without a schema {missing[0]}"
+            )
+
+        lines = [
+            "    if type(value) is not dict:",
+            *_raise("expected an object, found {describe(value)}"),
+        ]
+        if properties:
+            # Defined after all functions, as the table references them
+            entries = "".join(f'    "{n}": {f},\n' for n, f in properties.items())
+            self.tables.append(f"{function}_properties = {{\n{entries}}}")
+            lines += [
+                "    for name, item in value.items():",
+                f"        validate = {function}_properties.get(name)",
+                "        if validate is None:",
+            ]
+            if additional is False:
+                lines += _raise("property '{name}' is not allowed", " " * 12)
+            else:
+                lines.append("            continue")
+            lines += [
+                "        try:",
+                "            validate(item)",
+                "        except SchemaValidationError as e:",
+                "            e.prepend_property(name)",
+                "            raise",
+            ]
+        elif additional is False:
+            lines += [
+                "    for name in value:",
+                *_raise("property '{name}' is not allowed"),
+            ]
+        for name in required:
+            lines += [
+                f'    if "{name}" not in value:',
+                *_raise(f"required property '{name}' is missing"),
+            ]
+        return lines
+
+    def _unsupported(self, pointer: str, keyword: str) -> ValueError:
+        return ValueError(
+            f"Unsupported JSON schema keyword '{keyword}' at {pointer} in {self._file_name}"
+        )
+
+
+def generate_schema_validators_script(directory: str, output_file: str) -> None:
+    """Generates a Python script with a validator per ISO19848 JSON schema."""
+    schemas = sorted(Path(directory).glob("*" + SCHEMA_EXTENSION))
+    if not schemas:
+        raise ValueError(f"No JSON schemas found in {directory}")
+
+    header = [
+        "# =============================================================================",
+        "# AUTO-GENERATED FILE - DO NOT EDIT MANUALLY",
+        "# =============================================================================",
+        "#",
+        "# This file is generated from the JSON schemas in schemas/json/",
+        "#",
+        "# To regenerate after changing the schemas:",
+        "#",
+        "#   cd python",
+        "#   uv run python src/vista_sdk/source_generator/schema_validators_generator.py",
+        "#",
+        "# =============================================================================",
+        "",
+        '"""Validators for the ISO19848 packages, compiled from their JSON schemas."""',
+        "",
+        "from __future__ import annotations",
+        "",
+        "from vista_sdk.system_text_json.schema_validation import (",
+        "    SchemaValidationError,",
+        "    describe,",
+        "    is_date_time,",
+        ")",
+    ]
+    sections: list[str] = []
+    tables: list[str] = []
+    for path in schemas:
+        name = path.name[: -len(SCHEMA_EXTENSION)]
+        schema = json.loads(path.read_text(encoding="utf-8"))
+        title = schema.get("title", name)
+        compiler = _SchemaCompiler(schema, name, path.name)
+        functions = compiler.compile()
+        tables.extend(compiler.tables)
+        sections.append(
+            "\n".join(
+                [
+                    f"def validate_{_snake_case(name)}(value: object) -> None:",
+                    f'    """Validate a package from json.loads against {path.name}.',
+                    "",
+                    "    Raises:",
+                    "        SchemaValidationError: If the package doesn't conform.",
+                    '    """',
+                    "    try:",
+                    f"        _{_snake_case(name)}_0(value)",
+                    "    except SchemaValidationError as e:",
+                    f'        e.title = "{title}"',
+                    "        raise",
+                ]
+            )
+        )
+        sections.extend(functions)
+
+    output = Path(output_file)
+    output.parent.mkdir(parents=True, exist_ok=True)
+    output.write_text(
+        "\n".join(header)
+        + "\n\n\n"
+        + "\n\n\n".join(sections)
+        + "\n\n\n"
+        + "\n\n".join(tables)
+        + "\n",
+        encoding="utf-8",
+    )
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(description="Generate JSON schema validators.")
+    parser.add_argument(
+        "--schemas_dir",
+        type=str,
+        required=False,
+        help="The directory containing the .schema.json files",
+    )
+    args = parser.parse_args()
+
+    root_dir = Path(__file__).parent.parent.resolve()
+    schemas_dir = (
+        root_dir.parent.parent.parent / "schemas" / "json"
+        if not args.schemas_dir
+        else Path(args.schemas_dir).resolve()
+    )
+    output_file = root_dir / "system_text_json" / "schema_validators.py"
+
+    generate_schema_validators_script(str(schemas_dir), str(output_file))
@@ -22,6 +22,7 @@ from .data_channel_list import (
     Package as DataChannelPackage,
 )
 from .extensions import JsonExtensions
+from .schema_validation import SchemaValidationError
 from .serializer import DateTimeEncoder, Serializer
 from .time_series_data import (
     ConfigurationReference,
@@ -61,6 +62,8 @@ __all__ = [
     "Property",
     "Range",
     "Restriction",
+    # Raised by Serializer when validate_schema is set
+    "SchemaValidationError",
     # Serializer (mirrors C# Serializer)
     "Serializer",
     "TabularData",
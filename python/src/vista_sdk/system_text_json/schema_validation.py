@@ -0,0 +1,80 @@
+"""Support for the generated ISO19848 package validators in schema_validators.py.
+
+Mirrors C#'s Vista.SDK.Transport.Json.SchemaValidator, with the same messages and
+paths.
+"""
+
+from __future__ import annotations
+
+import re
+from datetime import datetime
+
+_DATE_TIME = re.compile(
+    r"(\d{4})-(\d{2})-(\d{2})T(\d{2}):(\d{2}):(\d{2})(?:\.\d+)?(?:Z|[+-](\d{2}):(\d{2}))"
+)
+
+
+class SchemaValidationError(ValueError):
+    """Raised when a package doesn't conform to its JSON schema.
+
+    The path is built while the error propagates out of the generated validators,
+    so conforming packages don't pay for it.
+    """
+
+    def __init__(self, message: str) -> None:
+        """Initialize the error with a message, the path is added by the callers."""
+        super().__init__(message)
+        self.message = message
+        self.title = ""
+        self._segments: list[str] = []
+
+    @property
+    def path(self) -> str:
+        """The JSON path of the offending value, like $.Package.Header.ShipID."""
+        return "$" + "".join(reversed(self._segments))
+
+    def prepend_property(self, name: str) -> None:
+        """Prefix the path with a property of the enclosing object."""
+        self._segments.append("." + name)
+
+    def prepend_index(self, index: int) -> None:
+        """Prefix the path with an index of the enclosing array."""
+        self._segments.append(f"[{index}]")
+
+    def __str__(self) -> str:
+        """Return the message as '<title>: <message> at <path>'."""
+        return f"{self.title}: {self.message} at {self.path}"
+
+
+def describe(value: object) -> str:
+    """Describe the JSON type of a value from json.loads, for error messages."""
+    if isinstance(value, dict):
+        return "an object"
+    if isinstance(value, list):
+        return "an array"
+    if isinstance(value, str):
+        return "a string"
+    if isinstance(value, bool):
+        return "a boolean"
+    if isinstance(value, (int, float)):
+        return "a number"
+    return "null"
+
+
+def is_date_time(value: str) -> bool:
+    """Check an ISO 8601 date-time as the deserializers accept it.
+
+    Requires seconds and an offset (Z or +HH:MM), like the C# DateTimeOffset converter.
+    """
+    match = _DATE_TIME.fullmatch(value)
+    if match is None:
+        return False
+    year, month, day, hour, minute, second = (int(g) for g in match.groups()[:6])
+    try:
+        datetime(year, month, day, hour, minute, second)  # noqa: DTZ001
+    except ValueError:
+        return False
+    if match.group(7) is None:
+        return True
+    offset_hours, offset_minutes = int(match.group(7)), int(match.group(8))
+    return offset_minutes < 60 and offset_hours * 60 + offset_minutes <= 14 * 60
@@ -0,0 +1,1168 @@
+# =============================================================================
+# AUTO-GENERATED FILE - DO NOT EDIT MANUALLY
+# =============================================================================
+#
+# This file is generated from the JSON schemas in schemas/json/
+#
+# To regenerate after changing the schemas:
+#
+#   cd python
+#   uv run python src/vista_sdk/source_generator/schema_validators_generator.py
+#
+# =============================================================================
+
+"""Validators for the ISO19848 packages, compiled from their JSON schemas."""
+
+from __future__ import annotations
+
+from vista_sdk.system_text_json.schema_validation import (
+    SchemaValidationError,
+    describe,
+    is_date_time,
+)
+
+
+def validate_data_channel_list(value: object) -> None:
+    """Validate a package from json.loads against DataChannelList.schema.json.
+
+    Raises:
+        SchemaValidationError: If the package doesn't conform.
+    """
+    try:
+        _data_channel_list_0(value)
+    except SchemaValidationError as e:
+        e.title = "DataChannelListPackage"
+        raise
+
+
+def _data_channel_list_0(value: object) -> None:
+    # Compiled from #
+    if type(value) is not dict:
+        raise SchemaValidationError(f"expected an object, found {describe(value)}")
+    for name, item in value.items():
+        validate = _data_channel_list_0_properties.get(name)
+        if validate is None:
+            raise SchemaValidationError(f"property '{name}' is not allowed")
+        try:
+            validate(item)
+        except SchemaValidationError as e:
+            e.prepend_property(name)
+            raise
+    if "Package" not in value:
+        raise SchemaValidationError("required property 'Package' is missing")
+
+
+def _data_channel_list_1(value: object) -> None:
+    # Compiled from #/definitions/Package
+    if type(value) is not dict:
+        raise SchemaValidationError(f"expected an object, found {describe(value)}")
+    for name, item in value.items():
+        validate = _data_channel_list_1_properties.get(name)
+        if validate is None:
+            raise SchemaValidationError(f"property '{name}' is not allowed")
+        try:
+            validate(item)
+        except SchemaValidationError as e:
+            e.prepend_property(name)
+            raise
+    if "Header" not in value:
+        raise SchemaValidationError("required property 'Header' is missing")
+    if "DataChannelList" not in value:
+        raise SchemaValidationError("required property 'DataChannelList' is missing")
+
+
+def _data_channel_list_2(value: object) -> None:
+    # Compiled from #/definitions/Header
+    if type(value) is not dict:
+        raise SchemaValidationError(f"expected an object, found {describe(value)}")
+    for name, item in value.items():
+        validate = _data_channel_list_2_properties.get(name)
+        if validate is None:
+            continue
+        try:
+            validate(item)
+        except SchemaValidationError as e:
+            e.prepend_property(name)
+            raise
+    if "ShipID" not in value:
+        raise SchemaValidationError("required property 'ShipID' is missing")
+    if "DataChannelListID" not in value:
+        raise SchemaValidationError("required property 'DataChannelListID' is missing")
+
+
+def _data_channel_list_3(value: object) -> None:
+    # Compiled from #/definitions/Header/properties/ShipID
+    if type(value) is not str:
+        raise SchemaValidationError(f"expected a string, found {describe(value)}")
+
+
+def _data_channel_list_4(value: object) -> None:
+    # Compiled from #/definitions/ConfigurationReference
+    if type(value) is not dict:
+        raise SchemaValidationError(f"expected an object, found {describe(value)}")
+    for name, item in value.items():
+        validate = _data_channel_list_4_properties.get(name)
+        if validate is None:
+            raise SchemaValidationError(f"property '{name}' is not allowed")
+        try:
+            validate(item)
+        except SchemaValidationError as e:
+            e.prepend_property(name)
+            raise
+    if "ID" not in value:
+        raise SchemaValidationError("required property 'ID' is missing")
+    if "TimeStamp" not in value:
+        raise SchemaValidationError("required property 'TimeStamp' is missing")
+
+
+def _data_channel_list_5(value: object) -> None:
+    # Compiled from #/definitions/ConfigurationReference/properties/ID
+    if type(value) is not str:
+        raise SchemaValidationError(f"expected a string, found {describe(value)}")
+
+
+def _data_channel_list_6(value: object) -> None:
+    # Compiled from #/definitions/ConfigurationReference/properties/Version
+    if type(value) is not str:
+        raise SchemaValidationError(f"expected a string, found {describe(value)}")
+
+
+def _data_channel_list_7(value: object) -> None:
+    # Compiled from #/definitions/ConfigurationReference/properties/TimeStamp
+    if type(value) is not str:
+        raise SchemaValidationError(
+            f"expected a date-time string, found {describe(value)}"
+        )
+    if not is_date_time(value):
+        raise SchemaValidationError(f"'{value}' is not an ISO 8601 date-time")
+
+
+def _data_channel_list_8(value: object) -> None:
+    # Compiled from #/definitions/VersionInformation
+    if type(value) is not dict:
+        raise SchemaValidationError(f"expected an object, found {describe(value)}")
+    for name, item in value.items():
+        validate = _data_channel_list_8_properties.get(name)
+        if validate is None:
+            raise SchemaValidationError(f"property '{name}' is not allowed")
+        try:
+            validate(item)
+        except SchemaValidationError as e:
+            e.prepend_property(name)
+            raise
+    if "NamingRule" not in value:
+        raise SchemaValidationError("required property 'NamingRule' is missing")
+    if "NamingSchemeVersion" not in value:
+        raise SchemaValidationError(
+            "required property 'NamingSchemeVersion' is missing"
+        )
+
+
+def _data_channel_list_9(value: object) -> None:
+    # Compiled from #/definitions/VersionInformation/properties/NamingRule
+    if type(value) is not str:
+        raise SchemaValidationError(f"expected a string, found {describe(value)}")
+
+
+def _data_channel_list_10(value: object) -> None:
+    # Compiled from #/definitions/VersionInformation/properties/NamingSchemeVersion
+    if type(value) is not str:
+        raise SchemaValidationError(f"expected a string, found {describe(value)}")
+
+
+def _data_channel_list_11(value: object) -> None:
+    # Compiled from #/definitions/VersionInformation/properties/ReferenceURL
+    if type(value) is not str:
+        raise SchemaValidationError(f"expected a string, found {describe(value)}")
+
+
+def _data_channel_list_12(value: object) -> None:
+    # Compiled from #/definitions/Header/properties/Author
+    if type(value) is not str:
+        raise SchemaValidationError(f"expected a string, found {describe(value)}")
+
+
+def _data_channel_list_13(value: object) -> None:
+    # Compiled from #/definitions/Header/properties/DateCreated
+    if type(value) is not str:
+        raise SchemaValidationError(
+            f"expected a date-time string, found {describe(value)}"
+        )
+    if not is_date_time(value):
+        raise SchemaValidationError(f"'{value}' is not an ISO 8601 date-time")
+
+
+def _data_channel_list_14(value: object) -> None:
+    # Compiled from #/definitions/DataChannelList
+    if type(value) is not dict:
+        raise SchemaValidationError(f"expected an object, found {describe(value)}")
+    for name, item in value.items():
+        validate = _data_channel_list_14_properties.get(name)
+        if validate is None:
+            raise SchemaValidationError(f"property '{name}' is not allowed")
+        try:
+            validate(item)
+        except SchemaValidationError as e:
+            e.prepend_property(name)
+            raise
+    if "DataChannel" not in value:
+        raise SchemaValidationError("required property 'DataChannel' is missing")
+
+
+def _data_channel_list_15(value: object) -> None:
+    # Compiled from #/definitions/DataChannelList/properties/DataChannel
+    if type(value) is not list:
+        raise SchemaValidationError(f"expected an array, found {describe(value)}")
+    for i, item in enumerate(value):
+        try:
+            _data_channel_list_16(item)
+        except SchemaValidationError as e:
+            e.prepend_index(i)
+            raise
+
+
+def _data_channel_list_16(value: object) -> None:
+    # Compiled from #/definitions/DataChannel
+    if type(value) is not dict:
+        raise SchemaValidationError(f"expected an object, found {describe(value)}")
+    for name, item in value.items():
+        validate = _data_channel_list_16_properties.get(name)
+        if validate is None:
+            raise SchemaValidationError(f"property '{name}' is not allowed")
+        try:
+            validate(item)
+        except SchemaValidationError as e:
+            e.prepend_property(name)
+            raise
+    if "DataChannelID" not in value:
+        raise SchemaValidationError("required property 'DataChannelID' is missing")
+    if "Property" not in value:
+        raise SchemaValidationError("required property 'Property' is missing")
+
+
+def _data_channel_list_17(value: object) -> None:
+    # Compiled from #/definitions/DataChannelID
+    if type(value) is not dict:
+        raise SchemaValidationError(f"expected an object, found {describe(value)}")
+    for name, item in value.items():
+        validate = _data_channel_list_17_properties.get(name)
+        if validate is None:
+            raise SchemaValidationError(f"property '{name}' is not allowed")
+        try:
+            validate(item)
+        except SchemaValidationError as e:
+            e.prepend_property(name)
+            raise
+    if "LocalID" not in value:
+        raise SchemaValidationError("required property 'LocalID' is missing")
+
+
+def _data_channel_list_18(value: object) -> None:
+    # Compiled from #/definitions/DataChannelID/properties/LocalID
+    if type(value) is not str:
+        raise SchemaValidationError(f"expected a string, found {describe(value)}")
+
+
+def _data_channel_list_19(value: object) -> None:
+    # Compiled from #/definitions/DataChannelID/properties/ShortID
+    if type(value) is not str:
+        raise SchemaValidationError(f"expected a string, found {describe(value)}")
+
+
+def _data_channel_list_20(value: object) -> None:
+    # Compiled from #/definitions/NameObject
+    if type(value) is not dict:
+        raise SchemaValidationError(f"expected an object, found {describe(value)}")
+    for name, item in value.items():
+        validate = _data_channel_list_20_properties.get(name)
+        if validate is None:
+            continue
+        try:
+            validate(item)
+        except SchemaValidationError as e:
+            e.prepend_property(name)
+            raise
+    if "NamingRule" not in value:
+        raise SchemaValidationError("required property 'NamingRule' is missing")
+
+
+def _data_channel_list_21(value: object) -> None:
+    # Compiled from #/definitions/NameObject/properties/NamingRule
+    if type(value) is not str:
+        raise SchemaValidationError(f"expected a string, found {describe(value)}")
+
+
+def _data_channel_list_22(value: object) -> None:
+    # Compiled from #/definitions/Property
+    if type(value) is not dict:
+        raise SchemaValidationError(f"expected an object, found {describe(value)}")
+    for name, item in value.items():
+        validate = _data_channel_list_22_properties.get(name)
+        if validate is None:
+            continue
+        try:
+            validate(item)
+        except SchemaValidationError as e:
+            e.prepend_property(name)
+            raise
+    if "DataChannelType" not in value:
+        raise SchemaValidationError("required property 'DataChannelType' is missing")
+    if "Format" not in value:
+        raise SchemaValidationError("required property 'Format' is missing")
+
+
+def _data_channel_list_23(value: object) -> None:
+    # Compiled from #/definitions/DataChannelType
+    if type(value) is not dict:
+        raise SchemaValidationError(f"expected an object, found {describe(value)}")
+    for name, item in value.items():
+        validate = _data_channel_list_23_properties.get(name)
+        if validate is None:
+            raise SchemaValidationError(f"property '{name}' is not allowed")
+        try:
+            validate(item)
+        except SchemaValidationError as e:
+            e.prepend_property(name)
+            raise
+    if "Type" not in value:
+        raise SchemaValidationError("required property 'Type' is missing")
+
+
+def _data_channel_list_24(value: object) -> None:
+    # Compiled from #/definitions/DataChannelType/properties/Type
+    if type(value) is not str:
+        raise SchemaValidationError(f"expected a string, found {describe(value)}")
+
+
+def _data_channel_list_25(value: object) -> None:
+    # Compiled from #/definitions/DataChannelType/properties/UpdateCycle
+    if type(value) is not int and type(value) is not float:
+        raise SchemaValidationError(f"expected a number, found {describe(value)}")
+
+
+def _data_channel_list_26(value: object) -> None:
+    # Compiled from #/definitions/DataChannelType/properties/CalculationPeriod
+    if type(value) is not int and type(value) is not float:
+        raise SchemaValidationError(f"expected a number, found {describe(value)}")
+
+
+def _data_channel_list_27(value: object) -> None:
+    # Compiled from #/definitions/Format
+    if type(value) is not dict:
+        raise SchemaValidationError(f"expected an object, found {describe(value)}")
+    for name, item in value.items():
+        validate = _data_channel_list_27_properties.get(name)
+        if validate is None:
+            raise SchemaValidationError(f"property '{name}' is not allowed")
+        try:
+            validate(item)
+        except SchemaValidationError as e:
+            e.prepend_property(name)
+            raise
+    if "Type" not in value:
+        raise SchemaValidationError("required property 'Type' is missing")
+
+
+def _data_channel_list_28(value: object) -> None:
+    # Compiled from #/definitions/Format/properties/Type
+    if type(value) is not str:
+        raise SchemaValidationError(f"expected a string, found {describe(value)}")
+
+
+def _data_channel_list_29(value: object) -> None:
+    # Compiled from #/definitions/Restriction
+    if type(value) is not dict:
+        raise SchemaValidationError(f"expected an object, found {describe(value)}")
+    for name, item in value.items():
+        validate = _data_channel_list_29_properties.get(name)
+        if validate is None:
+            raise SchemaValidationError(f"property '{name}' is not allowed")
+        try:
+            validate(item)
+        except SchemaValidationError as e:
+            e.prepend_property(name)
+            raise
+
+
+def _data_channel_list_30(value: object) -> None:
+    # Compiled from #/definitions/Restriction/properties/Enumeration
+    if type(value) is not list:
+        raise SchemaValidationError(f"expected an array, found {describe(value)}")
+    for i, item in enumerate(value):
+        try:
+            _data_channel_list_31(item)
+        except SchemaValidationError as e:
+            e.prepend_index(i)
+            raise
+
+
+def _data_channel_list_31(value: object) -> None:
+    # Compiled from #/definitions/Restriction/properties/Enumeration/items
+    if type(value) is not str:
+        raise SchemaValidationError(f"expected a string, found {describe(value)}")
+
+
+def _data_channel_list_32(value: object) -> None:
+    # Compiled from #/definitions/Restriction/properties/FractionDigits
+    if type(value) is not int and type(value) is not float:
+        raise SchemaValidationError(f"expected an integer, found {describe(value)}")
+    if type(value) is float and not value.is_integer():
+        raise SchemaValidationError(f"{value} is not an integer")
+    if value < 0:
+        raise SchemaValidationError(f"{value} is less than 0")
+
+
+def _data_channel_list_33(value: object) -> None:
+    # Compiled from #/definitions/Restriction/properties/Length
+    if type(value) is not int and type(value) is not float:
+        raise SchemaValidationError(f"expected an integer, found {describe(value)}")
+    if type(value) is float and not value.is_integer():
+        raise SchemaValidationError(f"{value} is not an integer")
+    if value < 0:
+        raise SchemaValidationError(f"{value} is less than 0")
+
+
+def _data_channel_list_34(value: object) -> None:
+    # Compiled from #/definitions/Restriction/properties/MaxExclusive
+    if type(value) is not int and type(value) is not float:
+        raise SchemaValidationError(f"expected a number, found {describe(value)}")
+
+
+def _data_channel_list_35(value: object) -> None:
+    # Compiled from #/definitions/Restriction/properties/MaxInclusive
+    if type(value) is not int and type(value) is not float:
+        raise SchemaValidationError(f"expected a number, found {describe(value)}")
+
+
+def _data_channel_list_36(value: object) -> None:
+    # Compiled from #/definitions/Restriction/properties/MaxLength
+    if type(value) is not int and type(value) is not float:
+        raise SchemaValidationError(f"expected an integer, found {describe(value)}")
+    if type(value) is float and not value.is_integer():
+        raise SchemaValidationError(f"{value} is not an integer")
+    if value < 0:
+        raise SchemaValidationError(f"{value} is less than 0")
+
+
+def _data_channel_list_37(value: object) -> None:
+    # Compiled from #/definitions/Restriction/properties/MinExclusive
+    if type(value) is not int and type(value) is not float:
+        raise SchemaValidationError(f"expected a number, found {describe(value)}")
+
+
+def _data_channel_list_38(value: object) -> None:
+    # Compiled from #/definitions/Restriction/properties/MinInclusive
+    if type(value) is not int and type(value) is not float:
+        raise SchemaValidationError(f"expected a number, found {describe(value)}")
+
+
+def _data_channel_list_39(value: object) -> None:
+    # Compiled from #/definitions/Restriction/properties/MinLength
+    if type(value) is not int and type(value) is not float:
+        raise SchemaValidationError(f"expected an integer, found {describe(value)}")
+    if type(value) is float and not value.is_integer():
+        raise SchemaValidationError(f"{value} is not an integer")
+    if value < 0:
+        raise SchemaValidationError(f"{value} is less than 0")
+
+
+def _data_channel_list_40(value: object) -> None:
+    # Compiled from #/definitions/Restriction/properties/Pattern
+    if type(value) is not str:
+        raise SchemaValidationError(f"expected a string, found {describe(value)}")
+
+
+def _data_channel_list_41(value: object) -> None:
+    # Compiled from #/definitions/Restriction/properties/TotalDigits
+    if type(value) is not int and type(value) is not float:
+        raise SchemaValidationError(f"expected an integer, found {describe(value)}")
+    if type(value) is float and not value.is_integer():
+        raise SchemaValidationError(f"{value} is not an integer")
+    if value < 1:
+        raise SchemaValidationError(f"{value} is less than 1")
+
+
+def _data_channel_list_42(value: object) -> None:
+    # Compiled from #/definitions/Restriction/properties/WhiteSpace
+    if type(value) is not str:
+        raise SchemaValidationError(f"expected a string, found {describe(value)}")
+    if value not in ("Preserve", "Replace", "Collapse"):
+        raise SchemaValidationError(
+            f"'{value}' is not one of Preserve, Replace, Collapse"
+        )
+
+
+def _data_channel_list_43(value: object) -> None:
+    # Compiled from #/definitions/Range
+    if type(value) is not dict:
+        raise SchemaValidationError(f"expected an object, found {describe(value)}")
+    for name, item in value.items():
+        validate = _data_channel_list_43_properties.get(name)
+        if validate is None:
+            raise SchemaValidationError(f"property '{name}' is not allowed")
+        try:
+            validate(item)
+        except SchemaValidationError as e:
+            e.prepend_property(name)
+            raise
+    if "High" not in value:
+        raise SchemaValidationError("required property 'High' is missing")
+    if "Low" not in value:
+        raise SchemaValidationError("required property 'Low' is missing")
+
+
+def _data_channel_list_44(value: object) -> None:
+    # Compiled from #/definitions/Range/properties/High
+    if type(value) is not int and type(value) is not float:
+        raise SchemaValidationError(f"expected a number, found {describe(value)}")
+
+
+def _data_channel_list_45(value: object) -> None:
+    # Compiled from #/definitions/Range/properties/Low
+    if type(value) is not int and type(value) is not float:
+        raise SchemaValidationError(f"expected a number, found {describe(value)}")
+
+
+def _data_channel_list_46(value: object) -> None:
+    # Compiled from #/definitions/Unit
+    if type(value) is not dict:
+        raise SchemaValidationError(f"expected an object, found {describe(value)}")
+    for name, item in value.items():
+        validate = _data_channel_list_46_properties.get(name)
+        if validate is None:
+            continue
+        try:
+            validate(item)
+        except SchemaValidationError as e:
+            e.prepend_property(name)
+            raise
+    if "UnitSymbol" not in value:
+        raise SchemaValidationError("required property 'UnitSymbol' is missing")
+
+
+def _data_channel_list_47(value: object) -> None:
+    # Compiled from #/definitions/Unit/properties/UnitSymbol
+    if type(value) is not str:
+        raise SchemaValidationError(f"expected a string, found {describe(value)}")
+
+
+def _data_channel_list_48(value: object) -> None:
+    # Compiled from #/definitions/Unit/properties/QuantityName
+    if type(value) is not str:
+        raise SchemaValidationError(f"expected a string, found {describe(value)}")
+
+
+def _data_channel_list_49(value: object) -> None:
+    # Compiled from #/definitions/Property/properties/QualityCoding
+    if type(value) is not str:
+        raise SchemaValidationError(f"expected a string, found {describe(value)}")
+
+
+def _data_channel_list_50(value: object) -> None:
+    # Compiled from #/definitions/Property/properties/AlertPriority
+    if type(value) is not str:
+        raise SchemaValidationError(f"expected a string, found {describe(value)}")
+
+
+def _data_channel_list_51(value: object) -> None:
+    # Compiled from #/definitions/Property/properties/Name
+    if type(value) is not str:
+        raise SchemaValidationError(f"expected a string, found {describe(value)}")
+
+
+def _data_channel_list_52(value: object) -> None:
+    # Compiled from #/definitions/Property/properties/Remarks
+    if type(value) is not str:
+        raise SchemaValidationError(f"expected a string, found {describe(value)}")
+
+
+def validate_time_series_data(value: object) -> None:
+    """Validate a package from json.loads against TimeSeriesData.schema.json.
+
+    Raises:
+        SchemaValidationError: If the package doesn't conform.
+    """
+    try:
+        _time_series_data_0(value)
+    except SchemaValidationError as e:
+        e.title = "TimeSeriesDataPackage"
+        raise
+
+
+def _time_series_data_0(value: object) -> None:
+    # Compiled from #
+    if type(value) is not dict:
+        raise SchemaValidationError(f"expected an object, found {describe(value)}")
+    for name, item in value.items():
+        validate = _time_series_data_0_properties.get(name)
+        if validate is None:
+            raise SchemaValidationError(f"property '{name}' is not allowed")
+        try:
+            validate(item)
+        except SchemaValidationError as e:
+            e.prepend_property(name)
+            raise
+    if "Package" not in value:
+        raise SchemaValidationError("required property 'Package' is missing")
+
+
+def _time_series_data_1(value: object) -> None:
+    # Compiled from #/definitions/Package
+    if type(value) is not dict:
+        raise SchemaValidationError(f"expected an object, found {describe(value)}")
+    for name, item in value.items():
+        validate = _time_series_data_1_properties.get(name)
+        if validate is None:
+            raise SchemaValidationError(f"property '{name}' is not allowed")
+        try:
+            validate(item)
+        except SchemaValidationError as e:
+            e.prepend_property(name)
+            raise
+    if "TimeSeriesData" not in value:
+        raise SchemaValidationError("required property 'TimeSeriesData' is missing")
+
+
+def _time_series_data_2(value: object) -> None:
+    # Compiled from #/definitions/Header
+    if type(value) is not dict:
+        raise SchemaValidationError(f"expected an object, found {describe(value)}")
+    for name, item in value.items():
+        validate = _time_series_data_2_properties.get(name)
+        if validate is None:
+            continue
+        try:
+            validate(item)
+        except SchemaValidationError as e:
+            e.prepend_property(name)
+            raise
+    if "ShipID" not in value:
+        raise SchemaValidationError("required property 'ShipID' is missing")
+
+
+def _time_series_data_3(value: object) -> None:
+    # Compiled from #/definitions/Header/properties/ShipID
+    if type(value) is not str:
+        raise SchemaValidationError(f"expected a string, found {describe(value)}")
+
+
+def _time_series_data_4(value: object) -> None:
+    # Compiled from #/definitions/TimeSpan
+    if type(value) is not dict:
+        raise SchemaValidationError(f"expected an object, found {describe(value)}")
+    for name, item in value.items():
+        validate = _time_series_data_4_properties.get(name)
+        if validate is None:
+            raise SchemaValidationError(f"property '{name}' is not allowed")
+        try:
+            validate(item)
+        except SchemaValidationError as e:
+            e.prepend_property(name)
+            raise
+    if "Start" not in value:
+        raise SchemaValidationError("required property 'Start' is missing")
+    if "End" not in value:
+        raise SchemaValidationError("required property 'End' is missing")
+
+
+def _time_series_data_5(value: object) -> None:
+    # Compiled from #/definitions/TimeSpan/properties/Start
+    if type(value) is not str:
+        raise SchemaValidationError(
+            f"expected a date-time string, found {describe(value)}"
+        )
+    if not is_date_time(value):
+        raise SchemaValidationError(f"'{value}' is not an ISO 8601 date-time")
+
+
+def _time_series_data_6(value: object) -> None:
+    # Compiled from #/definitions/TimeSpan/properties/End
+    if type(value) is not str:
+        raise SchemaValidationError(
+            f"expected a date-time string, found {describe(value)}"
+        )
+    if not is_date_time(value):
+        raise SchemaValidationError(f"'{value}' is not an ISO 8601 date-time")
+
+
+def _time_series_data_7(value: object) -> None:
+    # Compiled from #/definitions/Header/properties/DateCreated
+    if type(value) is not str:
+        raise SchemaValidationError(
+            f"expected a date-time string, found {describe(value)}"
+        )
+    if not is_date_time(value):
+        raise SchemaValidationError(f"'{value}' is not an ISO 8601 date-time")
+
+
+def _time_series_data_8(value: object) -> None:
+    # Compiled from #/definitions/Header/properties/DateModified
+    if type(value) is not str:
+        raise SchemaValidationError(
+            f"expected a date-time string, found {describe(value)}"
+        )
+    if not is_date_time(value):
+        raise SchemaValidationError(f"'{value}' is not an ISO 8601 date-time")
+
+
+def _time_series_data_9(value: object) -> None:
+    # Compiled from #/definitions/Header/properties/Author
+    if type(value) is not str:
+        raise SchemaValidationError(f"expected a string, found {describe(value)}")
+
+
+def _time_series_data_10(value: object) -> None:
+    # Compiled from #/definitions/Header/properties/SystemConfiguration
+    if type(value) is not list:
+        raise SchemaValidationError(f"expected an array, found {describe(value)}")
+    for i, item in enumerate(value):
+        try:
+            _time_series_data_11(item)
+        except SchemaValidationError as e:
+            e.prepend_index(i)
+            raise
+
+
+def _time_series_data_11(value: object) -> None:
+    # Compiled from #/definitions/ConfigurationReference
+    if type(value) is not dict:
+        raise SchemaValidationError(f"expected an object, found {describe(value)}")
+    for name, item in value.items():
+        validate = _time_series_data_11_properties.get(name)
+        if validate is None:
+            raise SchemaValidationError(f"property '{name}' is not allowed")
+        try:
+            validate(item)
+        except SchemaValidationError as e:
+            e.prepend_property(name)
+            raise
+    if "ID" not in value:
+        raise SchemaValidationError("required property 'ID' is missing")
+    if "TimeStamp" not in value:
+        raise SchemaValidationError("required property 'TimeStamp' is missing")
+
+
+def _time_series_data_12(value: object) -> None:
+    # Compiled from #/definitions/ConfigurationReference/properties/ID
+    if type(value) is not str:
+        raise SchemaValidationError(f"expected a string, found {describe(value)}")
+
+
+def _time_series_data_13(value: object) -> None:
+    # Compiled from #/definitions/ConfigurationReference/properties/TimeStamp
+    if type(value) is not str:
+        raise SchemaValidationError(
+            f"expected a date-time string, found {describe(value)}"
+        )
+    if not is_date_time(value):
+        raise SchemaValidationError(f"'{value}' is not an ISO 8601 date-time")
+
+
+def _time_series_data_14(value: object) -> None:
+    # Compiled from #/definitions/Package/properties/TimeSeriesData
+    if type(value) is not list:
+        raise SchemaValidationError(f"expected an array, found {describe(value)}")
+    for i, item in enumerate(value):
+        try:
+            _time_series_data_15(item)
+        except SchemaValidationError as e:
+            e.prepend_index(i)
+            raise
+
+
+def _time_series_data_15(value: object) -> None:
+    # Compiled from #/definitions/TimeSeriesData
+    if type(value) is not dict:
+        raise SchemaValidationError(f"expected an object, found {describe(value)}")
+    for name, item in value.items():
+        validate = _time_series_data_15_properties.get(name)
+        if validate is None:
+            continue
+        try:
+            validate(item)
+        except SchemaValidationError as e:
+            e.prepend_property(name)
+            raise
+
+
+def _time_series_data_16(value: object) -> None:
+    # Compiled from #/definitions/TimeSeriesData/properties/TabularData
+    if type(value) is not list:
+        raise SchemaValidationError(f"expected an array, found {describe(value)}")
+    for i, item in enumerate(value):
+        try:
+            _time_series_data_17(item)
+        except SchemaValidationError as e:
+            e.prepend_index(i)
+            raise
+
+
+def _time_series_data_17(value: object) -> None:
+    # Compiled from #/definitions/TabularData
+    if type(value) is not dict:
+        raise SchemaValidationError(f"expected an object, found {describe(value)}")
+    for name, item in value.items():
+        validate = _time_series_data_17_properties.get(name)
+        if validate is None:
+            raise SchemaValidationError(f"property '{name}' is not allowed")
+        try:
+            validate(item)
+        except SchemaValidationError as e:
+            e.prepend_property(name)
+            raise
+
+
+def _time_series_data_18(value: object) -> None:
+    # Compiled from #/definitions/TabularData/properties/NumberOfDataSet
+    if type(value) is not int and type(value) is not float:
+        raise SchemaValidationError(f"expected an integer, found {describe(value)}")
+    if type(value) is float and not value.is_integer():
+        raise SchemaValidationError(f"{value} is not an integer")
+    if value < 0:
+        raise SchemaValidationError(f"{value} is less than 0")
+
+
+def _time_series_data_19(value: object) -> None:
+    # Compiled from #/definitions/TabularData/properties/NumberOfDataChannel
+    if type(value) is not int and type(value) is not float:
+        raise SchemaValidationError(f"expected an integer, found {describe(value)}")
+    if type(value) is float and not value.is_integer():
+        raise SchemaValidationError(f"{value} is not an integer")
+    if value < 0:
+        raise SchemaValidationError(f"{value} is less than 0")
+
+
+def _time_series_data_20(value: object) -> None:
+    # Compiled from #/definitions/TabularData/properties/DataChannelID
+    if type(value) is not list:
+        raise SchemaValidationError(f"expected an array, found {describe(value)}")
+    for i, item in enumerate(value):
+        try:
+            _time_series_data_21(item)
+        except SchemaValidationError as e:
+            e.prepend_index(i)
+            raise
+
+
+def _time_series_data_21(value: object) -> None:
+    # Compiled from #/definitions/TabularData/properties/DataChannelID/items
+    if type(value) is not str:
+        raise SchemaValidationError(f"expected a string, found {describe(value)}")
+
+
+def _time_series_data_22(value: object) -> None:
+    # Compiled from #/definitions/TabularData/properties/DataSet
+    if type(value) is not list:
+        raise SchemaValidationError(f"expected an array, found {describe(value)}")
+    for i, item in enumerate(value):
+        try:
+            _time_series_data_23(item)
+        except SchemaValidationError as e:
+            e.prepend_index(i)
+            raise
+
+
+def _time_series_data_23(value: object) -> None:
+    # Compiled from #/definitions/DataSet_Tabular
+    if type(value) is not dict:
+        raise SchemaValidationError(f"expected an object, found {describe(value)}")
+    for name, item in value.items():
+        validate = _time_series_data_23_properties.get(name)
+        if validate is None:
+            raise SchemaValidationError(f"property '{name}' is not allowed")
+        try:
+            validate(item)
+        except SchemaValidationError as e:
+            e.prepend_property(name)
+            raise
+    if "TimeStamp" not in value:
+        raise SchemaValidationError("required property 'TimeStamp' is missing")
+    if "Value" not in value:
+        raise SchemaValidationError("required property 'Value' is missing")
+
+
+def _time_series_data_24(value: object) -> None:
+    # Compiled from #/definitions/DataSet_Tabular/properties/TimeStamp
+    if type(value) is not str:
+        raise SchemaValidationError(
+            f"expected a date-time string, found {describe(value)}"
+        )
+    if not is_date_time(value):
+        raise SchemaValidationError(f"'{value}' is not an ISO 8601 date-time")
+
+
+def _time_series_data_25(value: object) -> None:
+    # Compiled from #/definitions/DataSet_Tabular/properties/Value
+    if type(value) is not list:
+        raise SchemaValidationError(f"expected an array, found {describe(value)}")
+    for i, item in enumerate(value):
+        try:
+            _time_series_data_26(item)
+        except SchemaValidationError as e:
+            e.prepend_index(i)
+            raise
+
+
+def _time_series_data_26(value: object) -> None:
+    # Compiled from #/definitions/DataSet_Tabular/properties/Value/items
+    if type(value) is not str:
+        raise SchemaValidationError(f"expected a string, found {describe(value)}")
+
+
+def _time_series_data_27(value: object) -> None:
+    # Compiled from #/definitions/DataSet_Tabular/properties/Quality
+    if type(value) is not list:
+        raise SchemaValidationError(f"expected an array, found {describe(value)}")
+    for i, item in enumerate(value):
+        try:
+            _time_series_data_28(item)
+        except SchemaValidationError as e:
+            e.prepend_index(i)
+            raise
+
+
+def _time_series_data_28(value: object) -> None:
+    # Compiled from #/definitions/DataSet_Tabular/properties/Quality/items
+    if type(value) is not str:
+        raise SchemaValidationError(f"expected a string, found {describe(value)}")
+
+
+def _time_series_data_29(value: object) -> None:
+    # Compiled from #/definitions/EventData
+    if type(value) is not dict:
+        raise SchemaValidationError(f"expected an object, found {describe(value)}")
+    for name, item in value.items():
+        validate = _time_series_data_29_properties.get(name)
+        if validate is None:
+            raise SchemaValidationError(f"property '{name}' is not allowed")
+        try:
+            validate(item)
+        except SchemaValidationError as e:
+            e.prepend_property(name)
+            raise
+
+
+def _time_series_data_30(value: object) -> None:
+    # Compiled from #/definitions/EventData/properties/NumberOfDataSet
+    if type(value) is not int and type(value) is not float:
+        raise SchemaValidationError(f"expected an integer, found {describe(value)}")
+    if type(value) is float and not value.is_integer():
+        raise SchemaValidationError(f"{value} is not an integer")
+    if value < 0:
+        raise SchemaValidationError(f"{value} is less than 0")
+
+
+def _time_series_data_31(value: object) -> None:
+    # Compiled from #/definitions/EventData/properties/DataSet
+    if type(value) is not list:
+        raise SchemaValidationError(f"expected an array, found {describe(value)}")
+    for i, item in enumerate(value):
+        try:
+            _time_series_data_32(item)
+        except SchemaValidationError as e:
+            e.prepend_index(i)
+            raise
+
+
+def _time_series_data_32(value: object) -> None:
+    # Compiled from #/definitions/DataSet_Event
+    if type(value) is not dict:
+        raise SchemaValidationError(f"expected an object, found {describe(value)}")
+    for name, item in value.items():
+        validate = _time_series_data_32_properties.get(name)
+        if validate is None:
+            raise SchemaValidationError(f"property '{name}' is not allowed")
+        try:
+            validate(item)
+        except SchemaValidationError as e:
+            e.prepend_property(name)
+            raise
+    if "TimeStamp" not in value:
+        raise SchemaValidationError("required property 'TimeStamp' is missing")
+    if "DataChannelID" not in value:
+        raise SchemaValidationError("required property 'DataChannelID' is missing")
+    if "Value" not in value:
+        raise SchemaValidationError("required property 'Value' is missing")
+
+
+def _time_series_data_33(value: object) -> None:
+    # Compiled from #/definitions/DataSet_Event/properties/TimeStamp
+    if type(value) is not str:
+        raise SchemaValidationError(
+            f"expected a date-time string, found {describe(value)}"
+        )
+    if not is_date_time(value):
+        raise SchemaValidationError(f"'{value}' is not an ISO 8601 date-time")
+
+
+def _time_series_data_34(value: object) -> None:
+    # Compiled from #/definitions/DataSet_Event/properties/DataChannelID
+    if type(value) is not str:
+        raise SchemaValidationError(f"expected a string, found {describe(value)}")
+
+
+def _time_series_data_35(value: object) -> None:
+    # Compiled from #/definitions/DataSet_Event/properties/Value
+    if type(value) is not str:
+        raise SchemaValidationError(f"expected a string, found {describe(value)}")
+
+
+def _time_series_data_36(value: object) -> None:
+    # Compiled from #/definitions/DataSet_Event/properties/Quality
+    if type(value) is not str:
+        raise SchemaValidationError(f"expected a string, found {describe(value)}")
+
+
+_data_channel_list_4_properties = {
+    "ID": _data_channel_list_5,
+    "Version": _data_channel_list_6,
+    "TimeStamp": _data_channel_list_7,
+}
+
+_data_channel_list_8_properties = {
+    "NamingRule": _data_channel_list_9,
+    "NamingSchemeVersion": _data_channel_list_10,
+    "ReferenceURL": _data_channel_list_11,
+}
+
+_data_channel_list_2_properties = {
+    "ShipID": _data_channel_list_3,
+    "DataChannelListID": _data_channel_list_4,
+    "VersionInformation": _data_channel_list_8,
+    "Author": _data_channel_list_12,
+    "DateCreated": _data_channel_list_13,
+}
+
+_data_channel_list_20_properties = {
+    "NamingRule": _data_channel_list_21,
+}
+
+_data_channel_list_17_properties = {
+    "LocalID": _data_channel_list_18,
+    "ShortID": _data_channel_list_19,
+    "NameObject": _data_channel_list_20,
+}
+
+_data_channel_list_23_properties = {
+    "Type": _data_channel_list_24,
+    "UpdateCycle": _data_channel_list_25,
+    "CalculationPeriod": _data_channel_list_26,
+}
+
+_data_channel_list_29_properties = {
+    "Enumeration": _data_channel_list_30,
+    "FractionDigits": _data_channel_list_32,
+    "Length": _data_channel_list_33,
+    "MaxExclusive": _data_channel_list_34,
+    "MaxInclusive": _data_channel_list_35,
+    "MaxLength": _data_channel_list_36,
+    "MinExclusive": _data_channel_list_37,
+    "MinInclusive": _data_channel_list_38,
+    "MinLength": _data_channel_list_39,
+    "Pattern": _data_channel_list_40,
+    "TotalDigits": _data_channel_list_41,
+    "WhiteSpace": _data_channel_list_42,
+}
+
+_data_channel_list_27_properties = {
+    "Type": _data_channel_list_28,
+    "Restriction": _data_channel_list_29,
+}
+
+_data_channel_list_43_properties = {
+    "High": _data_channel_list_44,
+    "Low": _data_channel_list_45,
+}
+
+_data_channel_list_46_properties = {
+    "UnitSymbol": _data_channel_list_47,
+    "QuantityName": _data_channel_list_48,
+}
+
+_data_channel_list_22_properties = {
+    "DataChannelType": _data_channel_list_23,
+    "Format": _data_channel_list_27,
+    "Range": _data_channel_list_43,
+    "Unit": _data_channel_list_46,
+    "QualityCoding": _data_channel_list_49,
+    "AlertPriority": _data_channel_list_50,
+    "Name": _data_channel_list_51,
+    "Remarks": _data_channel_list_52,
+}
+
+_data_channel_list_16_properties = {
+    "DataChannelID": _data_channel_list_17,
+    "Property": _data_channel_list_22,
+}
+
+_data_channel_list_14_properties = {
+    "DataChannel": _data_channel_list_15,
+}
+
+_data_channel_list_1_properties = {
+    "Header": _data_channel_list_2,
+    "DataChannelList": _data_channel_list_14,
+}
+
+_data_channel_list_0_properties = {
+    "Package": _data_channel_list_1,
+}
+
+_time_series_data_4_properties = {
+    "Start": _time_series_data_5,
+    "End": _time_series_data_6,
+}
+
+_time_series_data_11_properties = {
+    "ID": _time_series_data_12,
+    "TimeStamp": _time_series_data_13,
+}
+
+_time_series_data_2_properties = {
+    "ShipID": _time_series_data_3,
+    "TimeSpan": _time_series_data_4,
+    "DateCreated": _time_series_data_7,
+    "DateModified": _time_series_data_8,
+    "Author": _time_series_data_9,
+    "SystemConfiguration": _time_series_data_10,
+}
+
+_time_series_data_23_properties = {
+    "TimeStamp": _time_series_data_24,
+    "Value": _time_series_data_25,
+    "Quality": _time_series_data_27,
+}
+
+_time_series_data_17_properties = {
+    "NumberOfDataSet": _time_series_data_18,
+    "NumberOfDataChannel": _time_series_data_19,
+    "DataChannelID": _time_series_data_20,
+    "DataSet": _time_series_data_22,
+}
+
+_time_series_data_32_properties = {
+    "TimeStamp": _time_series_data_33,
+    "DataChannelID": _time_series_data_34,
+    "Value": _time_series_data_35,
+    "Quality": _time_series_data_36,
+}
+
+_time_series_data_29_properties = {
+    "NumberOfDataSet": _time_series_data_30,
+    "DataSet": _time_series_data_31,
+}
+
+_time_series_data_15_properties = {
+    "DataConfiguration": _time_series_data_11,
+    "TabularData": _time_series_data_16,
+    "EventData": _time_series_data_29,
+}
+
+_time_series_data_1_properties = {
+    "Header": _time_series_data_2,
+    "TimeSeriesData": _time_series_data_14,
+}
+
+_time_series_data_0_properties = {
+    "Package": _time_series_data_1,
+}
@@ -11,6 +11,11 @@ import re
 from datetime import datetime
 from typing import TYPE_CHECKING, Any
 
+from vista_sdk.system_text_json.schema_validators import (
+    validate_data_channel_list,
+    validate_time_series_data,
+)
+
 if TYPE_CHECKING:
     from vista_sdk.system_text_json.data_channel_list import DataChannelListPackage
     from vista_sdk.system_text_json.time_series_data import TimeSeriesDataPackage
@@ -80,7 +85,10 @@ class Serializer:
 
     @staticmethod
     def deserialize_data_channel_list(
-        json_str: str, *, normalize_datetimes: bool = True
+        json_str: str,
+        *,
+        normalize_datetimes: bool = True,
+        validate_schema: bool = False,
     ) -> DataChannelListPackage:
         """Deserialize JSON string to DataChannelListPackage.
 
@@ -88,14 +96,26 @@ class Serializer:
             json_str: The JSON string to deserialize.
             normalize_datetimes: If True, normalizes datetime strings to use
                 'Z' suffix for UTC. Defaults to True.
+            validate_schema: If True, validates the parsed package against the
+                ISO19848 JSON schema, compiled to Python by
+                schema_validators_generator. Defaults to False.
+
+        Raises:
+            SchemaValidationError: If validate_schema is set and the package
+                doesn't conform.
         """
-        if normalize_datetimes:
-            return json.loads(json_str, object_hook=_normalize_datetimes_hook)  # type: ignore[return-value]
-        return json.loads(json_str)  # type: ignore[return-value]
+        hook = _normalize_datetimes_hook if normalize_datetimes else None
+        package = json.loads(json_str, object_hook=hook)
+        if validate_schema:
+            validate_data_channel_list(package)
+        return package  # type: ignore[no-any-return]
 
     @staticmethod
     def deserialize_time_series_data(
-        json_str: str, *, normalize_datetimes: bool = True
+        json_str: str,
+        *,
+        normalize_datetimes: bool = True,
+        validate_schema: bool = False,
     ) -> TimeSeriesDataPackage:
         """Deserialize JSON string to TimeSeriesDataPackage.
 
@@ -103,7 +123,16 @@ class Serializer:
             json_str: The JSON string to deserialize.
             normalize_datetimes: If True, normalizes datetime strings to use
                 'Z' suffix for UTC. Defaults to True.
+            validate_schema: If True, validates the parsed package against the
+                ISO19848 JSON schema, compiled to Python by
+                schema_validators_generator. Defaults to False.
+
+        Raises:
+            SchemaValidationError: If validate_schema is set and the package
+                doesn't conform.
         """
-        if normalize_datetimes:
-            return json.loads(json_str, object_hook=_normalize_datetimes_hook)  # type: ignore[return-value]
-        return json.loads(json_str)  # type: ignore[return-value]
+        hook = _normalize_datetimes_hook if normalize_datetimes else None
+        package = json.loads(json_str, object_hook=hook)
+        if validate_schema:
+            validate_time_series_data(package)
+        return package  # type: ignore[no-any-return]
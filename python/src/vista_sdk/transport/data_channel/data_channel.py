@@ -101,22 +101,32 @@ class VersionInformation:
 
 
 class DataChannelList:
-    """Collection of data channels with lookup capabilities."""
+    """Collection of data channels with lookup capabilities.
+
+    The LocalId index holds the channels in insertion order, so membership and
+    removal are dict operations. Positional access uses a list view of the index,
+    kept up to date by adds and rebuilt on first use after a removal.
+    """
 
     def __init__(self) -> None:
         """Initialize empty data channel list."""
-        self._data_channels: list[DataChannel] = []
-        self._short_id_map: dict[str, DataChannel] = {}
         self._local_id_map: dict[LocalId, DataChannel] = {}
+        self._short_id_map: dict[str, DataChannel] = {}
+        self._data_channels: list[DataChannel] | None = []
+
+    def _list(self) -> list[DataChannel]:
+        if self._data_channels is None:
+            self._data_channels = list(self._local_id_map.values())
+        return self._data_channels
 
     @property
     def data_channels(self) -> list[DataChannel]:
         """Get read-only list of data channels."""
-        return self._data_channels.copy()
+        return self._list().copy()
 
     def __len__(self) -> int:
         """Get number of data channels."""
-        return len(self._data_channels)
+        return len(self._local_id_map)
 
     def try_get_by_short_id(self, short_id: str) -> tuple[bool, DataChannel | None]:
         """Try to get data channel by short ID."""
@@ -129,79 +139,81 @@ class DataChannelList:
         return data_channel is not None, data_channel
 
     def add(self, data_channel: DataChannel | Iterable[DataChannel]) -> None:
-        """Add data channel(s) to the list."""
+        """Add data channel(s) to the list.
+
+        Several channels are added all or nothing: the list is unchanged when
+        one of them has the LocalId or ShortId of another channel.
+        """
         if isinstance(data_channel, DataChannel):
-            self._add_single(data_channel)
+            self._add_multiple((data_channel,))
         else:
             self._add_multiple(data_channel)
 
-    def _add_single(self, data_channel: DataChannel) -> None:
-        """Add a single data channel."""
-        local_id = data_channel.data_channel_id.local_id
-        if local_id in self._local_id_map:
-            raise ValueError(f"DataChannel with LocalId {local_id} already exists")
-
-        short_id = data_channel.data_channel_id.short_id
-        if short_id is not None:
-            if short_id in self._short_id_map:
-                raise ValueError(f"DataChannel with ShortId {short_id} already exists")
-            self._short_id_map[short_id] = data_channel
-
-        self._data_channels.append(data_channel)
-        self._local_id_map[local_id] = data_channel
-
     def _add_multiple(self, data_channels: Iterable[DataChannel]) -> None:
-        """Add multiple data channels."""
+        """Add data channels, checking them all before updating the indexes."""
+        local_ids: dict[LocalId, DataChannel] = {}
+        short_ids: dict[str, DataChannel] = {}
         for data_channel in data_channels:
-            self._add_single(data_channel)
+            local_id = data_channel.data_channel_id.local_id
+            if local_id in self._local_id_map or local_id in local_ids:
+                raise ValueError(f"DataChannel with LocalId {local_id} already exists")
+            local_ids[local_id] = data_channel
+
+            short_id = data_channel.data_channel_id.short_id
+            if short_id is not None:
+                if short_id in self._short_id_map or short_id in short_ids:
+                    raise ValueError(
+                        f"DataChannel with ShortId {short_id} already exists"
+                    )
+                short_ids[short_id] = data_channel
+
+        self._local_id_map.update(local_ids)
+        self._short_id_map.update(short_ids)
+        if self._data_channels is not None:
+            self._data_channels.extend(local_ids.values())
 
     def clear(self) -> None:
         """Clear all data channels."""
-        self._data_channels.clear()
-        self._short_id_map.clear()
         self._local_id_map.clear()
+        self._short_id_map.clear()
+        self._data_channels = []
 
     def __contains__(self, item: DataChannel) -> bool:
         """Check if data channel is in the list."""
-        return item in self._data_channels
+        return self._local_id_map.get(item.data_channel_id.local_id) is item
 
     def remove(self, item: DataChannel) -> bool:
         """Remove data channel from the list."""
         local_id = item.data_channel_id.local_id
-        if local_id not in self._local_id_map:
-            return False
-
-        short_id = item.data_channel_id.short_id
-        if short_id is not None and short_id not in self._short_id_map:
+        if self._local_id_map.get(local_id) is not item:
             return False
 
         del self._local_id_map[local_id]
+        short_id = item.data_channel_id.short_id
         if short_id is not None:
             del self._short_id_map[short_id]
-
-        try:
-            self._data_channels.remove(item)
-            return True
-        except ValueError:
-            return False
+        self._data_channels = None
+        return True
 
     def __getitem__(self, key: str | int | LocalId) -> DataChannel:
         """Get data channel by key."""
         if isinstance(key, str):
-            if key not in self._short_id_map:
+            data_channel = self._short_id_map.get(key)
+            if data_channel is None:
                 raise KeyError(f"No data channel with short ID '{key}'")
-            return self._short_id_map[key]
+            return data_channel
         if isinstance(key, int):
-            return self._data_channels[key]
+            return self._list()[key]
         if isinstance(key, LocalId):
-            if key not in self._local_id_map:
+            data_channel = self._local_id_map.get(key)
+            if data_channel is None:
                 raise KeyError(f"No data channel with local ID '{key}'")
-            return self._local_id_map[key]
+            return data_channel
         raise TypeError(f"Invalid key type: {type(key)}")
 
     def __iter__(self) -> Iterator[DataChannel]:
         """Iterate over data channels."""
-        return iter(self._data_channels)
+        return iter(self._list())
 
 
 class DataChannel:
@@ -13,6 +13,9 @@ from vista_sdk.transport.time_series_data.time_series_data import (
     TimeSeriesDataPackage,
     TimeSpan,
 )
+from vista_sdk.transport.time_series_data.time_series_data_producer import (
+    TimeSeriesDataProducer,
+)
 
 __all__ = [
     "ConfigurationReference",
@@ -25,5 +28,6 @@ __all__ = [
     "TabularDataSet",
     "TimeSeriesData",
     "TimeSeriesDataPackage",
+    "TimeSeriesDataProducer",
     "TimeSpan",
 ]
@@ -0,0 +1,261 @@
+"""Producer of TimeSeriesData packages from raw channel readings.
+
+Readings are addressed by the channel's short id. Channels are grouped by
+their update cycle, each group becoming one TabularData whose rows are the time
+slots of the update cycle. A reading is placed in the slot its time stamp falls
+in, a later reading of the same channel and slot replaces it. Channels without
+an update cycle share a group whose rows are their exact time stamps. Only the
+channels with readings are columns of a table. Rows without a reading of some
+channel are sent in another table of the channels they have, so every row is
+complete and the package validates against the DataChannelList.
+
+A package is emitted when a reading falls outside the time window of the
+buffered readings, when the number of buffered readings reaches the size limit,
+or on flush. Windows are aligned on multiples of the interval since the Unix
+epoch.
+"""
+
+from __future__ import annotations
+
+from collections.abc import Callable
+from datetime import datetime, timedelta, timezone
+from typing import TYPE_CHECKING
+
+from vista_sdk.transport.time_series_data.data_channel_id import DataChannelId
+from vista_sdk.transport.time_series_data.time_series_data import (
+    Header,
+    Package,
+    TabularData,
+    TabularDataSet,
+    TimeSeriesData,
+    TimeSeriesDataPackage,
+    TimeSpan,
+)
+
+if TYPE_CHECKING:
+    from vista_sdk.local_id import LocalId
+    from vista_sdk.transport.data_channel.data_channel import DataChannelListPackage
+
+_EPOCH = datetime(1970, 1, 1, tzinfo=timezone.utc)
+
+
+def _utc(time_stamp: datetime) -> datetime:
+    """Naive time stamps are UTC."""
+    if time_stamp.tzinfo is None:
+        return time_stamp.replace(tzinfo=timezone.utc)
+    return time_stamp
+
+
+class _Table:
+    """The rows of the channels of one update cycle, by time slot."""
+
+    __slots__ = ("ids", "qualities", "rows", "slot")
+
+    def __init__(self, slot: timedelta | None) -> None:
+        self.slot = slot
+        self.ids: list[LocalId] = []
+        # Slots are time stamps, rather than numbers, so they need no conversion
+        self.rows: dict[datetime, list[str | None]] = {}
+        # Only the rows with a quality
+        self.qualities: dict[datetime, list[str | None]] = {}
+
+    def set(
+        self, time_stamp: datetime, column: int, value: str, quality: str | None
+    ) -> bool:
+        """Set a cell, returns False when replacing the reading of a cell."""
+        slot = time_stamp
+        if self.slot is not None:
+            slot -= (time_stamp - _EPOCH) % self.slot
+        row = self.rows.get(slot)
+        if row is None:
+            row = self.rows[slot] = [None] * len(self.ids)
+        is_new = row[column] is None
+        row[column] = value
+        if quality is not None:
+            qualities = self.qualities.get(slot)
+            if qualities is None:
+                qualities = self.qualities[slot] = [None] * len(self.ids)
+            qualities[column] = quality
+        elif self.qualities and (qualities := self.qualities.get(slot)) is not None:
+            qualities[column] = None
+        return is_new
+
+    def to_tabular_data(self) -> list[TabularData]:
+        """One table per set of channels the rows have readings of."""
+        groups: dict[tuple[int, ...], list[datetime]] = {}
+        for slot in sorted(self.rows):
+            row = self.rows[slot]
+            columns = tuple(c for c, v in enumerate(row) if v is not None)
+            groups.setdefault(columns, []).append(slot)
+        return [self._create_table(columns, slots) for columns, slots in groups.items()]
+
+    def _create_table(
+        self, columns: tuple[int, ...], slots: list[datetime]
+    ) -> TabularData:
+        data_sets = [
+            TabularDataSet(slot, [self.rows[slot][c] for c in columns])  # type: ignore[misc]
+            for slot in slots
+        ]
+
+        # Only tables with qualities carry a quality per value
+        no_quality: list[str | None] = [None] * len(self.ids)
+        if self.qualities and any(slot in self.qualities for slot in slots):
+            for slot, data_set in zip(slots, data_sets, strict=True):
+                qualities = self.qualities.get(slot, no_quality)
+                data_set.quality = [qualities[c] or "" for c in columns]
+
+        return TabularData(
+            data_channel_ids=[DataChannelId(local_id=self.ids[c]) for c in columns],
+            data_sets=data_sets,
+        )
+
+    def clear(self) -> None:
+        self.rows.clear()
+        self.qualities.clear()
+
+
+class TimeSeriesDataProducer:
+    """Buffers raw readings of the channels of a DataChannelList into packages.
+
+    The channels are read once, on construction. Not thread safe.
+    """
+
+    def __init__(
+        self,
+        data_channel_list_package: DataChannelListPackage,
+        on_package: Callable[[TimeSeriesDataPackage], None],
+        interval: timedelta,
+        max_readings: int = 100_000,
+        author: str | None = None,
+    ) -> None:
+        """Create a producer emitting packages of the interval to on_package."""
+        if interval <= timedelta(0):
+            raise ValueError(f"Invalid interval {interval}. Should be positive")
+        if max_readings <= 0:
+            raise ValueError(f"Invalid max_readings {max_readings}. Should be positive")
+
+        self._package = data_channel_list_package
+        self._on_package = on_package
+        self._interval = interval
+        self._max_readings = max_readings
+        self._author = author
+
+        self._channels: dict[str, tuple[_Table, int]] = {}
+        tables: dict[float, _Table] = {}
+        unaligned: _Table | None = None
+        for data_channel in data_channel_list_package.data_channel_list:
+            short_id = data_channel.data_channel_id.short_id
+            if short_id is None:
+                continue
+            cycle = data_channel.property_.data_channel_type.update_cycle
+            if cycle is None or cycle <= 0:
+                if unaligned is None:
+                    unaligned = _Table(None)
+                table = unaligned
+            else:
+                table = tables.get(cycle)  # type: ignore[assignment]
+                if table is None:
+                    slot = max(timedelta(seconds=cycle), timedelta(microseconds=1))
+                    table = tables[cycle] = _Table(slot)
+            table.ids.append(data_channel.data_channel_id.local_id)
+            self._channels[short_id] = (table, len(table.ids) - 1)
+
+        self._tables = [tables[cycle] for cycle in sorted(tables)]
+        if unaligned is not None:
+            self._tables.append(unaligned)
+
+        # Empty until the first reading
+        self._window_start = self._window_end = _EPOCH
+        self._readings = 0
+
+        self.received_readings = 0
+        """Number of readings passed to the producer."""
+        self.rejected_readings = 0
+        """Number of readings of channels not in the DataChannelList."""
+        self.emitted_packages = 0
+        """Number of packages passed to on_package."""
+
+    @property
+    def buffered_readings(self) -> int:
+        """Number of readings waiting for the next package."""
+        return self._readings
+
+    def try_add(
+        self,
+        short_id: str,
+        time_stamp: datetime,
+        value: str | float,
+        quality: str | None = None,
+    ) -> bool:
+        """Buffer a reading, returns False when the channel is unknown.
+
+        The buffered package is emitted first when the reading falls outside of
+        its window.
+        """
+        self.received_readings += 1
+        channel = self._channels.get(short_id)
+        if channel is None:
+            self.rejected_readings += 1
+            return False
+
+        if time_stamp.tzinfo is None:
+            time_stamp = _utc(time_stamp)
+        if not self._window_start <= time_stamp < self._window_end:
+            self.flush()
+            self._window_start = time_stamp - (time_stamp - _EPOCH) % self._interval
+            self._window_end = self._window_start + self._interval
+
+        table, column = channel
+        if value.__class__ is not str:
+            value = repr(value)
+        if table.set(time_stamp, column, value, quality):  # type: ignore[arg-type]
+            self._readings += 1
+
+        if self._readings >= self._max_readings:
+            self.flush()
+        return True
+
+    def flush_if_due(self, now: datetime) -> None:
+        """Emit the buffered package when its window ended before now.
+
+        For timers, so the last readings before a pause are not held back until
+        the next reading.
+        """
+        if self._readings > 0 and _utc(now) >= self._window_end:
+            self.flush()
+
+    def flush(self) -> None:
+        """Emit the buffered readings, if any."""
+        if self._readings == 0:
+            return
+
+        tabular_data: list[TabularData] = []
+        for table in self._tables:
+            if not table.rows:
+                continue
+            tabular_data.extend(table.to_tabular_data())
+            table.clear()
+        self._readings = 0
+
+        start = min(t.data_sets[0].time_stamp for t in tabular_data)  # type: ignore[index]
+        end = max(t.data_sets[-1].time_stamp for t in tabular_data)  # type: ignore[index]
+        header = self._package.package.header
+        package = TimeSeriesDataPackage(
+            Package(
+                header=Header(
+                    ship_id=header.ship_id,
+                    time_span=TimeSpan(start=start, end=end),
+                    author=self._author,
+                ),
+                time_series_data=[
+                    TimeSeriesData(
+                        data_configuration=header.data_channel_list_id.as_time_series_reference(),
+                        tabular_data=tabular_data,
+                        event_data=None,
+                    )
+                ],
+            )
+        )
+
+        self.emitted_packages += 1
+        self._on_package(package)
@@ -14,8 +14,19 @@ from tests.benchmark.benchmark_base import (
     SummaryOrderPolicy,
     run_benchmark,
 )
+from vista_sdk.codebook_names import CodebookName
+from vista_sdk.local_id import LocalId
+from vista_sdk.metadata_tag import MetadataTag
 from vista_sdk.system_text_json import Serializer as JsonSerializer
 from vista_sdk.system_text_json.data_channel_list import DataChannelListPackage
+from vista_sdk.transport.data_channel import (
+    DataChannel,
+    DataChannelId,
+    DataChannelList,
+    DataChannelType,
+    Format,
+    Property,
+)
 
 
 @pytest.mark.benchmark(group="transport")
@@ -119,3 +130,138 @@ class TestDataChannelListSerialization:
         result = run_benchmark(benchmark, serialize_and_compress, config)
         assert result is not None
         assert len(result) > 0
+
+
+CHANNEL_COUNT = 50_000
+LOOKUPS = 1_000
+
+
+@pytest.mark.benchmark(group="transport")
+class TestDataChannelListIndexes:
+    """Membership, removal and bulk add on a list of 50k channels.
+
+    The List benchmarks do the same with a plain list of the channels, as the
+    DataChannelList did before it was backed by its LocalId index.
+    """
+
+    @pytest.fixture(scope="class")
+    def channels(self) -> list[DataChannel]:
+        """Channels of one LocalId with a different custom detail each."""
+        local_id = LocalId.parse(
+            "/dnv-v2/vis-3-4a/411.1/C101.31-2/meta/qty-temperature/cnt-exhaust.gas"
+        )
+        property_ = Property(
+            data_channel_type=DataChannelType("Inst", update_cycle=1.0),
+            data_format=Format("String"),
+            data_range=None,
+            unit=None,
+        )
+        return [
+            DataChannel(
+                DataChannelId(
+                    LocalId(
+                        local_id.builder.with_metadata_tag(
+                            MetadataTag(CodebookName.Detail, f"ch{i}", is_custom=True)
+                        )
+                    ),
+                    f"{i:05}",
+                ),
+                property_,
+            )
+            for i in range(CHANNEL_COUNT)
+        ]
+
+    @staticmethod
+    def _config(description: str) -> BenchmarkConfig:
+        return BenchmarkConfig(
+            group="DataChannelListIndexes",
+            method_order=MethodOrderPolicy.Declared,
+            summary_order=SummaryOrderPolicy.FastestToSlowest,
+            description=description,
+        )
+
+    def test_add(
+        self, benchmark: BenchmarkFixture, channels: list[DataChannel]
+    ) -> None:
+        """Bulk add of all channels, checking both indexes for duplicates."""
+
+        def add() -> int:
+            dc_list = DataChannelList()
+            dc_list.add(channels)
+            return len(dc_list)
+
+        assert run_benchmark(benchmark, add, self._config("Add")) == CHANNEL_COUNT
+
+    def test_contains_list(
+        self, benchmark: BenchmarkFixture, channels: list[DataChannel]
+    ) -> None:
+        """Membership of the last channels, scanning the list."""
+        lookups = channels[-LOOKUPS:]
+
+        def contains() -> int:
+            return sum(dc in channels for dc in lookups)
+
+        result = run_benchmark(benchmark, contains, self._config("Contains (List)"))
+        assert result == LOOKUPS
+
+    def test_contains(
+        self, benchmark: BenchmarkFixture, channels: list[DataChannel]
+    ) -> None:
+        """Membership of the last channels, in the LocalId index."""
+        dc_list = DataChannelList()
+        dc_list.add(channels)
+        lookups = channels[-LOOKUPS:]
+
+        def contains() -> int:
+            return sum(dc in dc_list for dc in lookups)
+
+        result = run_benchmark(benchmark, contains, self._config("Contains"))
+        assert result == LOOKUPS
+
+    def test_remove_list(
+        self, benchmark: BenchmarkFixture, channels: list[DataChannel]
+    ) -> None:
+        """Removal of every 50th channel from a copy of the list."""
+        removed = channels[::50]
+
+        def remove() -> int:
+            remaining = channels.copy()
+            for dc in removed:
+                remaining.remove(dc)
+            return len(remaining)
+
+        result = run_benchmark(benchmark, remove, self._config("Remove (List)"))
+        assert result == CHANNEL_COUNT - len(removed)
+
+    def test_remove(
+        self, benchmark: BenchmarkFixture, channels: list[DataChannel]
+    ) -> None:
+        """Removal of every 50th channel from a new DataChannelList.
+
+        Includes the bulk add, as the list copy of the List benchmark.
+        """
+        removed = channels[::50]
+
+        def remove() -> int:
+            dc_list = DataChannelList()
+            dc_list.add(channels)
+            for dc in removed:
+                dc_list.remove(dc)
+            return len(dc_list)
+
+        result = run_benchmark(benchmark, remove, self._config("Remove"))
+        assert result == CHANNEL_COUNT - len(removed)
+
+    def test_local_id_lookup(
+        self, benchmark: BenchmarkFixture, channels: list[DataChannel]
+    ) -> None:
+        """Lookup of every channel by its LocalId, hashed once per LocalId."""
+        dc_list = DataChannelList()
+        dc_list.add(channels)
+        local_ids = [dc.data_channel_id.local_id for dc in channels]
+
+        def lookup() -> int:
+            return sum(dc_list[local_id] is not None for local_id in local_ids)
+
+        result = run_benchmark(benchmark, lookup, self._config("LocalId lookup"))
+        assert result == CHANNEL_COUNT
@@ -0,0 +1,71 @@
+"""Gmod search benchmarks matching C# implementation."""
+
+import pytest
+from pytest_benchmark.fixture import BenchmarkFixture
+
+from tests.benchmark.benchmark_base import (
+    BenchmarkConfig,
+    MethodOrderPolicy,
+    SummaryOrderPolicy,
+    run_benchmark,
+)
+from vista_sdk.gmod import Gmod
+from vista_sdk.vis import VIS
+from vista_sdk.vis_version import VisVersion
+
+# What users type while searching: a code prefix, then the start of a word,
+# then most of one
+QUERIES = ["c", "pum", "lubricat"]
+
+
+@pytest.mark.benchmark(group="gmod")
+class TestGmodSearch:
+    """Mirror of C#'s GmodSearch benchmark class."""
+
+    @pytest.fixture(scope="class")
+    def gmod(self) -> Gmod:
+        """Mirror of C#'s Setup method, builds the index outside of the measurements."""
+        gmod = VIS().get_gmod(VisVersion.v3_4a)
+        gmod.search("c")
+        return gmod
+
+    @pytest.mark.parametrize("query", QUERIES)
+    def test_scan(self, benchmark: BenchmarkFixture, gmod: Gmod, query: str) -> None:
+        """Scan of every node, as done without the index."""
+        lowered = query.lower()
+
+        def scan() -> int:
+            count = 0
+            for node in gmod:
+                metadata = node.metadata
+                if (
+                    node.code.lower().startswith(lowered)
+                    or lowered in (metadata.name or "").lower()
+                    or lowered in (metadata.common_name or "").lower()
+                    or lowered in (metadata.definition or "").lower()
+                ):
+                    count += 1
+            return count
+
+        config = BenchmarkConfig(
+            group="GmodSearch",
+            method_order=MethodOrderPolicy.Declared,
+            summary_order=SummaryOrderPolicy.FastestToSlowest,
+            description=f"Scan '{query}'",
+        )
+        assert run_benchmark(benchmark, scan, config) > 0
+
+    @pytest.mark.parametrize("query", QUERIES)
+    def test_search(self, benchmark: BenchmarkFixture, gmod: Gmod, query: str) -> None:
+        """Mirror of C#'s Search benchmark method."""
+
+        def search() -> int:
+            return len(gmod.search(query))
+
+        config = BenchmarkConfig(
+            group="GmodSearch",
+            method_order=MethodOrderPolicy.Declared,
+            summary_order=SummaryOrderPolicy.FastestToSlowest,
+            description=f"Search '{query}'",
+        )
+        assert run_benchmark(benchmark, search, config) > 0
@@ -0,0 +1,142 @@
+"""TimeSeriesData producer benchmarks matching C# implementation."""
+
+import random
+from collections import defaultdict
+from datetime import datetime, timedelta, timezone
+from pathlib import Path
+
+import pytest
+from pytest_benchmark.fixture import BenchmarkFixture
+
+from tests.benchmark.benchmark_base import (
+    BenchmarkConfig,
+    MethodOrderPolicy,
+    SummaryOrderPolicy,
+    run_benchmark,
+)
+from vista_sdk.system_text_json import Serializer
+from vista_sdk.system_text_json.extensions import JsonExtensions
+from vista_sdk.transport.data_channel.data_channel import DataChannelListPackage
+from vista_sdk.transport.time_series_data import (
+    TabularDataSet,
+    TimeSeriesDataPackage,
+    TimeSeriesDataProducer,
+)
+
+START = datetime(2024, 1, 1, tzinfo=timezone.utc)
+SECONDS = 3000
+
+Reading = tuple[str, datetime, str]
+
+
+@pytest.mark.benchmark(group="transport")
+class TestTimeSeriesProducer:
+    """Mirror of C#'s TimeSeriesProducer benchmark class.
+
+    The test DataChannelList only has 4 channels: the 1 s and 60 s channels are
+    read once a second, the alerts once a minute.
+    """
+
+    @pytest.fixture(scope="class")
+    def setup_data(self) -> tuple[DataChannelListPackage, list[Reading]]:
+        """Mirror of C#'s Setup method."""
+        json_path = Path(__file__).parent.parent / "transport" / "json"
+        dto = Serializer.deserialize_data_channel_list(
+            (json_path / "DataChannelList.json").read_text()
+        )
+        dc_package = JsonExtensions.DataChannelList.to_domain_model(dto)
+
+        rng = random.Random(42)
+        readings: list[Reading] = []
+        for second in range(SECONDS):
+            time = START + timedelta(seconds=second)
+            for short_id in ("0010", "0020"):
+                jitter = timedelta(milliseconds=rng.randrange(1000))
+                readings.append((short_id, time + jitter, f"{rng.random() * 100:.1f}"))
+            if second % 60 == 0:
+                readings.append(("0011", time, "1"))
+        return dc_package, readings
+
+    def test_buffered(
+        self,
+        benchmark: BenchmarkFixture,
+        setup_data: tuple[DataChannelListPackage, list[Reading]],
+    ) -> None:
+        """Reading lists per channel, grouped on flush, as in the samples."""
+        dc_package, readings = setup_data
+        channels = dc_package.data_channel_list
+
+        def flush(buffer: dict[str, list[tuple[datetime, str]]]) -> int:
+            groups: dict[float | None, list[str]] = defaultdict(list)
+            for short_id in buffer:
+                _, dc = channels.try_get_by_short_id(short_id)
+                groups[dc.property_.data_channel_type.update_cycle].append(short_id)  # type: ignore[union-attr]
+
+            rows = 0
+            for cycle, short_ids in groups.items():
+                slot = timedelta(seconds=cycle) if cycle else None
+                table: dict[datetime, list[str]] = {}
+                for c, short_id in enumerate(short_ids):
+                    for time_stamp, value in buffer[short_id]:
+                        if slot is not None:
+                            time_stamp -= (time_stamp - START) % slot
+                        row = table.setdefault(time_stamp, [""] * len(short_ids))
+                        row[c] = value
+                data_sets = [TabularDataSet(t, table[t]) for t in sorted(table)]
+                rows += len(data_sets)
+            buffer.clear()
+            return rows
+
+        def buffered() -> int:
+            buffer: dict[str, list[tuple[datetime, str]]] = {}
+            window_end = START + timedelta(minutes=1)
+            rows = 0
+            for short_id, time_stamp, value in readings:
+                ok, _ = channels.try_get_by_short_id(short_id)
+                if not ok:
+                    continue
+                if time_stamp >= window_end:
+                    rows += flush(buffer)
+                    window_end += timedelta(minutes=1)
+                buffer.setdefault(short_id, []).append((time_stamp, value))
+            return rows + flush(buffer)
+
+        config = BenchmarkConfig(
+            group="TimeSeriesProducer",
+            method_order=MethodOrderPolicy.Declared,
+            summary_order=SummaryOrderPolicy.FastestToSlowest,
+            description="Buffered",
+        )
+        assert run_benchmark(benchmark, buffered, config) > 0
+
+    def test_producer(
+        self,
+        benchmark: BenchmarkFixture,
+        setup_data: tuple[DataChannelListPackage, list[Reading]],
+    ) -> None:
+        """Mirror of C#'s Producer benchmark method."""
+        dc_package, readings = setup_data
+
+        def produce() -> int:
+            rows = 0
+
+            def on_package(package: TimeSeriesDataPackage) -> None:
+                nonlocal rows
+                for table in package.package.time_series_data[0].tabular_data or []:
+                    rows += len(table.data_sets or [])
+
+            producer = TimeSeriesDataProducer(
+                dc_package, on_package, timedelta(minutes=1)
+            )
+            for short_id, time_stamp, value in readings:
+                producer.try_add(short_id, time_stamp, value)
+            producer.flush()
+            return rows
+
+        config = BenchmarkConfig(
+            group="TimeSeriesProducer",
+            method_order=MethodOrderPolicy.Declared,
+            summary_order=SummaryOrderPolicy.FastestToSlowest,
+            description="Producer",
+        )
+        assert run_benchmark(benchmark, produce, config) > 0
@@ -0,0 +1,148 @@
+"""Allocation budget tests for hot operations of the Vista SDK.
+
+Mirrors the C# AllocationBudgetTests. tracemalloc only sees live memory, so the
+measure is the peak of memory allocated during an operation, averaged over the
+inputs from testdata after a warm up pass that fills caches and lazy state.
+A failure means an operation allocates more than it used to, lower the budget
+when an operation gets cheaper.
+"""
+
+import tracemalloc
+import unittest
+from collections.abc import Callable, Sequence
+from pathlib import Path
+from typing import TypeVar
+
+from vista_sdk.codebook_names import CodebookName
+from vista_sdk.gmod_path import GmodPath
+from vista_sdk.local_id import LocalId
+from vista_sdk.local_id_builder import LocalIdBuilder
+from vista_sdk.vis_version import VisVersion, VisVersions
+
+from .test_vis import TestVis
+from .testdata import TestData
+
+T = TypeVar("T")
+
+# Every n-th line of LocalIds.txt, tracing allocations is slow
+LOCAL_ID_STRIDE = 20
+
+# Average peak bytes allocated per operation, measured on CPython 3.13 with
+# some room for interpreter differences
+BUDGETS = {
+    "GmodPath.try_parse": 4600,  # about 3.7 KB
+    "LocalIdBuilder.try_parse": 5100,  # about 4.1 KB
+    "LocalId.__str__": 660,  # about 530 bytes
+    "Locations.try_parse": 440,  # about 350 bytes
+    "Codebook.validate_position": 640,  # about 510 bytes
+    "Dictionary.try_get_value": 0,
+}
+
+
+def measure(inputs: Sequence[T], operation: Callable[[T], object]) -> int:
+    """Average peak bytes allocated by the operation over the inputs."""
+    for item in inputs:
+        operation(item)
+
+    total = 0
+    tracemalloc.start()
+    try:
+        for item in inputs:
+            before, _ = tracemalloc.get_traced_memory()
+            tracemalloc.reset_peak()
+            operation(item)
+            _, peak = tracemalloc.get_traced_memory()
+            total += peak - before
+    finally:
+        tracemalloc.stop()
+    return total // len(inputs)
+
+
+class TestAllocationBudgets(unittest.TestCase):
+    """Bytes allocated per operation of hot APIs, against declared budgets."""
+
+    local_ids: list[LocalId]
+    gmod_paths: list[GmodPath]
+
+    @classmethod
+    def setUpClass(cls) -> None:
+        """Load the inputs from testdata."""
+        TestVis.get_vis()
+
+        path = Path(__file__).parent / "testdata" / "LocalIds.txt"
+        with path.open() as file:
+            lines = [line.strip() for line in file][::LOCAL_ID_STRIDE]
+        cls.local_ids = []
+        for line in lines:
+            parsed, _, local_id = LocalId.try_parse(line)
+            if parsed and local_id is not None:
+                cls.local_ids.append(local_id)
+
+        cls.gmod_paths = [
+            GmodPath.parse(item.path, VisVersions.parse(item.vis_version))
+            for item in TestData.get_valid_gmod_path_data()
+        ]
+
+    def assert_budget(
+        self, name: str, inputs: Sequence[T], operation: Callable[[T], object]
+    ) -> None:
+        """Fail when the operation allocates more than its budget."""
+        assert inputs, f"No inputs for {name}"
+        per_operation = measure(inputs, operation)
+        budget = BUDGETS[name]
+        assert per_operation <= budget, (
+            f"{name}: {per_operation} bytes per operation, budget is {budget} bytes"
+        )
+
+    def test_gmod_path_try_parse(self) -> None:
+        """Test GmodPath.try_parse."""
+        inputs = [(str(p), p.vis_version) for p in self.gmod_paths]
+        self.assert_budget(
+            "GmodPath.try_parse",
+            inputs,
+            lambda item: GmodPath.try_parse(item[0], item[1]),
+        )
+
+    def test_local_id_builder_try_parse(self) -> None:
+        """Test LocalIdBuilder.try_parse."""
+        inputs = [str(local_id) for local_id in self.local_ids]
+        self.assert_budget("LocalIdBuilder.try_parse", inputs, LocalIdBuilder.try_parse)
+
+    def test_local_id_str(self) -> None:
+        """Test LocalId.__str__."""
+        self.assert_budget("LocalId.__str__", self.local_ids, str)
+
+    def test_locations_try_parse(self) -> None:
+        """Test Locations.try_parse."""
+        inputs = [
+            str(node.location)
+            for local_id in self.local_ids
+            for _, node in local_id.primary_item.get_full_path()
+            if node.location is not None
+        ]
+        locations = TestVis.get_vis().get_locations(VisVersion.v3_4a)
+        self.assert_budget("Locations.try_parse", inputs, locations.try_parse)
+
+    def test_codebook_validate_position(self) -> None:
+        """Test Codebook.validate_position."""
+        inputs = [
+            local_id.position.value
+            for local_id in self.local_ids
+            if local_id.position is not None
+        ]
+        positions = TestVis.get_vis().get_codebooks(VisVersion.v3_4a)[
+            CodebookName.Position
+        ]
+        self.assert_budget(
+            "Codebook.validate_position", inputs, positions.validate_position
+        )
+
+    def test_dictionary_try_get_value(self) -> None:
+        """Test the node map lookup behind Gmod.try_get_node."""
+        inputs = [
+            node.code for path in self.gmod_paths for _, node in path.get_full_path()
+        ]
+        gmod = TestVis.get_vis().get_gmod(VisVersion.v3_4a)
+        self.assert_budget(
+            "Dictionary.try_get_value", inputs, gmod._node_map.try_get_value
+        )
@@ -0,0 +1,95 @@
+"""Tests for Gmod search in the Vista SDK."""
+
+import unittest
+
+import pytest
+
+from vista_sdk.gmod_node import GmodNode
+from vista_sdk.internal.gmod_search_index import CODE_EXACT, tokenize
+from vista_sdk.vis_version import VisVersion
+
+from .test_vis import TestVis
+
+
+def _text(node: GmodNode) -> str:
+    metadata = node.metadata
+    return " ".join(
+        text or ""
+        for text in (
+            metadata.name,
+            metadata.common_name,
+            metadata.definition,
+            metadata.common_definition,
+        )
+    ).lower()
+
+
+def _matches(node: GmodNode, query: str) -> bool:
+    """Query semantics without the index."""
+    text = query.strip().lower()
+    if node.code.lower().startswith(text):
+        return True
+
+    tokens = tokenize(text)
+    words = tokenize(_text(node))
+    return bool(tokens) and all(
+        any(w.startswith(t) if len(t) < 3 else t in w for w in words) for t in tokens
+    )
+
+
+class TestGmodSearch(unittest.TestCase):
+    """Unit tests for Gmod.search."""
+
+    def setUp(self) -> None:
+        """Set up the test environment."""
+        self.vis = TestVis.get_vis()
+
+    def test_code_search(self) -> None:
+        """Test exact and prefix code matches."""
+        gmod = self.vis.get_gmod(VisVersion.v3_4a)
+
+        exact = gmod.search("411.1")
+        assert exact[0].node.code == "411.1"
+        assert exact[0].score == CODE_EXACT
+
+        prefix = gmod.search("c101.", max_results=20)
+        assert len(prefix) == 20
+        assert all(r.node.code.startswith("C101.") for r in prefix)
+        # Shortest codes first
+        lengths = [len(r.node.code) for r in prefix]
+        assert lengths == sorted(lengths)
+
+    def test_word_search(self) -> None:
+        """Test matches on words of names and definitions."""
+        gmod = self.vis.get_gmod(VisVersion.v3_4a)
+
+        results = gmod.search("fuel oil pump", max_results=50)
+        assert results
+        assert results[0].node.code == "621.22"
+        for result in results:
+            text = _text(result.node)
+            assert "fuel" in text
+            assert "oil" in text
+            assert "pump" in text
+
+        # Inside words
+        assert any(r.node.code == "C101" for r in gmod.search("ngine", 1000))
+
+        assert gmod.search("  ") == []
+        assert gmod.search("zzzz") == []
+        with pytest.raises(ValueError, match="query"):
+            gmod.search(None)  # type: ignore[arg-type]
+
+    def test_search_matches_scan(self) -> None:
+        """Test that the index finds the same nodes as a scan."""
+        queries = ["4", "c", "C101", "pu", "pum", "lubricat", "main eng", "Fuel, oil"]
+        for version in VisVersion:
+            gmod = self.vis.get_gmod(version)
+            for query in [*queries, "411.1/c"]:
+                with self.subTest(version=version, query=query):
+                    results = gmod.search(query, 1_000_000)
+                    scores = [r.score for r in results]
+                    assert scores == sorted(scores, reverse=True)
+
+                    expected = sorted(n.code for n in gmod if _matches(n, query))
+                    assert sorted(r.node.code for r in results) == expected
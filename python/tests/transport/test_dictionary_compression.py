@@ -0,0 +1,35 @@
+"""Interop of the C# DictionaryCompression payloads with zlib."""
+
+import gzip
+import zlib
+from pathlib import Path
+
+ROOT = Path(__file__).parents[3]
+
+
+def _load() -> tuple[bytes, bytes]:
+    dictionary = gzip.decompress(
+        (ROOT / "resources" / "compression-dictionary-vis-3-4a.bin.gz").read_bytes()
+    )
+    json = (ROOT / "schemas" / "json" / "TimeSeriesData.sample.json").read_bytes()
+    return dictionary, json
+
+
+def test_inflates_sdk_payload() -> None:
+    """A payload written by DictionaryCompression.Compress is a zlib stream."""
+    dictionary, json = _load()
+    payload = (ROOT / "testdata" / "DictionaryCompression.sdk.bin").read_bytes()
+
+    inflater = zlib.decompressobj(zdict=dictionary)
+    assert inflater.decompress(payload) == json
+    assert inflater.eof
+    assert not inflater.unused_data
+
+
+def test_zlib_payload() -> None:
+    """The payload DictionaryCompression.Decompress reads, written by zlib."""
+    dictionary, json = _load()
+    payload = (ROOT / "testdata" / "DictionaryCompression.zlib.bin").read_bytes()
+
+    # zlib.compressobj(9, zdict=dictionary), the deflate blocks depend on zlib's version
+    assert zlib.decompressobj(zdict=dictionary).decompress(payload) == json
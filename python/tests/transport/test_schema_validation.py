@@ -0,0 +1,180 @@
+"""Tests for the ISO19848 package validators compiled from the JSON schemas."""
+
+from __future__ import annotations
+
+import json
+from collections.abc import Callable
+from pathlib import Path
+from typing import Any
+
+import pytest
+
+from vista_sdk.source_generator.schema_validators_generator import (
+    generate_schema_validators_script,
+)
+from vista_sdk.system_text_json import SchemaValidationError, Serializer
+from vista_sdk.system_text_json.schema_validation import is_date_time
+
+JSON_DIR = Path(__file__).parent / "json"
+SCHEMAS_DIR = Path(__file__).parent.parent.parent.parent / "schemas" / "json"
+
+
+def _modify(file_name: str, modify: Callable[[Any], None]) -> str:
+    package = json.loads((JSON_DIR / file_name).read_text())
+    modify(package)
+    return json.dumps(package)
+
+
+def test_valid_packages() -> None:
+    """Test that the sample packages conform to their schemas."""
+    dcl = (JSON_DIR / "DataChannelList.json").read_text()
+    assert Serializer.deserialize_data_channel_list(
+        dcl, validate_schema=True
+    ) == Serializer.deserialize_data_channel_list(dcl)
+
+    tsd = (JSON_DIR / "TimeSeriesData.json").read_text()
+    assert Serializer.deserialize_time_series_data(
+        tsd, validate_schema=True
+    ) == Serializer.deserialize_time_series_data(tsd)
+
+
+def test_additional_properties_are_skipped() -> None:
+    """Test that Header allows additional properties, with values of any shape."""
+    json_str = _modify(
+        "DataChannelList.json",
+        lambda p: p["Package"]["Header"].update(
+            Custom={"Nested": [{"Package": 1}, [True, None]], "Value": "x"}
+        ),
+    )
+
+    assert Serializer.deserialize_data_channel_list(json_str, validate_schema=True)
+
+
+def _channel(package: Any) -> Any:  # noqa: ANN401
+    return package["Package"]["DataChannelList"]["DataChannel"][1]
+
+
+@pytest.mark.parametrize(
+    ("modify", "message", "path"),
+    [
+        (
+            lambda p: _channel(p)["Property"].pop("Format"),
+            "required property 'Format' is missing",
+            "$.Package.DataChannelList.DataChannel[1].Property",
+        ),
+        (
+            lambda p: _channel(p)["Property"]["DataChannelType"].update(Priority=1),
+            "property 'Priority' is not allowed",
+            "$.Package.DataChannelList.DataChannel[1].Property.DataChannelType",
+        ),
+        (
+            lambda p: _channel(p)["DataChannelID"].update(LocalID=5),
+            "expected a string, found a number",
+            "$.Package.DataChannelList.DataChannel[1].DataChannelID.LocalID",
+        ),
+        (
+            lambda p: p["Package"]["Header"]["DataChannelListID"].update(
+                TimeStamp="yesterday"
+            ),
+            "'yesterday' is not an ISO 8601 date-time",
+            "$.Package.Header.DataChannelListID.TimeStamp",
+        ),
+        (
+            lambda p: _channel(p)["Property"]["Format"].update(
+                Restriction={"WhiteSpace": "Trim"}
+            ),
+            "'Trim' is not one of Preserve, Replace, Collapse",
+            "$.Package.DataChannelList.DataChannel[1].Property.Format.Restriction.WhiteSpace",
+        ),
+        (
+            lambda p: _channel(p)["Property"]["Format"].update(
+                Restriction={"FractionDigits": 1.5}
+            ),
+            "1.5 is not an integer",
+            "$.Package.DataChannelList.DataChannel[1].Property.Format.Restriction.FractionDigits",
+        ),
+        (
+            lambda p: _channel(p)["Property"]["Format"].update(
+                Restriction={"MaxLength": -1}
+            ),
+            "-1 is less than 0",
+            "$.Package.DataChannelList.DataChannel[1].Property.Format.Restriction.MaxLength",
+        ),
+        (
+            lambda p: _channel(p)["Property"]["Format"].update(
+                Restriction={"MaxLength": True}
+            ),
+            "expected an integer, found a boolean",
+            "$.Package.DataChannelList.DataChannel[1].Property.Format.Restriction.MaxLength",
+        ),
+    ],
+)
+def test_data_channel_list_violations(
+    modify: Callable[[Any], None], message: str, path: str
+) -> None:
+    """Test the message and path of DataChannelList schema violations."""
+    json_str = _modify("DataChannelList.json", modify)
+
+    with pytest.raises(SchemaValidationError) as e:
+        Serializer.deserialize_data_channel_list(json_str, validate_schema=True)
+    assert e.value.message == message
+    assert e.value.path == path
+    assert str(e.value) == f"DataChannelListPackage: {message} at {path}"
+
+
+def test_time_series_data_violations() -> None:
+    """Test that unknown properties are only rejected when validating."""
+    json_str = _modify(
+        "TimeSeriesData.json",
+        lambda p: p["Package"]["TimeSeriesData"][0]["TabularData"][0]["DataSet"][
+            1
+        ].update(Unit="%"),
+    )
+
+    with pytest.raises(SchemaValidationError, match="property 'Unit' is not allowed"):
+        Serializer.deserialize_time_series_data(json_str, validate_schema=True)
+    assert Serializer.deserialize_time_series_data(json_str)
+
+
+@pytest.mark.parametrize("json_str", ["null", "[]", "{}", '{"Package": null}'])
+def test_invalid_documents(json_str: str) -> None:
+    """Test documents that aren't packages."""
+    with pytest.raises(SchemaValidationError):
+        Serializer.deserialize_time_series_data(json_str, validate_schema=True)
+
+
+@pytest.mark.parametrize(
+    ("value", "expected"),
+    [
+        ("2022-04-04T20:44:31Z", True),
+        ("2022-04-04T20:44:31.1234567+00:00", True),
+        ("2022-04-04T20:44:31-14:00", True),
+        ("2024-02-29T00:00:00Z", True),
+        ("2023-02-29T00:00:00Z", False),
+        ("2022-04-04T24:00:00Z", False),
+        ("2022-04-04T20:44Z", False),
+        ("2022-04-04T20:44:31", False),
+        ("2022-04-04T20:44:31+14:01", False),
+        ("2022-04-04T20:44:31+01:60", False),
+        ("2022-04-04 20:44:31Z", False),
+    ],
+)
+def test_is_date_time(value: str, expected: bool) -> None:
+    """Test the date-time format of the schemas."""
+    assert is_date_time(value) == expected
+
+
+def test_schema_validators_generation(tmp_path: Path) -> None:
+    """Test that the committed validators are up to date with the schemas."""
+    output_file = tmp_path / "schema_validators.py"
+
+    generate_schema_validators_script(str(SCHEMAS_DIR), str(output_file))
+
+    committed = (
+        Path(__file__).parent.parent.parent
+        / "src"
+        / "vista_sdk"
+        / "system_text_json"
+        / "schema_validators.py"
+    )
+    assert output_file.read_text() == committed.read_text()
@@ -0,0 +1,200 @@
+"""Tests for TimeSeriesDataProducer, matching C# TimeSeriesDataProducerTests."""
+
+from datetime import datetime, timedelta, timezone
+from pathlib import Path
+
+import pytest
+
+from vista_sdk.result import Ok
+from vista_sdk.system_text_json import Serializer
+from vista_sdk.system_text_json.extensions import JsonExtensions
+from vista_sdk.transport.data_channel.data_channel import DataChannelListPackage
+from vista_sdk.transport.time_series_data import (
+    TimeSeriesDataPackage,
+    TimeSeriesDataProducer,
+)
+
+START = datetime(2024, 1, 1, tzinfo=timezone.utc)
+
+
+@pytest.fixture
+def dc_package() -> DataChannelListPackage:
+    """The test DataChannelList: 0010 every 1 s, 0020 every 60 s, alerts without."""
+    file_path = Path(__file__).parent / "json" / "DataChannelList.json"
+    dto = Serializer.deserialize_data_channel_list(file_path.read_text())
+    return JsonExtensions.DataChannelList.to_domain_model(dto)
+
+
+def test_groups_by_update_cycle(dc_package: DataChannelListPackage) -> None:
+    """Channels are grouped by update cycle, in time slots of the cycle."""
+    packages: list[TimeSeriesDataPackage] = []
+    producer = TimeSeriesDataProducer(dc_package, packages.append, timedelta(hours=1))
+
+    assert producer.try_add("0010", START + timedelta(milliseconds=200), 1.5)
+    assert producer.try_add("0010", START + timedelta(seconds=1.1), "3")
+    assert producer.try_add("0020", START + timedelta(seconds=61), "2")
+    assert producer.try_add("0011", START + timedelta(seconds=1.25), "alarm", "0")
+    assert not producer.try_add("unknown", START, "6")
+    assert producer.buffered_readings == 4
+
+    producer.flush()
+    assert len(packages) == 1
+    package = packages[0].package
+    assert package.header is not None
+    assert package.header.ship_id == dc_package.package.header.ship_id
+    assert package.header.time_span is not None
+    assert package.header.time_span.start == START
+    assert package.header.time_span.end == START + timedelta(seconds=60)
+
+    data = package.time_series_data[0]
+    assert data.data_configuration is not None
+    assert (
+        data.data_configuration.id == dc_package.package.header.data_channel_list_id.id
+    )
+    assert data.tabular_data is not None
+    assert len(data.tabular_data) == 3
+
+    table = data.tabular_data[0]
+    assert table.data_sets is not None
+    assert [d.time_stamp for d in table.data_sets] == [
+        START,
+        START + timedelta(seconds=1),
+    ]
+    assert [d.value for d in table.data_sets] == [["1.5"], ["3"]]
+    assert table.data_sets[0].quality is None
+
+    table = data.tabular_data[1]
+    assert table.data_sets is not None
+    assert table.data_sets[0].time_stamp == START + timedelta(seconds=60)
+
+    table = data.tabular_data[2]
+    assert table.data_sets is not None
+    assert table.data_sets[0].time_stamp == START + timedelta(seconds=1.25)
+    assert table.data_sets[0].quality == ["0"]
+
+    assert producer.received_readings == 5
+    assert producer.rejected_readings == 1
+    assert producer.buffered_readings == 0
+
+
+def test_missing_cells(dc_package: DataChannelListPackage) -> None:
+    """Rows without a reading of a channel are in a table of the channels they have."""
+    packages: list[TimeSeriesDataPackage] = []
+    producer = TimeSeriesDataProducer(dc_package, packages.append, timedelta(hours=1))
+
+    producer.try_add("0011", START, "a")
+    producer.try_add("0021", START, "b")
+    producer.try_add("0011", START + timedelta(seconds=1), "c")
+    producer.flush()
+
+    tables = packages[0].package.time_series_data[0].tabular_data
+    assert tables is not None
+    assert len(tables) == 2
+    assert len(tables[0].data_channel_ids) == 2  # type: ignore[arg-type]
+    assert [d.value for d in tables[0].data_sets] == [["a", "b"]]  # type: ignore[union-attr]
+    assert len(tables[1].data_channel_ids) == 1  # type: ignore[arg-type]
+    assert tables[1].data_sets is not None
+    assert tables[1].data_sets[0].value == ["c"]
+    assert tables[1].data_sets[0].quality is None
+
+
+def test_time_trigger(dc_package: DataChannelListPackage) -> None:
+    """A reading of the next window emits the buffered package."""
+    packages: list[TimeSeriesDataPackage] = []
+    producer = TimeSeriesDataProducer(
+        dc_package, packages.append, timedelta(seconds=10)
+    )
+
+    for i in range(25):
+        producer.try_add("0010", START + timedelta(seconds=i), i)
+
+    assert len(packages) == 2
+    assert producer.buffered_readings == 5
+    for i, package in enumerate(packages):
+        assert package.package.header is not None
+        assert package.package.header.time_span is not None
+        assert package.package.header.time_span.start == START + timedelta(
+            seconds=10 * i
+        )
+        table = package.package.time_series_data[0].tabular_data[0]  # type: ignore[index]
+        assert len(table.data_sets) == 10  # type: ignore[arg-type]
+
+    producer.flush_if_due(START + timedelta(seconds=29))
+    assert len(packages) == 2
+    producer.flush_if_due(START + timedelta(seconds=30))
+    assert len(packages) == 3
+    assert producer.emitted_packages == 3
+
+
+def test_size_trigger_and_order(dc_package: DataChannelListPackage) -> None:
+    """Out of order readings are sorted, replaced readings are not counted."""
+    packages: list[TimeSeriesDataPackage] = []
+    producer = TimeSeriesDataProducer(
+        dc_package, packages.append, timedelta(hours=1), max_readings=4
+    )
+
+    for seconds, value in [(3, "3"), (1, "1"), (1.5, "1.5"), (2, "2")]:
+        producer.try_add("0010", START + timedelta(seconds=seconds), value)
+    assert not packages
+    producer.try_add("0010", START, "0")
+
+    assert len(packages) == 1
+    table = packages[0].package.time_series_data[0].tabular_data[0]  # type: ignore[index]
+    assert [d.value[0] for d in table.data_sets] == ["0", "1.5", "2", "3"]  # type: ignore[union-attr]
+
+
+def test_validates_against_data_channel_list(
+    dc_package: DataChannelListPackage,
+) -> None:
+    """Complete rows of the emitted packages validate against the list."""
+    packages: list[TimeSeriesDataPackage] = []
+    producer = TimeSeriesDataProducer(dc_package, packages.append, timedelta(minutes=1))
+
+    for i in range(200):
+        producer.try_add("0010", START + timedelta(milliseconds=i * 500), i / 10)
+    producer.flush()
+
+    assert len(packages) == 2
+    for package in packages:
+        result = package.package.time_series_data[0].validate(
+            dc_package, lambda *_: Ok(), lambda *_: Ok()
+        )
+        assert isinstance(result, Ok)
+
+
+def test_rows_with_gaps_validate(dc_package: DataChannelListPackage) -> None:
+    """Packages with rows missing a reading validate against the list."""
+    packages: list[TimeSeriesDataPackage] = []
+    producer = TimeSeriesDataProducer(dc_package, packages.append, timedelta(minutes=1))
+
+    # 0021 misses every third second
+    readings = 0
+    for i in range(100):
+        time_stamp = START + timedelta(seconds=i)
+        producer.try_add("0011", time_stamp, "Normal", "0" if i % 5 == 0 else None)
+        readings += 1
+        if i % 3:
+            producer.try_add("0021", time_stamp, "High")
+            readings += 1
+    producer.flush()
+
+    assert len(packages) == 2
+    values = 0
+
+    def count(*_: object) -> Ok:
+        nonlocal values
+        values += 1
+        return Ok()
+
+    for package in packages:
+        data = package.package.time_series_data[0]
+        result = data.validate(dc_package, count, lambda *_: Ok())
+        assert isinstance(result, Ok)
+        assert data.tabular_data is not None
+        assert len(data.tabular_data) == 2
+        for table in data.tabular_data:
+            assert all(
+                len(d.value) == len(table.data_channel_ids)  # type: ignore[arg-type]
+                for d in table.data_sets  # type: ignore[union-attr]
+            )
+    assert values == readings
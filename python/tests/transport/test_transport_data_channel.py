@@ -522,3 +522,43 @@ def test_data_channel_list_json_fully_custom() -> None:
     assert dc1.property_.unit is not None
     assert dc2.property_.unit is not None
     assert dc1.property_.unit.unit_symbol == dc2.property_.unit.unit_symbol
+
+
+def test_data_channel_list_indexes() -> None:
+    """Membership, removal and bulk add keep the indexes and the order in sync."""
+    message = create_valid_fully_custom_data_channel_list()
+    channels = list(message.package.data_channel_list)
+    assert len(channels) == 2
+
+    dc_list = DataChannelList()
+    dc_list.add(channels)
+    assert list(dc_list) == channels
+    assert all(dc in dc_list for dc in channels)
+
+    first = channels[0]
+    # A different channel object with the same ids is not a member
+    copy = DataChannel(first.data_channel_id, first.property_)
+    assert copy not in dc_list
+    assert not dc_list.remove(copy)
+
+    assert dc_list.remove(first)
+    assert first not in dc_list
+    assert not dc_list.remove(first)
+    assert len(dc_list) == len(channels) - 1
+    assert dc_list[0] is channels[1]
+    assert first.data_channel_id.short_id is not None
+    assert dc_list.try_get_by_short_id(first.data_channel_id.short_id) == (False, None)
+
+    dc_list.add(first)
+    assert dc_list[len(dc_list) - 1] is first
+    assert list(dc_list) == [*channels[1:], first]
+
+    # Bulk adds with a duplicate change nothing
+    duplicate = DataChannel(channels[1].data_channel_id, channels[1].property_)
+    with pytest.raises(ValueError, match="LocalId"):
+        dc_list.add([first, duplicate])
+    dc_list.clear()
+    with pytest.raises(ValueError, match="LocalId"):
+        dc_list.add([first, copy])
+    assert len(dc_list) == 0
+    assert first not in dc_list